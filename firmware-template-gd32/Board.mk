@@ -45,24 +45,34 @@ endif
 ifeq ($(strip $(BOARD)),BOARD_GD32F407RE)
 	MCU=GD32F407RE
 	DEFINES+=-DCONFIG_STORE_USE_SPI
+	ENET_RXBUF_NUM?=8
+	ENET_TXBUF_NUM?=4
 endif
 	
 ifeq ($(strip $(BOARD)),BOARD_GD32F450VE)
 	MCU=GD32F450VE
 	DEFINES+=-DCONFIG_STORE_USE_RAM
 	BITBANGING595=1
+	ENET_RXBUF_NUM?=16
+	ENET_TXBUF_NUM?=4
 endif
 
 ifeq ($(strip $(BOARD)),BOARD_GD32F450VI)
 	MCU=GD32F450VI
+	ENET_RXBUF_NUM?=16
+	ENET_TXBUF_NUM?=4
 endif
 
 ifeq ($(strip $(BOARD)),BOARD_16X4U_PIXEL)
 	MCU=GD32F450VI
+	ENET_RXBUF_NUM?=16
+	ENET_TXBUF_NUM?=4
 endif
 
 ifeq ($(strip $(BOARD)),BOARD_GD32F470VG)
 	MCU=GD32F470VG
+	ENET_RXBUF_NUM?=16
+	ENET_TXBUF_NUM?=4
 endif
 
 ifeq ($(strip $(BOARD)),BOARD_GD32F207C_EVAL)
@@ -73,6 +83,8 @@ endif
 ifeq ($(strip $(BOARD)),BOARD_GD32F470Z_EVAL)
 	MCU=GD32F470ZK
 	DEFINES+=-DCONFIG_STORE_USE_RAM
+	ENET_RXBUF_NUM?=16
+	ENET_TXBUF_NUM?=4
 endif
 
 ifeq ($(strip $(BOARD)),BOARD_GD32H759I_EVAL)
@@ -83,16 +95,22 @@ endif
 ifeq ($(strip $(BOARD)),BOARD_BW_OPIDMX4)
 	BOARD_DMX=4
 	DEFINES+=-DCONFIG_STORE_USE_SPI
+	ENET_RXBUF_NUM?=16
+	ENET_TXBUF_NUM?=4
 endif
 
 ifeq ($(strip $(BOARD)),BOARD_DMX3)
 	BOARD_DMX=3
 	DEFINES+=-DCONFIG_STORE_USE_SPI
+	ENET_RXBUF_NUM?=16
+	ENET_TXBUF_NUM?=4
 endif
 
 ifeq ($(strip $(BOARD)),BOARD_DMX4)
 	DEFINES+=-DCONFIG_STORE_USE_SPI
 	BOARD_DMX=4
+	ENET_RXBUF_NUM?=16
+	ENET_TXBUF_NUM?=4
 endif
 
 ifdef BOARD_DMX
@@ -105,4 +123,17 @@ endif
 
 ifndef MCU
 	$(error BOARD is not configured)
+endif
+
+# Ethernet DMA descriptors, the application Makefile can override with DEFINES+=ENET_RXBUF_NUM=n ENET_TXBUF_NUM=n
+ifdef ENET_RXBUF_NUM
+	ifeq ($(findstring ENET_RXBUF_NUM,$(DEFINES) $(MAKE_FLAGS)),)
+		DEFINES+=-DENET_RXBUF_NUM=$(ENET_RXBUF_NUM)
+	endif
+endif
+
+ifdef ENET_TXBUF_NUM
+	ifeq ($(findstring ENET_TXBUF_NUM,$(DEFINES) $(MAKE_FLAGS)),)
+		DEFINES+=-DENET_TXBUF_NUM=$(ENET_TXBUF_NUM)
+	endif
 endif
\ No newline at end of file
@@ -71,6 +71,7 @@
 #endif
 
 #include "lightset.h"
+#include "lightsetportindex.h"
 #include "hardware.h"
 #include "network.h"
 
@@ -83,6 +84,8 @@
 #endif
 
 namespace artnetnode {
+static constexpr uint32_t TOD_UIDS_PER_PACKET = sizeof(artnet::ArtTodData::Tod) / sizeof(artnet::ArtTodData::Tod[0]);
+
 enum class FailSafe : uint8_t {
 	LAST = 0x08, OFF= 0x09, ON = 0x0a, PLAYBACK = 0x0b, RECORD = 0x0c
 };
@@ -111,7 +114,7 @@ struct State {
 	uint8_t DiagPriority;				///< ArtPoll : Field 6 : The lowest priority of diagnostics message that should be sent.
 	struct {
 		uint32_t nDiscoveryMillis;
-		uint32_t nDiscoveryPortIndex;
+		uint32_t nDiscoveryPortMask;	///< Ports started in the current discovery round
 		bool IsDiscoveryRunning;
 		bool IsEnabled;
 	} rdm;
@@ -189,10 +192,17 @@ public:
 
 	void Run() {
 		uint16_t nForeignPort;
-		const auto nBytesReceived = Network::Get()->RecvFrom(m_nHandle, const_cast<const void **>(reinterpret_cast<void **>(&m_pReceiveBuffer)), &m_nIpAddressFrom, &nForeignPort);
-		m_nCurrentPacketMillis = Hardware::Get()->Millis();
+		uint32_t nBytesReceived;
+
+		/*
+		 * Drain all the pending packets. The last call is with nBytesReceived == 0.
+		 */
+		do {
+			nBytesReceived = Network::Get()->RecvFrom(m_nHandle, const_cast<const void **>(reinterpret_cast<void **>(&m_pReceiveBuffer)), &m_nIpAddressFrom, &nForeignPort);
+			m_nCurrentPacketMillis = Hardware::Get()->Millis();
 
-		Process(nBytesReceived);
+			Process(nBytesReceived);
+		} while (nBytesReceived != 0);
 
 #if (ARTNET_VERSION >= 4)
 		E131Bridge::Run();
@@ -212,21 +222,26 @@ public:
 
 				if (!m_State.rdm.IsDiscoveryRunning) {
 					DEBUG_PUTS("RDM Discovery -> DONE");
-					m_State.rdm.nDiscoveryPortIndex = 0;
+					m_State.rdm.nDiscoveryPortMask = 0;
 					m_State.rdm.nDiscoveryMillis = m_nCurrentPacketMillis;
 				}
 			} else {
-				uint32_t nPortIndex;
-				bool bIsIncremental;
-				if (m_pArtNetRdmController->IsFinished(nPortIndex, bIsIncremental)) {
-					SendTod(nPortIndex);
-
-					DEBUG_PRINTF("TOD sent -> %u", static_cast<unsigned int>(nPortIndex));
-
-					if (m_OutputPort[nPortIndex].IsTransmitting) {
-						DEBUG_PUTS("m_pLightSet->Stop/Start");
-						m_pLightSet->Stop(nPortIndex);
-						m_pLightSet->Start(nPortIndex);
+				for (uint32_t nPortIndex = 0; nPortIndex < artnetnode::MAX_PORTS; nPortIndex++) {
+					bool bIsIncremental;
+					if (m_pArtNetRdmController->IsFinished(nPortIndex, bIsIncremental)) {
+						if (bIsIncremental) {
+							SendTodChanges(nPortIndex);
+						} else {
+							SendTod(nPortIndex);
+						}
+
+						DEBUG_PRINTF("TOD sent -> %u", static_cast<unsigned int>(nPortIndex));
+
+						if (m_OutputPort[nPortIndex].IsTransmitting) {
+							DEBUG_PUTS("m_pLightSet->Stop/Start");
+							m_pLightSet->Stop(nPortIndex);
+							m_pLightSet->Start(nPortIndex);
+						}
 					}
 				}
 			}
@@ -429,13 +444,9 @@ public:
 	}
 
 	bool RdmIsRunning(const uint32_t nPortIndex, bool& bIsIncremental) {
-		uint32_t nRdmnPortIndex;
-		if (m_pArtNetRdmController->IsRunning(nRdmnPortIndex, bIsIncremental)) {
-			const auto isRunning = (nRdmnPortIndex == nPortIndex);
-			if (isRunning) {
-				assert(!((m_OutputPort[nPortIndex].GoodOutputB & artnet::GoodOutputB::DISCOVERY_NOT_RUNNING) == artnet::GoodOutputB::DISCOVERY_NOT_RUNNING));
-			}
-			return isRunning;
+		if (m_pArtNetRdmController->IsRunning(nPortIndex, bIsIncremental)) {
+			assert(!((m_OutputPort[nPortIndex].GoodOutputB & artnet::GoodOutputB::DISCOVERY_NOT_RUNNING) == artnet::GoodOutputB::DISCOVERY_NOT_RUNNING));
+			return true;
 		}
 
 		return false;
@@ -560,6 +571,13 @@ public:
 		return E131Bridge::GetPriority(nPortIndex);
 	}
 
+	void SetPriorityThreshold4(uint32_t nPortIndex, uint8_t nPriority) {
+		E131Bridge::SetPriorityThreshold(nPortIndex, nPriority);
+	}
+	uint8_t GetPriorityThreshold4(uint32_t nPortIndex) const {
+		return E131Bridge::GetPriorityThreshold(nPortIndex);
+	}
+
 	bool GetUniverse4(uint32_t nPortIndex, uint16_t &nUniverse, lightset::PortDir portDir) const {
 		return E131Bridge::GetUniverse(nPortIndex, nUniverse, portDir);
 	}
@@ -629,13 +647,16 @@ private:
 		return artnet::make_port_address(m_Node.Port[nPage].NetSwitch, m_Node.Port[nPage].SubSwitch, nUniverse);
 	}
 
+	void UpdatePortIndex();
 	void UpdateMergeStatus(const uint32_t nPortIndex);
 	void CheckMergeTimeouts(const uint32_t nPortIndex);
 
 	void ProcessPollRelply(const uint32_t nPortIndex, uint32_t& NumPortsInput, uint32_t& NumPortsOutput);
 	void SendPollRelply(const uint32_t nBindIndex, const uint32_t nDestinationIp, artnet::ArtPollQueue *pQueue = nullptr);
 
+	void SendTodData(const uint32_t nPortIndex, const uint32_t nUidTotal, const uint32_t nBlockCount, const uint32_t nUidCount);
 	void SendTod(uint32_t nPortIndex);
+	void SendTodChanges(uint32_t nPortIndex);
 	void SendTodRequest(uint32_t nPortIndex);
 
 	void SetNetworkDataLossCondition();
@@ -646,20 +667,28 @@ private:
 	void Process(const uint32_t);
 
 #if defined (RDM_CONTROLLER)
+	/*
+	 * The ports are discovered in parallel. A port is started once per round,
+	 * the round ends when none of the started ports is running.
+	 */
 	bool RdmDiscoveryRun() {
-		if ((GetPortDirection(m_State.rdm.nDiscoveryPortIndex) == lightset::PortDir::OUTPUT)
-				&& (GetRdm(m_State.rdm.nDiscoveryPortIndex))
-				&& (GetRdmDiscovery(m_State.rdm.nDiscoveryPortIndex)))
-		{
-			uint32_t nPortIndex;
+		auto isRunning = false;
+
+		for (uint32_t nPortIndex = 0; nPortIndex < artnetnode::MAX_PORTS; nPortIndex++) {
+			if (!((GetPortDirection(nPortIndex) == lightset::PortDir::OUTPUT) && (GetRdm(nPortIndex)) && (GetRdmDiscovery(nPortIndex)))) {
+				continue;
+			}
+
 			bool bIsIncremental;
 
 			if (m_pArtNetRdmController->IsFinished(nPortIndex, bIsIncremental)) {
-				assert(m_State.rdm.nDiscoveryPortIndex == nPortIndex);
-
-				SendTod(nPortIndex);
+				if (bIsIncremental) {
+					SendTodChanges(nPortIndex);
+				} else {
+					SendTod(nPortIndex);
+				}
 
-				DEBUG_PUTS("TOD sent");
+				DEBUG_PRINTF("TOD sent -> %u", static_cast<unsigned int>(nPortIndex));
 
 				if (m_OutputPort[nPortIndex].IsTransmitting) {
 					DEBUG_PUTS("m_pLightSet->Stop/Start");
@@ -667,23 +696,24 @@ private:
 					m_pLightSet->Start(nPortIndex);
 				}
 
-				m_OutputPort[m_State.rdm.nDiscoveryPortIndex].GoodOutputB |= artnet::GoodOutputB::DISCOVERY_NOT_RUNNING;
-
-				m_State.rdm.nDiscoveryPortIndex++;
-				return (m_State.rdm.nDiscoveryPortIndex != artnetnode::MAX_PORTS);
+				m_OutputPort[nPortIndex].GoodOutputB |= artnet::GoodOutputB::DISCOVERY_NOT_RUNNING;
+				continue;
 			}
 
-			if (!m_pArtNetRdmController->IsRunning(nPortIndex, bIsIncremental)) {
-				DEBUG_PRINTF("RDM Discovery Incremental -> %u", static_cast<unsigned int>(m_State.rdm.nDiscoveryPortIndex));
-				m_pArtNetRdmController->Incremental(m_State.rdm.nDiscoveryPortIndex);
-				m_OutputPort[m_State.rdm.nDiscoveryPortIndex].GoodOutputB &= static_cast<uint8_t>(~artnet::GoodOutputB::DISCOVERY_NOT_RUNNING);
+			const auto nPortMask = 1U << nPortIndex;
+
+			if ((m_State.rdm.nDiscoveryPortMask & nPortMask) == 0) {
+				m_State.rdm.nDiscoveryPortMask |= nPortMask;
+
+				DEBUG_PRINTF("RDM Discovery Incremental -> %u", static_cast<unsigned int>(nPortIndex));
+				m_pArtNetRdmController->Incremental(nPortIndex);
+				m_OutputPort[nPortIndex].GoodOutputB &= static_cast<uint8_t>(~artnet::GoodOutputB::DISCOVERY_NOT_RUNNING);
 			}
 
-			return true;
+			isRunning |= m_pArtNetRdmController->IsRunning(nPortIndex, bIsIncremental);
 		}
 
-		m_State.rdm.nDiscoveryPortIndex++;
-		return (m_State.rdm.nDiscoveryPortIndex != artnetnode::MAX_PORTS);
+		return isRunning;
 	}
 #endif
 
@@ -704,6 +734,7 @@ private:
 	artnetnode::State m_State;
 	artnetnode::OutputPort m_OutputPort[artnetnode::MAX_PORTS];
 	artnetnode::InputPort m_InputPort[artnetnode::MAX_PORTS];
+	lightset::PortIndex<artnetnode::MAX_PORTS> m_PortIndex;	///< Port-Address -> enabled ports
 
 	artnet::ArtPollReply m_ArtPollReply;
 #if defined (ARTNET_HAVE_DMXIN)
@@ -38,10 +38,15 @@
 
 #include "debug.h"
 
-class ArtNetRdmController final: public RDMDeviceController, RDMDiscovery {
+class ArtNetRdmController final: public RDMDeviceController {
 public:
-	ArtNetRdmController(): RDMDiscovery(RDMDeviceController::GetUID()) {
+	ArtNetRdmController() {
 		DEBUG_ENTRY
+
+		for (auto& discovery : m_Discovery) {
+			discovery.SetUid(RDMDeviceController::GetUID());
+		}
+
 		DEBUG_EXIT
 	}
 
@@ -50,27 +55,21 @@ public:
 	void Full(const uint32_t nPortIndex) {
 		DEBUG_ENTRY
 		assert(nPortIndex < artnetnode::MAX_PORTS);
-		RDMDiscovery::Full(nPortIndex, &m_pRDMTod[nPortIndex]);
+		m_Discovery[nPortIndex].Full(nPortIndex, &m_pRDMTod[nPortIndex]);
 		DEBUG_EXIT
 	}
 
 	void Incremental(const uint32_t nPortIndex) {
 		DEBUG_ENTRY
 		assert(nPortIndex < artnetnode::MAX_PORTS);
-		RDMDiscovery::Incremental(nPortIndex, &m_pRDMTod[nPortIndex]);
+		m_Discovery[nPortIndex].Incremental(nPortIndex, &m_pRDMTod[nPortIndex]);
 		DEBUG_EXIT
 	}
 
 	void Stop(const uint32_t nPortIndex) {
 		DEBUG_ENTRY
 		assert(nPortIndex < artnetnode::MAX_PORTS);
-		bool bIsIncremental;
-		uint32_t _nPortIndex;
-		if (IsRunning(_nPortIndex, bIsIncremental)) {
-			if (_nPortIndex == nPortIndex) {
-				RDMDiscovery::Stop();
-			}
-		}
+		m_Discovery[nPortIndex].Stop();
 		DEBUG_EXIT
 	}
 
@@ -86,20 +85,53 @@ public:
 		DEBUG_EXIT
 	}
 
+	uint32_t TodCopy(const uint32_t nPortIndex, uint8_t *pTod, const uint32_t nOffset, const uint32_t nCount) {
+		assert(nPortIndex < artnetnode::MAX_PORTS);
+		return m_pRDMTod[nPortIndex].Copy(pTod, nOffset, nCount);
+	}
+
 	void Run() {
-		RDMDiscovery::Run();
+		for (auto& discovery : m_Discovery) {
+			discovery.Run();
+		}
 	}
 
-	bool IsRunning(uint32_t& nPortIndex, bool& bIsIncremental) {
-		return RDMDiscovery::IsRunning(nPortIndex, bIsIncremental);
+	bool IsRunning(const uint32_t nPortIndex, bool& bIsIncremental) const {
+		assert(nPortIndex < artnetnode::MAX_PORTS);
+		uint32_t nDiscoveryPortIndex;
+		return m_Discovery[nPortIndex].IsRunning(nDiscoveryPortIndex, bIsIncremental);
 	}
 
-	bool IsFinished(uint32_t& nPortIndex, bool& bIsIncremental) {
-		return RDMDiscovery::IsFinished(nPortIndex, bIsIncremental);
+	bool IsFinished(const uint32_t nPortIndex, bool& bIsIncremental) {
+		assert(nPortIndex < artnetnode::MAX_PORTS);
+		uint32_t nDiscoveryPortIndex;
+		return m_Discovery[nPortIndex].IsFinished(nDiscoveryPortIndex, bIsIncremental);
 	}
 
 	uint32_t CopyWorkingQueue(char *pOutBuffer, const uint32_t nOutBufferSize) {
-		return RDMDiscovery::CopyWorkingQueue(pOutBuffer, nOutBufferSize);
+		uint32_t nLength = 0;
+
+		for (auto& discovery : m_Discovery) {
+			if (nLength >= nOutBufferSize) {
+				break;
+			}
+
+			const auto nCopied = discovery.CopyWorkingQueue(&pOutBuffer[nLength], nOutBufferSize - nLength);
+
+			if (nCopied != 0) {
+				nLength += nCopied;
+				pOutBuffer[nLength++] = ',';
+			}
+		}
+
+		if (nLength == 0) {
+			return 0;
+		}
+
+		nLength--;
+		pOutBuffer[nLength] = '\0';
+
+		return nLength;
 	}
 
 	uint32_t CopyTod(const uint32_t nPortIndex, char *pOutBuffer, const uint32_t nOutBufferSize) {
@@ -141,6 +173,11 @@ public:
 		return m_pRDMTod[nPortIndex].AddUid(pUid);
 	}
 
+	uint32_t TodAddUids(const uint32_t nPortIndex, const uint8_t *pTable, const uint32_t nCount) {
+		assert(nPortIndex < artnetnode::MAX_PORTS);
+		return m_pRDMTod[nPortIndex].AddUids(pTable, nCount);
+	}
+
 	// Generic
 
 	bool CopyTodEntry(const uint32_t nPortIndex, uint32_t nIndex, uint8_t uid[RDM_UID_SIZE]) {
@@ -159,6 +196,7 @@ public:
 	}
 
 private:
+	RDMDiscovery m_Discovery[artnetnode::MAX_PORTS];
 	static RDMTod m_pRDMTod[artnetnode::MAX_PORTS];
 };
 
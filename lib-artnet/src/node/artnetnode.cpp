@@ -105,6 +105,8 @@ ArtNetNode::ArtNetNode() {
 		port.direction = lightset::PortDir::DISABLE;
 	}
 
+	UpdatePortIndex();
+
 	for (uint32_t nPortIndex = 0; nPortIndex < artnetnode::MAX_PORTS; nPortIndex++) {
 		SetShortName(nPortIndex, nullptr);	// Set default port label
 	}
@@ -87,6 +87,16 @@ void ArtNetNode::SetLocalMerging() {
 	DEBUG_EXIT
 }
 
+void ArtNetNode::UpdatePortIndex() {
+	m_PortIndex.Clear();
+
+	for (uint32_t nPortIndex = 0; nPortIndex < artnetnode::MAX_PORTS; nPortIndex++) {
+		if (m_Node.Port[nPortIndex].direction != lightset::PortDir::DISABLE) {
+			m_PortIndex.Add(m_Node.Port[nPortIndex].PortAddress, nPortIndex);
+		}
+	}
+}
+
 void ArtNetNode::SetUniverse(const uint32_t nPortIndex, const lightset::PortDir dir, const uint16_t nUniverse) {
 	assert(nPortIndex < artnetnode::MAX_PORTS);
 
@@ -155,6 +165,8 @@ void ArtNetNode::SetUniverseSwitch(const uint32_t nPortIndex, const lightset::Po
 		m_Node.Port[nPortIndex].direction = lightset::PortDir::OUTPUT;
 	}
 
+	UpdatePortIndex();
+
 #if (ARTNET_VERSION >= 4)
 	SetUniverse4(nPortIndex, dir);
 #endif
@@ -178,6 +190,8 @@ void ArtNetNode::SetSubnetSwitch(const uint32_t nPortIndex, const uint8_t nSubne
 	m_Node.Port[nPortIndex].SubSwitch = nSubnetSwitch;
 	m_Node.Port[nPortIndex].PortAddress = MakePortAddress(m_Node.Port[nPortIndex].PortAddress, nPortIndex);
 
+	UpdatePortIndex();
+
 	if (m_State.status == artnet::Status::ON) {
 		ArtNetStore::SaveSubnetSwitch(nPortIndex, nSubnetSwitch);
 	}
@@ -192,6 +206,8 @@ void ArtNetNode::SetNetSwitch(const uint32_t nPortIndex, const uint8_t nNetSwitc
 	m_Node.Port[nPortIndex].NetSwitch = nNetSwitch;
 	m_Node.Port[nPortIndex].PortAddress = MakePortAddress(m_Node.Port[nPortIndex].PortAddress, nPortIndex);
 
+	UpdatePortIndex();
+
 	if (m_State.status == artnet::Status::ON) {
 		ArtNetStore::SaveNetSwitch(nPortIndex, nNetSwitch);
 	}
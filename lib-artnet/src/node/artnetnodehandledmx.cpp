@@ -83,10 +83,13 @@ void ArtNetNode::HandleDmx() {
 	const auto *const pArtDmx = reinterpret_cast<artnet::ArtDmx *>(m_pReceiveBuffer);
 	const auto nDmxSlots = std::min(static_cast<uint32_t>(((pArtDmx->LengthHi << 8) & 0xff00) | pArtDmx->Length), artnet::DMX_LENGTH);
 
-	for (uint32_t nPortIndex = 0; nPortIndex < artnetnode::MAX_PORTS; nPortIndex++) {
+	auto nPortMask = m_PortIndex.Get(pArtDmx->PortAddress);
+
+	while (nPortMask != 0) {
+		const auto nPortIndex = lightset::next_port(nPortMask);
+
 		if ((m_Node.Port[nPortIndex].direction == lightset::PortDir::OUTPUT)
-		 && (m_Node.Port[nPortIndex].protocol == artnet::PortProtocol::ARTNET)
-		 && (m_Node.Port[nPortIndex].PortAddress == pArtDmx->PortAddress)) {
+		 && (m_Node.Port[nPortIndex].protocol == artnet::PortProtocol::ARTNET)) {
 
 			m_OutputPort[nPortIndex].GoodOutput |= artnet::GoodOutput::DATA_IS_BEING_TRANSMITTED;
 
@@ -49,6 +49,7 @@
 
 #include "lightsetparamsconst.h"
 #include "lightset.h"
+#include "lightsetdata.h"
 
 #include "network.h"
 
@@ -209,6 +210,22 @@ void ArtNetParams::callbackFunction(const char *pLine) {
 			return;
 		}
 
+		nLength = 7;
+
+		if (Sscan::Char(pLine, LightSetParamsConst::LTP_SLOTS_PORT[nPortIndex], aValue, nLength) == Sscan::OK) {
+			aValue[nLength] = '\0';
+			uint16_t nSlotFirst, nSlotLast;
+
+			if (lightset::get_slot_range(aValue, nSlotFirst, nSlotLast)) {
+				m_Params.nLtpSlots[nPortIndex][0] = nSlotFirst;
+				m_Params.nLtpSlots[nPortIndex][1] = nSlotLast;
+				m_Params.nSetList |= (Mask::LTP_SLOTS_A << nPortIndex);
+			} else {
+				m_Params.nSetList &= ~(Mask::LTP_SLOTS_A << nPortIndex);
+			}
+			return;
+		}
+
 		nLength = artnet::SHORT_NAME_LENGTH - 1;
 
 		if (Sscan::Char(pLine, LightSetParamsConst::NODE_LABEL[nPortIndex], reinterpret_cast<char*>(m_Params.aLabel[nPortIndex]), nLength) == Sscan::OK) {
@@ -313,6 +330,19 @@ void ArtNetParams::callbackFunction(const char *pLine) {
 		}
 #endif
 
+#if (ARTNET_VERSION >= 4)
+		if (Sscan::Uint8(pLine, LightSetParamsConst::PRIORITY_THRESHOLD[nPortIndex], nValue8) == Sscan::OK) {
+			if ((nValue8 >= e131::priority::LOWEST) && (nValue8 <= e131::priority::HIGHEST)) {
+				m_Params.nPriorityThreshold[nPortIndex] = nValue8;
+				m_Params.nSetList |= (Mask::PRIORITY_THRESHOLD_A << nPortIndex);
+			} else {
+				m_Params.nPriorityThreshold[nPortIndex] = 0;
+				m_Params.nSetList &= ~(Mask::PRIORITY_THRESHOLD_A << nPortIndex);
+			}
+			return;
+		}
+#endif
+
 #if defined (RDM_CONTROLLER)
 		if (Sscan::Uint8(pLine, ArtNetParamsConst::RDM_ENABLE_PORT[nPortIndex], nValue8) == Sscan::OK) {
 			m_Params.nRdm &= artnetparams::clear_mask(nPortIndex);
@@ -393,6 +423,11 @@ void ArtNetParams::Builder(const struct Params *pParams, char *pBuffer, uint32_t
 		const auto isDefault = (mergeMode == lightset::MergeMode::HTP);
 		builder.Add(LightSetParamsConst::MERGE_MODE_PORT[nPortIndex], lightset::get_merge_mode(mergeMode), !isDefault);
 
+		const auto isLtpSlotsSet = isMaskSet(Mask::LTP_SLOTS_A << nPortIndex);
+		char aLtpSlots[8];
+		snprintf(aLtpSlots, sizeof(aLtpSlots), "%u-%u", isLtpSlotsSet ? m_Params.nLtpSlots[nPortIndex][0] : 0U, isLtpSlotsSet ? m_Params.nLtpSlots[nPortIndex][1] : 0U);
+		builder.Add(LightSetParamsConst::LTP_SLOTS_PORT[nPortIndex], aLtpSlots, isLtpSlotsSet);
+
 #if defined (OUTPUT_HAVE_STYLESWITCH)
 		const auto isSet = isOutputStyleSet(1U << nPortIndex);
 		builder.Add(LightSetParamsConst::OUTPUT_STYLE[nPortIndex], lightset::get_output_style(static_cast<lightset::OutputStyle>(isSet)), isSet);
@@ -421,6 +456,7 @@ void ArtNetParams::Builder(const struct Params *pParams, char *pBuffer, uint32_t
 #if defined (E131_HAVE_DMXIN)
 		builder.Add(LightSetParamsConst::PRIORITY[nPortIndex], m_Params.nPriority[nPortIndex], isMaskSet(Mask::PRIORITY_A << nPortIndex));
 #endif
+		builder.Add(LightSetParamsConst::PRIORITY_THRESHOLD[nPortIndex], m_Params.nPriorityThreshold[nPortIndex], isMaskSet(Mask::PRIORITY_THRESHOLD_A << nPortIndex));
 	}
 	builder.Add(ArtNetParamsConst::MAP_UNIVERSE0, isMaskSet(Mask::MAP_UNIVERSE0));
 
@@ -466,6 +502,14 @@ void ArtNetParams::Set() {
 
 		p->SetMergeMode(nOffset, mergemode_get(nPortIndex));
 
+		lightset::Data::ClearSlotMergeMode(nOffset);
+
+		if (isMaskSet(Mask::LTP_SLOTS_A << nPortIndex)) {
+			for (uint32_t nSlot = m_Params.nLtpSlots[nPortIndex][0]; nSlot <= m_Params.nLtpSlots[nPortIndex][1]; nSlot++) {
+				lightset::Data::SetSlotMergeMode(nOffset, nSlot - 1, lightset::MergeMode::LTP);
+			}
+		}
+
 #if (ARTNET_VERSION >= 4)
 		p->SetPortProtocol4(nOffset, protocol_get(nPortIndex));
 #endif
@@ -490,6 +534,8 @@ void ArtNetParams::Set() {
 		if (isMaskSet(Mask::PRIORITY_A << nPortIndex)) {
 			p->SetPriority4(m_Params.nPriority[nOffset]);
 		}
+
+		p->SetPriorityThreshold4(nOffset, isMaskSet(Mask::PRIORITY_THRESHOLD_A << nPortIndex) ? m_Params.nPriorityThreshold[nPortIndex] : e131::priority::LOWEST);
 #endif
 	}
 
@@ -540,6 +586,12 @@ void ArtNetParams::Dump() {
 		printf(" %s=%s\n", LightSetParamsConst::MERGE_MODE_PORT[i], lightset::get_merge_mode(mergemode_get(i)));
 	}
 
+	for (uint32_t i = 0; i < artnet::PORTS; i++) {
+		if (isMaskSet(Mask::LTP_SLOTS_A << i)) {
+			printf(" %s=%u-%u\n", LightSetParamsConst::LTP_SLOTS_PORT[i], m_Params.nLtpSlots[i][0], m_Params.nLtpSlots[i][1]);
+		}
+	}
+
 	for (uint32_t i = 0; i < artnet::PORTS; i++) {
 		printf(" %s=%s\n", ArtNetParamsConst::PROTOCOL_PORT[i], artnet::get_protocol_mode(i));
 	}
@@ -569,6 +621,12 @@ void ArtNetParams::Dump() {
 		printf(" %s=%u\n", LightSetParamsConst::PRIORITY[i], m_Params.nPriority[i]);
 	}
 
+	for (uint32_t i = 0; i < artnet::PORTS; i++) {
+		if (isMaskSet(Mask::PRIORITY_THRESHOLD_A << i)) {
+			printf(" %s=%u\n", LightSetParamsConst::PRIORITY_THRESHOLD[i], m_Params.nPriorityThreshold[i]);
+		}
+	}
+
 	/**
 	 * Extra's
 	 */
@@ -49,12 +49,27 @@
 #include "debug.h"
 
 static uint32_t s_ReceivingMask = 0;
+static uint32_t s_nPortIndexResume = 0;	///< The port where the previous call stopped, the Tx descriptor ring was full
 
 void ArtNetNode::HandleDmxIn() {
-	for (uint32_t nPortIndex = 0; nPortIndex < artnetnode::MAX_PORTS; nPortIndex++) {
+	for (uint32_t i = 0; i < artnetnode::MAX_PORTS; i++) {
+		auto nPortIndex = s_nPortIndexResume + i;
+
+		if (nPortIndex >= artnetnode::MAX_PORTS) {
+			nPortIndex -= artnetnode::MAX_PORTS;
+		}
+
 		if  ((m_Node.Port[nPortIndex].direction == lightset::PortDir::INPUT)
 		 &&  (m_Node.Port[nPortIndex].protocol == artnet::PortProtocol::ARTNET)
 		 && ((m_InputPort[nPortIndex].GoodInput & artnet::GoodInput::DISABLED) != artnet::GoodInput::DISABLED)) {
+			/*
+			 * The Tx descriptor ring is full, the next call starts with this port.
+			 * The changed data is kept by GetDmxChanged.
+			 */
+			if (__builtin_expect((Network::Get()->GetSendAvailable() == 0), 0)) {
+				s_nPortIndexResume = nPortIndex;
+				return;
+			}
 
 			const auto *const pDmxData = reinterpret_cast<const struct Data *>(Dmx::Get()->GetDmxChanged(nPortIndex));
 
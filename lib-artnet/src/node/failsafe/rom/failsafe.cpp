@@ -31,6 +31,8 @@
 
 #include "../lib-flashcode/include/flashcode.h"
 
+#include "configstore.h"
+
 #include "debug.h"
 
 namespace artnetnode {
@@ -54,9 +56,12 @@ static bool is_detected() {
 
 		DEBUG_PRINTF("KB_NEEDED=%u, nEraseSize=%u, nPages=%u", failsafe::BYTES_NEEDED, nEraseSize, nPages);
 
-		assert(((nPages + 1) * nEraseSize) <= FlashCode::Get()->GetSize());
+		// The ConfigStore area is at the end of the device, the failsafe record is just below it
+		const auto nConfigStoreSize = configstore::flashstore::size(nEraseSize);
+
+		assert(((nPages * nEraseSize) + nConfigStoreSize) <= FlashCode::Get()->GetSize());
 
-		nOffsetBase = FlashCode::Get()->GetSize() - ((nPages + 1) * nEraseSize);
+		nOffsetBase = FlashCode::Get()->GetSize() - (nPages * nEraseSize) - nConfigStoreSize;
 
 		DEBUG_PRINTF("nOffsetBase=%p", nOffsetBase);
 	}
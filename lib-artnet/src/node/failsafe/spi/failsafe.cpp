@@ -24,6 +24,7 @@
  */
 
 #include <cstdint>
+#include <cstring>
 #include <cassert>
 
 #include "artnetnode.h"
@@ -31,12 +32,20 @@
 
 #include "../lib-flash/include/spi/spi_flash.h"
 
+#include "configstore.h"
+
 #include "debug.h"
 
 namespace artnetnode {
 
 static bool s_hasFlash;
 static uint32_t nOffsetBase;
+static uint32_t s_nEraseLength;
+/*
+ * The record is written asynchronously: erase, then write the ports in one go.
+ * Ports which are not written keep 0xFF, as after the erase.
+ */
+static uint8_t s_Record[failsafe::BYTES_NEEDED];
 
 static bool check_have_flash() {
 	DEBUG_ENTRY
@@ -54,9 +63,13 @@ static bool check_have_flash() {
 
 		DEBUG_PRINTF("KB_NEEDED=%u, nEraseSize=%u, nPages=%u", failsafe::BYTES_NEEDED, nEraseSize, nPages);
 
-		assert(((nPages + 1) * nEraseSize) <= spi_flash_get_size());
+		// The ConfigStore area is at the end of the device, the failsafe record is just below it
+		const auto nConfigStoreSize = configstore::flashstore::size(nEraseSize);
 
-		nOffsetBase = spi_flash_get_size() - ((nPages + 1) * nEraseSize);
+		assert(((nPages * nEraseSize) + nConfigStoreSize) <= spi_flash_get_size());
+
+		nOffsetBase = spi_flash_get_size() - (nPages * nEraseSize) - nConfigStoreSize;
+		s_nEraseLength = nPages * nEraseSize;
 
 		DEBUG_PRINTF("nOffsetBase=%p", nOffsetBase);
 	}
@@ -65,6 +78,16 @@ static bool check_have_flash() {
 	return true;
 }
 
+static void write_record(int nResult) {
+	DEBUG_PRINTF("nResult=%d", nResult);
+
+	if (nResult < 0) {
+		return;
+	}
+
+	spi_flash_async_write(nOffsetBase, sizeof(s_Record), s_Record);
+}
+
 void failsafe_write_start() {
 	DEBUG_ENTRY
 	DEBUG_PRINTF("s_hasFlash=%d", s_hasFlash);
@@ -74,11 +97,10 @@ void failsafe_write_start() {
 		return;
 	}
 
-	const auto nReturn = spi_flash_cmd_erase(nOffsetBase, spi_flash_get_sector_size());
+	s_hasFlash = true;
 
-	s_hasFlash = !(nReturn < 0) ;
+	memset(s_Record, 0xFF, sizeof(s_Record));
 
-	DEBUG_PRINTF("nReturn=%d, s_hasFlash=%d", nReturn, s_hasFlash);
 	DEBUG_EXIT
 }
 
@@ -92,11 +114,7 @@ void failsafe_write(uint32_t nPortIndex, const uint8_t *pData) {
 		return;
 	}
 
-	const auto nOffset = nOffsetBase + (nPortIndex * lightset::dmx::UNIVERSE_SIZE);
-
-	DEBUG_PRINTF("nOffsetBase=%p, nOffset=%p", nOffsetBase, nOffset);
-
-	spi_flash_cmd_write_multi(nOffset, lightset::dmx::UNIVERSE_SIZE, pData);
+	memcpy(&s_Record[nPortIndex * lightset::dmx::UNIVERSE_SIZE], pData, lightset::dmx::UNIVERSE_SIZE);
 
 	DEBUG_EXIT
 }
@@ -104,12 +122,25 @@ void failsafe_write(uint32_t nPortIndex, const uint8_t *pData) {
 void failsafe_write_end() {
 	DEBUG_ENTRY
 
-	// No code needed here
+	if (!s_hasFlash) {
+		DEBUG_EXIT
+		return;
+	}
+
+	DEBUG_PRINTF("nOffsetBase=%p, s_nEraseLength=%u", nOffsetBase, s_nEraseLength);
+
+	if (spi_flash_async_erase(nOffsetBase, s_nEraseLength, write_record) < 0) {
+		// The flash chip is in use, fall back to blocking
+		s_hasFlash = !(spi_flash_cmd_erase(nOffsetBase, s_nEraseLength) < 0);
+
+		if (s_hasFlash) {
+			spi_flash_cmd_write_multi(nOffsetBase, sizeof(s_Record), s_Record);
+		}
+	}
 
 	DEBUG_EXIT
 }
 
-
 void failsafe_read_start() {
 	DEBUG_ENTRY
 	DEBUG_PRINTF("s_hasFlash=%d", s_hasFlash);
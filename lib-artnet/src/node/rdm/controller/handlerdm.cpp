@@ -53,10 +53,10 @@ void ArtNetNode::HandleTodControl() {
 
 	const auto portAddress = static_cast<uint16_t>((pArtTodControl->Net << 8)) | static_cast<uint16_t>((pArtTodControl->Address));
 
-	for (uint32_t nPortIndex = 0; nPortIndex < artnetnode::MAX_PORTS; nPortIndex++) {
-		if (portAddress != m_Node.Port[nPortIndex].PortAddress) {
-			continue;
-		}
+	auto nPortMask = m_PortIndex.Get(static_cast<uint16_t>(portAddress));
+
+	while (nPortMask != 0) {
+		const auto nPortIndex = lightset::next_port(nPortMask);
 
 		if ((m_Node.Port[nPortIndex].direction == lightset::PortDir::OUTPUT) &&
 				((m_OutputPort[nPortIndex].GoodOutputB & artnet::GoodOutputB::RDM_DISABLED) != artnet::GoodOutputB::RDM_DISABLED)) {
@@ -100,18 +100,15 @@ void ArtNetNode::HandleTodData() {
 
 	const auto portAddress = static_cast<uint16_t>((pArtTodData->Net << 8)) | static_cast<uint16_t>((pArtTodData->Address));
 
-	for (uint32_t nPortIndex = 0; nPortIndex < artnetnode::MAX_PORTS; nPortIndex++) {
-		if (m_Node.Port[nPortIndex].direction != lightset::PortDir::INPUT) {
-			continue;
-		}
+	auto nPortMask = m_PortIndex.Get(static_cast<uint16_t>(portAddress));
 
-		if (m_Node.Port[nPortIndex].PortAddress == portAddress) {
+	while (nPortMask != 0) {
+		const auto nPortIndex = lightset::next_port(nPortMask);
+
+		if (m_Node.Port[nPortIndex].direction == lightset::PortDir::INPUT) {
 			DEBUG_PRINTF("nPortIndex=%u, portAddress=%u, pArtTodData->UidCount=%u",nPortIndex, portAddress, pArtTodData->UidCount);
 
-			for (uint32_t nUidIndex = 0; nUidIndex < pArtTodData->UidCount; nUidIndex++) {
-				const uint8_t *pUid = pArtTodData->Tod[nUidIndex];
-				m_pArtNetRdmController->TodAddUid(nPortIndex, pUid);
-			}
+			m_pArtNetRdmController->TodAddUids(nPortIndex, reinterpret_cast<const uint8_t *>(pArtTodData->Tod), pArtTodData->UidCount);
 		}
 	}
 
@@ -120,10 +117,10 @@ void ArtNetNode::HandleTodData() {
 
 /**
  * Output Gateway always Directed Broadcasts this packet.
+ * The UIDs must be in pTodData->Tod already.
  */
-void ArtNetNode::SendTod(uint32_t nPortIndex) {
-	DEBUG_ENTRY
-	DEBUG_PRINTF("nPortIndex=%u", nPortIndex);
+void ArtNetNode::SendTodData(const uint32_t nPortIndex, const uint32_t nUidTotal, const uint32_t nBlockCount, const uint32_t nUidCount) {
+	DEBUG_PRINTF("nPortIndex=%u, nUidTotal=%u, nBlockCount=%u, nUidCount=%u", nPortIndex, nUidTotal, nBlockCount, nUidCount);
 	assert(nPortIndex < artnetnode::MAX_PORTS);
 
 	auto *pTodData = &m_ArtTodPacket.ArtTodData;
@@ -135,8 +132,6 @@ void ArtNetNode::SendTod(uint32_t nPortIndex) {
 	pTodData->ProtVerLo = artnet::PROTOCOL_REVISION;
 	pTodData->RdmVer = 0x01; // Devices that support RDM STANDARD V1.0 set field to 0x01.
 
-	const auto nDiscovered = static_cast<uint8_t>(m_pArtNetRdmController->GetUidCount(nPortIndex));
-
 	/**
 	 * Physical Port = (BindIndex-1) * ArtPollReply- >NumPortsLo + ArtTodData->Port
 	 * As most modern Art-Net gateways implement one universe per ArtPollReply,
@@ -153,16 +148,54 @@ void ArtNetNode::SendTod(uint32_t nPortIndex) {
 	pTodData->Net = m_Node.Port[nPage].NetSwitch;
 	pTodData->CommandResponse = 0; 							///< The packet contains the entire TOD or is the first packet in a sequence of packets that contains the entire TOD.
 	pTodData->Address = m_Node.Port[nPortIndex].DefaultAddress;
-	pTodData->UidTotalHi = 0;
-	pTodData->UidTotalLo = nDiscovered;
-	pTodData->BlockCount = 0;
-	pTodData->UidCount = nDiscovered;
-
-	m_pArtNetRdmController->TodCopy(nPortIndex, reinterpret_cast<uint8_t*>(pTodData->Tod));
+	pTodData->UidTotalHi = static_cast<uint8_t>(nUidTotal >> 8);
+	pTodData->UidTotalLo = static_cast<uint8_t>(nUidTotal);
+	pTodData->BlockCount = static_cast<uint8_t>(nBlockCount);
+	pTodData->UidCount = static_cast<uint8_t>(nUidCount);
 
-	const auto nLength = sizeof(struct artnet::ArtTodData) - (sizeof(pTodData->Tod)) + (nDiscovered * 6U);
+	const auto nLength = sizeof(struct artnet::ArtTodData) - (sizeof(pTodData->Tod)) + (nUidCount * RDM_UID_SIZE);
 
 	Network::Get()->SendTo(m_nHandle, pTodData, static_cast<uint16_t>(nLength), Network::Get()->GetBroadcastIp(), artnet::UDP_PORT);
+}
+
+/**
+ * The full TOD, when it has more than 200 UIDs, it is sent in multiple ArtTodData packets.
+ */
+void ArtNetNode::SendTod(uint32_t nPortIndex) {
+	DEBUG_ENTRY
+	DEBUG_PRINTF("nPortIndex=%u", nPortIndex);
+	assert(nPortIndex < artnetnode::MAX_PORTS);
+
+	auto *pTod = reinterpret_cast<uint8_t *>(m_ArtTodPacket.ArtTodData.Tod);
+	const auto nUidTotal = m_pArtNetRdmController->GetUidCount(nPortIndex);
+	uint32_t nOffset = 0;
+	uint32_t nBlockCount = 0;
+
+	do {
+		const auto nUidCount = m_pArtNetRdmController->TodCopy(nPortIndex, pTod, nOffset, artnetnode::TOD_UIDS_PER_PACKET);
+		SendTodData(nPortIndex, nUidTotal, nBlockCount++, nUidCount);
+		nOffset += nUidCount;
+	} while (nOffset < nUidTotal);
+
+	m_pArtNetRdmController->GetTod(nPortIndex)->ClearChanges();
+
+	DEBUG_EXIT
+}
+
+/**
+ * After an incremental discovery the full TOD is sent only when it has changed.
+ * Art-Net has no TOD delta, a TodFull packet is always (the first block of) the full TOD.
+ */
+void ArtNetNode::SendTodChanges(uint32_t nPortIndex) {
+	DEBUG_ENTRY
+	DEBUG_PRINTF("nPortIndex=%u", nPortIndex);
+	assert(nPortIndex < artnetnode::MAX_PORTS);
+
+	const auto *pRdmTod = m_pArtNetRdmController->GetTod(nPortIndex);
+
+	if (pRdmTod->IsChangesOverflow() || (pRdmTod->GetAddedCount() != 0) || (pRdmTod->GetRemovedCount() != 0)) {
+		SendTod(nPortIndex);
+	}
 
 	DEBUG_EXIT
 }
@@ -209,10 +242,10 @@ void ArtNetNode::HandleRdm() {
 
 	const auto portAddress = static_cast<uint16_t>((pArtRdm->Net << 8)) | static_cast<uint16_t>((pArtRdm->Address));
 
-	for (uint32_t nPortIndex = 0; nPortIndex < artnetnode::MAX_PORTS; nPortIndex++) {
-		if (m_Node.Port[nPortIndex].PortAddress != portAddress) {
-			continue;
-		}
+	auto nPortMask = m_PortIndex.Get(static_cast<uint16_t>(portAddress));
+
+	while (nPortMask != 0) {
+		const auto nPortIndex = lightset::next_port(nPortMask);
 
 		if ((m_Node.Port[nPortIndex].direction == lightset::PortDir::OUTPUT) &&
 		   ((m_OutputPort[nPortIndex].GoodOutputB & artnet::GoodOutputB::RDM_DISABLED) != artnet::GoodOutputB::RDM_DISABLED)) {
@@ -222,17 +255,26 @@ void ArtNetNode::HandleRdm() {
 				m_OutputPort[nPortIndex].IsTransmitting = (GetGoodOutput4(nPortIndex) & nMask) != 0;
 			}
 # endif
-			if (m_OutputPort[nPortIndex].IsTransmitting) {
-				m_OutputPort[nPortIndex].IsTransmitting = false;
-				m_pLightSet->Stop(nPortIndex); // Stop DMX if was running
-			}
-
-			m_OutputPort[nPortIndex].nIpRdm = m_nIpAddressFrom;
-
 			auto *pRdmMessage = reinterpret_cast<const TRdmMessage *>(&pArtRdm->Address);
 
 			pArtRdm->Address = E120_SC_RDM;
-			Rdm::SendRaw(nPortIndex, &pArtRdm->Address, pRdmMessage->message_length + RDM_MESSAGE_CHECKSUM_SIZE);
+			const auto nLength = pRdmMessage->message_length + RDM_MESSAGE_CHECKSUM_SIZE;
+
+			/*
+			 * When DMX is running, the request is sent in between two DMX frames.
+			 * The queued request carries the IP address of the controller, the response is sent back to it.
+			 */
+			if (m_OutputPort[nPortIndex].IsTransmitting && Rdm::SendRawQueued(nPortIndex, &pArtRdm->Address, nLength, m_nIpAddressFrom)) {
+				m_OutputPort[nPortIndex].nIpRdm = 0;
+			} else {
+				if (m_OutputPort[nPortIndex].IsTransmitting) {
+					m_OutputPort[nPortIndex].IsTransmitting = false;
+					m_pLightSet->Stop(nPortIndex); // Stop DMX if was running
+				}
+
+				m_OutputPort[nPortIndex].nIpRdm = m_nIpAddressFrom;
+				Rdm::SendRaw(nPortIndex, &pArtRdm->Address, nLength);
+			}
 
 #ifndef NDEBUG
 			rdm::message_print(reinterpret_cast<const uint8_t *>(pRdmMessage));
@@ -76,30 +76,36 @@ void ArtNetNode::HandleRdmIn() {
 				}
 			}
 		} else if (m_Node.Port[nPortIndex].direction == lightset::PortDir::OUTPUT) {
-			if (m_OutputPort[nPortIndex].nIpRdm != 0) {
-				const auto *pRdmData = Rdm::Receive(nPortIndex);
-				if (pRdmData != nullptr) {
-					pArtRdm->OpCode = static_cast<uint16_t>(artnet::OpCodes::OP_RDM);
-					pArtRdm->RdmVer = 0x01;
-					pArtRdm->Net = m_Node.Port[nPortIndex].NetSwitch;
-					pArtRdm->Command = 0;
-					pArtRdm->Address = m_Node.Port[nPortIndex].DefaultAddress;
+			uint32_t nIpRdm = 0;
+			const auto *pRdmData = Rdm::ReceiveQueued(nPortIndex, nIpRdm);
 
-					auto *pMessage = reinterpret_cast<const struct TRdmMessage *>(pRdmData);
-					memcpy(pArtRdm->RdmPacket, &pRdmData[1], pMessage->message_length + 1U);
+			if ((pRdmData == nullptr) && (m_OutputPort[nPortIndex].nIpRdm != 0)) {
+				nIpRdm = m_OutputPort[nPortIndex].nIpRdm;
 
-					const auto *pRdmMessage = reinterpret_cast<const struct TRdmMessageNoSc *>(pArtRdm->RdmPacket);
+				if ((pRdmData = Rdm::Receive(nPortIndex)) != nullptr) {
+					m_OutputPort[nPortIndex].nIpRdm = 0;
+				}
+			}
 
-					Network::Get()->SendTo(m_nHandle, pArtRdm, ((sizeof(struct artnet::ArtRdm)) - 256) + pRdmMessage->message_length + 1 , m_OutputPort[nPortIndex].nIpRdm, artnet::UDP_PORT);
+			if (pRdmData != nullptr) {
+				pArtRdm->OpCode = static_cast<uint16_t>(artnet::OpCodes::OP_RDM);
+				pArtRdm->RdmVer = 0x01;
+				pArtRdm->Net = m_Node.Port[nPortIndex].NetSwitch;
+				pArtRdm->Command = 0;
+				pArtRdm->Address = m_Node.Port[nPortIndex].DefaultAddress;
 
-					m_OutputPort[nPortIndex].nIpRdm = 0;
+				auto *pMessage = reinterpret_cast<const struct TRdmMessage *>(pRdmData);
+				memcpy(pArtRdm->RdmPacket, &pRdmData[1], pMessage->message_length + 1U);
+
+				const auto *pRdmMessage = reinterpret_cast<const struct TRdmMessageNoSc *>(pArtRdm->RdmPacket);
+
+				Network::Get()->SendTo(m_nHandle, pArtRdm, ((sizeof(struct artnet::ArtRdm)) - 256) + pRdmMessage->message_length + 1 , nIpRdm, artnet::UDP_PORT);
 
 #if defined(CONFIG_PANELLED_RDM_PORT)
-					hal::panel_led_on(hal::panelled::PORT_A_RDM << nPortIndex);
+				hal::panel_led_on(hal::panelled::PORT_A_RDM << nPortIndex);
 #elif defined(CONFIG_PANELLED_RDM_NO_PORT)
-					hal::panel_led_on(hal::panelled::RDM << nPortIndex);
+				hal::panel_led_on(hal::panelled::RDM << nPortIndex);
 #endif
-				}
 			}
 		}
 	}
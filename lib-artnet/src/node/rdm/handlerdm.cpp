@@ -43,12 +43,16 @@ void ArtNetNode::HandleTodRequest() {
 	for (auto nCount = 0; nCount < nAddCount; nCount++) {
 		const auto portAddress = static_cast<uint16_t>((pArtTodRequest->Net << 8)) | static_cast<uint16_t>((pArtTodRequest->Address[nCount]));
 
-		for (uint32_t nPortIndex = 0; nPortIndex < artnetnode::MAX_PORTS; nPortIndex++) {
+		auto nPortMask = m_PortIndex.Get(static_cast<uint16_t>(portAddress));
+
+		while (nPortMask != 0) {
+			const auto nPortIndex = lightset::next_port(nPortMask);
+
 			if ((m_OutputPort[nPortIndex].GoodOutputB & artnet::GoodOutputB::RDM_DISABLED) == artnet::GoodOutputB::RDM_DISABLED) {
 				continue;
 			}
 
-			if ((portAddress == m_Node.Port[nPortIndex].PortAddress) && (m_Node.Port[nPortIndex].direction == lightset::PortDir::OUTPUT)) {
+			if (m_Node.Port[nPortIndex].direction == lightset::PortDir::OUTPUT) {
 				SendTod(nPortIndex);
 			}
 		}
@@ -0,0 +1,398 @@
+/**
+ * @file rdm_discovery.cpp
+ *
+ * Host test: ArtNetRdmController discovers all ports in parallel on simulated RDM buses.
+ * Responders with random and with adjacent UIDs (collisions in every branch), a responder
+ * that never acknowledges DISC_MUTE, an empty port, and an incremental discovery.
+ * The discovery time per port is reported in simulated time.
+ */
+/* Copyright (C) 2024 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+#include "artnetrdmcontroller.h"
+
+#include "rdmtod.h"
+#include "rdmconst.h"
+#include "rdm_e120.h"
+
+#include "dmx.h"
+#include "hardware.h"
+
+RDMTod ArtNetRdmController::m_pRDMTod[artnetnode::MAX_PORTS];
+
+static constexpr uint32_t PORTS = artnetnode::MAX_PORTS;
+static constexpr uint32_t MAX_RESPONDERS = 32;
+static constexpr uint32_t SLOT_MICROS = 44;				///< 250 kbit/s, 11 bits
+static constexpr uint32_t TURNAROUND_MICROS = 300;		///< Responder packet spacing, max 2 ms
+static constexpr uint32_t LOOP_MICROS = 2;				///< The rest of the main loop
+static constexpr uint32_t GIVE_UP_MICROS = 60U * 1000U * 1000U;
+
+static int s_nFailed;
+
+static void check(const bool isOk, const char *pName) {
+	if (!isOk) {
+		printf("FAIL %s at %u us\n", pName, static_cast<unsigned>(Hardware::Get()->Micros()));
+		s_nFailed++;
+	}
+}
+
+void udelay(uint32_t us, [[maybe_unused]] uint32_t offset) {
+	Hardware::Get()->Advance(us);
+}
+
+/*
+ * The simulated RDM bus, one per port
+ */
+
+struct Responder {
+	uint64_t nUid;
+	bool isPresent;
+	bool isMuted;
+	bool isMuteFailure;	///< Answers DISC_UNIQUE_BRANCH, never acknowledges DISC_MUTE
+};
+
+struct Bus {
+	Responder responders[MAX_RESPONDERS];
+	uint32_t nResponders;
+
+	uint8_t response[sizeof(struct TRdmMessage)];
+	uint32_t nReadyMicros;
+	bool isPending;
+
+	uint32_t nDub;
+	uint32_t nMute;
+	uint32_t nCollisions;
+};
+
+static Bus s_Bus[PORTS];
+
+static void add_responder(const uint32_t nPortIndex, const uint64_t nUid, const bool isMuteFailure = false) {
+	auto& bus = s_Bus[nPortIndex];
+	assert(bus.nResponders < MAX_RESPONDERS);
+	bus.responders[bus.nResponders++] = Responder { nUid, true, false, isMuteFailure };
+}
+
+static void encode_dub_response(const uint64_t nUid, uint8_t *pResponse) {
+	uint8_t uid[RDM_UID_SIZE];
+	rdmtod::uid_unpack(nUid, uid);
+
+	auto *pMsg = reinterpret_cast<struct TRdmDiscoveryMsg *>(pResponse);
+	memset(pMsg->header_FE, 0xFE, sizeof(pMsg->header_FE));
+	pMsg->header_AA = 0xAA;
+
+	uint16_t nChecksum = 0;
+
+	for (uint32_t i = 0; i < RDM_UID_SIZE; i++) {
+		pMsg->masked_device_id[i * 2] = uid[i] | 0xAA;
+		pMsg->masked_device_id[i * 2 + 1] = uid[i] | 0x55;
+		nChecksum = static_cast<uint16_t>(nChecksum + pMsg->masked_device_id[i * 2] + pMsg->masked_device_id[i * 2 + 1]);
+	}
+
+	pMsg->checksum[0] = static_cast<uint8_t>((nChecksum >> 8) | 0xAA);
+	pMsg->checksum[1] = static_cast<uint8_t>((nChecksum >> 8) | 0x55);
+	pMsg->checksum[2] = static_cast<uint8_t>((nChecksum & 0xFF) | 0xAA);
+	pMsg->checksum[3] = static_cast<uint8_t>((nChecksum & 0xFF) | 0x55);
+}
+
+void Dmx::RdmSendRaw(const uint32_t nPortIndex, const uint8_t *pRdmData, uint32_t nLength) {
+	// The transmit is blocking, the ports share the CPU
+	Hardware::Get()->Advance(RDM_TRANSMIT_BREAK_TIME + RDM_TRANSMIT_MAB_TIME + nLength * SLOT_MICROS);
+
+	auto& bus = s_Bus[nPortIndex];
+	bus.isPending = false;
+
+	const auto *pRequest = reinterpret_cast<const struct TRdmMessage *>(pRdmData);
+
+	if (pRequest->command_class != E120_DISCOVERY_COMMAND) {
+		return;
+	}
+
+	const auto nPid = static_cast<uint16_t>((pRequest->param_id[0] << 8) | pRequest->param_id[1]);
+	const auto nDestination = rdmtod::uid_pack(pRequest->destination_uid);
+	const auto isBroadcast = (memcmp(pRequest->destination_uid, UID_ALL, RDM_UID_SIZE) == 0);
+
+	switch (nPid) {
+	case E120_DISC_UN_MUTE:
+		for (uint32_t i = 0; i < bus.nResponders; i++) {
+			if (isBroadcast || (bus.responders[i].nUid == nDestination)) {
+				bus.responders[i].isMuted = false;
+			}
+		}
+		break;
+	case E120_DISC_MUTE: {
+		bus.nMute++;
+
+		for (uint32_t i = 0; i < bus.nResponders; i++) {
+			auto& responder = bus.responders[i];
+
+			if (!responder.isPresent || (responder.nUid != nDestination) || responder.isMuteFailure) {
+				continue;
+			}
+
+			responder.isMuted = true;
+
+			auto *pResponse = reinterpret_cast<struct TRdmMessage *>(bus.response);
+			memset(pResponse, 0, sizeof(struct TRdmMessage));
+			pResponse->start_code = E120_SC_RDM;
+			pResponse->sub_start_code = E120_SC_SUB_MESSAGE;
+			pResponse->message_length = RDM_MESSAGE_MINIMUM_SIZE;
+			memcpy(pResponse->destination_uid, pRequest->source_uid, RDM_UID_SIZE);
+			rdmtod::uid_unpack(responder.nUid, pResponse->source_uid);
+			pResponse->command_class = E120_DISCOVERY_COMMAND_RESPONSE;
+			pResponse->param_id[0] = static_cast<uint8_t>(E120_DISC_MUTE >> 8);
+			pResponse->param_id[1] = static_cast<uint8_t>(E120_DISC_MUTE);
+
+			bus.nReadyMicros = Hardware::Get()->Micros() + TURNAROUND_MICROS + RDM_TRANSMIT_BREAK_TIME + RDM_TRANSMIT_MAB_TIME
+					+ (RDM_MESSAGE_MINIMUM_SIZE + RDM_MESSAGE_CHECKSUM_SIZE) * SLOT_MICROS;
+			bus.isPending = true;
+			break;
+		}
+	}
+		break;
+	case E120_DISC_UNIQUE_BRANCH: {
+		bus.nDub++;
+
+		const auto nLowerBound = rdmtod::uid_pack(&pRequest->param_data[0]);
+		const auto nUpperBound = rdmtod::uid_pack(&pRequest->param_data[RDM_UID_SIZE]);
+		uint32_t nResponses = 0;
+
+		for (uint32_t i = 0; i < bus.nResponders; i++) {
+			const auto& responder = bus.responders[i];
+
+			if (!responder.isPresent || responder.isMuted || (responder.nUid < nLowerBound) || (responder.nUid > nUpperBound)) {
+				continue;
+			}
+
+			uint8_t response[sizeof(struct TRdmDiscoveryMsg)];
+			encode_dub_response(responder.nUid, response);
+
+			if (nResponses == 0) {
+				memcpy(bus.response, response, sizeof(response));
+			} else {
+				// The line is driven by more than one responder: the dominant low bits win
+				for (uint32_t j = 0; j < sizeof(response); j++) {
+					bus.response[j] &= response[j];
+				}
+			}
+
+			nResponses++;
+		}
+
+		if (nResponses > 1) {
+			bus.nCollisions++;
+		}
+
+		if (nResponses != 0) {
+			bus.nReadyMicros = Hardware::Get()->Micros() + TURNAROUND_MICROS + sizeof(struct TRdmDiscoveryMsg) * SLOT_MICROS;
+			bus.isPending = true;
+		}
+	}
+		break;
+	default:
+		break;
+	}
+}
+
+const uint8_t *Dmx::RdmReceive(const uint32_t nPortIndex) {
+	auto& bus = s_Bus[nPortIndex];
+
+	if (bus.isPending && (static_cast<int32_t>(Hardware::Get()->Micros() - bus.nReadyMicros) >= 0)) {
+		bus.isPending = false;
+		return bus.response;
+	}
+
+	return nullptr;
+}
+
+/*
+ * The discovery
+ */
+
+struct Result {
+	uint32_t nMicros;
+	bool isFinished;
+};
+
+static void run(ArtNetRdmController& controller, Result result[PORTS], const uint32_t nPortMask) {
+	const auto nStart = Hardware::Get()->Micros();
+	uint32_t nRunning = nPortMask;
+
+	while ((nRunning != 0) && ((Hardware::Get()->Micros() - nStart) < GIVE_UP_MICROS)) {
+		controller.Run();
+		Hardware::Get()->Advance(LOOP_MICROS);
+
+		for (uint32_t nPortIndex = 0; nPortIndex < PORTS; nPortIndex++) {
+			bool bIsIncremental;
+
+			if ((nRunning & (1U << nPortIndex)) && controller.IsFinished(nPortIndex, bIsIncremental)) {
+				result[nPortIndex].nMicros = Hardware::Get()->Micros() - nStart;
+				result[nPortIndex].isFinished = true;
+				nRunning &= ~(1U << nPortIndex);
+			}
+		}
+	}
+}
+
+static bool is_tod(ArtNetRdmController& controller, const uint32_t nPortIndex) {
+	const auto& bus = s_Bus[nPortIndex];
+	uint32_t nExpected = 0;
+
+	for (uint32_t i = 0; i < bus.nResponders; i++) {
+		const auto& responder = bus.responders[i];
+
+		if (!responder.isPresent || responder.isMuteFailure) {
+			continue;
+		}
+
+		nExpected++;
+
+		bool isFound = false;
+
+		for (uint32_t j = 0; j < controller.GetUidCount(nPortIndex); j++) {
+			uint8_t uid[RDM_UID_SIZE];
+			controller.CopyTodEntry(nPortIndex, j, uid);
+			isFound |= (rdmtod::uid_pack(uid) == responder.nUid);
+		}
+
+		if (!isFound) {
+			return false;
+		}
+	}
+
+	return controller.GetUidCount(nPortIndex) == nExpected;
+}
+
+static void report(const char *pName, const Result result[PORTS]) {
+	for (uint32_t nPortIndex = 0; nPortIndex < PORTS; nPortIndex++) {
+		const auto& bus = s_Bus[nPortIndex];
+		printf("%s port %c: %2u responders, %4u.%u ms, DUB %3u, collisions %3u, MUTE %3u\n",
+				pName,
+				static_cast<char>('A' + nPortIndex),
+				static_cast<unsigned>(bus.nResponders),
+				static_cast<unsigned>(result[nPortIndex].nMicros / 1000),
+				static_cast<unsigned>((result[nPortIndex].nMicros % 1000) / 100),
+				static_cast<unsigned>(bus.nDub),
+				static_cast<unsigned>(bus.nCollisions),
+				static_cast<unsigned>(bus.nMute));
+	}
+}
+
+static void clear_counters() {
+	for (auto& bus : s_Bus) {
+		bus.nDub = 0;
+		bus.nMute = 0;
+		bus.nCollisions = 0;
+	}
+}
+
+int main() {
+	/*
+	 * Port A: random UIDs
+	 * Port B: adjacent UIDs, the branches collide down to the last bits
+	 * Port C: one responder never acknowledges DISC_MUTE
+	 * Port D: no responders
+	 */
+	uint64_t nRandom = 0x2545F4914F6CDD1DULL;
+
+	for (uint32_t i = 0; i < 24; i++) {
+		nRandom ^= nRandom << 13;
+		nRandom ^= nRandom >> 7;
+		nRandom ^= nRandom << 17;
+		add_responder(0, (static_cast<uint64_t>(0x7FF0) << 32) | (nRandom & 0xFFFFFFFF));
+	}
+
+	for (uint32_t i = 0; i < 8; i++) {
+		add_responder(1, 0x414C00001000ULL + i);
+	}
+
+	for (uint32_t i = 0; i < 6; i++) {
+		add_responder(2, 0x6574000A0000ULL + (static_cast<uint64_t>(i) << 12), i == 3);
+	}
+
+	static_assert(PORTS == 4, "The scenarios use 4 ports");
+
+	ArtNetRdmController controller;
+	Result parallel[PORTS] = {};
+
+	for (uint32_t nPortIndex = 0; nPortIndex < PORTS; nPortIndex++) {
+		controller.Full(nPortIndex);
+	}
+
+	run(controller, parallel, 0xF);
+	report("parallel  ", parallel);
+
+	for (uint32_t nPortIndex = 0; nPortIndex < PORTS; nPortIndex++) {
+		check(parallel[nPortIndex].isFinished, "finished");
+		check(is_tod(controller, nPortIndex), "TOD");
+	}
+
+	/*
+	 * The same discovery one port after the other
+	 */
+	clear_counters();
+	Result sequential[PORTS] = {};
+	uint32_t nSequentialMicros = 0;
+	uint32_t nParallelMicros = 0;
+
+	for (uint32_t nPortIndex = 0; nPortIndex < PORTS; nPortIndex++) {
+		controller.Full(nPortIndex);
+		run(controller, sequential, 1U << nPortIndex);
+		check(is_tod(controller, nPortIndex), "TOD one port");
+		nSequentialMicros += sequential[nPortIndex].nMicros;
+		nParallelMicros = std::max(nParallelMicros, parallel[nPortIndex].nMicros);
+	}
+
+	report("sequential", sequential);
+	printf("all ports: parallel %u ms, one port after the other %u ms\n",
+			static_cast<unsigned>(nParallelMicros / 1000),
+			static_cast<unsigned>(nSequentialMicros / 1000));
+
+	/*
+	 * Incremental: on port A two responders are gone and one is new
+	 */
+	clear_counters();
+	s_Bus[0].responders[3].isPresent = false;
+	s_Bus[0].responders[17].isPresent = false;
+	add_responder(0, 0x7FF000ABCDEFULL);
+
+	Result incremental[PORTS] = {};
+	controller.Incremental(0);
+	run(controller, incremental, 1U << 0);
+
+	check(incremental[0].isFinished, "incremental finished");
+	check(is_tod(controller, 0), "incremental TOD");
+	printf("incremental port A: %u ms, DUB %u, MUTE %u\n",
+			static_cast<unsigned>(incremental[0].nMicros / 1000),
+			static_cast<unsigned>(s_Bus[0].nDub),
+			static_cast<unsigned>(s_Bus[0].nMute));
+
+	if (s_nFailed != 0) {
+		printf("%d failed\n", s_nFailed);
+		return 1;
+	}
+
+	puts("ok");
+	return 0;
+}
@@ -0,0 +1,43 @@
+/**
+ * @file dmx.h
+ *
+ * Host stub, the RDM bus is simulated by the test
+ */
+
+#ifndef DMX_H_
+#define DMX_H_
+
+#include <cstdint>
+
+namespace dmx {
+enum class PortDirection {
+	OUTP, INP
+};
+
+namespace config {
+namespace max {
+static constexpr uint32_t PORTS = 4;
+}  // namespace max
+}  // namespace config
+}  // namespace dmx
+
+class Dmx {
+public:
+	void SetPortDirection(const uint32_t, const dmx::PortDirection, const bool) {}
+
+	void RdmSendRaw(const uint32_t nPortIndex, const uint8_t *pRdmData, uint32_t nLength);
+	const uint8_t *RdmReceive(const uint32_t nPortIndex);
+
+	bool RdmSendRawQueued(const uint32_t nPortIndex, const uint8_t *pRdmData, uint32_t nLength, const uint32_t nTag);
+	uint32_t GetRdmQueueDepth(const uint32_t nPortIndex);
+	void RdmSendDiscoveryRespondMessage(const uint32_t nPortIndex, const uint8_t *pRdmData, uint32_t nLength);
+	const uint8_t *RdmReceiveQueued(const uint32_t nPortIndex, uint32_t& nTag);
+	const uint8_t *RdmReceiveTimeOut(const uint32_t nPortIndex, uint16_t nTimeOut);
+
+	static Dmx *Get() {
+		static Dmx s_Dmx;
+		return &s_Dmx;
+	}
+};
+
+#endif /* DMX_H_ */
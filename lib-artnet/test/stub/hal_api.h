@@ -0,0 +1,14 @@
+/**
+ * @file hal_api.h
+ *
+ * Host stub, udelay() advances the simulated clock
+ */
+
+#ifndef HAL_API_H_
+#define HAL_API_H_
+
+#include <cstdint>
+
+void udelay(uint32_t us, uint32_t offset = 0);
+
+#endif /* HAL_API_H_ */
@@ -0,0 +1,31 @@
+/**
+ * @file hardware.h
+ *
+ * Host stub, a simulated microseconds clock
+ */
+
+#ifndef HARDWARE_H_
+#define HARDWARE_H_
+
+#include <cstdint>
+
+class Hardware {
+public:
+	uint32_t Micros() const {
+		return m_nMicros;
+	}
+
+	void Advance(const uint32_t nMicros) {
+		m_nMicros += nMicros;
+	}
+
+	static Hardware *Get() {
+		static Hardware s_Hardware;
+		return &s_Hardware;
+	}
+
+private:
+	uint32_t m_nMicros { 0 };
+};
+
+#endif /* HARDWARE_H_ */
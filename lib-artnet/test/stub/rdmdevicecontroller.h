@@ -0,0 +1,20 @@
+/**
+ * @file rdmdevicecontroller.h
+ *
+ * Host stub, only the controller UID
+ */
+
+#ifndef RDMDEVICECONTROLLER_H_
+#define RDMDEVICECONTROLLER_H_
+
+#include <cstdint>
+
+class RDMDeviceController {
+public:
+	const uint8_t *GetUID() const {
+		static constexpr uint8_t UID[] = { 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x01 };
+		return UID;
+	}
+};
+
+#endif /* RDMDEVICECONTROLLER_H_ */
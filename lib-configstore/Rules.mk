@@ -22,6 +22,10 @@ ifneq ($(MAKE_FLAGS),)
 	ifneq (,$(findstring CONFIG_STORE_USE_SPI,$(MAKE_FLAGS)))
 		EXTRA_SRCDIR+=device/spi
 	endif
+
+	ifneq (,$(findstring CONFIG_STORE_USE_SIM,$(MAKE_FLAGS)))
+		EXTRA_SRCDIR+=device/sim
+	endif
 else
 	EXTRA_SRCDIR+=device/file
 	EXTRA_SRCDIR+=device/i2c
@@ -0,0 +1,240 @@
+/**
+ * @file storedevice.cpp
+ *
+ */
+/* Copyright (C) 2024 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * RAM backed NOR flash simulator for host builds.
+ * Erase sets the bytes to 0xFF, Write can only clear bits.
+ * Like the SPI flash device, Erase and Write are done in micro steps:
+ * one sector or one chunk of PROGRAM_CHUNK_SIZE bytes per call.
+ * The geometry is set with CONFIG_STORE_SIM_SIZE and CONFIG_STORE_SIM_SECTOR_SIZE,
+ * a power loss is injected with storedevice::sim::power_fail_after.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <cassert>
+
+#include "configstoredevice.h"
+
+#include "debug.h"
+
+#if !defined (CONFIG_STORE_SIM_SIZE)
+# define CONFIG_STORE_SIM_SIZE			(64 * 1024)
+#endif
+#if !defined (CONFIG_STORE_SIM_SECTOR_SIZE)
+# define CONFIG_STORE_SIM_SECTOR_SIZE	4096
+#endif
+
+namespace storedevice {
+static constexpr uint32_t SIZE = CONFIG_STORE_SIM_SIZE;
+static constexpr uint32_t SECTOR_SIZE = CONFIG_STORE_SIM_SECTOR_SIZE;
+static constexpr uint32_t PAGE_SIZE = 256;
+static constexpr uint32_t PROGRAM_CHUNK_SIZE = 32;
+
+static_assert((SIZE % SECTOR_SIZE) == 0, "");
+
+static uint8_t s_Flash[SIZE];
+static bool s_bPowerOn = true;
+static bool s_bRunning;
+static uint32_t s_nOffset;
+static uint32_t s_nRemaining;
+static const uint8_t *s_pBuffer;
+
+static uint32_t s_nSteps;
+static uint32_t s_nErasedSectors;
+static uint32_t s_nPowerFailStep = UINT32_MAX;
+
+/**
+ * @return false when the power is off, the step is not done
+ */
+static bool step() {
+	if (s_nSteps > s_nPowerFailStep) {
+		return false;
+	}
+	s_nSteps++;
+	return true;
+}
+
+static bool is_torn() {
+	return s_nSteps == (s_nPowerFailStep + 1);
+}
+
+namespace sim {
+void power_fail_after(const uint32_t nSteps) {
+	s_nPowerFailStep = s_nSteps + nSteps;
+}
+
+bool is_power_failed() {
+	return s_nSteps > s_nPowerFailStep;
+}
+
+void power_on() {
+	s_nPowerFailStep = UINT32_MAX;
+	s_bRunning = false;
+}
+
+uint32_t get_steps() {
+	return s_nSteps;
+}
+
+uint32_t get_erased_sectors() {
+	return s_nErasedSectors;
+}
+
+uint8_t *get_flash() {
+	return s_Flash;
+}
+}  // namespace sim
+}  // namespace storedevice
+
+using namespace storedevice;
+
+StoreDevice::StoreDevice() {
+	DEBUG_ENTRY
+
+	// The contents survive a new instance, like a reboot
+	if (s_bPowerOn) {
+		s_bPowerOn = false;
+		memset(s_Flash, 0xFF, sizeof(s_Flash));
+		printf("StoreDevice: Simulator with sector size %u total %u bytes [%u kB]\n", SECTOR_SIZE, SIZE, SIZE / 1024U);
+	}
+
+	s_bRunning = false;
+	m_IsDetected = true;
+
+	DEBUG_EXIT
+}
+
+StoreDevice::~StoreDevice() {
+	DEBUG_ENTRY
+
+	DEBUG_EXIT
+}
+
+uint32_t StoreDevice::GetSize() const {
+	return SIZE;
+}
+
+uint32_t StoreDevice::GetSectorSize() const {
+	return SECTOR_SIZE;
+}
+
+bool StoreDevice::Read(uint32_t nOffset, uint32_t nLength, uint8_t *pBuffer, storedevice::result& nResult) {
+	assert(!s_bRunning);
+
+	if ((nOffset + nLength) > SIZE) {
+		nResult = result::ERROR;
+		return true;
+	}
+
+	memcpy(pBuffer, &s_Flash[nOffset], nLength);
+
+	nResult = result::OK;
+	return true;
+}
+
+bool StoreDevice::Erase(uint32_t nOffset, uint32_t nLength, storedevice::result& nResult) {
+	nResult = result::OK;
+
+	if (!s_bRunning) {
+		if (((nOffset % SECTOR_SIZE) != 0) || ((nLength % SECTOR_SIZE) != 0) || ((nOffset + nLength) > SIZE)) {
+			nResult = result::ERROR;
+			return true;
+		}
+
+		s_bRunning = true;
+		s_nOffset = nOffset;
+		s_nRemaining = nLength;
+	}
+
+	if (s_nRemaining == 0) {
+		s_bRunning = false;
+		return true;
+	}
+
+	if (!step()) {
+		s_bRunning = false;
+		return true;
+	}
+
+	// A torn erase leaves the second half of the sector as it was
+	memset(&s_Flash[s_nOffset], 0xFF, is_torn() ? SECTOR_SIZE / 2 : SECTOR_SIZE);
+	s_nErasedSectors++;
+
+	s_nOffset += SECTOR_SIZE;
+	s_nRemaining -= SECTOR_SIZE;
+
+	return false;
+}
+
+bool StoreDevice::Write(uint32_t nOffset, uint32_t nLength, const uint8_t *pBuffer, storedevice::result& nResult) {
+	nResult = result::OK;
+
+	if (!s_bRunning) {
+		if ((nOffset + nLength) > SIZE) {
+			nResult = result::ERROR;
+			return true;
+		}
+
+		s_bRunning = true;
+		s_nOffset = nOffset;
+		s_nRemaining = nLength;
+		s_pBuffer = pBuffer;
+	}
+
+	if (s_nRemaining == 0) {
+		s_bRunning = false;
+		return true;
+	}
+
+	auto nChunk = PAGE_SIZE - (s_nOffset % PAGE_SIZE);
+
+	if (nChunk > PROGRAM_CHUNK_SIZE) {
+		nChunk = PROGRAM_CHUNK_SIZE;
+	}
+
+	if (nChunk > s_nRemaining) {
+		nChunk = s_nRemaining;
+	}
+
+	if (!step()) {
+		s_bRunning = false;
+		return true;
+	}
+
+	// A torn program step programs the first half of the chunk
+	const auto nProgram = is_torn() ? nChunk / 2 : nChunk;
+
+	for (uint32_t i = 0; i < nProgram; i++) {
+		s_Flash[s_nOffset + i] &= s_pBuffer[i];
+	}
+
+	s_nOffset += nChunk;
+	s_nRemaining -= nChunk;
+	s_pBuffer += nChunk;
+
+	return false;
+}
@@ -25,12 +25,22 @@
 
 #include <cstdint>
 #include <cstdio>
+#include <cassert>
 
 #include "configstoredevice.h"
 #include "spi/spi_flash.h"
 
 #include "debug.h"
 
+/*
+ * Erase and Write are asynchronous: the first call starts the operation,
+ * the next calls return false until the operation is finished.
+ * The buffers are static in ConfigStore, they stay valid.
+ */
+namespace storedevice {
+static bool s_isRunning;
+}  // namespace storedevice
+
 StoreDevice::StoreDevice() {
 	DEBUG_ENTRY
 
@@ -73,24 +83,60 @@ bool StoreDevice::Read(uint32_t nOffset, uint32_t nLength, uint8_t *pBuffer, sto
 	return true;
 }
 
-bool StoreDevice::Erase(uint32_t nOffset, uint32_t nLength, storedevice::result& nResult) {
-	DEBUG_ENTRY
+static bool is_finished(storedevice::result& nResult) {
+	using namespace storedevice;
 
-	const auto nReturn = spi_flash_cmd_erase(nOffset, nLength);
-	nResult = (nReturn < 0) ? storedevice::result::ERROR : storedevice::result::OK;
+	if (spi_flash_async_is_busy()) {
+		return false;
+	}
+
+	s_isRunning = false;
+	nResult = (spi_flash_async_get_result() < 0) ? result::ERROR : result::OK;
 
 	DEBUG_PRINTF("nResult=%d", static_cast<int>(nResult));
-	DEBUG_EXIT
 	return true;
 }
 
+bool StoreDevice::Erase(uint32_t nOffset, uint32_t nLength, storedevice::result& nResult) {
+	using namespace storedevice;
+
+	if (!s_isRunning) {
+		// Another user of the flash chip
+		if (spi_flash_async_is_busy()) {
+			return false;
+		}
+
+		DEBUG_PRINTF("nOffset=%x, nLength=%u", nOffset, nLength);
+
+		if (spi_flash_async_erase(nOffset, nLength) < 0) {
+			nResult = result::ERROR;
+			return true;
+		}
+
+		s_isRunning = true;
+	}
+
+	return is_finished(nResult);
+}
+
 bool StoreDevice::Write(uint32_t nOffset, uint32_t nLength, const uint8_t *pBuffer, storedevice::result& nResult) {
-	DEBUG_ENTRY
+	using namespace storedevice;
 
-	const auto nReturn = spi_flash_cmd_write_multi(nOffset, nLength, pBuffer);
-	nResult = (nReturn < 0) ? storedevice::result::ERROR : storedevice::result::OK;
+	if (!s_isRunning) {
+		// Another user of the flash chip
+		if (spi_flash_async_is_busy()) {
+			return false;
+		}
 
-	DEBUG_PRINTF("nResult=%d", static_cast<int>(nResult));
-	DEBUG_EXIT
-	return true;
+		DEBUG_PRINTF("nOffset=%x, nLength=%u", nOffset, nLength);
+
+		if (spi_flash_async_write(nOffset, nLength, pBuffer) < 0) {
+			nResult = result::ERROR;
+			return true;
+		}
+
+		s_isRunning = true;
+	}
+
+	return is_finished(nResult);
 }
@@ -65,12 +65,43 @@ enum class Store {
 	RGBPANEL,
 	NODE,
 	PCA9685,
+	DMXSENDPORTS,
 	LAST
 };
 
 enum class State {
-	IDLE, CHANGED, CHANGED_WAITING, ERASING, ERASED, ERASED_WAITING, WRITING
+	IDLE, CHANGED, CHANGED_WAITING,
+	WRITING, WRITING_HEADER,						///< Append a record to the log, EEPROM/RAM: write in place
+	ERASING, WRITING_SNAPSHOT, WRITING_SNAPSHOT_HEADER,	///< Compaction into the spare bank
+	ERASING_SPARE
 };
+
+/**
+ * Flash layout, 2 banks at the end of the device. Bank: [log][snapshot]
+ * The snapshot is the RAM image, the log has the records with the changes after the snapshot.
+ * When the log is full, the RAM image is written as the snapshot into the (pre-erased) other bank.
+ * A bank is rounded up to whole sectors: with 4 kB sectors 2 sectors, with 64 kB or 128 kB sectors
+ * 1 sector, the log is then the rest of the sector. The snapshot of the top bank is at GetSize() - SIZE,
+ * the location of the single sector image of the old layout (only sectors up to 4 kB were supported).
+ */
+namespace flashstore {
+static constexpr uint32_t SIZE = 4096;	///< RAM image
+static constexpr uint32_t LOG_SIZE = 4096;
+
+inline constexpr uint32_t bank_size(const uint32_t nSectorSize) {
+	return ((SIZE + LOG_SIZE + nSectorSize - 1) / nSectorSize) * nSectorSize;
+}
+
+/**
+ * @return bytes used at the end of the device
+ */
+inline constexpr uint32_t size(const uint32_t nSectorSize) {
+	if constexpr (storedevice::NEEDS_ERASE) {
+		return 2 * bank_size(nSectorSize);
+	}
+	return ((SIZE + nSectorSize - 1) / nSectorSize) * nSectorSize;
+}
+}  // namespace flashstore
 }  // namespace configstore
 
 class ConfigStore: StoreDevice {
@@ -115,7 +146,7 @@ public:
 
 			if (p->nUtcOffset != nUtcOffset) {
 				p->nUtcOffset = nUtcOffset;
-				s_State = configstore::State::CHANGED;
+				SetChanged(FlashStore::SIGNATURE_SIZE, sizeof(p->nUtcOffset));
 			}
 
 			DEBUG_EXIT
@@ -155,6 +186,18 @@ public:
 private:
 	uint32_t GetStoreOffset(configstore::Store tStore);
 
+	void SetChanged(const uint32_t nOffset, const uint32_t nLength);
+	bool GetChanged(uint32_t& nOffset, uint32_t& nLength);
+	void Next();
+	void Load();
+
+	uint32_t GetLogAddress(const uint32_t nBank) const {
+		return s_nStartAddress + nBank * s_nBankSize;
+	}
+	uint32_t GetSnapshotAddress(const uint32_t nBank) const {
+		return GetLogAddress(nBank) + s_nBankSize - FlashStore::SIZE;
+	}
+
 private:
 	struct Env {
 		int32_t nUtcOffset;
@@ -162,21 +205,43 @@ private:
 	};
 
 	struct FlashStore {
-		static constexpr uint32_t SIGNATURE_SIZE = 16;
+		static constexpr uint32_t SIGNATURE_SIZE = 16;	///< Signature + snapshot sequence number
 		static constexpr uint32_t ENV_SIZE = 16;
 		static constexpr uint32_t OFFSET_STORES = SIGNATURE_SIZE + ENV_SIZE;
-		static constexpr uint32_t SIZE = 4096;
+		static constexpr uint32_t SIZE = configstore::flashstore::SIZE;
+		static constexpr uint32_t BLOCK_SIZE = 16;		///< Change tracking granularity
+		static constexpr uint32_t RECORD_DATA_SIZE = 64;	///< Maximum data bytes in a log record
+		static_assert((RECORD_DATA_SIZE % BLOCK_SIZE) == 0, "");
+	};
+
+	struct Record {
+		uint16_t nOffset;	///< Offset in the RAM image
+		uint16_t nLength;	///< Data bytes, the data is following the header
+		uint16_t nChecksum;	///< Fletcher-16 of nOffset, nLength and the data
+		uint16_t nMarker;
 	};
 
 	static_assert(sizeof(struct Env) == FlashStore::ENV_SIZE, "");
+	static_assert(sizeof(struct Record) == 8, "");
 
 	static bool s_bHaveFlashChip;
 
 	static configstore::State s_State;
 	static uint32_t s_nStartAddress;
+	static uint32_t s_nBankSize;
+	static uint32_t s_nActiveBank;
+	static uint32_t s_nLogOffset;
+	static bool s_bCompact;
+	static bool s_bSpareErased;
 
 	static uint32_t s_nSpiFlashStoreSize;
 	static uint8_t s_SpiFlashData[FlashStore::SIZE];
+	static uint32_t s_ChangedBlocks[FlashStore::SIZE / FlashStore::BLOCK_SIZE / 32];
+
+	static struct RecordBuffer {
+		Record header;
+		uint8_t data[FlashStore::RECORD_DATA_SIZE];
+	} s_Record;
 
 	static uint32_t s_nWaitMillis;
 
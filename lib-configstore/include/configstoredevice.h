@@ -11,8 +11,34 @@ namespace storedevice {
 enum class result {
 	OK, ERROR
 };
+
+#if defined (CONFIG_STORE_USE_I2C) || defined (CONFIG_STORE_USE_RAM)
+static constexpr bool NEEDS_ERASE = false;	///< EEPROM and RAM are written in place
+#else
+static constexpr bool NEEDS_ERASE = true;
+#endif
 }  // namespace storedevice
 
+#if defined (CONFIG_STORE_USE_SIM)
+namespace storedevice {
+namespace sim {
+/**
+ * The erase or program step after nSteps more steps is torn (half done), then the power is off:
+ * the following steps are acknowledged without changing the flash.
+ */
+void power_fail_after(const uint32_t nSteps);
+bool is_power_failed();
+/**
+ * Power is back, the flash contents are kept
+ */
+void power_on();
+uint32_t get_steps();
+uint32_t get_erased_sectors();
+uint8_t *get_flash();
+}  // namespace sim
+}  // namespace storedevice
+#endif
+
 #if defined (CONFIG_STORE_USE_I2C)
 # include "i2c/at24cxx.h"
 class StoreDevice: AT24C32 {
@@ -32,6 +58,10 @@ public:
 	uint32_t GetSectorSize() const;
 	uint32_t GetSize() const;
 
+	/*
+	 * Erase and Write return false when not finished yet, the caller repeats the call
+	 * with the same arguments until true is returned. pBuffer must stay valid.
+	 */
 	bool Read(uint32_t nOffset, uint32_t nLength, uint8_t *pBuffer, storedevice::result& nResult);
 	bool Erase(uint32_t nOffset, uint32_t nLength, storedevice::result& nResult);
 	bool Write(uint32_t nOffset, uint32_t nLength, const uint8_t *pBuffer, storedevice::result& nResult);
@@ -43,24 +43,55 @@ extern int32_t *gp_nUtcOffset;
 using namespace configstore;
 
 static constexpr uint8_t s_aSignature[] = {'A', 'v', 'V', 0x01};
-static constexpr uint32_t s_aStorSize[static_cast<uint32_t>(Store::LAST)]  = {96,        32,    64,      64,    32,     32,        480,          64,         32,        96,           48,        32,      944,          48,        64,            32,        96,         32,      1024,     32,     32,       64,            96,               32,    32,          320,    32};
+static constexpr uint32_t s_aStorSize[static_cast<uint32_t>(Store::LAST)]  = {96,        32,    64,      64,    32,     32,        480,          64,         32,        96,           48,        32,      944,          48,        64,            32,        96,         32,      1024,     32,     32,       64,            96,               32,    32,          320,    32,       64};
 #ifndef NDEBUG
-static constexpr char s_aStoreName[static_cast<uint32_t>(Store::LAST)][16] = {"Network", "DMX", "Pixel", "LTC", "MIDI", "LTC ETC", "OSC Server", "TLC59711", "USB Pro", "RDM Device", "RConfig", "TCNet", "OSC Client", "Display", "LTC Display", "Monitor", "SparkFun", "Slush", "Motors", "Show", "Serial", "RDM Sensors", "RDM SubDevices", "GPS", "RGB Panel", "Node", "PCA9685"};
+static constexpr char s_aStoreName[static_cast<uint32_t>(Store::LAST)][16] = {"Network", "DMX", "Pixel", "LTC", "MIDI", "LTC ETC", "OSC Server", "TLC59711", "USB Pro", "RDM Device", "RConfig", "TCNet", "OSC Client", "Display", "LTC Display", "Monitor", "SparkFun", "Slush", "Motors", "Show", "Serial", "RDM Sensors", "RDM SubDevices", "GPS", "RGB Panel", "Node", "PCA9685", "DMX Ports"};
 #endif
 
+static constexpr uint16_t RECORD_MARKER = 0xC5A3;
+
 bool ConfigStore::s_bHaveFlashChip;
 State ConfigStore::s_State;
 uint32_t ConfigStore::s_nStartAddress;
+uint32_t ConfigStore::s_nBankSize;
+uint32_t ConfigStore::s_nActiveBank;
+uint32_t ConfigStore::s_nLogOffset;
+bool ConfigStore::s_bCompact;
+bool ConfigStore::s_bSpareErased;
 uint32_t ConfigStore::s_nSpiFlashStoreSize;
 uint32_t ConfigStore::s_nWaitMillis;
 uint8_t ConfigStore::s_SpiFlashData[FlashStore::SIZE] SECTION_CONFIGSTORE;
+uint32_t ConfigStore::s_ChangedBlocks[FlashStore::SIZE / FlashStore::BLOCK_SIZE / 32];
+ConfigStore::RecordBuffer ConfigStore::s_Record;
 
 ConfigStore *ConfigStore::s_pThis;
 
+static uint16_t fletcher16(const uint16_t nOffset, const uint16_t nLength, const uint8_t *pData) {
+	uint32_t nSum1 = static_cast<uint32_t>((nOffset & 0xFF) + (nOffset >> 8) + (nLength & 0xFF) + (nLength >> 8));
+	uint32_t nSum2 = nSum1;
+
+	for (uint32_t i = 0; i < nLength; i++) {
+		nSum1 += pData[i];
+		nSum2 += nSum1;
+	}
+
+	return static_cast<uint16_t>(((nSum2 % 255) << 8) | (nSum1 % 255));
+}
+
+static bool is_erased(const uint8_t *pData, const uint32_t nLength) {
+	for (uint32_t i = 0; i < nLength; i++) {
+		if (pData[i] != 0xFF) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
 ConfigStore::ConfigStore() {
 	DEBUG_ENTRY
 
-	static_assert(sizeof(s_aSignature) <= FlashStore::SIGNATURE_SIZE);
+	static_assert(sizeof(s_aSignature) + sizeof(uint32_t) <= FlashStore::SIGNATURE_SIZE);
 
 	assert(s_pThis == nullptr);
 	s_pThis = this;
@@ -69,25 +100,38 @@ ConfigStore::ConfigStore() {
 
 	s_bHaveFlashChip = StoreDevice::IsDetected();
 
-	assert(FlashStore::SIZE <= StoreDevice::GetSize());
+	// The state comes from the store device only, also for a new instance without a reset (host builds)
+	s_State = State::IDLE;
+	s_nActiveBank = 0;
+	s_nLogOffset = 0;
+	s_bCompact = false;
+	s_bSpareErased = false;
+	memset(s_ChangedBlocks, 0, sizeof(s_ChangedBlocks));
 
 	const auto nEraseSize = StoreDevice::GetSectorSize();
-	assert(nEraseSize <= FlashStore::SIZE);
-
-	const auto nSectors = FlashStore::SIZE / nEraseSize;
+	const auto nSize = flashstore::size(nEraseSize);
 
-	DEBUG_PRINTF("KB_NEEDED=%u, nEraseSize=%u, nSectors=%u", FlashStore::SIZE, nEraseSize, nSectors);
+	DEBUG_PRINTF("KB_NEEDED=%u, nEraseSize=%u", nSize, nEraseSize);
 
-	assert((nSectors * nEraseSize) <= StoreDevice::GetSize());
+	assert(nSize <= StoreDevice::GetSize());
 
-	s_nStartAddress = StoreDevice::GetSize() - (nSectors * nEraseSize);
+	s_nStartAddress = StoreDevice::GetSize() - nSize;
+	s_nBankSize = flashstore::bank_size(nEraseSize);
 
 	DEBUG_PRINTF("s_nStartAddress=%p", reinterpret_cast<void *>(s_nStartAddress));
 
+	s_nSpiFlashStoreSize = FlashStore::OFFSET_STORES;
+
+	for (uint32_t j = 0; j < static_cast<uint32_t>(Store::LAST); j++) {
+		s_nSpiFlashStoreSize += s_aStorSize[j];
+	}
+
+	DEBUG_PRINTF("FlashStore::OFFSET_STORES=%d, m_nSpiFlashStoreSize=%d", static_cast<int>(FlashStore::OFFSET_STORES), s_nSpiFlashStoreSize);
+
+	assert(s_nSpiFlashStoreSize <= FlashStore::SIZE);
+
 	if (s_bHaveFlashChip) {
-		storedevice::result result;
-		StoreDevice::Read(s_nStartAddress, FlashStore::SIZE, reinterpret_cast<uint8_t *>(&s_SpiFlashData), result);
-		assert(result == storedevice::result::OK);
+		Load();
 	}
 
 	bool bSignatureOK = true;
@@ -102,19 +146,14 @@ ConfigStore::ConfigStore() {
 	if (!bSignatureOK) {
 		DEBUG_PUTS("No signature");
 		memset(&s_SpiFlashData[FlashStore::SIGNATURE_SIZE], 0, FlashStore::SIZE - FlashStore::SIGNATURE_SIZE);
-		s_State = State::CHANGED;
+		s_bCompact = true;
+		SetChanged(FlashStore::SIGNATURE_SIZE, s_nSpiFlashStoreSize - FlashStore::SIGNATURE_SIZE);
 	}
 
-	s_nSpiFlashStoreSize = FlashStore::OFFSET_STORES;
-
-	for (uint32_t j = 0; j < static_cast<uint32_t>(Store::LAST); j++) {
-		s_nSpiFlashStoreSize += s_aStorSize[j];
+	if (s_bCompact) {
+		s_State = State::CHANGED;
 	}
 
-	DEBUG_PRINTF("FlashStore::OFFSET_STORES=%d, m_nSpiFlashStoreSize=%d", static_cast<int>(FlashStore::OFFSET_STORES), s_nSpiFlashStoreSize);
-
-	assert(s_nSpiFlashStoreSize <= FlashStore::SIZE);
-
 	for (uint32_t nStore = 0; nStore < static_cast<uint32_t>(Store::LAST); nStore++) {
 		auto *pSet = reinterpret_cast<uint32_t *>((&s_SpiFlashData[GetStoreOffset(static_cast<Store>(nStore))]));
 		if (*pSet == UINT32_MAX) {
@@ -133,6 +172,97 @@ ConfigStore::ConfigStore() {
 	DEBUG_EXIT
 }
 
+/**
+ * Read the newest valid snapshot and replay its log.
+ * A torn record or a not erased log tail is cleaned up with a compaction.
+ */
+void ConfigStore::Load() {
+	DEBUG_ENTRY
+	storedevice::result result;
+
+	if constexpr (!storedevice::NEEDS_ERASE) {
+		StoreDevice::Read(s_nStartAddress, FlashStore::SIZE, reinterpret_cast<uint8_t *>(&s_SpiFlashData), result);
+		assert(result == storedevice::result::OK);
+		DEBUG_EXIT
+		return;
+	}
+
+	bool isValid[2];
+	uint32_t nSequence[2];
+
+	for (uint32_t nBank = 0; nBank < 2; nBank++) {
+		uint8_t header[FlashStore::SIGNATURE_SIZE];
+		StoreDevice::Read(GetSnapshotAddress(nBank), sizeof(header), header, result);
+		isValid[nBank] = (result == storedevice::result::OK) && (memcmp(header, s_aSignature, sizeof(s_aSignature)) == 0);
+		memcpy(&nSequence[nBank], &header[sizeof(s_aSignature)], sizeof(uint32_t));
+		DEBUG_PRINTF("nBank=%u, isValid=%d, nSequence=%u", nBank, isValid[nBank], nSequence[nBank]);
+	}
+
+	if (!isValid[0] && !isValid[1]) {
+		memset(s_SpiFlashData, 0, sizeof(s_SpiFlashData));
+		s_nActiveBank = 1;
+		s_bCompact = true;
+		DEBUG_EXIT
+		return;
+	}
+
+	if (isValid[0] && isValid[1]) {
+		s_nActiveBank = (static_cast<int32_t>(nSequence[1] - nSequence[0]) > 0) ? 1 : 0;
+	} else {
+		s_nActiveBank = isValid[1] ? 1 : 0;
+	}
+
+	StoreDevice::Read(GetSnapshotAddress(s_nActiveBank), FlashStore::SIZE, reinterpret_cast<uint8_t *>(&s_SpiFlashData), result);
+	assert(result == storedevice::result::OK);
+
+	const auto nLogSize = s_nBankSize - FlashStore::SIZE;
+	const auto nLogAddress = GetLogAddress(s_nActiveBank);
+
+	s_nLogOffset = 0;
+
+	while ((s_nLogOffset + sizeof(struct Record)) <= nLogSize) {
+		auto& record = s_Record.header;
+		StoreDevice::Read(nLogAddress + s_nLogOffset, sizeof(struct Record), reinterpret_cast<uint8_t *>(&record), result);
+
+		if (is_erased(reinterpret_cast<uint8_t *>(&record), sizeof(struct Record))) {
+			break;
+		}
+
+		if ((record.nMarker != RECORD_MARKER)
+		 || (record.nLength == 0) || (record.nLength > FlashStore::RECORD_DATA_SIZE)
+		 || ((record.nOffset + record.nLength) > FlashStore::SIZE)
+		 || ((s_nLogOffset + sizeof(struct Record) + record.nLength) > nLogSize)) {
+			DEBUG_PRINTF("Invalid record at %u", s_nLogOffset);
+			s_bCompact = true;
+			break;
+		}
+
+		StoreDevice::Read(nLogAddress + s_nLogOffset + sizeof(struct Record), record.nLength, s_Record.data, result);
+
+		if (fletcher16(record.nOffset, record.nLength, s_Record.data) != record.nChecksum) {
+			DEBUG_PRINTF("Checksum error at %u", s_nLogOffset);
+			s_bCompact = true;
+			break;
+		}
+
+		memcpy(&s_SpiFlashData[record.nOffset], s_Record.data, record.nLength);
+		s_nLogOffset += static_cast<uint32_t>(sizeof(struct Record)) + record.nLength;
+	}
+
+	for (auto nOffset = s_nLogOffset; !s_bCompact && (nOffset < nLogSize); nOffset += FlashStore::RECORD_DATA_SIZE) {
+		const auto nLength = (nLogSize - nOffset) < FlashStore::RECORD_DATA_SIZE ? nLogSize - nOffset : FlashStore::RECORD_DATA_SIZE;
+		StoreDevice::Read(nLogAddress + nOffset, nLength, s_Record.data, result);
+
+		if (!is_erased(s_Record.data, nLength)) {
+			DEBUG_PRINTF("Log not erased at %u", nOffset);
+			s_bCompact = true;
+		}
+	}
+
+	DEBUG_PRINTF("s_nActiveBank=%u, s_nLogOffset=%u, s_bCompact=%d", s_nActiveBank, s_nLogOffset, s_bCompact);
+	DEBUG_EXIT
+}
+
 uint32_t ConfigStore::GetStoreOffset(Store store) {
 	assert(store < Store::LAST);
 
@@ -157,7 +287,7 @@ void ConfigStore::ResetSetList(Store store) {
 	*pbSetList++ = 0x00;
 	*pbSetList = 0x00;
 
-	s_State = State::CHANGED;
+	SetChanged(GetStoreOffset(store), sizeof(uint32_t));
 }
 
 void ConfigStore::Update(Store store, uint32_t nOffset, const void *pData, uint32_t nDataLength, uint32_t nSetList, uint32_t nOffsetSetList) {
@@ -185,6 +315,7 @@ void ConfigStore::Update(Store store, uint32_t nOffset, const void *pData, uint3
 		if (*pSrc != *pDst) {
 			bIsChanged = true;
 			*pDst = *pSrc;
+			SetChanged(nBase + i, 1);
 		}
 		pDst++;
 		pSrc++;
@@ -193,10 +324,7 @@ void ConfigStore::Update(Store store, uint32_t nOffset, const void *pData, uint3
 	if (bIsChanged){
 		auto *pSet = reinterpret_cast<uint32_t *>((&s_SpiFlashData[GetStoreOffset(store)] + nOffsetSetList));
 		*pSet |= nSetList;
-	}
-
-	if (bIsChanged) {
-		s_State = State::CHANGED;
+		SetChanged(GetStoreOffset(store) + nOffsetSetList, sizeof(uint32_t));
 	}
 
 	debug_dump(&s_SpiFlashData[GetStoreOffset(store)] + nOffsetSetList, 8);
@@ -236,17 +364,127 @@ void ConfigStore::Copy(const Store store, void *pData, uint32_t nDataLength, uin
 	DEBUG_EXIT
 }
 
+void ConfigStore::SetChanged(const uint32_t nOffset, const uint32_t nLength) {
+	assert((nOffset + nLength) <= FlashStore::SIZE);
+
+	const auto nLast = (nOffset + nLength - 1) / FlashStore::BLOCK_SIZE;
+
+	for (auto nBlock = nOffset / FlashStore::BLOCK_SIZE; nBlock <= nLast; nBlock++) {
+		s_ChangedBlocks[nBlock / 32] |= (1U << (nBlock & 31));
+	}
+
+	// A running erase/write step is finished first, Next() picks up the changes.
+	if ((s_State == State::IDLE) || (s_State == State::CHANGED_WAITING)) {
+		s_State = State::CHANGED;
+	}
+}
+
+/**
+ * Take the first run of changed blocks, at most RECORD_DATA_SIZE bytes.
+ */
+bool ConfigStore::GetChanged(uint32_t& nOffset, uint32_t& nLength) {
+	constexpr auto BLOCKS = FlashStore::SIZE / FlashStore::BLOCK_SIZE;
+
+	uint32_t nBlock = 0;
+
+	while ((nBlock < BLOCKS) && ((s_ChangedBlocks[nBlock / 32] & (1U << (nBlock & 31))) == 0)) {
+		if (s_ChangedBlocks[nBlock / 32] == 0) {
+			nBlock = (nBlock | 31) + 1;
+		} else {
+			nBlock++;
+		}
+	}
+
+	if (nBlock >= BLOCKS) {
+		return false;
+	}
+
+	nOffset = nBlock * FlashStore::BLOCK_SIZE;
+	nLength = 0;
+
+	while ((nBlock < BLOCKS) && (nLength < FlashStore::RECORD_DATA_SIZE) && ((s_ChangedBlocks[nBlock / 32] & (1U << (nBlock & 31))) != 0)) {
+		s_ChangedBlocks[nBlock / 32] &= ~(1U << (nBlock & 31));
+		nLength += FlashStore::BLOCK_SIZE;
+		nBlock++;
+	}
+
+	return true;
+}
+
+/**
+ * Select the next step after a finished erase/write.
+ */
+void ConfigStore::Next() {
+	if constexpr (storedevice::NEEDS_ERASE) {
+		if (s_bCompact) {
+			memset(s_ChangedBlocks, 0, sizeof(s_ChangedBlocks));
+
+			uint32_t nSequence;
+			memcpy(&nSequence, &s_SpiFlashData[sizeof(s_aSignature)], sizeof(uint32_t));
+			nSequence++;
+			memcpy(&s_SpiFlashData[sizeof(s_aSignature)], &nSequence, sizeof(uint32_t));
+
+			s_State = s_bSpareErased ? State::WRITING_SNAPSHOT : State::ERASING;
+			DEBUG_PRINTF("Compaction -> bank %u, nSequence=%u", s_nActiveBank ^ 1, nSequence);
+			return;
+		}
+	}
+
+	uint32_t nOffset;
+	uint32_t nLength;
+
+	if (!GetChanged(nOffset, nLength)) {
+		if constexpr (storedevice::NEEDS_ERASE) {
+			s_State = s_bSpareErased ? State::IDLE : State::ERASING_SPARE;
+		} else {
+			s_State = State::IDLE;
+		}
+		return;
+	}
+
+	if (nOffset + nLength > s_nSpiFlashStoreSize) {
+		nLength = s_nSpiFlashStoreSize - nOffset;
+	}
+
+	if constexpr (storedevice::NEEDS_ERASE) {
+		if ((s_nLogOffset + sizeof(struct Record) + nLength) > (s_nBankSize - FlashStore::SIZE)) {
+			s_bCompact = true;
+			Next();
+			return;
+		}
+	}
+
+	s_Record.header.nOffset = static_cast<uint16_t>(nOffset);
+	s_Record.header.nLength = static_cast<uint16_t>(nLength);
+	s_Record.header.nMarker = RECORD_MARKER;
+	memcpy(s_Record.data, &s_SpiFlashData[nOffset], nLength);
+	s_Record.header.nChecksum = fletcher16(s_Record.header.nOffset, s_Record.header.nLength, s_Record.data);
+
+	s_State = State::WRITING;
+}
+
 void ConfigStore::Delay() {
-	if (s_State != State::IDLE) {
+	if ((s_State == State::CHANGED) || (s_State == State::CHANGED_WAITING)) {
 		s_State = State::CHANGED;
 	}
 }
 
+/**
+ * Each call is doing at most one erase or write step of the store device.
+ * @return true when there is still work to do
+ */
 bool ConfigStore::Flash() {
 	if (__builtin_expect((s_State == State::IDLE), 1)) {
 		return false;
 	}
 
+	if (!s_bHaveFlashChip) {
+		s_State = State::IDLE;
+		return false;
+	}
+
+	storedevice::result result;
+
 	switch (s_State) {
 	case State::CHANGED:
 		s_nWaitMillis = Hardware::Get()->Millis();
@@ -256,41 +494,59 @@ bool ConfigStore::Flash() {
 		if ((Hardware::Get()->Millis() - s_nWaitMillis) < 100) {
 			return true;
 		}
-		s_State = State::ERASING;
+		Next();
 		return true;
-		break;
-	case State::ERASING: {
-		storedevice::result result;
-		if (StoreDevice::Erase(s_nStartAddress, FlashStore::SIZE, result)) {
-			s_nWaitMillis = Hardware::Get()->Millis();
-			s_State = State::ERASED_WAITING;
+	case State::WRITING:
+		if constexpr (storedevice::NEEDS_ERASE) {
+			if (StoreDevice::Write(GetLogAddress(s_nActiveBank) + s_nLogOffset + sizeof(struct Record), s_Record.header.nLength, s_Record.data, result)) {
+				assert(result == storedevice::result::OK);
+				s_State = State::WRITING_HEADER;
+			}
+		} else {
+			if (StoreDevice::Write(s_nStartAddress + s_Record.header.nOffset, s_Record.header.nLength, s_Record.data, result)) {
+				assert(result == storedevice::result::OK);
+				Next();
+			}
 		}
-		assert(result == storedevice::result::OK);
-		DEBUG_PRINTF("s_State=%u", static_cast<uint32_t>(s_State));
 		return true;
-	}
-		break;
-	case State::ERASED_WAITING:
-		if ((Hardware::Get()->Millis() - s_nWaitMillis) < 100) {
-			return true;
+	case State::WRITING_HEADER:
+		if (StoreDevice::Write(GetLogAddress(s_nActiveBank) + s_nLogOffset, sizeof(struct Record), reinterpret_cast<const uint8_t *>(&s_Record.header), result)) {
+			assert(result == storedevice::result::OK);
+			s_nLogOffset += static_cast<uint32_t>(sizeof(struct Record)) + s_Record.header.nLength;
+			Next();
 		}
-		s_State = State::ERASED;
 		return true;
-		break;
-	case State::ERASED:
-		s_State = State::WRITING;
+	case State::ERASING:
+		if (StoreDevice::Erase(GetLogAddress(s_nActiveBank ^ 1), s_nBankSize, result)) {
+			assert(result == storedevice::result::OK);
+			s_bSpareErased = true;
+			s_State = State::WRITING_SNAPSHOT;
+		}
 		return true;
-		break;
-	case State::WRITING: {
-		storedevice::result result;
-		if (StoreDevice::Write(s_nStartAddress, s_nSpiFlashStoreSize, reinterpret_cast<uint8_t*>(&s_SpiFlashData), result)) {
-			s_State = State::IDLE;
-			return false;
+	case State::WRITING_SNAPSHOT:
+		if (StoreDevice::Write(GetSnapshotAddress(s_nActiveBank ^ 1) + FlashStore::SIGNATURE_SIZE, s_nSpiFlashStoreSize - FlashStore::SIGNATURE_SIZE, &s_SpiFlashData[FlashStore::SIGNATURE_SIZE], result)) {
+			assert(result == storedevice::result::OK);
+			s_State = State::WRITING_SNAPSHOT_HEADER;
+		}
+		return true;
+	case State::WRITING_SNAPSHOT_HEADER:
+		// The header is written last, it makes the snapshot valid
+		if (StoreDevice::Write(GetSnapshotAddress(s_nActiveBank ^ 1), FlashStore::SIGNATURE_SIZE, s_SpiFlashData, result)) {
+			assert(result == storedevice::result::OK);
+			s_nActiveBank ^= 1;
+			s_nLogOffset = 0;
+			s_bCompact = false;
+			s_bSpareErased = false;
+			Next();
+		}
+		return true;
+	case State::ERASING_SPARE:
+		if (StoreDevice::Erase(GetLogAddress(s_nActiveBank ^ 1), s_nBankSize, result)) {
+			assert(result == storedevice::result::OK);
+			s_bSpareErased = true;
+			Next();
 		}
-		assert(result == storedevice::result::OK);
 		return true;
-	}
-		break;
 	default:
 		assert(0);
 		__builtin_unreachable();
@@ -0,0 +1,261 @@
+/**
+ * @file configstore_power_loss.cpp
+ *
+ * Host test: ConfigStore on the NOR flash simulator.
+ * A power loss is injected at every erase/program step of a workload that fills the log,
+ * compacts into the other bank and erases the old bank. After the reboot the counter
+ * must be the old or the new value, the other stores must be intact and the store must
+ * accept new updates. The image of the old single sector layout must still load.
+ */
+/* Copyright (C) 2024 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "configstore.h"
+
+namespace global {
+int32_t *gp_nUtcOffset;
+}  // namespace global
+
+static constexpr uint32_t SIZE = CONFIG_STORE_SIM_SIZE;
+static constexpr uint32_t SECTOR_SIZE = CONFIG_STORE_SIM_SECTOR_SIZE;
+static constexpr uint32_t COUNTER_OFFSET = 4;	///< After the set list of Store::NETWORK
+static constexpr uint32_t WORKLOAD_UPDATES = 6;
+
+static int s_nFailed;
+
+static void check(const bool isOk, const char *pName, const uint32_t nValue = 0) {
+	if (!isOk) {
+		s_nFailed++;
+		printf("FAIL %s [%u]\n", pName, static_cast<unsigned>(nValue));
+	}
+}
+
+static void drain(ConfigStore& configStore) {
+	while (configStore.Flash())
+		;
+}
+
+static void set_counter(ConfigStore& configStore, const uint32_t nCounter) {
+	configStore.Update(configstore::Store::NETWORK, COUNTER_OFFSET, &nCounter, sizeof(nCounter));
+	drain(configStore);
+}
+
+static uint32_t get_counter(ConfigStore& configStore) {
+	uint32_t nCounter = 0;
+	configStore.Copy(configstore::Store::NETWORK, &nCounter, sizeof(nCounter), COUNTER_OFFSET, false);
+	return nCounter;
+}
+
+static uint8_t s_Pattern[28];
+
+static bool is_pattern(ConfigStore& configStore) {
+	uint8_t pattern[sizeof(s_Pattern)] = {};
+	configStore.Copy(configstore::Store::DMXSEND, pattern, sizeof(pattern), 4, false);
+	return memcmp(pattern, s_Pattern, sizeof(s_Pattern)) == 0;
+}
+
+/**
+ * Updates until the next compaction, detected by the erase of the old bank
+ * @return the number of updates
+ */
+static uint32_t run_to_compaction(ConfigStore& configStore, uint32_t& nCounter) {
+	const auto nErasedSectors = storedevice::sim::get_erased_sectors();
+	uint32_t nUpdates = 0;
+
+	while (storedevice::sim::get_erased_sectors() == nErasedSectors) {
+		set_counter(configStore, ++nCounter);
+		nUpdates++;
+	}
+
+	return nUpdates;
+}
+
+static void test_power_loss() {
+	auto *pFlash = storedevice::sim::get_flash();
+
+	for (uint32_t i = 0; i < sizeof(s_Pattern); i++) {
+		s_Pattern[i] = static_cast<uint8_t>(0xA0 + i);
+	}
+
+	uint32_t nCounter = 0;
+
+	{
+		ConfigStore configStore;
+		drain(configStore);
+		configStore.Update(configstore::Store::DMXSEND, 4, s_Pattern, sizeof(s_Pattern));
+		drain(configStore);
+	}
+
+	std::vector<uint8_t> image;
+	uint32_t nCycle;
+
+	{
+		ConfigStore configStore;
+		check(is_pattern(configStore), "pattern after the first boot");
+
+		// The first update after a boot is followed by the erase of the spare bank
+		set_counter(configStore, ++nCounter);
+
+		nCycle = run_to_compaction(configStore, nCounter);
+		check(nCycle > WORKLOAD_UPDATES, "log size", nCycle);
+
+		for (uint32_t i = 0; i < (nCycle - (WORKLOAD_UPDATES / 2)); i++) {
+			set_counter(configStore, ++nCounter);
+		}
+	}
+
+	image.assign(pFlash, pFlash + SIZE);
+
+	/*
+	 * The power fails after nStep steps of the workload: the spare erase after the boot,
+	 * log appends, the compaction into the other bank and the erase of the old bank.
+	 */
+	const auto nBase = nCounter;
+	const auto nBankSectors = configstore::flashstore::bank_size(SECTOR_SIZE) / SECTOR_SIZE;
+	uint32_t nStep = 0;
+	uint32_t nPoints[3] = {};	///< Until the spare bank is erased, log and compaction, from the erase of the old bank
+
+	for (;; nStep++) {
+		memcpy(pFlash, image.data(), SIZE);
+		storedevice::sim::power_on();
+
+		uint32_t nInFlight = 0;
+		bool isPowerFailed = false;
+
+		{
+			ConfigStore configStore;
+			const auto nErasedSectors = storedevice::sim::get_erased_sectors();
+			storedevice::sim::power_fail_after(nStep);
+
+			for (uint32_t i = 1; i <= WORKLOAD_UPDATES; i++) {
+				nInFlight = i;
+				set_counter(configStore, nBase + i);
+
+				if (storedevice::sim::is_power_failed()) {
+					isPowerFailed = true;
+					break;
+				}
+			}
+
+			if (isPowerFailed) {
+				const auto nErased = storedevice::sim::get_erased_sectors() - nErasedSectors;
+				nPoints[(nErased < nBankSectors) ? 0 : ((nErased == nBankSectors) ? 1 : 2)]++;
+			}
+		}
+
+		storedevice::sim::power_on();
+
+		{
+			ConfigStore configStore;
+			const auto nValue = get_counter(configStore);
+
+			if (isPowerFailed) {
+				check((nValue == (nBase + nInFlight)) || (nValue == (nBase + nInFlight - 1)), "old or new counter", nStep);
+			} else {
+				check(nValue == (nBase + WORKLOAD_UPDATES), "counter", nStep);
+			}
+
+			check(is_pattern(configStore), "pattern", nStep);
+
+			set_counter(configStore, 0xC0FFEE00 + nStep);
+		}
+
+		{
+			ConfigStore configStore;
+			check(get_counter(configStore) == (0xC0FFEE00 + nStep), "update after the power loss", nStep);
+			check(is_pattern(configStore), "pattern after the update", nStep);
+		}
+
+		if (!isPowerFailed) {
+			break;
+		}
+	}
+
+	check((nPoints[0] != 0) && (nPoints[1] != 0) && (nPoints[2] != 0), "power loss in every phase");
+
+	printf("sector %u kB, log %u updates, %u power loss points: spare bank erase %u, log and compaction %u, old bank erase %u\n",
+			SECTOR_SIZE / 1024U, nCycle, nStep, nPoints[0], nPoints[1], nPoints[2]);
+}
+
+/**
+ * The image of the old layout is at GetSize() - 4096, the snapshot location of the top bank.
+ * The old layout had a single sector, only parts with sectors up to 4 kB were supported.
+ */
+static void test_old_layout() {
+	if constexpr (SECTOR_SIZE > 4096) {
+		return;
+	}
+
+	auto *pFlash = storedevice::sim::get_flash();
+	memset(pFlash, 0xFF, SIZE);
+
+	auto *pImage = &pFlash[SIZE - 4096];
+	static constexpr uint8_t SIGNATURE[] = {'A', 'v', 'V', 0x01};
+	static constexpr uint32_t DMXSEND_OFFSET = 32 + 96;	///< The stores start at 32, Store::NETWORK is 96 bytes
+
+	memset(pImage, 0, 4096);
+	memcpy(pImage, SIGNATURE, sizeof(SIGNATURE));
+	memcpy(&pImage[DMXSEND_OFFSET + 4], s_Pattern, sizeof(s_Pattern));
+
+	// The old failsafe record was below the image, now the log of the top bank
+	memset(&pFlash[SIZE - 8192], 0x00, 512);
+
+	storedevice::sim::power_on();
+
+	{
+		ConfigStore configStore;
+		check(is_pattern(configStore), "old layout");
+		drain(configStore);
+	}
+
+	{
+		ConfigStore configStore;
+		check(is_pattern(configStore), "old layout after the compaction");
+		set_counter(configStore, 0x12345678);
+	}
+
+	{
+		ConfigStore configStore;
+		check(get_counter(configStore) == 0x12345678, "old layout update");
+		check(is_pattern(configStore), "old layout pattern after the update");
+	}
+
+	puts("old layout loaded");
+}
+
+int main() {
+	test_power_loss();
+	test_old_layout();
+
+	if (s_nFailed != 0) {
+		printf("%d failed\n", s_nFailed);
+		return 1;
+	}
+
+	puts("ok");
+	return 0;
+}
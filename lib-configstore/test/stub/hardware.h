@@ -0,0 +1,36 @@
+/**
+ * @file hardware.h
+ *
+ * Host stub
+ */
+
+#ifndef HARDWARE_H_
+#define HARDWARE_H_
+
+#include <cstdint>
+
+/**
+ * Simulated clock, every Millis() call is 1 ms later
+ */
+class Hardware {
+public:
+	uint32_t Millis() {
+		return m_nMillis++;
+	}
+
+	bool IsWatchdog() const {
+		return false;
+	}
+	void WatchdogInit() {}
+	void WatchdogStop() {}
+
+	static Hardware *Get() {
+		static Hardware s_Hardware;
+		return &s_Hardware;
+	}
+
+private:
+	uint32_t m_nMillis { 0 };
+};
+
+#endif /* HARDWARE_H_ */
@@ -0,0 +1,110 @@
+/**
+ * @file dmxanalyzer.h
+ *
+ */
+/* Copyright (C) 2024 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef DMXANALYZER_H_
+#define DMXANALYZER_H_
+
+#include <cstdint>
+
+/**
+ * DMX input line analyzer, all values are in microseconds.
+ */
+
+namespace dmx {
+namespace analyzer {
+enum class Metric {
+	BREAK, MAB, INTERSLOT, PERIOD, LAST
+};
+
+static constexpr uint32_t BUCKETS = 8;
+
+/**
+ * Upper bound (exclusive) of the first BUCKETS - 1 buckets, the last bucket is everything above.
+ */
+static constexpr uint32_t BUCKET_LIMITS[static_cast<uint32_t>(Metric::LAST)][BUCKETS - 1] = {
+		{ 88, 100, 120, 176, 500, 1000, 10000 },				///< BREAK: E1.11 receiver minimum is 88
+		{ 8, 12, 16, 24, 88, 1000, 10000 },						///< MAB: E1.11 receiver minimum is 8
+		{ 1, 2, 4, 8, 16, 32, 100 },							///< INTERSLOT: mean per frame
+		{ 1204, 10000, 22728, 25000, 33334, 100000, 1000000 }	///< PERIOD: BREAK to BREAK
+};
+
+static constexpr char METRIC_NAME[static_cast<uint32_t>(Metric::LAST)][10] = { "break", "mab", "interslot", "period" };
+
+struct Statistics {
+	uint64_t nSum;
+	uint32_t nCount;
+	uint32_t nMin;
+	uint32_t nMax;
+	uint32_t nBucket[BUCKETS];
+
+	void Reset() {
+		nSum = 0;
+		nCount = 0;
+		nMin = UINT32_MAX;
+		nMax = 0;
+
+		for (auto& nValue : nBucket) {
+			nValue = 0;
+		}
+	}
+
+	void Add(const uint32_t nValue, const Metric metric) {
+		nSum += nValue;
+		nCount++;
+
+		if (nValue < nMin) {
+			nMin = nValue;
+		}
+
+		if (nValue > nMax) {
+			nMax = nValue;
+		}
+
+		nBucket[GetBucket(nValue, metric)]++;
+	}
+
+	uint32_t GetMin() const {
+		return (nCount == 0) ? 0 : nMin;
+	}
+
+	uint32_t GetMean() const {
+		return (nCount == 0) ? 0 : static_cast<uint32_t>(nSum / nCount);
+	}
+
+	static uint32_t GetBucket(const uint32_t nValue, const Metric metric) {
+		const auto *pLimits = BUCKET_LIMITS[static_cast<uint32_t>(metric)];
+		uint32_t i = 0;
+
+		while ((i < (BUCKETS - 1)) && (nValue >= pLimits[i])) {
+			i++;
+		}
+
+		return i;
+	}
+};
+}  // namespace analyzer
+}  // namespace dmx
+
+#endif /* DMXANALYZER_H_ */
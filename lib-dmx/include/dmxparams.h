@@ -29,6 +29,7 @@
 #include <cstdint>
 
 #include "dmx.h"
+#include "dmxparamsconst.h"
 #include "configstore.h"
 
 namespace dmxsendparams {
@@ -49,6 +50,24 @@ struct Mask {
 	static constexpr uint32_t SLOTS_COUNT = (1U << 3);
 };
 
+/**
+ * Per port, a port without a setting uses the setting for all ports.
+ * nRefreshRate 0 is auto: the highest rate for the slots in the frame.
+ */
+struct PortParams {
+	uint32_t nSetList;		///< Mask bits per port
+	uint16_t nBreakTime[MAX_PORTS];
+	uint16_t nMabTime[MAX_PORTS];
+	uint16_t nRefreshRate[MAX_PORTS];
+	uint8_t nSlotsCount[MAX_PORTS];
+}__attribute__((packed));
+
+static_assert(sizeof(struct PortParams) <= 64, "struct PortParams is too large");
+
+static constexpr uint32_t port_mask(const uint32_t nMask, const uint32_t nPortIndex) {
+	return nMask << (nPortIndex * 4U);
+}
+
 static constexpr uint8_t rounddown_slots(uint16_t n) {
 	return static_cast<uint8_t>((n / 2U) - 1);
 }
@@ -68,6 +87,17 @@ public:
 	}
 };
 
+class StoreDmxSendPorts {
+public:
+	static void Update(const struct dmxsendparams::PortParams *pParams) {
+		ConfigStore::Get()->Update(configstore::Store::DMXSENDPORTS, pParams, sizeof(struct dmxsendparams::PortParams));
+	}
+
+	static void Copy(struct dmxsendparams::PortParams *pParams) {
+		ConfigStore::Get()->Copy(configstore::Store::DMXSENDPORTS, pParams, sizeof(struct dmxsendparams::PortParams));
+	}
+};
+
 class DmxParams {
 public:
 	DmxParams();
@@ -90,9 +120,14 @@ private:
     bool isMaskSet(uint32_t nMask) const  {
     	return (m_Params.nSetList & nMask) == nMask;
     }
+    bool isPortMaskSet(uint32_t nMask, uint32_t nPortIndex) const  {
+    	const auto nPortMask = dmxsendparams::port_mask(nMask, nPortIndex);
+    	return (m_PortParams.nSetList & nPortMask) == nPortMask;
+    }
 
 private:
     dmxsendparams::Params m_Params;
+    dmxsendparams::PortParams m_PortParams;
 };
 
 #endif /* DMXPARAMS_H_ */
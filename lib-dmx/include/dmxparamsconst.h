@@ -27,6 +27,12 @@
 #ifndef DMXPARAMSCONST_H_
 #define DMXPARAMSCONST_H_
 
+#include <cstdint>
+
+namespace dmxsendparams {
+static constexpr uint32_t MAX_PORTS = 8;
+}  // namespace dmxsendparams
+
 struct DmxParamsConst {
 	static const char FILE_NAME[];
 
@@ -34,6 +40,11 @@ struct DmxParamsConst {
 	static const char MAB_TIME[];
 	static const char REFRESH_RATE[];
 	static const char SLOTS_COUNT[];
+
+	static const char BREAK_TIME_PORT[dmxsendparams::MAX_PORTS][18];
+	static const char MAB_TIME_PORT[dmxsendparams::MAX_PORTS][16];
+	static const char REFRESH_RATE_PORT[dmxsendparams::MAX_PORTS][20];
+	static const char SLOTS_COUNT_PORT[dmxsendparams::MAX_PORTS][19];
 };
 
 #endif /* DMXPARAMSCONST_H_ */
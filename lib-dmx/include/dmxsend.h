@@ -138,10 +138,15 @@ public:
 
 	void Print() override {
 		puts("DMX Send");
-		printf(" Break time   : %u\n", static_cast<unsigned int>(Dmx::Get()->GetDmxBreakTime()));
-		printf(" MAB time     : %u\n", static_cast<unsigned int>(Dmx::Get()->GetDmxMabTime()));
-		printf(" Refresh rate : %u\n", static_cast<unsigned int>(1000000U / Dmx::Get()->GetDmxPeriodTime()));
-		printf(" Slots        : %u\n", Dmx::Get()->GetDmxSlots());
+
+		for (uint32_t nPortIndex = 0; nPortIndex < dmx::config::max::PORTS; nPortIndex++) {
+			printf(" Port %c: Break time %u, MAB time %u, Refresh rate %u, Slots %u\n",
+					static_cast<char>('A' + nPortIndex),
+					static_cast<unsigned int>(Dmx::Get()->GetDmxBreakTime(nPortIndex)),
+					static_cast<unsigned int>(Dmx::Get()->GetDmxMabTime(nPortIndex)),
+					static_cast<unsigned int>(1000000U / Dmx::Get()->GetDmxPeriodTime(nPortIndex)),
+					Dmx::Get()->GetDmxSlots(nPortIndex));
+		}
 	}
 
 private:
@@ -31,6 +31,9 @@
 #include "dmxconst.h"
 #include "dmx_config.h"
 #include "dmxstatistics.h"
+#if defined (CONFIG_DMX_RX_ANALYZER)
+# include "dmxanalyzer.h"
+#endif
 
 struct Statistics {
 	uint32_t nSlotsInPacket;
@@ -59,27 +62,53 @@ public:
 	void RdmSendRaw(const uint32_t nPortIndex, const uint8_t *pRdmData, uint32_t nLength);
 	void RdmSendDiscoveryRespondMessage(const uint32_t nPortIndex, const uint8_t *pRdmData, uint32_t nLength);
 
+	/**
+	 * The request is sent in between two DMX frames, the DMX output keeps running.
+	 * The response is read with RdmReceiveQueued, which returns nTag.
+	 * @return false when the port is not sending continuous DMX, use RdmSendRaw instead
+	 */
+	bool RdmSendRawQueued(const uint32_t nPortIndex, const uint8_t *pRdmData, uint32_t nLength, const uint32_t nTag);
+	uint32_t GetRdmQueueDepth(const uint32_t nPortIndex) const;
+
 	// RDM Receive
 
 	const uint8_t *RdmReceive(const uint32_t nPortIndex);
+	const uint8_t *RdmReceiveQueued(const uint32_t nPortIndex, uint32_t& nTag);
 	const uint8_t *RdmReceiveTimeOut(const uint32_t nPortIndex, uint16_t nTimeOut);
 
 	// DMX Send
 
-	void SetDmxBreakTime(uint32_t nBreakTime);
-	uint32_t GetDmxBreakTime() const;
+	/**
+	 * Output timing per port, the set functions without nPortIndex are for all ports.
+	 * nPeriodTime is BREAK to BREAK, 0 is auto: the shortest period for the slots in the frame.
+	 */
+	void SetDmxBreakTime(const uint32_t nPortIndex, const uint32_t nBreakTime);
+	uint32_t GetDmxBreakTime(const uint32_t nPortIndex) const;
+	void SetDmxBreakTime(const uint32_t nBreakTime);
+	uint32_t GetDmxBreakTime() const {
+		return GetDmxBreakTime(0);
+	}
 
-	void SetDmxMabTime(uint32_t nMabTime);
-	uint32_t GetDmxMabTime() const;
+	void SetDmxMabTime(const uint32_t nPortIndex, const uint32_t nMabTime);
+	uint32_t GetDmxMabTime(const uint32_t nPortIndex) const;
+	void SetDmxMabTime(const uint32_t nMabTime);
+	uint32_t GetDmxMabTime() const {
+		return GetDmxMabTime(0);
+	}
 
-	void SetDmxPeriodTime(uint32_t nPeriodTime);
+	void SetDmxPeriodTime(const uint32_t nPortIndex, const uint32_t nPeriodTime);
+	uint32_t GetDmxPeriodTime(const uint32_t nPortIndex) const;
+	uint32_t GetDmxPeriodTimeRequested(const uint32_t nPortIndex) const;
+	void SetDmxPeriodTime(const uint32_t nPeriodTime);
 	uint32_t GetDmxPeriodTime() const {
-		return m_nDmxTransmitPeriod;
+		return GetDmxPeriodTime(0);
 	}
 
-	void SetDmxSlots(uint16_t nSlots = dmx::max::CHANNELS);
+	void SetDmxSlots(const uint32_t nPortIndex, const uint16_t nSlots);
+	uint16_t GetDmxSlots(const uint32_t nPortIndex) const;
+	void SetDmxSlots(const uint16_t nSlots = dmx::max::CHANNELS);
 	uint16_t GetDmxSlots() const {
-		return m_nDmxTransmitSlots;
+		return GetDmxSlots(0);
 	}
 
 	void SetSendData(const uint32_t nPortIndex, const uint8_t *pData, uint32_t nLength);
@@ -91,6 +120,12 @@ public:
 	void SetOutputStyle(const uint32_t nPortIndex, const dmx::OutputStyle outputStyle);
 	dmx::OutputStyle GetOutputStyle(const uint32_t nPortIndex) const;
 
+	/**
+	 * Measured: DMX frames per second and the last BREAK to BREAK time
+	 */
+	uint32_t GetDmxRefreshRate(const uint32_t nPortIndex) const;
+	uint32_t GetDmxPeriodTimeMeasured(const uint32_t nPortIndex) const;
+
 	void Blackout();
 	void FullOn();
 
@@ -101,6 +136,18 @@ public:
 	const uint8_t *GetDmxCurrentData(const uint32_t nPortIndex);
 
 	uint32_t GetDmxUpdatesPerSecond(const uint32_t nPortIndex);
+	/**
+	 * USART interrupts per second, one per byte or (CONFIG_DMX_RX_DMA) one or two per frame
+	 */
+	uint32_t GetRxIrqsPerSecond(const uint32_t nPortIndex);
+
+#if defined (CONFIG_DMX_RX_ANALYZER)
+	/**
+	 * BREAK, MAB, inter-slot and BREAK to BREAK timing of the input port
+	 */
+	void GetRxAnalyzer(const uint32_t nPortIndex, const dmx::analyzer::Metric metric, dmx::analyzer::Statistics& statistics);
+	void ResetRxAnalyzer(const uint32_t nPortIndex);
+#endif
 
 	static Dmx* Get() {
 		return s_pThis;
@@ -112,10 +159,7 @@ private:
 	void StartDmxOutput(const uint32_t nPortIndex);
 
 private:
-	uint32_t m_nDmxTransmitPeriod { dmx::transmit::PERIOD_DEFAULT };
-	uint32_t m_nDmxTransmitPeriodRequested { dmx::transmit::PERIOD_DEFAULT };
 	uint32_t m_nDmxTransmissionLength[dmx::config::max::PORTS];
-	uint32_t m_nDmxTransmitSlots { dmx::max::CHANNELS };
 	dmx::PortDirection m_dmxPortDirection[dmx::config::max::PORTS];
 	bool m_bHasContinuosOutput { false };
 
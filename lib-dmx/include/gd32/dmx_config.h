@@ -70,6 +70,9 @@ namespace dmx {
 namespace buffer {
 static constexpr auto SIZE = 516;	// multiple of uint32_t
 }  // namespace buffer
+namespace rdm {
+static constexpr uint32_t QUEUE_SIZE = 4;	// power of 2
+}  // namespace rdm
 }  // namespace dmx
 
 #if defined(GD32F10X_HD) || defined (GD32F10X_CL)
@@ -106,4 +109,58 @@ static constexpr auto SIZE = 516;	// multiple of uint32_t
 # endif
 #endif
 
+/**
+ * DMX/RDM receive with DMA
+ */
+#if defined (CONFIG_DMX_RX_DMA)
+# if !defined (GD32F4XX)
+#  error CONFIG_DMX_RX_DMA is GD32F4XX only
+# endif
+# if defined (CONFIG_DMX_TRANSMIT_ONLY)
+#  error CONFIG_DMX_RX_DMA and CONFIG_DMX_TRANSMIT_ONLY
+# endif
+# if defined (DMX_USE_USART2) && defined (DMX_USE_UART6)
+#  error DMA0 Channel 1 and DMA0 Channel 3
+# endif
+# if defined (DMX_USE_UART4) && defined (DMX_USE_UART7)
+#  error DMA0 Channel 0
+# endif
+# if defined (DMX_USE_USART1) && defined (DMX_USE_UART7)
+#  error DMA0 Channel 6
+# endif
+#endif
+
+/**
+ * DMX input line analyzer, EXTI on the RX pin
+ */
+#if defined (CONFIG_DMX_RX_ANALYZER)
+# if !defined (GD32F4XX)
+#  error CONFIG_DMX_RX_ANALYZER is GD32F4XX only
+# endif
+# if defined (CONFIG_DMX_TRANSMIT_ONLY)
+#  error CONFIG_DMX_RX_ANALYZER and CONFIG_DMX_TRANSMIT_ONLY
+# endif
+# if defined (DMX_USE_UART7)
+#  error UART7 RX is EXTI line 0
+# endif
+# if defined (DMX_USE_USART0) && defined (USART0_REMAP) && defined (DMX_USE_USART5) && !defined (USART5_REMAP)
+#  error USART0 and USART5 RX are EXTI line 7
+# endif
+# if defined (DMX_USE_USART0) && defined (USART0_REMAP) && defined (DMX_USE_UART6) && !defined (UART6_REMAP)
+#  error USART0 and UART6 RX are EXTI line 7
+# endif
+# if defined (DMX_USE_USART5) && !defined (USART5_REMAP) && defined (DMX_USE_UART6) && !defined (UART6_REMAP)
+#  error USART5 and UART6 RX are EXTI line 7
+# endif
+# if defined (DMX_USE_USART1) && defined (USART1_REMAP) && defined (DMX_USE_UART6) && defined (UART6_REMAP)
+#  error USART1 and UART6 RX are EXTI line 6
+# endif
+# if defined (DMX_USE_USART2) && defined (USART2_FULL_REMAP) && defined (DMX_USE_USART5) && defined (USART5_REMAP)
+#  error USART2 and USART5 RX are EXTI line 9
+# endif
+# if defined (DMX_USE_USART2) && !defined (USART2_FULL_REMAP) && defined (DMX_USE_UART3) && !defined (UART3_REMAP)
+#  error USART2 and UART3 RX are EXTI line 11
+# endif
+#endif
+
 #endif /* GD32_DMX_CONFIG_H_ */
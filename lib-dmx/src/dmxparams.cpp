@@ -46,6 +46,8 @@
 
 #include "debug.h"
 
+static_assert(dmx::config::max::PORTS <= dmxsendparams::MAX_PORTS, "nSetList has 4 mask bits per port for MAX_PORTS ports");
+
 DmxParams::DmxParams() {
 	m_Params.nSetList = 0;
 	m_Params.nBreakTime = dmx::transmit::BREAK_TIME_TYPICAL;
@@ -53,6 +55,15 @@ DmxParams::DmxParams() {
 	m_Params.nRefreshRate = dmx::transmit::REFRESH_RATE_DEFAULT;
 	m_Params.nSlotsCount = dmxsendparams::rounddown_slots(dmx::max::CHANNELS);
 
+	m_PortParams.nSetList = 0;
+
+	for (uint32_t nPortIndex = 0; nPortIndex < dmxsendparams::MAX_PORTS; nPortIndex++) {
+		m_PortParams.nBreakTime[nPortIndex] = dmx::transmit::BREAK_TIME_TYPICAL;
+		m_PortParams.nMabTime[nPortIndex] = dmx::transmit::MAB_TIME_MIN;
+		m_PortParams.nRefreshRate[nPortIndex] = dmx::transmit::REFRESH_RATE_DEFAULT;
+		m_PortParams.nSlotsCount[nPortIndex] = dmxsendparams::rounddown_slots(dmx::max::CHANNELS);
+	}
+
 	DEBUG_PRINTF("m_Params.nSlotsCount=%d", m_Params.nSlotsCount);
 }
 
@@ -60,15 +71,20 @@ void DmxParams::Load() {
 	DEBUG_ENTRY
 
 	m_Params.nSetList = 0;
+	m_PortParams.nSetList = 0;
 
 #if !defined(DISABLE_FS)
 	ReadConfigFile configfile(DmxParams::staticCallbackFunction, this);
 
 	if (configfile.Read(DmxParamsConst::FILE_NAME)) {
 		StoreDmxSend::Update(&m_Params);
+		StoreDmxSendPorts::Update(&m_PortParams);
 	} else
 #endif
+	{
 		StoreDmxSend::Copy(&m_Params);
+		StoreDmxSendPorts::Copy(&m_PortParams);
+	}
 
 #ifndef NDEBUG
 	Dump();
@@ -83,12 +99,14 @@ void DmxParams::Load(const char* pBuffer, uint32_t nLength) {
 	assert(nLength != 0);
 
 	m_Params.nSetList = 0;
+	m_PortParams.nSetList = 0;
 
 	ReadConfigFile config(DmxParams::staticCallbackFunction, this);
 
 	config.Read(pBuffer, nLength);
 
 	StoreDmxSend::Update(&m_Params);
+	StoreDmxSendPorts::Update(&m_PortParams);
 
 #ifndef NDEBUG
 	Dump();
@@ -146,6 +164,47 @@ void DmxParams::callbackFunction(const char *pLine) {
 		}
 		return;
 	}
+
+	for (uint32_t nPortIndex = 0; nPortIndex < dmxsendparams::MAX_PORTS; nPortIndex++) {
+		if (Sscan::Uint16(pLine, DmxParamsConst::BREAK_TIME_PORT[nPortIndex], nValue16) == Sscan::OK) {
+			if (nValue16 >= dmx::transmit::BREAK_TIME_MIN) {
+				m_PortParams.nBreakTime[nPortIndex] = nValue16;
+				m_PortParams.nSetList |= dmxsendparams::port_mask(dmxsendparams::Mask::BREAK_TIME, nPortIndex);
+			} else {
+				m_PortParams.nBreakTime[nPortIndex] = dmx::transmit::BREAK_TIME_TYPICAL;
+				m_PortParams.nSetList &= ~dmxsendparams::port_mask(dmxsendparams::Mask::BREAK_TIME, nPortIndex);
+			}
+			return;
+		}
+
+		if (Sscan::Uint16(pLine, DmxParamsConst::MAB_TIME_PORT[nPortIndex], nValue16) == Sscan::OK) {
+			if (nValue16 >= dmx::transmit::MAB_TIME_MIN) {
+				m_PortParams.nMabTime[nPortIndex] = nValue16;
+				m_PortParams.nSetList |= dmxsendparams::port_mask(dmxsendparams::Mask::MAB_TIME, nPortIndex);
+			} else {
+				m_PortParams.nMabTime[nPortIndex] = dmx::transmit::MAB_TIME_MIN;
+				m_PortParams.nSetList &= ~dmxsendparams::port_mask(dmxsendparams::Mask::MAB_TIME, nPortIndex);
+			}
+			return;
+		}
+
+		if (Sscan::Uint16(pLine, DmxParamsConst::REFRESH_RATE_PORT[nPortIndex], nValue16) == Sscan::OK) {
+			m_PortParams.nRefreshRate[nPortIndex] = nValue16;
+			m_PortParams.nSetList |= dmxsendparams::port_mask(dmxsendparams::Mask::REFRESH_RATE, nPortIndex);
+			return;
+		}
+
+		if (Sscan::Uint16(pLine, DmxParamsConst::SLOTS_COUNT_PORT[nPortIndex], nValue16) == Sscan::OK) {
+			if ((nValue16 >= 2) && (nValue16 <= dmx::max::CHANNELS)) {
+				m_PortParams.nSlotsCount[nPortIndex] = dmxsendparams::rounddown_slots(nValue16);
+				m_PortParams.nSetList |= dmxsendparams::port_mask(dmxsendparams::Mask::SLOTS_COUNT, nPortIndex);
+			} else {
+				m_PortParams.nSlotsCount[nPortIndex] = dmxsendparams::rounddown_slots(dmx::max::CHANNELS);
+				m_PortParams.nSetList &= ~dmxsendparams::port_mask(dmxsendparams::Mask::SLOTS_COUNT, nPortIndex);
+			}
+			return;
+		}
+	}
 }
 
 void DmxParams::Builder(const struct dmxsendparams::Params *ptDMXParams, char *pBuffer, uint32_t nLength, uint32_t& nSize) {
@@ -159,6 +218,8 @@ void DmxParams::Builder(const struct dmxsendparams::Params *ptDMXParams, char *p
 		StoreDmxSend::Copy(&m_Params);
 	}
 
+	StoreDmxSendPorts::Copy(&m_PortParams);
+
 	PropertiesBuilder builder(DmxParamsConst::FILE_NAME, pBuffer, nLength);
 
 	builder.Add(DmxParamsConst::BREAK_TIME, m_Params.nBreakTime, isMaskSet(dmxsendparams::Mask::BREAK_TIME));
@@ -166,6 +227,13 @@ void DmxParams::Builder(const struct dmxsendparams::Params *ptDMXParams, char *p
 	builder.Add(DmxParamsConst::REFRESH_RATE, m_Params.nRefreshRate, isMaskSet(dmxsendparams::Mask::REFRESH_RATE));
 	builder.Add(DmxParamsConst::SLOTS_COUNT, dmxsendparams::roundup_slots(m_Params.nSlotsCount), isMaskSet(dmxsendparams::Mask::SLOTS_COUNT));
 
+	for (uint32_t nPortIndex = 0; nPortIndex < dmx::config::max::PORTS; nPortIndex++) {
+		builder.Add(DmxParamsConst::BREAK_TIME_PORT[nPortIndex], m_PortParams.nBreakTime[nPortIndex], isPortMaskSet(dmxsendparams::Mask::BREAK_TIME, nPortIndex));
+		builder.Add(DmxParamsConst::MAB_TIME_PORT[nPortIndex], m_PortParams.nMabTime[nPortIndex], isPortMaskSet(dmxsendparams::Mask::MAB_TIME, nPortIndex));
+		builder.Add(DmxParamsConst::REFRESH_RATE_PORT[nPortIndex], m_PortParams.nRefreshRate[nPortIndex], isPortMaskSet(dmxsendparams::Mask::REFRESH_RATE, nPortIndex));
+		builder.Add(DmxParamsConst::SLOTS_COUNT_PORT[nPortIndex], dmxsendparams::roundup_slots(m_PortParams.nSlotsCount[nPortIndex]), isPortMaskSet(dmxsendparams::Mask::SLOTS_COUNT, nPortIndex));
+	}
+
 	nSize = builder.GetSize();
 
 	DEBUG_PRINTF("nSize=%d", nSize);
@@ -194,6 +262,28 @@ void DmxParams::Set(Dmx *p) {
 	if (isMaskSet(dmxsendparams::Mask::SLOTS_COUNT)) {
 		p->SetDmxSlots(dmxsendparams::roundup_slots(m_Params.nSlotsCount));
 	}
+
+	for (uint32_t nPortIndex = 0; nPortIndex < dmx::config::max::PORTS; nPortIndex++) {
+		if (isPortMaskSet(dmxsendparams::Mask::BREAK_TIME, nPortIndex)) {
+			p->SetDmxBreakTime(nPortIndex, m_PortParams.nBreakTime[nPortIndex]);
+		}
+
+		if (isPortMaskSet(dmxsendparams::Mask::MAB_TIME, nPortIndex)) {
+			p->SetDmxMabTime(nPortIndex, m_PortParams.nMabTime[nPortIndex]);
+		}
+
+		if (isPortMaskSet(dmxsendparams::Mask::REFRESH_RATE, nPortIndex)) {
+			uint32_t period = 0;
+			if (m_PortParams.nRefreshRate[nPortIndex] != 0) {
+				period = 1000000U / m_PortParams.nRefreshRate[nPortIndex];
+			}
+			p->SetDmxPeriodTime(nPortIndex, period);
+		}
+
+		if (isPortMaskSet(dmxsendparams::Mask::SLOTS_COUNT, nPortIndex)) {
+			p->SetDmxSlots(nPortIndex, dmxsendparams::roundup_slots(m_PortParams.nSlotsCount[nPortIndex]));
+		}
+	}
 }
 
 void DmxParams::staticCallbackFunction(void *p, const char *s) {
@@ -221,4 +311,22 @@ void DmxParams::Dump() {
 	if (isMaskSet(dmxsendparams::Mask::SLOTS_COUNT)) {
 		printf(" %s=%d [%d]\n", DmxParamsConst::SLOTS_COUNT, m_Params.nSlotsCount, dmxsendparams::roundup_slots(m_Params.nSlotsCount));
 	}
+
+	for (uint32_t nPortIndex = 0; nPortIndex < dmxsendparams::MAX_PORTS; nPortIndex++) {
+		if (isPortMaskSet(dmxsendparams::Mask::BREAK_TIME, nPortIndex)) {
+			printf(" %s=%d\n", DmxParamsConst::BREAK_TIME_PORT[nPortIndex], m_PortParams.nBreakTime[nPortIndex]);
+		}
+
+		if (isPortMaskSet(dmxsendparams::Mask::MAB_TIME, nPortIndex)) {
+			printf(" %s=%d\n", DmxParamsConst::MAB_TIME_PORT[nPortIndex], m_PortParams.nMabTime[nPortIndex]);
+		}
+
+		if (isPortMaskSet(dmxsendparams::Mask::REFRESH_RATE, nPortIndex)) {
+			printf(" %s=%d\n", DmxParamsConst::REFRESH_RATE_PORT[nPortIndex], m_PortParams.nRefreshRate[nPortIndex]);
+		}
+
+		if (isPortMaskSet(dmxsendparams::Mask::SLOTS_COUNT, nPortIndex)) {
+			printf(" %s=%d [%d]\n", DmxParamsConst::SLOTS_COUNT_PORT[nPortIndex], m_PortParams.nSlotsCount[nPortIndex], dmxsendparams::roundup_slots(m_PortParams.nSlotsCount[nPortIndex]));
+		}
+	}
 }
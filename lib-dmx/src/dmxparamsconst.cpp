@@ -32,3 +32,47 @@ const char DmxParamsConst::BREAK_TIME[] = "break_time";
 const char DmxParamsConst::MAB_TIME[] = "mab_time";
 const char DmxParamsConst::REFRESH_RATE[] = "refresh_rate";
 const char DmxParamsConst::SLOTS_COUNT[] = "slots_count";
+
+const char DmxParamsConst::BREAK_TIME_PORT[dmxsendparams::MAX_PORTS][18] = {
+		"break_time_port_a",
+		"break_time_port_b",
+		"break_time_port_c",
+		"break_time_port_d",
+		"break_time_port_e",
+		"break_time_port_f",
+		"break_time_port_g",
+		"break_time_port_h"
+};
+
+const char DmxParamsConst::MAB_TIME_PORT[dmxsendparams::MAX_PORTS][16] = {
+		"mab_time_port_a",
+		"mab_time_port_b",
+		"mab_time_port_c",
+		"mab_time_port_d",
+		"mab_time_port_e",
+		"mab_time_port_f",
+		"mab_time_port_g",
+		"mab_time_port_h"
+};
+
+const char DmxParamsConst::REFRESH_RATE_PORT[dmxsendparams::MAX_PORTS][20] = {
+		"refresh_rate_port_a",
+		"refresh_rate_port_b",
+		"refresh_rate_port_c",
+		"refresh_rate_port_d",
+		"refresh_rate_port_e",
+		"refresh_rate_port_f",
+		"refresh_rate_port_g",
+		"refresh_rate_port_h"
+};
+
+const char DmxParamsConst::SLOTS_COUNT_PORT[dmxsendparams::MAX_PORTS][19] = {
+		"slots_count_port_a",
+		"slots_count_port_b",
+		"slots_count_port_c",
+		"slots_count_port_d",
+		"slots_count_port_e",
+		"slots_count_port_f",
+		"slots_count_port_g",
+		"slots_count_port_h"
+};
@@ -55,7 +55,7 @@ extern struct HwTimersSeconds g_Seconds;
 
 namespace dmx {
 enum class TxRxState {
-	IDLE, BREAK, MAB, DMXDATA, DMXINTER, RDMDATA, CHECKSUMH, CHECKSUML, RDMDISC
+	IDLE, BREAK, MAB, DMXDATA, DMXINTER, RDMDATA, CHECKSUMH, CHECKSUML, RDMDISC, RDMWAIT
 };
 
 enum class PortState {
@@ -65,27 +65,74 @@ enum class PortState {
 struct TxDmxPacket {
 	uint8_t data[dmx::buffer::SIZE];	// multiple of uint32_t
 	uint32_t nLength;
-	bool bDataPending;
 };
 
+/*
+ * Ping-pong buffers. The DMA transmits dmx[nFront], the writer fills dmx[nFront ^ 1].
+ * The buffers are swapped in the TIMER IRQ at the end of the BREAK, so a frame is never
+ * updated while it is being transmitted.
+ */
 struct TxData {
-	TxDmxPacket dmx;
+	TxDmxPacket dmx[2];
+	volatile uint32_t nFront;
+	volatile bool bSwapPending;
+	bool bDataPending;
 	OutputStyle outputStyle ALIGNED;
 	volatile TxRxState State;
 };
 
+/*
+ * Output timing per port, each port has its own TIMER compare channel.
+ */
 struct DmxTransmit {
 	uint32_t nBreakTime;
 	uint32_t nMabTime;
-	uint32_t nInterTime;
+	uint32_t nPeriod;			///< BREAK to BREAK
+	uint32_t nPeriodRequested;	///< 0 is auto: the shortest period for the slots in the frame
+	uint32_t nSlots;
+};
+
+struct TxPeriod {
+	uint32_t nBreakStart;		///< TIMER counter at the start of the last DMX BREAK
+	uint32_t nMeasured;			///< BREAK to BREAK of the last two DMX frames
 };
 
-struct RxDmxPackets {
+struct DmxPackets {
 	uint32_t nPerSecond;
 	uint32_t nCount;
 	uint32_t nCountPrevious;
 };
 
+/*
+ * RDM requests for a port which is sending continuous DMX.
+ * The main loop writes request[nHead], the TIMER IRQ sends request[nTail] in between two DMX frames.
+ * There is one response buffer per port: the next request is sent when the response has been read
+ * with RdmReceiveQueued.
+ */
+struct RdmRequest {
+	uint8_t data[sizeof(struct TRdmMessage)] ALIGNED;
+	uint32_t nLength;
+	uint32_t nTag;		///< Identifies the requester, returned with the response
+	bool bExpectResponse;
+};
+
+struct RdmQueue {
+	RdmRequest request[dmx::rdm::QUEUE_SIZE];
+	volatile uint32_t nHead;
+	volatile uint32_t nTail;
+	uint32_t nWaitTime;
+	uint32_t nResponseTag;
+	volatile bool bResponsePending;	///< The response for nResponseTag is not read yet
+	bool bActive;	///< The current frame is request[nTail]
+};
+
+namespace rdm {
+static constexpr uint32_t RESPONSE_POLL_TIME = 400;		///< us
+static constexpr uint32_t RESPONSE_LOST_TIME = 2800;	///< E1.20 Table 3-2, the response has not started
+static constexpr uint32_t RESPONSE_MAX_TIME = RESPONSE_LOST_TIME + ((sizeof(struct TRdmMessage) + 1) * 44);
+static constexpr uint32_t PACKET_SPACING = 176;			///< E1.20 Table 3-3, end of response -> next BREAK
+}  // namespace rdm
+
 struct RxDmxData {
 	uint8_t data[dmx::buffer::SIZE] ALIGNED;	// multiple of uint32_t
 	uint32_t nSlotsInPacket;
@@ -144,7 +191,8 @@ static volatile dmx::TotalStatistics sv_TotalStatistics[dmx::config::max::PORTS]
 
 // DMX RX
 
-static volatile RxDmxPackets sv_nRxDmxPackets[dmx::config::max::PORTS] ALIGNED;
+static volatile DmxPackets sv_nRxDmxPackets[dmx::config::max::PORTS] ALIGNED;
+static volatile DmxPackets sv_nRxIrqs[dmx::config::max::PORTS] ALIGNED;
 
 // RDM RX
 volatile uint32_t gsv_RdmDataReceiveEnd;
@@ -153,13 +201,399 @@ volatile uint32_t gsv_RdmDataReceiveEnd;
 
 static RxData sv_RxBuffer[dmx::config::max::PORTS] ALIGNED;
 
+#if defined (CONFIG_DMX_RX_DMA)
+struct RxDmaData {
+	uint8_t data[dmx::buffer::SIZE] ALIGNED;	// multiple of uint32_t
+};
+
+static RxDmaData s_RxDma[dmx::config::max::PORTS] ALIGNED SECTION_DMA_BUFFER;
+
+/*
+ * No more DMA requests and error interrupts, the USART is back in byte mode.
+ */
+static void rx_dma_stop(const uint32_t nUart) {
+	USART_CTL2(nUart) &= ~(USART_CTL2_DENR | USART_CTL2_ERRIE);
+}
+#endif
+
 // DMX TX
 
 static TxData s_TxBuffer[dmx::config::max::PORTS] ALIGNED SECTION_DMA_BUFFER;
-static DmxTransmit s_nDmxTransmit;
+static DmxTransmit s_DmxTransmit[dmx::config::max::PORTS];
+static volatile TxPeriod sv_TxPeriod[dmx::config::max::PORTS];
+static volatile DmxPackets sv_nTxDmxPackets[dmx::config::max::PORTS] ALIGNED;
+
+// The GD32F4xx/GD32H7XX Timer 1 and Timer 4 have a 32-bit counter
+#if defined(GD32F4XX) || defined (GD32H7XX)
+static constexpr uint32_t TX_TIMER_MASK = UINT32_MAX;
+#else
+static constexpr uint32_t TX_TIMER_MASK = UINT16_MAX;
+#endif
+
+// RDM TX
+
+static RdmQueue s_RdmQueue[dmx::config::max::PORTS] ALIGNED SECTION_DMA_BUFFER;
+
+/*
+ * Main loop: get the back buffer. A pending swap is cancelled, so the IRQ cannot swap while writing.
+ */
+static TxDmxPacket& tx_back_begin(TxData& txData) {
+	txData.bSwapPending = false;
+	__DMB();
+	return txData.dmx[txData.nFront ^ 1];
+}
+
+static void tx_back_end(TxData& txData) {
+	__DMB();
+	txData.bSwapPending = true;
+}
+
+/*
+ * TIMER IRQ: the DMA is not running
+ */
+static void tx_swap(TxData& txData) {
+	if (txData.bSwapPending) {
+		txData.nFront = txData.nFront ^ 1;
+		txData.bSwapPending = false;
+	}
+}
+
+/*
+ * A DMX BREAK is started, the next BREAK is scheduled relative to this one.
+ */
+template<uint32_t nPortIndex, uint32_t nTimer>
+static void tx_break_start(const bool bMeasure) {
+	auto& txPeriod = sv_TxPeriod[nPortIndex];
+	const auto nNow = TIMER_CNT(nTimer);
+
+	if (bMeasure) {
+		txPeriod.nMeasured = (nNow - txPeriod.nBreakStart) & TX_TIMER_MASK;
+	}
+
+	txPeriod.nBreakStart = nNow;
+}
+
+/*
+ * TIMER IRQ: DMXINTER -> BREAK.
+ * A queued RDM request takes the place of every other DMX frame.
+ */
+template<uint32_t nPortIndex, uint32_t nTimer>
+static uint32_t tx_break_time() {
+	auto& queue = s_RdmQueue[nPortIndex];
+
+	queue.bActive = !queue.bActive && (queue.nHead != queue.nTail) && !queue.bResponsePending;
+
+	if (queue.bActive) {
+		return RDM_TRANSMIT_BREAK_TIME;
+	}
+
+	tx_break_start<nPortIndex, nTimer>(true);
+	return s_DmxTransmit[nPortIndex].nBreakTime;
+}
+
+/*
+ * TIMER IRQ: BREAK -> MAB
+ */
+template<uint32_t nPortIndex>
+static uint32_t tx_mab_time() {
+	if (s_RdmQueue[nPortIndex].bActive) {
+		return RDM_TRANSMIT_MAB_TIME;
+	}
+
+	tx_swap(s_TxBuffer[nPortIndex]);
+	return s_DmxTransmit[nPortIndex].nMabTime;
+}
+
+/*
+ * TIMER IRQ: MAB -> DMA
+ */
+template<uint32_t nPortIndex>
+static const uint8_t *tx_frame(uint32_t& nLength) {
+	const auto& queue = s_RdmQueue[nPortIndex];
+
+	if (queue.bActive) {
+		const auto& request = queue.request[queue.nTail & (dmx::rdm::QUEUE_SIZE - 1)];
+		nLength = request.nLength;
+		return request.data;
+	}
+
+	const auto& packet = s_TxBuffer[nPortIndex].dmx[s_TxBuffer[nPortIndex].nFront];
+	nLength = packet.nLength;
+	return packet.data;
+}
+
+/*
+ * DMA IRQ: time until the next BREAK.
+ * The deadline is relative to the start of the BREAK, so the period does not depend on
+ * the slot count or the interrupt latency. The last 2 slots are still in the USART.
+ */
+template<uint32_t nPortIndex, uint32_t nTimer>
+static uint32_t tx_inter_time() {
+	const auto nElapsed = (TIMER_CNT(nTimer) - sv_TxPeriod[nPortIndex].nBreakStart) & TX_TIMER_MASK;
+	const auto nPeriod = s_DmxTransmit[nPortIndex].nPeriod;
+
+	if ((nElapsed + (2 * 44U)) >= nPeriod) {
+		return 2 * 44U;
+	}
+
+	return nPeriod - nElapsed;
+}
+
+/*
+ * DMA IRQ: all slots are written to the USART.
+ */
+template<uint32_t nPortIndex, uint32_t nTimer, uint16_t nTimerChannel>
+static void tx_dma_complete() {
+	auto& txBuffer = s_TxBuffer[nPortIndex];
+
+	if (s_RdmQueue[nPortIndex].bActive) {
+		timer_channel_output_pulse_value_config(nTimer, nTimerChannel, TIMER_CNT(nTimer) + 44U);
+		txBuffer.State = TxRxState::RDMDATA;
+#if !defined (CONFIG_DMX_DISABLE_STATISTICS)
+		sv_TotalStatistics[nPortIndex].Rdm.Sent.Class++;
+#endif
+		return;
+	}
+
+	if (txBuffer.outputStyle == dmx::OutputStyle::DELTA) {
+		txBuffer.State = TxRxState::IDLE;
+	} else {
+		timer_channel_output_pulse_value_config(nTimer, nTimerChannel, TIMER_CNT(nTimer) + tx_inter_time<nPortIndex, nTimer>());
+		txBuffer.State = TxRxState::DMXINTER;
+	}
+
+	sv_nTxDmxPackets[nPortIndex].nCount++;
+#if !defined (CONFIG_DMX_DISABLE_STATISTICS)
+	sv_TotalStatistics[nPortIndex].Dmx.Sent++;
+#endif
+}
+
+/*
+ * TIMER IRQ: RDMDATA -> RDMWAIT -> DMXINTER
+ * RDMDATA: wait for the last slot, then turn the line around for the response.
+ * RDMWAIT: the response is collected by the USART IRQ.
+ * @return the time until the next compare
+ */
+template<uint32_t nPortIndex, uint32_t nUart>
+static uint32_t rdm_tx_timer() {
+	auto& txBuffer = s_TxBuffer[nPortIndex];
+	auto& queue = s_RdmQueue[nPortIndex];
+	auto& rxBuffer = sv_RxBuffer[nPortIndex];
+	const auto& request = queue.request[queue.nTail & (dmx::rdm::QUEUE_SIZE - 1)];
+
+	if (txBuffer.State == TxRxState::RDMDATA) {
+		if (!gd32_usart_flag_get<USART_FLAG_TC>(nUart)) {
+			return 44U;
+		}
+
+		if (request.bExpectResponse) {
+			rxBuffer.Rdm.nIndex = 0;
+			rxBuffer.State = TxRxState::IDLE;
+			GPIO_BC(s_DirGpio[nPortIndex].nPort) = s_DirGpio[nPortIndex].nPin;
+			static_cast<void>(GET_BITS(USART_RDATA(nUart), 0U, 8U));
+			gd32_usart_interrupt_enable<USART_INT_RBNE>(nUart);
+
+			queue.nWaitTime = 0;
+			txBuffer.State = TxRxState::RDMWAIT;
+			return dmx::rdm::RESPONSE_POLL_TIME;
+		}
+	} else {
+		queue.nWaitTime += dmx::rdm::RESPONSE_POLL_TIME;
+
+		if ((rxBuffer.Rdm.nIndex & 0x4000) != 0x4000) {
+			const auto isReceiving = (rxBuffer.State != TxRxState::IDLE);
+
+			if ((queue.nWaitTime < dmx::rdm::RESPONSE_LOST_TIME) || (isReceiving && (queue.nWaitTime < dmx::rdm::RESPONSE_MAX_TIME))) {
+				return dmx::rdm::RESPONSE_POLL_TIME;
+			}
+
+			rxBuffer.State = TxRxState::IDLE;
+		} else {
+			queue.nResponseTag = request.nTag;
+			queue.bResponsePending = true;
+		}
+
+		gd32_usart_interrupt_disable<USART_INT_RBNE>(nUart);
+#if defined (CONFIG_DMX_RX_DMA)
+		gd32_usart_interrupt_disable<USART_INT_FLAG_IDLE>(nUart);
+		rx_dma_stop(nUart);
+#endif
+		GPIO_BOP(s_DirGpio[nPortIndex].nPort) = s_DirGpio[nPortIndex].nPin;
+	}
+
+	queue.nTail = queue.nTail + 1;
+	txBuffer.State = TxRxState::DMXINTER;
+	return dmx::rdm::PACKET_SPACING;
+}
+
+#if defined (CONFIG_DMX_RX_ANALYZER)
+/*
+ * DMX input line analyzer.
+ * The BREAK is detected by the USART (frame error) after 9.5 bit times, the EXTI on the RX pin
+ * then takes the rising edge (end of BREAK) and the falling edge (end of MAB). The inter-slot time is
+ * the mean of the frame and is computed when the IDLE line closes the frame.
+ * Per frame there are 2 EXTI interrupts, there is no per slot cost.
+ */
+namespace dmx {
+namespace analyzer {
+enum class State {
+	IDLE, BREAK, MAB, DATA
+};
+
+static constexpr uint32_t CYCLES_PER_US = MCU_CLOCK_FREQ / 1000000U;
+static constexpr uint32_t BREAK_DETECT = 38;	///< us, stop bit of the first character
+static constexpr uint32_t SLOT_TIME = 44;		///< us, 11 bits
+static constexpr uint32_t PERIOD_MAX = 1250000;	///< us, E1.11 BREAK to BREAK
+}  // namespace analyzer
+}  // namespace dmx
+
+struct RxAnalyzer {
+	dmx::analyzer::Statistics statistics[static_cast<uint32_t>(dmx::analyzer::Metric::LAST)];
+	uint32_t nBreakStart;
+	uint32_t nBreakEnd;
+	uint32_t nMabEnd;
+	uint32_t nExtiLine;
+	dmx::analyzer::State state;
+	bool bHaveBreak;
+};
+
+static RxAnalyzer s_RxAnalyzer[dmx::config::max::PORTS];
+
+static void rx_analyzer_config(const uint32_t nPortIndex, const uint32_t nGpio, const uint32_t nPin) {
+	const auto nSourcePin = static_cast<uint8_t>(__builtin_ctz(nPin));
+	const auto nSourcePort = static_cast<uint8_t>((nGpio - GPIOA) / (GPIOB - GPIOA));
+
+	// An EXTI line is shared by the pins with the same number, see dmx_config.h
+	rcu_periph_clock_enable(RCU_SYSCFG);
+	syscfg_exti_line_config(nSourcePort, nSourcePin);
+
+	EXTI_INTEN &= ~nPin;
+	EXTI_RTEN &= ~nPin;
+	EXTI_FTEN &= ~nPin;
+	EXTI_PD = nPin;
+
+	auto& analyzer = s_RxAnalyzer[nPortIndex];
+	analyzer.nExtiLine = nPin;
+	analyzer.state = dmx::analyzer::State::IDLE;
+	analyzer.bHaveBreak = false;
+
+	for (auto& statistics : analyzer.statistics) {
+		statistics.Reset();
+	}
+
+	IRQn_Type irq;
+
+	if (nSourcePin >= 10) {
+		irq = EXTI10_15_IRQn;
+	} else if (nSourcePin >= 5) {
+		irq = EXTI5_9_IRQn;
+	} else {
+		irq = static_cast<IRQn_Type>(EXTI0_IRQn + nSourcePin);
+	}
+
+	NVIC_SetPriority(irq, 0);
+	NVIC_EnableIRQ(irq);
+}
+
+static void rx_analyzer_stop(const uint32_t nPortIndex) {
+	auto& analyzer = s_RxAnalyzer[nPortIndex];
+
+	EXTI_INTEN &= ~analyzer.nExtiLine;
+	analyzer.state = dmx::analyzer::State::IDLE;
+	analyzer.bHaveBreak = false;
+}
+
+/*
+ * USART IRQ: a BREAK is detected
+ */
+template<uint32_t nPortIndex>
+static void rx_analyzer_break() {
+	auto& analyzer = s_RxAnalyzer[nPortIndex];
+	const auto nBreakStart = DWT->CYCCNT - (dmx::analyzer::BREAK_DETECT * dmx::analyzer::CYCLES_PER_US);
+
+	if (analyzer.bHaveBreak) {
+		const auto nPeriod = (nBreakStart - analyzer.nBreakStart) / dmx::analyzer::CYCLES_PER_US;
+
+		if (nPeriod <= dmx::analyzer::PERIOD_MAX) {
+			analyzer.statistics[static_cast<uint32_t>(dmx::analyzer::Metric::PERIOD)].Add(nPeriod, dmx::analyzer::Metric::PERIOD);
+		}
+	}
+
+	analyzer.nBreakStart = nBreakStart;
+	analyzer.bHaveBreak = true;
+	analyzer.state = dmx::analyzer::State::BREAK;
+
+	EXTI_FTEN &= ~analyzer.nExtiLine;
+	EXTI_RTEN |= analyzer.nExtiLine;
+	EXTI_PD = analyzer.nExtiLine;
+	EXTI_INTEN |= analyzer.nExtiLine;
+}
+
+/*
+ * USART IRQ: the IDLE line closed a DMX frame, nSlotsInPacket includes the START Code
+ */
+template<uint32_t nPortIndex>
+static void rx_analyzer_frame(const uint32_t nSlotsInPacket) {
+	auto& analyzer = s_RxAnalyzer[nPortIndex];
+
+	if ((analyzer.state != dmx::analyzer::State::DATA) || (nSlotsInPacket < 2)) {
+		analyzer.state = dmx::analyzer::State::IDLE;
+		return;
+	}
+
+	analyzer.state = dmx::analyzer::State::IDLE;
+
+	const auto nFrameTime = static_cast<int32_t>((DWT->CYCCNT - analyzer.nMabEnd) / dmx::analyzer::CYCLES_PER_US);
+	const auto nSlotsTime = static_cast<int32_t>((nSlotsInPacket + 1) * dmx::analyzer::SLOT_TIME);	// + IDLE detection
+	const auto nInterSlot = std::max(0, (nFrameTime - nSlotsTime) / static_cast<int32_t>(nSlotsInPacket - 1));
+
+	analyzer.statistics[static_cast<uint32_t>(dmx::analyzer::Metric::INTERSLOT)].Add(static_cast<uint32_t>(nInterSlot), dmx::analyzer::Metric::INTERSLOT);
+}
+
+/*
+ * EXTI IRQ: rising edge is the end of the BREAK, falling edge is the end of the MAB
+ */
+static void rx_analyzer_exti(const uint32_t nLines) {
+	const auto nNow = DWT->CYCCNT;
+	const auto nPending = EXTI_PD & nLines;
+	EXTI_PD = nPending;
+
+	for (uint32_t nPortIndex = 0; nPortIndex < DMX_MAX_PORTS; nPortIndex++) {
+		auto& analyzer = s_RxAnalyzer[nPortIndex];
+
+		if ((nPending & analyzer.nExtiLine) == 0) {
+			continue;
+		}
+
+		if (analyzer.state == dmx::analyzer::State::BREAK) {
+			const auto nBreak = (nNow - analyzer.nBreakStart) / dmx::analyzer::CYCLES_PER_US;
+			analyzer.statistics[static_cast<uint32_t>(dmx::analyzer::Metric::BREAK)].Add(nBreak, dmx::analyzer::Metric::BREAK);
+			analyzer.nBreakEnd = nNow;
+			analyzer.state = dmx::analyzer::State::MAB;
+
+			EXTI_RTEN &= ~analyzer.nExtiLine;
+			EXTI_FTEN |= analyzer.nExtiLine;
+			continue;
+		}
+
+		if (analyzer.state == dmx::analyzer::State::MAB) {
+			const auto nMab = (nNow - analyzer.nBreakEnd) / dmx::analyzer::CYCLES_PER_US;
+			analyzer.statistics[static_cast<uint32_t>(dmx::analyzer::Metric::MAB)].Add(nMab, dmx::analyzer::Metric::MAB);
+			analyzer.nMabEnd = nNow;
+			analyzer.state = dmx::analyzer::State::DATA;
+		}
+
+		EXTI_INTEN &= ~analyzer.nExtiLine;
+		EXTI_FTEN &= ~analyzer.nExtiLine;
+		EXTI_RTEN &= ~analyzer.nExtiLine;
+	}
+}
+#endif
 
 template<uint32_t uart, uint32_t nPortIndex>
 void irq_handler_dmx_rdm_input() {
+	sv_nRxIrqs[nPortIndex].nCount++;
+
 	const auto isFlagIdleFrame = (USART_REG_VAL(uart, USART_FLAG_IDLE) & BIT(USART_BIT_POS(USART_FLAG_IDLE))) == BIT(USART_BIT_POS(USART_FLAG_IDLE));
 	/*
 	 * Software can clear this bit by reading the USART_STAT and USART_DATA registers one by one.
@@ -170,11 +604,13 @@ void irq_handler_dmx_rdm_input() {
 		if (sv_RxBuffer[nPortIndex].State == TxRxState::DMXDATA) {
 			sv_RxBuffer[nPortIndex].State = TxRxState::IDLE;
 			sv_RxBuffer[nPortIndex].Dmx.current.nSlotsInPacket |= 0x8000;
-
+#if defined (CONFIG_DMX_RX_ANALYZER)
+			rx_analyzer_frame<nPortIndex>(sv_RxBuffer[nPortIndex].Dmx.current.nSlotsInPacket & ~0x8000);
+#endif
 			return;
 		}
 
-		if (sv_RxBuffer[0].State == TxRxState::RDMDISC) {
+		if (sv_RxBuffer[nPortIndex].State == TxRxState::RDMDISC) {
 			sv_RxBuffer[nPortIndex].State = TxRxState::IDLE;
 			sv_RxBuffer[nPortIndex].Rdm.nIndex |= 0x4000;
 
@@ -193,6 +629,9 @@ void irq_handler_dmx_rdm_input() {
 
 		if (sv_RxBuffer[nPortIndex].State == TxRxState::IDLE) {
 			sv_RxBuffer[nPortIndex].State = TxRxState::BREAK;
+#if defined (CONFIG_DMX_RX_ANALYZER)
+			rx_analyzer_break<nPortIndex>();
+#endif
 		}
 
 		return;
@@ -290,49 +729,281 @@ void irq_handler_dmx_rdm_input() {
 	}
 }
 
+#if defined (CONFIG_DMX_RX_DMA)
+/*
+ * DMX/RDM receive with DMA, the USART IRQ is taken on the frame boundaries only.
+ * The BREAK (frame error) arms the DMA, the IDLE line or the BREAK of the next frame closes the frame.
+ * An RDM discovery response has no BREAK, it is received byte by byte.
+ */
+template<uint32_t uart, uint32_t nPortIndex, uint32_t dmax, dma_channel_enum channelx>
+static void rx_dma_start() {
+	DMA_CHCTL(dmax, channelx) &= ~DMA_CHXCTL_CHEN;
+	while ((DMA_CHCTL(dmax, channelx) & DMA_CHXCTL_CHEN) == DMA_CHXCTL_CHEN) {
+		__DMB();
+	}
+	gd32_dma_interrupt_flag_clear<dmax, channelx, DMA_INT_FLAG_FTF | DMA_INT_FLAG_HTF | DMA_INT_FLAG_TAE | DMA_INT_FLAG_SDE | DMA_INT_FLAG_FEE>();
+	DMA_CHMADDR(dmax, channelx) = reinterpret_cast<uint32_t>(s_RxDma[nPortIndex].data);
+	DMA_CHCNT(dmax, channelx) = (dmx::buffer::SIZE & DMA_CHXCNT_CNT);
+	DMA_CHCTL(dmax, channelx) |= DMA_CHXCTL_CHEN;
+
+	gd32_usart_interrupt_disable<USART_INT_RBNE>(uart);
+	USART_CTL2(uart) |= (USART_CTL2_DENR | USART_CTL2_ERRIE);
+	gd32_usart_interrupt_enable<USART_INT_FLAG_IDLE>(uart);
+
+	sv_RxBuffer[nPortIndex].State = TxRxState::BREAK;
+}
+
+/*
+ * @return the number of bytes received, including the START Code
+ */
+template<uint32_t uart, uint32_t dmax, dma_channel_enum channelx>
+static uint32_t rx_dma_end() {
+	USART_CTL2(uart) &= ~USART_CTL2_DENR;
+	DMA_CHCTL(dmax, channelx) &= ~DMA_CHXCTL_CHEN;
+	while ((DMA_CHCTL(dmax, channelx) & DMA_CHXCTL_CHEN) == DMA_CHXCTL_CHEN) {
+		__DMB();
+	}
+	return dmx::buffer::SIZE - (DMA_CHCNT(dmax, channelx) & DMA_CHXCNT_CNT);
+}
+
+/*
+ * USART IRQ: a complete frame is in s_RxDma[nPortIndex]
+ */
+template<uint32_t nPortIndex>
+static void rx_dma_frame(const uint32_t nLength) {
+	if (nLength == 0) {
+		return;
+	}
+
+	auto& rxBuffer = sv_RxBuffer[nPortIndex];
+	const auto *pData = s_RxDma[nPortIndex].data;
+
+	if (pData[0] == START_CODE) {
+		const auto nSlotsInPacket = std::min(nLength, static_cast<uint32_t>(dmx::max::CHANNELS + 1));
+		const auto *pSrc32 = reinterpret_cast<const uint32_t *>(pData);
+		auto *pDst32 = reinterpret_cast<volatile uint32_t *>(rxBuffer.Dmx.current.data);
+
+		for (uint32_t i = 0; i < ((nSlotsInPacket + 3) / 4); i++) {
+			pDst32[i] = pSrc32[i];
+		}
+
+		rxBuffer.Dmx.current.nSlotsInPacket = nSlotsInPacket | 0x8000;
+		sv_nRxDmxPackets[nPortIndex].nCount++;
+		return;
+	}
+
+	if (pData[0] == E120_SC_RDM) {
+		const uint32_t nMessageLength = reinterpret_cast<const struct TRdmMessage *>(pData)->message_length;
+
+		if ((nMessageLength < 24) || ((nMessageLength + 2) > sizeof(struct TRdmMessage)) || ((nMessageLength + 2) > nLength)) {
+			return;
+		}
+
+		for (uint32_t i = 0; i < (nMessageLength + 2); i++) {
+			rxBuffer.Rdm.data[i] = pData[i];
+		}
+
+		rxBuffer.Rdm.nIndex = (nMessageLength + 1) | 0x4000;
+		gsv_RdmDataReceiveEnd = DWT->CYCCNT;
+	}
+}
+
+template<uint32_t uart, uint32_t nPortIndex, uint32_t dmax, dma_channel_enum channelx>
+void irq_handler_dmx_rdm_input_dma() {
+	sv_nRxIrqs[nPortIndex].nCount++;
+
+	auto& rxBuffer = sv_RxBuffer[nPortIndex];
+	const auto isFlagIdleFrame = (USART_REG_VAL(uart, USART_FLAG_IDLE) & BIT(USART_BIT_POS(USART_FLAG_IDLE))) == BIT(USART_BIT_POS(USART_FLAG_IDLE));
+	const auto isFlagFrameError = (USART_REG_VAL(uart, USART_FLAG_FERR) & BIT(USART_BIT_POS(USART_FLAG_FERR))) == BIT(USART_BIT_POS(USART_FLAG_FERR));
+
+	if (rxBuffer.State == TxRxState::BREAK) {
+		if (!isFlagIdleFrame && !isFlagFrameError) {
+			// Noise or overrun error, the DMA has taken the data
+			static_cast<void>(GET_BITS(USART_RDATA(uart), 0U, 8U));
+			return;
+		}
+
+		auto nLength = rx_dma_end<uart, dmax, channelx>();
+
+		if (isFlagFrameError) {
+			/*
+			 * The BREAK of the next frame. When the DMA has already taken the BREAK byte, it is not part of this frame.
+			 */
+			if (!gd32_usart_flag_get<USART_FLAG_RBNE>(uart) && (nLength != 0)) {
+				nLength--;
+			}
+		}
+
+		/*
+		 * Software can clear the flags by reading the USART_STAT and USART_DATA registers one by one.
+		 */
+		static_cast<void>(GET_BITS(USART_RDATA(uart), 0U, 8U));
+
+		rx_dma_frame<nPortIndex>(nLength);
+
+		if (isFlagFrameError) {
+#if defined (CONFIG_DMX_RX_ANALYZER)
+			rx_analyzer_break<nPortIndex>();
+#endif
+			rx_dma_start<uart, nPortIndex, dmax, channelx>();
+			return;
+		}
+#if defined (CONFIG_DMX_RX_ANALYZER)
+		if ((nLength != 0) && (s_RxDma[nPortIndex].data[0] == START_CODE)) {
+			rx_analyzer_frame<nPortIndex>(std::min(nLength, static_cast<uint32_t>(dmx::max::CHANNELS + 1)));
+		}
+#endif
+
+		USART_CTL2(uart) &= ~USART_CTL2_ERRIE;
+		rxBuffer.State = TxRxState::IDLE;
+		gd32_usart_interrupt_enable<USART_INT_RBNE>(uart);
+		return;
+	}
+
+	if (isFlagIdleFrame) {
+		static_cast<void>(GET_BITS(USART_RDATA(uart), 0U, 8U));
+
+		if (rxBuffer.State == TxRxState::RDMDISC) {
+			rxBuffer.State = TxRxState::IDLE;
+			rxBuffer.Rdm.nIndex |= 0x4000;
+		}
+
+		return;
+	}
+
+	if (isFlagFrameError) {
+		static_cast<void>(GET_BITS(USART_RDATA(uart), 0U, 8U));
+
+		if (rxBuffer.State == TxRxState::IDLE) {
+#if defined (CONFIG_DMX_RX_ANALYZER)
+			rx_analyzer_break<nPortIndex>();
+#endif
+			rx_dma_start<uart, nPortIndex, dmax, channelx>();
+		}
+
+		return;
+	}
+
+	const auto data = static_cast<uint8_t>(GET_BITS(USART_RDATA(uart), 0U, 8U));
+
+	if (rxBuffer.State == TxRxState::IDLE) {
+		rxBuffer.State = TxRxState::RDMDISC;
+		rxBuffer.Rdm.data[0] = data;
+		rxBuffer.Rdm.nIndex = 1;
+		return;
+	}
+
+	if (rxBuffer.State == TxRxState::RDMDISC) {
+		const auto nIndex = rxBuffer.Rdm.nIndex;
+
+		if (nIndex < 24) {
+			rxBuffer.Rdm.data[nIndex] = data;
+			rxBuffer.Rdm.nIndex = nIndex + 1;
+		}
+	}
+}
+#endif
+
 extern "C" {
 #if !defined(CONFIG_DMX_TRANSMIT_ONLY)
 #if defined (DMX_USE_USART0)
 void USART0_IRQHandler(void) {
+#if defined (CONFIG_DMX_RX_DMA)
+	irq_handler_dmx_rdm_input_dma<USART0, config::USART0_PORT, USART0_DMAx, USART0_RX_DMA_CHx>();
+#else
 	irq_handler_dmx_rdm_input<USART0, config::USART0_PORT>();
+#endif
 }
 #endif
 #if defined (DMX_USE_USART1)
 void USART1_IRQHandler(void) {
+#if defined (CONFIG_DMX_RX_DMA)
+	irq_handler_dmx_rdm_input_dma<USART1, config::USART1_PORT, USART1_DMAx, USART1_RX_DMA_CHx>();
+#else
 	irq_handler_dmx_rdm_input<USART1, config::USART1_PORT>();
+#endif
 }
 #endif
 #if defined (DMX_USE_USART2)
 void USART2_IRQHandler(void) {
+#if defined (CONFIG_DMX_RX_DMA)
+	irq_handler_dmx_rdm_input_dma<USART2, config::USART2_PORT, USART2_DMAx, USART2_RX_DMA_CHx>();
+#else
 	irq_handler_dmx_rdm_input<USART2, config::USART2_PORT>();
+#endif
 }
 #endif
 #if defined (DMX_USE_UART3)
 void UART3_IRQHandler(void) {
+#if defined (CONFIG_DMX_RX_DMA)
+	irq_handler_dmx_rdm_input_dma<UART3, config::UART3_PORT, UART3_DMAx, UART3_RX_DMA_CHx>();
+#else
 	irq_handler_dmx_rdm_input<UART3, config::UART3_PORT>();
+#endif
 }
 #endif
 #if defined (DMX_USE_UART4)
 void UART4_IRQHandler(void) {
+#if defined (CONFIG_DMX_RX_DMA)
+	irq_handler_dmx_rdm_input_dma<UART4, config::UART4_PORT, UART4_DMAx, UART4_RX_DMA_CHx>();
+#else
 	irq_handler_dmx_rdm_input<UART4, config::UART4_PORT>();
+#endif
 }
 #endif
 #if defined (DMX_USE_USART5)
 void USART5_IRQHandler(void) {
+#if defined (CONFIG_DMX_RX_DMA)
+	irq_handler_dmx_rdm_input_dma<USART5, config::USART5_PORT, USART5_DMAx, USART5_RX_DMA_CHx>();
+#else
 	irq_handler_dmx_rdm_input<USART5, config::USART5_PORT>();
+#endif
 }
 #endif
 #if defined (DMX_USE_UART6)
 void UART6_IRQHandler(void) {
+#if defined (CONFIG_DMX_RX_DMA)
+	irq_handler_dmx_rdm_input_dma<UART6, config::UART6_PORT, UART6_DMAx, UART6_RX_DMA_CHx>();
+#else
 	irq_handler_dmx_rdm_input<UART6, config::UART6_PORT>();
+#endif
 }
 #endif
 #if defined (DMX_USE_UART7)
 void UART7_IRQHandler(void) {
+#if defined (CONFIG_DMX_RX_DMA)
+	irq_handler_dmx_rdm_input_dma<UART7, config::UART7_PORT, UART7_DMAx, UART7_RX_DMA_CHx>();
+#else
 	irq_handler_dmx_rdm_input<UART7, config::UART7_PORT>();
+#endif
 }
 #endif
 #endif
+#if defined (CONFIG_DMX_RX_ANALYZER)
+void EXTI1_IRQHandler(void) {
+	rx_analyzer_exti(EXTI_1);
+}
+
+void EXTI2_IRQHandler(void) {
+	rx_analyzer_exti(EXTI_2);
+}
+
+void EXTI3_IRQHandler(void) {
+	rx_analyzer_exti(EXTI_3);
+}
+
+void EXTI4_IRQHandler(void) {
+	rx_analyzer_exti(EXTI_4);
+}
+
+void EXTI5_9_IRQHandler(void) {
+	rx_analyzer_exti(EXTI_5 | EXTI_6 | EXTI_7 | EXTI_8 | EXTI_9);
+}
+
+void EXTI10_15_IRQHandler(void) {
+	rx_analyzer_exti(EXTI_10 | EXTI_11 | EXTI_12 | EXTI_13 | EXTI_14 | EXTI_15);
+}
+#endif
 }
 
 static void timer1_config() {
@@ -431,6 +1102,25 @@ static void timer4_config() {
 	timer_enable(TIMER4);
 }
 
+#if defined (CONFIG_DMX_RX_DMA)
+template<uint32_t dmax, dma_channel_enum channelx, dma_subperipheral_enum subperix>
+static void rx_dma_config(const uint32_t uart) {
+	DMA_PARAMETER_STRUCT dma_init_struct;
+	dma_deinit(dmax, channelx);
+	dma_init_struct.direction = DMA_PERIPH_TO_MEMORY;
+	dma_init_struct.memory_inc = DMA_MEMORY_INCREASE_ENABLE;
+	dma_init_struct.periph_addr = uart + 0x04U;
+	dma_init_struct.periph_inc = DMA_PERIPH_INCREASE_DISABLE;
+	dma_init_struct.periph_memory_width = DMA_PERIPHERAL_WIDTH_8BIT;
+	dma_init_struct.priority = DMA_PRIORITY_ULTRA_HIGH;
+	dma_init(dmax, channelx, &dma_init_struct);
+	/* configure DMA mode */
+	dma_circulation_disable(dmax, channelx);
+	dma_channel_subperipheral_select(dmax, channelx, subperix);
+	gd32_dma_interrupt_disable<dmax, channelx, DMA_INTERRUPT_DISABLE>();
+}
+#endif
+
 static void usart_dma_config(void) {
 	DMA_PARAMETER_STRUCT dma_init_struct;
 	rcu_periph_clock_enable(RCU_DMA0);
@@ -760,6 +1450,35 @@ static void usart_dma_config(void) {
 	NVIC_EnableIRQ(DMA0_Channel0_IRQn);
 # endif
 #endif /* DMX_USE_UART7 */
+#if defined (CONFIG_DMX_RX_DMA)
+	/*
+	 * DMX/RDM Receive, the DMA is started by the USART IRQ
+	 */
+# if defined (DMX_USE_USART0)
+	rx_dma_config<USART0_DMAx, USART0_RX_DMA_CHx, USART0_RX_DMA_SUBPERIx>(USART0);
+# endif
+# if defined (DMX_USE_USART1)
+	rx_dma_config<USART1_DMAx, USART1_RX_DMA_CHx, USART1_RX_DMA_SUBPERIx>(USART1);
+# endif
+# if defined (DMX_USE_USART2)
+	rx_dma_config<USART2_DMAx, USART2_RX_DMA_CHx, USART2_RX_DMA_SUBPERIx>(USART2);
+# endif
+# if defined (DMX_USE_UART3)
+	rx_dma_config<UART3_DMAx, UART3_RX_DMA_CHx, UART3_RX_DMA_SUBPERIx>(UART3);
+# endif
+# if defined (DMX_USE_UART4)
+	rx_dma_config<UART4_DMAx, UART4_RX_DMA_CHx, UART4_RX_DMA_SUBPERIx>(UART4);
+# endif
+# if defined (DMX_USE_USART5)
+	rx_dma_config<USART5_DMAx, USART5_RX_DMA_CHx, USART5_RX_DMA_SUBPERIx>(USART5);
+# endif
+# if defined (DMX_USE_UART6)
+	rx_dma_config<UART6_DMAx, UART6_RX_DMA_CHx, UART6_RX_DMA_SUBPERIx>(UART6);
+# endif
+# if defined (DMX_USE_UART7)
+	rx_dma_config<UART7_DMAx, UART7_RX_DMA_CHx, UART7_RX_DMA_SUBPERIx>(UART7);
+# endif
+#endif
 }
 
 extern "C" {
@@ -774,27 +1493,32 @@ void TIMER1_IRQHandler() {
 			gd32_gpio_mode_output<USART0_GPIOx, USART0_TX_GPIO_PINx>();
 			GPIO_BC(USART0_GPIOx) = USART0_TX_GPIO_PINx;
 			s_TxBuffer[dmx::config::USART0_PORT].State = TxRxState::BREAK;
-			TIMER_CH0CV(TIMER1) =  TIMER_CNT(TIMER1) + s_nDmxTransmit.nBreakTime;
+			TIMER_CH0CV(TIMER1) = TIMER_CNT(TIMER1) + tx_break_time<dmx::config::USART0_PORT, TIMER1>();
 			break;
 		case TxRxState::BREAK:
 			gd32_gpio_mode_af<USART0_GPIOx, USART0_TX_GPIO_PINx, USART0>();
 			s_TxBuffer[dmx::config::USART0_PORT].State = TxRxState::MAB;
-			TIMER_CH0CV(TIMER1) =  TIMER_CNT(TIMER1) + s_nDmxTransmit.nMabTime;
+			TIMER_CH0CV(TIMER1) = TIMER_CNT(TIMER1) + tx_mab_time<dmx::config::USART0_PORT>();
 			break;
 		case TxRxState::MAB: {
 			uint32_t dmaCHCTL = DMA_CHCTL(USART0_DMAx, USART0_TX_DMA_CHx);
 			dmaCHCTL &= ~DMA_CHXCTL_CHEN;
 			DMA_CHCTL(USART0_DMAx, USART0_TX_DMA_CHx) = dmaCHCTL;
 			gd32_dma_interrupt_flag_clear<USART0_DMAx, USART0_TX_DMA_CHx, DMA_INTF_FTFIF>();
-			const auto *p = &s_TxBuffer[dmx::config::USART0_PORT].dmx;
-			DMA_CHMADDR(USART0_DMAx, USART0_TX_DMA_CHx) = (uint32_t) p->data;
-			DMA_CHCNT(USART0_DMAx, USART0_TX_DMA_CHx) = (p->nLength & DMA_CHXCNT_CNT);
+			uint32_t nLength;
+			const auto *pData = tx_frame<dmx::config::USART0_PORT>(nLength);
+			DMA_CHMADDR(USART0_DMAx, USART0_TX_DMA_CHx) = (uint32_t) pData;
+			DMA_CHCNT(USART0_DMAx, USART0_TX_DMA_CHx) = (nLength & DMA_CHXCNT_CNT);
 			dmaCHCTL |= DMA_CHXCTL_CHEN;
 			dmaCHCTL |= DMA_INTERRUPT_ENABLE;
 			DMA_CHCTL(USART0_DMAx, USART0_TX_DMA_CHx) = dmaCHCTL;
 			USART_CTL2(USART0) |= USART_TRANSMIT_DMA_ENABLE;
 		}
 		break;
+		case TxRxState::RDMDATA:
+		case TxRxState::RDMWAIT:
+			TIMER_CH0CV(TIMER1) = TIMER_CNT(TIMER1) + rdm_tx_timer<dmx::config::USART0_PORT, USART0>();
+			break;
 		default:
 			break;
 		}
@@ -812,27 +1536,32 @@ void TIMER1_IRQHandler() {
 			gd32_gpio_mode_output<USART1_GPIOx, USART1_TX_GPIO_PINx>();
 			GPIO_BC(USART1_GPIOx) = USART1_TX_GPIO_PINx;
 			s_TxBuffer[dmx::config::USART1_PORT].State = TxRxState::BREAK;
-			TIMER_CH1CV(TIMER1) = TIMER_CNT(TIMER1) + s_nDmxTransmit.nBreakTime;
+			TIMER_CH1CV(TIMER1) = TIMER_CNT(TIMER1) + tx_break_time<dmx::config::USART1_PORT, TIMER1>();
 			break;
 		case TxRxState::BREAK:
 			gd32_gpio_mode_af<USART1_GPIOx, USART1_TX_GPIO_PINx, USART1>();
 			s_TxBuffer[dmx::config::USART1_PORT].State = TxRxState::MAB;
-			TIMER_CH1CV(TIMER1) =  TIMER_CNT(TIMER1) + s_nDmxTransmit.nMabTime;
+			TIMER_CH1CV(TIMER1) = TIMER_CNT(TIMER1) + tx_mab_time<dmx::config::USART1_PORT>();
 			break;
 		case TxRxState::MAB: {
 			uint32_t dmaCHCTL = DMA_CHCTL(USART1_DMAx, USART1_TX_DMA_CHx);
 			dmaCHCTL &= ~DMA_CHXCTL_CHEN;
 			DMA_CHCTL(USART1_DMAx, USART1_TX_DMA_CHx) = dmaCHCTL;
 			gd32_dma_interrupt_flag_clear<USART1_DMAx, USART1_TX_DMA_CHx, DMA_INTF_FTFIF>();
-			const auto *p = &s_TxBuffer[dmx::config::USART1_PORT].dmx;
-			DMA_CHMADDR(USART1_DMAx, USART1_TX_DMA_CHx) = (uint32_t) p->data;
-			DMA_CHCNT(USART1_DMAx, USART1_TX_DMA_CHx) = (p->nLength & DMA_CHXCNT_CNT);
+			uint32_t nLength;
+			const auto *pData = tx_frame<dmx::config::USART1_PORT>(nLength);
+			DMA_CHMADDR(USART1_DMAx, USART1_TX_DMA_CHx) = (uint32_t) pData;
+			DMA_CHCNT(USART1_DMAx, USART1_TX_DMA_CHx) = (nLength & DMA_CHXCNT_CNT);
 			dmaCHCTL |= DMA_CHXCTL_CHEN;
 			dmaCHCTL |= DMA_INTERRUPT_ENABLE;
 			DMA_CHCTL(USART1_DMAx, USART1_TX_DMA_CHx) = dmaCHCTL;
 			USART_CTL2(USART1) |= USART_TRANSMIT_DMA_ENABLE;
 		}
 		break;
+		case TxRxState::RDMDATA:
+		case TxRxState::RDMWAIT:
+			TIMER_CH1CV(TIMER1) = TIMER_CNT(TIMER1) + rdm_tx_timer<dmx::config::USART1_PORT, USART1>();
+			break;
 		default:
 			break;
 		}
@@ -850,27 +1579,32 @@ void TIMER1_IRQHandler() {
 			gd32_gpio_mode_output<USART2_GPIOx, USART2_TX_GPIO_PINx>();
 			GPIO_BC(USART2_GPIOx) = USART2_TX_GPIO_PINx;
 			s_TxBuffer[dmx::config::USART2_PORT].State = TxRxState::BREAK;
-			TIMER_CH2CV(TIMER1) = TIMER_CNT(TIMER1) + s_nDmxTransmit.nBreakTime;
+			TIMER_CH2CV(TIMER1) = TIMER_CNT(TIMER1) + tx_break_time<dmx::config::USART2_PORT, TIMER1>();
 			break;
 		case TxRxState::BREAK:
 			gd32_gpio_mode_af<USART2_GPIOx, USART2_TX_GPIO_PINx, USART2>();
 			s_TxBuffer[dmx::config::USART2_PORT].State = TxRxState::MAB;
-			TIMER_CH2CV(TIMER1) = TIMER_CNT(TIMER1) + s_nDmxTransmit.nMabTime;
+			TIMER_CH2CV(TIMER1) = TIMER_CNT(TIMER1) + tx_mab_time<dmx::config::USART2_PORT>();
 			break;
 		case TxRxState::MAB: {
 			uint32_t dmaCHCTL = DMA_CHCTL(USART2_DMAx, USART2_TX_DMA_CHx);
 			dmaCHCTL &= ~DMA_CHXCTL_CHEN;
 			DMA_CHCTL(USART2_DMAx, USART2_TX_DMA_CHx) = dmaCHCTL;
 			gd32_dma_interrupt_flag_clear<USART2_DMAx, USART2_TX_DMA_CHx, DMA_INTF_FTFIF>();
-			const auto *p = &s_TxBuffer[dmx::config::USART2_PORT].dmx;
-			DMA_CHMADDR(USART2_DMAx, USART2_TX_DMA_CHx) = (uint32_t) p->data;
-			DMA_CHCNT(USART2_DMAx, USART2_TX_DMA_CHx) = (p->nLength & DMA_CHXCNT_CNT);
+			uint32_t nLength;
+			const auto *pData = tx_frame<dmx::config::USART2_PORT>(nLength);
+			DMA_CHMADDR(USART2_DMAx, USART2_TX_DMA_CHx) = (uint32_t) pData;
+			DMA_CHCNT(USART2_DMAx, USART2_TX_DMA_CHx) = (nLength & DMA_CHXCNT_CNT);
 			dmaCHCTL |= DMA_CHXCTL_CHEN;
 			dmaCHCTL |= DMA_INTERRUPT_ENABLE;
 			DMA_CHCTL(USART2_DMAx, USART2_TX_DMA_CHx) = dmaCHCTL;
 			USART_CTL2(USART2) |= USART_TRANSMIT_DMA_ENABLE;
 		}
 		break;
+		case TxRxState::RDMDATA:
+		case TxRxState::RDMWAIT:
+			TIMER_CH2CV(TIMER1) = TIMER_CNT(TIMER1) + rdm_tx_timer<dmx::config::USART2_PORT, USART2>();
+			break;
 		default:
 			break;
 		}
@@ -888,27 +1622,32 @@ void TIMER1_IRQHandler() {
 			gd32_gpio_mode_output<UART3_GPIOx, UART3_TX_GPIO_PINx>();
 			GPIO_BC(UART3_GPIOx) = UART3_TX_GPIO_PINx;
 			s_TxBuffer[dmx::config::UART3_PORT].State = TxRxState::BREAK;
-			TIMER_CH3CV(TIMER1) = TIMER_CNT(TIMER1) + s_nDmxTransmit.nBreakTime;
+			TIMER_CH3CV(TIMER1) = TIMER_CNT(TIMER1) + tx_break_time<dmx::config::UART3_PORT, TIMER1>();
 			break;
 		case TxRxState::BREAK:
 			gd32_gpio_mode_af<UART3_GPIOx, UART3_TX_GPIO_PINx, UART3>();
 			s_TxBuffer[dmx::config::UART3_PORT].State = TxRxState::MAB;
-			TIMER_CH3CV(TIMER1) = TIMER_CNT(TIMER1) + s_nDmxTransmit.nMabTime;
+			TIMER_CH3CV(TIMER1) = TIMER_CNT(TIMER1) + tx_mab_time<dmx::config::UART3_PORT>();
 			break;
 		case TxRxState::MAB: {
 			uint32_t dmaCHCTL = DMA_CHCTL(UART3_DMAx, UART3_TX_DMA_CHx);
 			dmaCHCTL &= ~DMA_CHXCTL_CHEN;
 			DMA_CHCTL(UART3_DMAx, UART3_TX_DMA_CHx) = dmaCHCTL;
 			gd32_dma_interrupt_flag_clear<UART3_DMAx, UART3_TX_DMA_CHx, DMA_INTF_FTFIF>();
-			const auto *p = &s_TxBuffer[dmx::config::UART3_PORT].dmx;
-			DMA_CHMADDR(UART3_DMAx, UART3_TX_DMA_CHx) = (uint32_t) p->data;
-			DMA_CHCNT(UART3_DMAx, UART3_TX_DMA_CHx) = (p->nLength & DMA_CHXCNT_CNT);
+			uint32_t nLength;
+			const auto *pData = tx_frame<dmx::config::UART3_PORT>(nLength);
+			DMA_CHMADDR(UART3_DMAx, UART3_TX_DMA_CHx) = (uint32_t) pData;
+			DMA_CHCNT(UART3_DMAx, UART3_TX_DMA_CHx) = (nLength & DMA_CHXCNT_CNT);
 			dmaCHCTL |= DMA_CHXCTL_CHEN;
 			dmaCHCTL |= DMA_INTERRUPT_ENABLE;
 			DMA_CHCTL(UART3_DMAx, UART3_TX_DMA_CHx) = dmaCHCTL;
 			USART_CTL2(UART3) |= USART_TRANSMIT_DMA_ENABLE;
 		}
 		break;
+		case TxRxState::RDMDATA:
+		case TxRxState::RDMWAIT:
+			TIMER_CH3CV(TIMER1) = TIMER_CNT(TIMER1) + rdm_tx_timer<dmx::config::UART3_PORT, UART3>();
+			break;
 		default:
 			break;
 		}
@@ -931,27 +1670,32 @@ void TIMER4_IRQHandler() {
 			gd32_gpio_mode_output<UART4_TX_GPIOx, UART4_TX_GPIO_PINx>();
 			GPIO_BC(UART4_TX_GPIOx) = UART4_TX_GPIO_PINx;
 			s_TxBuffer[dmx::config::UART4_PORT].State = TxRxState::BREAK;
-			TIMER_CH0CV(TIMER4) = TIMER_CNT(TIMER4) + s_nDmxTransmit.nBreakTime;
+			TIMER_CH0CV(TIMER4) = TIMER_CNT(TIMER4) + tx_break_time<dmx::config::UART4_PORT, TIMER4>();
 			break;
 		case TxRxState::BREAK:
 			gd32_gpio_mode_af<UART4_TX_GPIOx, UART4_TX_GPIO_PINx, UART4>();
 			s_TxBuffer[dmx::config::UART4_PORT].State = TxRxState::MAB;
-			TIMER_CH0CV(TIMER4) = TIMER_CNT(TIMER4) + s_nDmxTransmit.nMabTime;
+			TIMER_CH0CV(TIMER4) = TIMER_CNT(TIMER4) + tx_mab_time<dmx::config::UART4_PORT>();
 			break;
 		case TxRxState::MAB: {
 			uint32_t dmaCHCTL = DMA_CHCTL(UART4_DMAx, UART4_TX_DMA_CHx);
 			dmaCHCTL &= ~DMA_CHXCTL_CHEN;
 			DMA_CHCTL(UART4_DMAx, UART4_TX_DMA_CHx) = dmaCHCTL;
 			gd32_dma_interrupt_flag_clear<UART4_DMAx, UART4_TX_DMA_CHx, DMA_INTF_FTFIF>();
-			const auto *p = &s_TxBuffer[dmx::config::UART4_PORT].dmx;
-			DMA_CHMADDR(UART4_DMAx, UART4_TX_DMA_CHx) = (uint32_t) p->data;
-			DMA_CHCNT(UART4_DMAx, UART4_TX_DMA_CHx) = (p->nLength & DMA_CHXCNT_CNT);
+			uint32_t nLength;
+			const auto *pData = tx_frame<dmx::config::UART4_PORT>(nLength);
+			DMA_CHMADDR(UART4_DMAx, UART4_TX_DMA_CHx) = (uint32_t) pData;
+			DMA_CHCNT(UART4_DMAx, UART4_TX_DMA_CHx) = (nLength & DMA_CHXCNT_CNT);
 			dmaCHCTL |= DMA_CHXCTL_CHEN;
 			dmaCHCTL |= DMA_INTERRUPT_ENABLE;
 			DMA_CHCTL(UART4_DMAx, UART4_TX_DMA_CHx) = dmaCHCTL;
 			USART_CTL2(UART4) |= USART_TRANSMIT_DMA_ENABLE;
 		}
 		break;
+		case TxRxState::RDMDATA:
+		case TxRxState::RDMWAIT:
+			TIMER_CH0CV(TIMER4) = TIMER_CNT(TIMER4) + rdm_tx_timer<dmx::config::UART4_PORT, UART4>();
+			break;
 		default:
 			break;
 		}
@@ -969,27 +1713,32 @@ void TIMER4_IRQHandler() {
 			gd32_gpio_mode_output<USART5_GPIOx, USART5_TX_GPIO_PINx>();
 			GPIO_BC(USART5_GPIOx) = USART5_TX_GPIO_PINx;
 			s_TxBuffer[dmx::config::USART5_PORT].State = TxRxState::BREAK;
-			TIMER_CH1CV(TIMER4) = TIMER_CNT(TIMER4) + s_nDmxTransmit.nBreakTime;
+			TIMER_CH1CV(TIMER4) = TIMER_CNT(TIMER4) + tx_break_time<dmx::config::USART5_PORT, TIMER4>();
 			break;
 		case TxRxState::BREAK:
 			gd32_gpio_mode_af<USART5_GPIOx, USART5_TX_GPIO_PINx, USART5>();
 			s_TxBuffer[dmx::config::USART5_PORT].State = TxRxState::MAB;
-			TIMER_CH1CV(TIMER4) = TIMER_CNT(TIMER4) + s_nDmxTransmit.nMabTime;
+			TIMER_CH1CV(TIMER4) = TIMER_CNT(TIMER4) + tx_mab_time<dmx::config::USART5_PORT>();
 			break;
 		case TxRxState::MAB: {
 			uint32_t dmaCHCTL = DMA_CHCTL(USART5_DMAx, USART5_TX_DMA_CHx);
 			dmaCHCTL &= ~DMA_CHXCTL_CHEN;
 			DMA_CHCTL(USART5_DMAx, USART5_TX_DMA_CHx) = dmaCHCTL;
 			gd32_dma_interrupt_flag_clear<USART5_DMAx, USART5_TX_DMA_CHx, DMA_INTF_FTFIF>();
-			const auto *p = &s_TxBuffer[dmx::config::USART5_PORT].dmx;
-			DMA_CHMADDR(USART5_DMAx, USART5_TX_DMA_CHx) = (uint32_t) p->data;
-			DMA_CHCNT(USART5_DMAx, USART5_TX_DMA_CHx) = (p->nLength & DMA_CHXCNT_CNT);
+			uint32_t nLength;
+			const auto *pData = tx_frame<dmx::config::USART5_PORT>(nLength);
+			DMA_CHMADDR(USART5_DMAx, USART5_TX_DMA_CHx) = (uint32_t) pData;
+			DMA_CHCNT(USART5_DMAx, USART5_TX_DMA_CHx) = (nLength & DMA_CHXCNT_CNT);
 			dmaCHCTL |= DMA_CHXCTL_CHEN;
 			dmaCHCTL |= DMA_INTERRUPT_ENABLE;
 			DMA_CHCTL(USART5_DMAx, USART5_TX_DMA_CHx) = dmaCHCTL;
 			USART_CTL2(USART5) |= USART_TRANSMIT_DMA_ENABLE;
 		}
 		break;
+		case TxRxState::RDMDATA:
+		case TxRxState::RDMWAIT:
+			TIMER_CH1CV(TIMER4) = TIMER_CNT(TIMER4) + rdm_tx_timer<dmx::config::USART5_PORT, USART5>();
+			break;
 		default:
 			break;
 		}
@@ -1007,27 +1756,32 @@ void TIMER4_IRQHandler() {
 			gd32_gpio_mode_output<UART6_GPIOx, UART6_TX_GPIO_PINx>();
 			GPIO_BC(UART6_GPIOx) = UART6_TX_GPIO_PINx;
 			s_TxBuffer[dmx::config::UART6_PORT].State = TxRxState::BREAK;
-			TIMER_CH2CV(TIMER4) = TIMER_CNT(TIMER4) + s_nDmxTransmit.nBreakTime;
+			TIMER_CH2CV(TIMER4) = TIMER_CNT(TIMER4) + tx_break_time<dmx::config::UART6_PORT, TIMER4>();
 			break;
 		case TxRxState::BREAK:
 			gd32_gpio_mode_af<UART6_GPIOx, UART6_TX_GPIO_PINx, UART6>();
 			s_TxBuffer[dmx::config::UART6_PORT].State = TxRxState::MAB;
-			TIMER_CH2CV(TIMER4) = TIMER_CNT(TIMER4) + s_nDmxTransmit.nMabTime;
+			TIMER_CH2CV(TIMER4) = TIMER_CNT(TIMER4) + tx_mab_time<dmx::config::UART6_PORT>();
 			break;
 		case TxRxState::MAB: {
 			uint32_t dmaCHCTL = DMA_CHCTL(UART6_DMAx, UART6_TX_DMA_CHx);
 			dmaCHCTL &= ~DMA_CHXCTL_CHEN;
 			DMA_CHCTL(UART6_DMAx, UART6_TX_DMA_CHx)= dmaCHCTL;
 			gd32_dma_interrupt_flag_clear<UART6_DMAx, UART6_TX_DMA_CHx, DMA_INTF_FTFIF>();
-			const auto *p = &s_TxBuffer[dmx::config::UART6_PORT].dmx;
-			DMA_CHMADDR(UART6_DMAx, UART6_TX_DMA_CHx) = (uint32_t) p->data;
-			DMA_CHCNT(UART6_DMAx, UART6_TX_DMA_CHx) = (p->nLength & DMA_CHXCNT_CNT);
+			uint32_t nLength;
+			const auto *pData = tx_frame<dmx::config::UART6_PORT>(nLength);
+			DMA_CHMADDR(UART6_DMAx, UART6_TX_DMA_CHx) = (uint32_t) pData;
+			DMA_CHCNT(UART6_DMAx, UART6_TX_DMA_CHx) = (nLength & DMA_CHXCNT_CNT);
 			dmaCHCTL |= DMA_CHXCTL_CHEN;
 			dmaCHCTL |= DMA_INTERRUPT_ENABLE;
 			DMA_CHCTL(UART6_DMAx, UART6_TX_DMA_CHx)= dmaCHCTL;
 			USART_CTL2(UART6) |= USART_TRANSMIT_DMA_ENABLE;
 		}
 		break;
+		case TxRxState::RDMDATA:
+		case TxRxState::RDMWAIT:
+			TIMER_CH2CV(TIMER4) = TIMER_CNT(TIMER4) + rdm_tx_timer<dmx::config::UART6_PORT, UART6>();
+			break;
 		default:
 			break;
 		}
@@ -1045,27 +1799,32 @@ void TIMER4_IRQHandler() {
 			gd32_gpio_mode_output<UART7_GPIOx, UART7_TX_GPIO_PINx>();
 			GPIO_BC(UART7_GPIOx) = UART7_TX_GPIO_PINx;
 			s_TxBuffer[dmx::config::UART7_PORT].State = TxRxState::BREAK;
-			TIMER_CH3CV(TIMER4) = TIMER_CNT(TIMER4) + s_nDmxTransmit.nBreakTime;
+			TIMER_CH3CV(TIMER4) = TIMER_CNT(TIMER4) + tx_break_time<dmx::config::UART7_PORT, TIMER4>();
 			break;
 		case TxRxState::BREAK:
 			gd32_gpio_mode_af<UART7_GPIOx, UART7_TX_GPIO_PINx, UART7>();
 			s_TxBuffer[dmx::config::UART7_PORT].State = TxRxState::MAB;
-			TIMER_CH3CV(TIMER4) = TIMER_CNT(TIMER4) + s_nDmxTransmit.nMabTime;
+			TIMER_CH3CV(TIMER4) = TIMER_CNT(TIMER4) + tx_mab_time<dmx::config::UART7_PORT>();
 			break;
 		case TxRxState::MAB: {
 			uint32_t dmaCHCTL = DMA_CHCTL(UART7_DMAx, UART7_TX_DMA_CHx);
 			dmaCHCTL &= ~DMA_CHXCTL_CHEN;
 			DMA_CHCTL(UART7_DMAx, UART7_TX_DMA_CHx) = dmaCHCTL;
 			gd32_dma_interrupt_flag_clear<UART7_DMAx, UART7_TX_DMA_CHx, DMA_INTF_FTFIF>();
-			const auto *p = &s_TxBuffer[dmx::config::UART7_PORT].dmx;
-			DMA_CHMADDR(UART7_DMAx, UART7_TX_DMA_CHx) = (uint32_t) p->data;
-			DMA_CHCNT(UART7_DMAx, UART7_TX_DMA_CHx) = (p->nLength & DMA_CHXCNT_CNT);
+			uint32_t nLength;
+			const auto *pData = tx_frame<dmx::config::UART7_PORT>(nLength);
+			DMA_CHMADDR(UART7_DMAx, UART7_TX_DMA_CHx) = (uint32_t) pData;
+			DMA_CHCNT(UART7_DMAx, UART7_TX_DMA_CHx) = (nLength & DMA_CHXCNT_CNT);
 			dmaCHCTL |= DMA_CHXCTL_CHEN;
 			dmaCHCTL |= DMA_INTERRUPT_ENABLE;
 			DMA_CHCTL(UART7_DMAx, UART7_TX_DMA_CHx)= dmaCHCTL;
 			USART_CTL2(UART7) |= USART_TRANSMIT_DMA_ENABLE;
 		}
 		break;
+		case TxRxState::RDMDATA:
+		case TxRxState::RDMWAIT:
+			TIMER_CH3CV(TIMER4) = TIMER_CNT(TIMER4) + rdm_tx_timer<dmx::config::UART7_PORT, UART7>();
+			break;
 		default:
 			break;
 		}
@@ -1087,7 +1846,18 @@ void TIMER6_IRQHandler() {
 			packet.nPerSecond = sv_nRxDmxPackets[i].nCount - packet.nCountPrevious;
 			packet.nCountPrevious = packet.nCount;
 		}
+		for (uint32_t i = 0; i < DMX_MAX_PORTS; i++) {
+			auto &irqs = sv_nRxIrqs[i];
+			irqs.nPerSecond = irqs.nCount - irqs.nCountPrevious;
+			irqs.nCountPrevious = irqs.nCount;
+		}
 #endif
+		for (uint32_t i = 0; i < DMX_MAX_PORTS; i++) {
+			auto &packet = sv_nTxDmxPackets[i];
+			packet.nPerSecond = packet.nCount - packet.nCountPrevious;
+			packet.nCountPrevious = packet.nCount;
+		}
+
 		g_Seconds.nUptime++;
 	}
 
@@ -1106,16 +1876,7 @@ void DMA1_Channel7_IRQHandler() {
 	if (gd32_dma_interrupt_flag_get<DMA1, DMA_CH7, DMA_INTERRUPT_FLAG_GET>()) {
 		gd32_dma_interrupt_disable<DMA1, DMA_CH7, DMA_INTERRUPT_DISABLE>();
 
-		if (s_TxBuffer[dmx::config::USART0_PORT].outputStyle == dmx::OutputStyle::DELTA) {
-			s_TxBuffer[dmx::config::USART0_PORT].State = TxRxState::IDLE;
-		} else {
-			timer_channel_output_pulse_value_config(TIMER1, TIMER_CH_0 , TIMER_CNT(TIMER1) + s_nDmxTransmit.nInterTime);
-			s_TxBuffer[dmx::config::USART0_PORT].State = TxRxState::DMXINTER;
-		}
-
-#if !defined (CONFIG_DMX_DISABLE_STATISTICS)
-		sv_TotalStatistics[dmx::config::USART0_PORT].Dmx.Sent++;
-#endif
+		tx_dma_complete<dmx::config::USART0_PORT, TIMER1, TIMER_CH_0>();
 	}
 
 	gd32_dma_interrupt_flag_clear<DMA1, DMA_CH7, DMA_INTERRUPT_FLAG_CLEAR>();
@@ -1125,16 +1886,7 @@ void DMA0_Channel3_IRQHandler() {
 	if (gd32_dma_interrupt_flag_get<DMA0, DMA_CH3, DMA_INTERRUPT_FLAG_GET>()) {
 		gd32_dma_interrupt_disable<DMA0, DMA_CH3, DMA_INTERRUPT_DISABLE>();
 
-		if (s_TxBuffer[dmx::config::USART0_PORT].outputStyle == dmx::OutputStyle::DELTA) {
-			s_TxBuffer[dmx::config::USART0_PORT].State = TxRxState::IDLE;
-		} else {
-			timer_channel_output_pulse_value_config(TIMER1, TIMER_CH_0 , TIMER_CNT(TIMER1) + s_nDmxTransmit.nInterTime);
-			s_TxBuffer[dmx::config::USART0_PORT].State = TxRxState::DMXINTER;
-		}
-
-#if !defined (CONFIG_DMX_DISABLE_STATISTICS)
-		sv_TotalStatistics[dmx::config::USART0_PORT].Dmx.Sent++;
-#endif
+		tx_dma_complete<dmx::config::USART0_PORT, TIMER1, TIMER_CH_0>();
 	}
 
 	gd32_dma_interrupt_flag_clear<DMA0, DMA_CH3, DMA_INTERRUPT_FLAG_CLEAR>();
@@ -1149,16 +1901,7 @@ void DMA0_Channel6_IRQHandler() {
 	if (gd32_dma_interrupt_flag_get<DMA0, DMA_CH6, DMA_INTERRUPT_FLAG_GET>()) {
 		gd32_dma_interrupt_disable<DMA0, DMA_CH6, DMA_INTERRUPT_DISABLE>();
 
-		if (s_TxBuffer[dmx::config::USART1_PORT].outputStyle == dmx::OutputStyle::DELTA) {
-			s_TxBuffer[dmx::config::USART1_PORT].State = TxRxState::IDLE;
-		} else {
-			timer_channel_output_pulse_value_config(TIMER1, TIMER_CH_1 , TIMER_CNT(TIMER1) + s_nDmxTransmit.nInterTime);
-			s_TxBuffer[dmx::config::USART1_PORT].State = TxRxState::DMXINTER;
-		}
-
-#if !defined (CONFIG_DMX_DISABLE_STATISTICS)
-		sv_TotalStatistics[dmx::config::USART1_PORT].Dmx.Sent++;
-#endif
+		tx_dma_complete<dmx::config::USART1_PORT, TIMER1, TIMER_CH_1>();
 	}
 
 	gd32_dma_interrupt_flag_clear<DMA0, DMA_CH6, DMA_INTERRUPT_FLAG_CLEAR>();
@@ -1173,16 +1916,7 @@ void DMA0_Channel3_IRQHandler() {
 	if (gd32_dma_interrupt_flag_get<DMA0, DMA_CH3, DMA_INTERRUPT_FLAG_GET>()) {
 		gd32_dma_interrupt_disable<DMA0, DMA_CH3, DMA_INTERRUPT_DISABLE>();
 
-		if (s_TxBuffer[dmx::config::USART2_PORT].outputStyle == dmx::OutputStyle::DELTA) {
-			s_TxBuffer[dmx::config::USART2_PORT].State = TxRxState::IDLE;
-		} else {
-			timer_channel_output_pulse_value_config(TIMER1, TIMER_CH_2 , TIMER_CNT(TIMER1) + s_nDmxTransmit.nInterTime);
-			s_TxBuffer[dmx::config::USART2_PORT].State = TxRxState::DMXINTER;
-		}
-
-#if !defined (CONFIG_DMX_DISABLE_STATISTICS)
-		sv_TotalStatistics[dmx::config::USART2_PORT].Dmx.Sent++;
-#endif
+		tx_dma_complete<dmx::config::USART2_PORT, TIMER1, TIMER_CH_2>();
 	}
 
 	gd32_dma_interrupt_flag_clear<DMA0, DMA_CH3, DMA_INTERRUPT_FLAG_CLEAR>();
@@ -1192,16 +1926,7 @@ void DMA0_Channel1_IRQHandler() {
 	if (gd32_dma_interrupt_flag_get<DMA0, DMA_CH1, DMA_INTERRUPT_FLAG_GET>()) {
 		gd32_dma_interrupt_disable<DMA0, DMA_CH1, DMA_INTERRUPT_DISABLE>();
 
-		if (s_TxBuffer[dmx::config::USART2_PORT].outputStyle == dmx::OutputStyle::DELTA) {
-			s_TxBuffer[dmx::config::USART2_PORT].State = TxRxState::IDLE;
-		} else {
-			timer_channel_output_pulse_value_config(TIMER1, TIMER_CH_2 , TIMER_CNT(TIMER1) + s_nDmxTransmit.nInterTime);
-			s_TxBuffer[dmx::config::USART2_PORT].State = TxRxState::DMXINTER;
-		}
-
-#if !defined (CONFIG_DMX_DISABLE_STATISTICS)
-		sv_TotalStatistics[dmx::config::USART2_PORT].Dmx.Sent++;
-#endif
+		tx_dma_complete<dmx::config::USART2_PORT, TIMER1, TIMER_CH_2>();
 	}
 
 	gd32_dma_interrupt_flag_clear<DMA0, DMA_CH1, DMA_INTERRUPT_FLAG_CLEAR>();
@@ -1217,16 +1942,7 @@ void DMA0_Channel4_IRQHandler() {
 	if (gd32_dma_interrupt_flag_get<DMA0, DMA_CH4, DMA_INTERRUPT_FLAG_GET>()) {
 		gd32_dma_interrupt_disable<DMA0, DMA_CH4, DMA_INTERRUPT_DISABLE>();
 
-		if (s_TxBuffer[dmx::config::UART3_PORT].outputStyle == dmx::OutputStyle::DELTA) {
-			s_TxBuffer[dmx::config::UART3_PORT].State = TxRxState::IDLE;
-		} else {
-			timer_channel_output_pulse_value_config(TIMER4, TIMER_CH_3 , TIMER_CNT(TIMER4) + s_nDmxTransmit.nInterTime);
-			s_TxBuffer[dmx::config::UART3_PORT].State = TxRxState::DMXINTER;
-		}
-
-#if !defined (CONFIG_DMX_DISABLE_STATISTICS)
-		sv_TotalStatistics[dmx::config::UART3_PORT].Dmx.Sent++;
-#endif
+		tx_dma_complete<dmx::config::UART3_PORT, TIMER1, TIMER_CH_3>();
 	}
 
 	gd32_dma_interrupt_flag_clear<DMA0, DMA_CH4, DMA_INTERRUPT_FLAG_CLEAR>();
@@ -1236,16 +1952,7 @@ void DMA1_Channel4_IRQHandler() {
 	if (gd32_dma_interrupt_flag_get<DMA1, DMA_CH4, DMA_INTERRUPT_FLAG_GET>()) {
 		gd32_dma_interrupt_disable<DMA1, DMA_CH4, DMA_INTERRUPT_DISABLE>();
 
-		if (s_TxBuffer[dmx::config::UART3_PORT].outputStyle == dmx::OutputStyle::DELTA) {
-			s_TxBuffer[dmx::config::UART3_PORT].State = TxRxState::IDLE;
-		} else {
-			timer_channel_output_pulse_value_config(TIMER1, TIMER_CH_3 , TIMER_CNT(TIMER1) + s_nDmxTransmit.nInterTime);
-			s_TxBuffer[dmx::config::UART3_PORT].State = TxRxState::DMXINTER;
-		}
-
-#if !defined (CONFIG_DMX_DISABLE_STATISTICS)
-		sv_TotalStatistics[dmx::config::UART3_PORT].Dmx.Sent++;
-#endif
+		tx_dma_complete<dmx::config::UART3_PORT, TIMER1, TIMER_CH_3>();
 	}
 
 	gd32_dma_interrupt_flag_clear<DMA1, DMA_CH4, DMA_INTERRUPT_FLAG_CLEAR>();
@@ -1261,16 +1968,7 @@ void DMA1_Channel3_IRQHandler() {
 	if (gd32_dma_interrupt_flag_get<DMA1, DMA_CH3, DMA_INTERRUPT_FLAG_GET>()) {
 		gd32_dma_interrupt_disable<DMA1, DMA_CH3, DMA_INTERRUPT_DISABLE>();
 
-		if (s_TxBuffer[dmx::config::UART4_PORT].outputStyle == dmx::OutputStyle::DELTA) {
-			s_TxBuffer[dmx::config::UART4_PORT].State = TxRxState::IDLE;
-		} else {
-			timer_channel_output_pulse_value_config(TIMER4, TIMER_CH_0 , TIMER_CNT(TIMER4) + s_nDmxTransmit.nInterTime);
-			s_TxBuffer[dmx::config::UART4_PORT].State = TxRxState::DMXINTER;
-		}
-
-#if !defined (CONFIG_DMX_DISABLE_STATISTICS)
-		sv_TotalStatistics[dmx::config::UART4_PORT].Dmx.Sent++;
-#endif
+		tx_dma_complete<dmx::config::UART4_PORT, TIMER4, TIMER_CH_0>();
 	}
 
 	gd32_dma_interrupt_flag_clear<DMA1, DMA_CH3, DMA_INTERRUPT_FLAG_CLEAR>();
@@ -1281,18 +1979,9 @@ void DMA0_Channel7_IRQHandler() {
 	if (gd32_dma_interrupt_flag_get<DMA0, DMA_CH7, DMA_INTERRUPT_FLAG_GET>()) {
 		gd32_dma_interrupt_disable<DMA0, DMA_CH7, DMA_INTERRUPT_DISABLE>();
 
-		if (s_TxBuffer[dmx::config::UART4_PORT].outputStyle == dmx::OutputStyle::DELTA) {
-			s_TxBuffer[dmx::config::UART4_PORT].State = TxRxState::IDLE;
-		} else {
-			timer_channel_output_pulse_value_config(TIMER4, TIMER_CH_0 , TIMER_CNT(TIMER4) + s_nDmxTransmit.nInterTime);
-			s_TxBuffer[dmx::config::UART4_PORT].State = TxRxState::DMXINTER;
-		}
+		tx_dma_complete<dmx::config::UART4_PORT, TIMER4, TIMER_CH_0>();
 	}
 
-#if !defined (CONFIG_DMX_DISABLE_STATISTICS)
-	sv_TotalStatistics[dmx::config::UART4_PORT].Dmx.Sent++;
-#endif
-
 	gd32_dma_interrupt_flag_clear<DMA0, DMA_CH7, DMA_INTERRUPT_FLAG_CLEAR>();
 }
 # endif
@@ -1305,16 +1994,7 @@ void DMA1_Channel6_IRQHandler() {
 	if (gd32_dma_interrupt_flag_get<DMA1, DMA_CH6, DMA_INTERRUPT_FLAG_GET>()) {
 		gd32_dma_interrupt_disable<DMA1, DMA_CH6, DMA_INTERRUPT_DISABLE>();
 
-		if (s_TxBuffer[dmx::config::USART5_PORT].outputStyle == dmx::OutputStyle::DELTA) {
-			s_TxBuffer[dmx::config::USART5_PORT].State = TxRxState::IDLE;
-		} else {
-			timer_channel_output_pulse_value_config(TIMER4, TIMER_CH_1 , TIMER_CNT(TIMER4) + s_nDmxTransmit.nInterTime);
-			s_TxBuffer[dmx::config::USART5_PORT].State = TxRxState::DMXINTER;
-		}
-
-#if !defined (CONFIG_DMX_DISABLE_STATISTICS)
-		sv_TotalStatistics[dmx::config::USART5_PORT].Dmx.Sent++;
-#endif
+		tx_dma_complete<dmx::config::USART5_PORT, TIMER4, TIMER_CH_1>();
 	}
 
 	gd32_dma_interrupt_flag_clear<DMA1, DMA_CH6, DMA_INTERRUPT_FLAG_CLEAR>();
@@ -1329,16 +2009,7 @@ void DMA1_Channel4_IRQHandler() {
 	if (gd32_dma_interrupt_flag_get<DMA1, DMA_CH4, DMA_INTERRUPT_FLAG_GET>()) {
 		gd32_dma_interrupt_disable<DMA1, DMA_CH4, DMA_INTERRUPT_DISABLE>();
 
-		if (s_TxBuffer[dmx::config::UART6_PORT].outputStyle == dmx::OutputStyle::DELTA) {
-			s_TxBuffer[dmx::config::UART6_PORT].State = TxRxState::IDLE;
-		} else {
-			timer_channel_output_pulse_value_config(TIMER4, TIMER_CH_2 , TIMER_CNT(TIMER4) + s_nDmxTransmit.nInterTime);
-			s_TxBuffer[dmx::config::UART6_PORT].State = TxRxState::DMXINTER;
-		}
-
-#if !defined (CONFIG_DMX_DISABLE_STATISTICS)
-		sv_TotalStatistics[dmx::config::UART6_PORT].Dmx.Sent++;
-#endif
+		tx_dma_complete<dmx::config::UART6_PORT, TIMER4, TIMER_CH_2>();
 	}
 
 	gd32_dma_interrupt_flag_clear<DMA1, DMA_CH4, DMA_INTERRUPT_FLAG_CLEAR>();
@@ -1349,16 +2020,7 @@ void DMA0_Channel1_IRQHandler() {
 	if (gd32_dma_interrupt_flag_get<DMA0, DMA_CH1, DMA_INTERRUPT_FLAG_GET>()) {
 		gd32_dma_interrupt_disable<DMA0, DMA_CH1, DMA_INTERRUPT_DISABLE>();
 
-		if (s_TxBuffer[dmx::config::UART6_PORT].outputStyle == dmx::OutputStyle::DELTA) {
-			s_TxBuffer[dmx::config::UART6_PORT].State = TxRxState::IDLE;
-		} else {
-			timer_channel_output_pulse_value_config(TIMER4, TIMER_CH_2 , TIMER_CNT(TIMER4) + s_nDmxTransmit.nInterTime);
-			s_TxBuffer[dmx::config::UART6_PORT].State = TxRxState::DMXINTER;
-		}
-
-#if !defined (CONFIG_DMX_DISABLE_STATISTICS)
-		sv_TotalStatistics[dmx::config::UART6_PORT].Dmx.Sent++;
-#endif
+		tx_dma_complete<dmx::config::UART6_PORT, TIMER4, TIMER_CH_2>();
 	}
 
 	gd32_dma_interrupt_flag_clear<DMA0, DMA_CH1, DMA_INTERRUPT_FLAG_CLEAR>();
@@ -1374,16 +2036,7 @@ void DMA1_Channel3_IRQHandler() {
 	if (gd32_dma_interrupt_flag_get<DMA1, DMA_CH3, DMA_INTERRUPT_FLAG_GET>()) {
 		gd32_dma_interrupt_disable<DMA1, DMA_CH3, DMA_INTERRUPT_DISABLE>();
 
-		if (s_TxBuffer[dmx::config::UART7_PORT].outputStyle == dmx::OutputStyle::DELTA) {
-			s_TxBuffer[dmx::config::UART7_PORT].State = TxRxState::IDLE;
-		} else {
-			timer_channel_output_pulse_value_config(TIMER4, TIMER_CH_3 , TIMER_CNT(TIMER4) + s_nDmxTransmit.nInterTime);
-			s_TxBuffer[dmx::config::UART7_PORT].State = TxRxState::DMXINTER;
-		}
-
-#if !defined (CONFIG_DMX_DISABLE_STATISTICS)
-		sv_TotalStatistics[dmx::config::UART7_PORT].Dmx.Sent++;
-#endif
+		tx_dma_complete<dmx::config::UART7_PORT, TIMER4, TIMER_CH_3>();
 	}
 
 	gd32_dma_interrupt_flag_clear<DMA1, DMA_CH3, DMA_INTERRUPT_FLAG_CLEAR>();
@@ -1394,16 +2047,7 @@ void DMA0_Channel0_IRQHandler() {
 	if (gd32_dma_interrupt_flag_get<DMA0, DMA_CH0, DMA_INTERRUPT_FLAG_GET>()) {
 		gd32_dma_interrupt_disable<DMA0, DMA_CH0, DMA_INTERRUPT_DISABLE>();
 
-		if (s_TxBuffer[dmx::config::UART7_PORT].outputStyle == dmx::OutputStyle::DELTA) {
-			s_TxBuffer[dmx::config::UART7_PORT].State = TxRxState::IDLE;
-		} else {
-			timer_channel_output_pulse_value_config(TIMER4, TIMER_CH_3 , TIMER_CNT(TIMER4) + s_nDmxTransmit.nInterTime);
-			s_TxBuffer[dmx::config::UART7_PORT].State = TxRxState::DMXINTER;
-		}
-
-#if !defined (CONFIG_DMX_DISABLE_STATISTICS)
-		sv_TotalStatistics[dmx::config::UART7_PORT].Dmx.Sent++;
-#endif
+		tx_dma_complete<dmx::config::UART7_PORT, TIMER4, TIMER_CH_3>();
 	}
 
 	gd32_dma_interrupt_flag_clear<DMA0, DMA_CH0, DMA_INTERRUPT_FLAG_CLEAR>();
@@ -1424,11 +2068,14 @@ Dmx::Dmx() {
 	assert(s_pThis == nullptr);
 	s_pThis = this;
 
-	s_nDmxTransmit.nBreakTime = dmx::transmit::BREAK_TIME_TYPICAL;
-	s_nDmxTransmit.nMabTime = dmx::transmit::MAB_TIME_MIN;
-	s_nDmxTransmit.nInterTime = dmx::transmit::PERIOD_DEFAULT - s_nDmxTransmit.nBreakTime - s_nDmxTransmit.nMabTime - (dmx::max::CHANNELS * 44) - 44;
-
 	for (auto i = 0; i < DMX_MAX_PORTS; i++) {
+		s_DmxTransmit[i].nBreakTime = dmx::transmit::BREAK_TIME_TYPICAL;
+		s_DmxTransmit[i].nMabTime = dmx::transmit::MAB_TIME_MIN;
+		s_DmxTransmit[i].nPeriod = dmx::transmit::PERIOD_DEFAULT;
+		s_DmxTransmit[i].nPeriodRequested = dmx::transmit::PERIOD_DEFAULT;
+		s_DmxTransmit[i].nSlots = dmx::max::CHANNELS;
+		sv_TxPeriod[i].nBreakStart = 0;
+		sv_TxPeriod[i].nMeasured = 0;
 #if defined (GPIO_INIT)
 		gpio_init(s_DirGpio[i].nPort, GPIO_MODE_OUT_PP, GPIO_OSPEED_50MHZ, s_DirGpio[i].nPin);
 #else
@@ -1440,10 +2087,40 @@ Dmx::Dmx() {
 		sv_RxBuffer[i].State = TxRxState::IDLE;
 		s_TxBuffer[i].State = TxRxState::IDLE;
 		s_TxBuffer[i].outputStyle = dmx::OutputStyle::DELTA;
+		s_TxBuffer[i].nFront = 0;
+		s_RdmQueue[i].nHead = 0;
+		s_RdmQueue[i].nTail = 0;
+		s_RdmQueue[i].bResponsePending = false;
+		s_RdmQueue[i].bActive = false;
+		ClearData(i);
+		tx_swap(s_TxBuffer[i]);
 		ClearData(i);
 	}
 
 	usart_dma_config();	// DMX Transmit
+#if defined (CONFIG_DMX_RX_ANALYZER)
+# if defined (DMX_USE_USART0)
+	rx_analyzer_config(config::USART0_PORT, USART0_GPIOx, USART0_RX_GPIO_PINx);
+# endif
+# if defined (DMX_USE_USART1)
+	rx_analyzer_config(config::USART1_PORT, USART1_GPIOx, USART1_RX_GPIO_PINx);
+# endif
+# if defined (DMX_USE_USART2)
+	rx_analyzer_config(config::USART2_PORT, USART2_GPIOx, USART2_RX_GPIO_PINx);
+# endif
+# if defined (DMX_USE_UART3)
+	rx_analyzer_config(config::UART3_PORT, UART3_GPIOx, UART3_RX_GPIO_PINx);
+# endif
+# if defined (DMX_USE_UART4)
+	rx_analyzer_config(config::UART4_PORT, UART4_RX_GPIOx, UART4_RX_GPIO_PINx);
+# endif
+# if defined (DMX_USE_USART5)
+	rx_analyzer_config(config::USART5_PORT, USART5_GPIOx, USART5_RX_GPIO_PINx);
+# endif
+# if defined (DMX_USE_UART6)
+	rx_analyzer_config(config::UART6_PORT, UART6_GPIOx, UART6_RX_GPIO_PINx);
+# endif
+#endif
 #if defined (DMX_USE_USART0) || defined (DMX_USE_USART1) || defined (DMX_USE_USART2) || defined (DMX_USE_UART3)
 	timer1_config();	// DMX Transmit -> USART0, USART1, USART2, UART3
 #endif
@@ -1522,9 +2199,13 @@ void Dmx::SetPortDirection(const uint32_t nPortIndex, PortDirection portDirectio
 void Dmx::ClearData(const uint32_t nPortIndex) {
 	assert(nPortIndex < dmx::config::max::PORTS);
 
-	auto *p = &s_TxBuffer[nPortIndex];
-	p->dmx.nLength = 513; // Including START Code
-	 __builtin_memset(p->dmx.data, 0, dmx::buffer::SIZE);
+	auto &txBuffer = s_TxBuffer[nPortIndex];
+	auto &dmx = tx_back_begin(txBuffer);
+
+	dmx.nLength = 513; // Including START Code
+	 __builtin_memset(dmx.data, 0, dmx::buffer::SIZE);
+
+	tx_back_end(txBuffer);
 }
 
 #if !defined (CONFIG_DMX_DISABLE_STATISTICS)
@@ -1551,7 +2232,8 @@ static void start_dmx_output() {
 	case USART0:
 		gd32_gpio_mode_output<USART0_GPIOx, USART0_TX_GPIO_PINx>();
 		GPIO_BC(USART0_GPIOx) = USART0_TX_GPIO_PINx;
-		TIMER_CH0CV(TIMER1) = TIMER_CNT(TIMER1) + s_nDmxTransmit.nBreakTime;
+		tx_break_start<dmx::config::USART0_PORT, TIMER1>(false);
+		TIMER_CH0CV(TIMER1) = TIMER_CNT(TIMER1) + s_DmxTransmit[dmx::config::USART0_PORT].nBreakTime;
 		s_TxBuffer[dmx::config::USART0_PORT].State = TxRxState::BREAK;
 		return;
 		break;
@@ -1560,7 +2242,8 @@ static void start_dmx_output() {
 	case USART1:
 		gd32_gpio_mode_output<USART1_GPIOx, USART1_TX_GPIO_PINx>();
 		GPIO_BC(USART1_GPIOx) = USART1_TX_GPIO_PINx;
-		TIMER_CH1CV(TIMER1) = TIMER_CNT(TIMER1) + s_nDmxTransmit.nBreakTime;
+		tx_break_start<dmx::config::USART1_PORT, TIMER1>(false);
+		TIMER_CH1CV(TIMER1) = TIMER_CNT(TIMER1) + s_DmxTransmit[dmx::config::USART1_PORT].nBreakTime;
 		s_TxBuffer[dmx::config::USART1_PORT].State = TxRxState::BREAK;
 		return;
 		break;
@@ -1569,7 +2252,8 @@ static void start_dmx_output() {
 	case USART2:
 		gd32_gpio_mode_output<USART2_GPIOx, USART2_TX_GPIO_PINx>();
 		GPIO_BC(USART2_GPIOx) = USART2_TX_GPIO_PINx;
-		TIMER_CH2CV(TIMER1) = TIMER_CNT(TIMER1) + s_nDmxTransmit.nBreakTime;
+		tx_break_start<dmx::config::USART2_PORT, TIMER1>(false);
+		TIMER_CH2CV(TIMER1) = TIMER_CNT(TIMER1) + s_DmxTransmit[dmx::config::USART2_PORT].nBreakTime;
 		s_TxBuffer[dmx::config::USART2_PORT].State = TxRxState::BREAK;
 		return;
 		break;
@@ -1578,7 +2262,8 @@ static void start_dmx_output() {
 	case UART3:
 		gd32_gpio_mode_output<UART3_GPIOx, UART3_TX_GPIO_PINx>();
 		GPIO_BC(UART3_GPIOx) = UART3_TX_GPIO_PINx;
-		TIMER_CH3CV(TIMER1) = TIMER_CNT(TIMER1) + s_nDmxTransmit.nBreakTime;
+		tx_break_start<dmx::config::UART3_PORT, TIMER1>(false);
+		TIMER_CH3CV(TIMER1) = TIMER_CNT(TIMER1) + s_DmxTransmit[dmx::config::UART3_PORT].nBreakTime;
 		s_TxBuffer[dmx::config::UART3_PORT].State = TxRxState::BREAK;
 		return;
 		break;
@@ -1588,7 +2273,8 @@ static void start_dmx_output() {
 	case UART4:
 		gd32_gpio_mode_output<UART4_TX_GPIOx, UART4_TX_GPIO_PINx>();
 		GPIO_BC(UART4_TX_GPIOx) = UART4_TX_GPIO_PINx;
-		TIMER_CH0CV(TIMER4) = TIMER_CNT(TIMER4) + s_nDmxTransmit.nBreakTime;
+		tx_break_start<dmx::config::UART4_PORT, TIMER4>(false);
+		TIMER_CH0CV(TIMER4) = TIMER_CNT(TIMER4) + s_DmxTransmit[dmx::config::UART4_PORT].nBreakTime;
 		s_TxBuffer[dmx::config::UART4_PORT].State = TxRxState::BREAK;
 		return;
 		break;
@@ -1597,7 +2283,8 @@ static void start_dmx_output() {
 	case USART5:
 		gd32_gpio_mode_output<USART5_GPIOx, USART5_TX_GPIO_PINx>();
 		GPIO_BC(USART5_GPIOx) = USART5_TX_GPIO_PINx;
-		TIMER_CH1CV(TIMER4) = TIMER_CNT(TIMER4) + s_nDmxTransmit.nBreakTime;
+		tx_break_start<dmx::config::USART5_PORT, TIMER4>(false);
+		TIMER_CH1CV(TIMER4) = TIMER_CNT(TIMER4) + s_DmxTransmit[dmx::config::USART5_PORT].nBreakTime;
 		s_TxBuffer[dmx::config::USART5_PORT].State = TxRxState::BREAK;
 		return;
 		break;
@@ -1606,7 +2293,8 @@ static void start_dmx_output() {
 	case UART6:
 		gd32_gpio_mode_output<UART6_GPIOx, UART6_TX_GPIO_PINx>();
 		GPIO_BC(UART6_GPIOx) = UART6_TX_GPIO_PINx;
-		TIMER_CH2CV(TIMER4) = TIMER_CNT(TIMER4) + s_nDmxTransmit.nBreakTime;
+		tx_break_start<dmx::config::UART6_PORT, TIMER4>(false);
+		TIMER_CH2CV(TIMER4) = TIMER_CNT(TIMER4) + s_DmxTransmit[dmx::config::UART6_PORT].nBreakTime;
 		s_TxBuffer[dmx::config::UART6_PORT].State = TxRxState::BREAK;
 		return;
 		break;
@@ -1615,7 +2303,8 @@ static void start_dmx_output() {
 	case UART7:
 		gd32_gpio_mode_output<UART7_GPIOx, UART7_TX_GPIO_PINx>();
 		GPIO_BC(UART7_GPIOx) = UART7_TX_GPIO_PINx;
-		TIMER_CH3CV(TIMER4) = TIMER_CNT(TIMER4) + s_nDmxTransmit.nBreakTime;
+		tx_break_start<dmx::config::UART7_PORT, TIMER4>(false);
+		TIMER_CH3CV(TIMER4) = TIMER_CNT(TIMER4) + s_DmxTransmit[dmx::config::UART7_PORT].nBreakTime;
 		s_TxBuffer[dmx::config::UART7_PORT].State = TxRxState::BREAK;
 		return;
 		break;
@@ -1693,12 +2382,22 @@ void Dmx::StopData(const uint32_t nPortIndex) {
 			}
 		} while (s_TxBuffer[nPortIndex].State != dmx::TxRxState::IDLE);
 
+		// Requests not sent yet and a response not read are dropped
+		s_RdmQueue[nPortIndex].bActive = false;
+		s_RdmQueue[nPortIndex].bResponsePending = false;
+		s_RdmQueue[nPortIndex].nHead = s_RdmQueue[nPortIndex].nTail;
 		return;
 	}
 
 	if (m_dmxPortDirection[nPortIndex] == PortDirection::INP) {
 		gd32_usart_interrupt_disable<USART_INT_RBNE>(nUart);
 		gd32_usart_interrupt_disable<USART_INT_FLAG_IDLE>(nUart);
+#if defined (CONFIG_DMX_RX_DMA)
+		rx_dma_stop(nUart);
+#endif
+#if defined (CONFIG_DMX_RX_ANALYZER)
+		rx_analyzer_stop(nPortIndex);
+#endif
 		sv_RxBuffer[nPortIndex].State = TxRxState::IDLE;
 		return;
 	}
@@ -1709,72 +2408,106 @@ void Dmx::StopData(const uint32_t nPortIndex) {
 
 // DMX Send
 
-void Dmx::SetDmxBreakTime(uint32_t nBreakTime) {
-	s_nDmxTransmit.nBreakTime = std::max(transmit::BREAK_TIME_MIN, nBreakTime);
-	SetDmxPeriodTime(m_nDmxTransmitPeriodRequested);
-}
+void Dmx::SetDmxBreakTime(const uint32_t nPortIndex, const uint32_t nBreakTime) {
+	assert(nPortIndex < dmx::config::max::PORTS);
 
-uint32_t Dmx::GetDmxBreakTime() const {
-	return s_nDmxTransmit.nBreakTime;
+	s_DmxTransmit[nPortIndex].nBreakTime = std::max(transmit::BREAK_TIME_MIN, nBreakTime);
+	SetDmxPeriodTime(nPortIndex, s_DmxTransmit[nPortIndex].nPeriodRequested);
 }
 
-void Dmx::SetDmxMabTime(uint32_t nMabTime) {
-	s_nDmxTransmit.nMabTime = std::max(transmit::MAB_TIME_MIN, nMabTime);
-	SetDmxPeriodTime(m_nDmxTransmitPeriodRequested);
+uint32_t Dmx::GetDmxBreakTime(const uint32_t nPortIndex) const {
+	assert(nPortIndex < dmx::config::max::PORTS);
+	return s_DmxTransmit[nPortIndex].nBreakTime;
 }
 
-uint32_t Dmx::GetDmxMabTime() const {
-	return s_nDmxTransmit.nMabTime;
+void Dmx::SetDmxMabTime(const uint32_t nPortIndex, const uint32_t nMabTime) {
+	assert(nPortIndex < dmx::config::max::PORTS);
+
+	s_DmxTransmit[nPortIndex].nMabTime = std::max(transmit::MAB_TIME_MIN, nMabTime);
+	SetDmxPeriodTime(nPortIndex, s_DmxTransmit[nPortIndex].nPeriodRequested);
 }
 
-void Dmx::SetDmxPeriodTime(uint32_t nPeriod) {
-	m_nDmxTransmitPeriodRequested = nPeriod;
+uint32_t Dmx::GetDmxMabTime(const uint32_t nPortIndex) const {
+	assert(nPortIndex < dmx::config::max::PORTS);
+	return s_DmxTransmit[nPortIndex].nMabTime;
+}
 
-	auto nLengthMax = s_TxBuffer[0].dmx.nLength;
+void Dmx::SetDmxPeriodTime(const uint32_t nPortIndex, const uint32_t nPeriod) {
+	assert(nPortIndex < dmx::config::max::PORTS);
 
-	for (uint32_t nPortIndex = 1; nPortIndex < dmx::config::max::PORTS; nPortIndex++) {
-		const auto nLength = s_TxBuffer[nPortIndex].dmx.nLength;
-		if (nLength > nLengthMax) {
-			nLengthMax = nLength;
-		}
-	}
+	auto& transmit = s_DmxTransmit[nPortIndex];
+	transmit.nPeriodRequested = nPeriod;
 
-	auto nPackageLengthMicroSeconds = s_nDmxTransmit.nBreakTime + s_nDmxTransmit.nMabTime + (nLengthMax * 44U);
+	const auto nLength = m_nDmxTransmissionLength[nPortIndex] + 1U;	// Including START Code
+	auto nPackageLengthMicroSeconds = transmit.nBreakTime + transmit.nMabTime + (nLength * 44U);
 
 	// The GD32F4xx/GD32H7XX Timer 1 has a 32-bit counter
 #if  defined(GD32F4XX) || defined (GD32H7XX)
 #else
 	if (nPackageLengthMicroSeconds > (static_cast<uint16_t>(~0) - 44U)) {
-		s_nDmxTransmit.nBreakTime = std::min(transmit::BREAK_TIME_TYPICAL, s_nDmxTransmit.nBreakTime);
-		s_nDmxTransmit.nMabTime = transmit::MAB_TIME_MIN;
-		nPackageLengthMicroSeconds = s_nDmxTransmit.nBreakTime + s_nDmxTransmit.nMabTime + (nLengthMax * 44U);
+		transmit.nBreakTime = std::min(transmit::BREAK_TIME_TYPICAL, transmit.nBreakTime);
+		transmit.nMabTime = transmit::MAB_TIME_MIN;
+		nPackageLengthMicroSeconds = transmit.nBreakTime + transmit.nMabTime + (nLength * 44U);
 	}
 #endif
 
-	if (nPeriod != 0) {
-		if (nPeriod < nPackageLengthMicroSeconds) {
-			m_nDmxTransmitPeriod = std::max(transmit::BREAK_TO_BREAK_TIME_MIN, nPackageLengthMicroSeconds + 44U);
-		} else {
-			m_nDmxTransmitPeriod = nPeriod;
-		}
+	const auto nPeriodMin = std::max(transmit::BREAK_TO_BREAK_TIME_MIN, nPackageLengthMicroSeconds + 44U);
+
+	if (nPeriod < nPeriodMin) {
+		transmit.nPeriod = nPeriodMin;
 	} else {
-		m_nDmxTransmitPeriod = std::max(transmit::BREAK_TO_BREAK_TIME_MIN, nPackageLengthMicroSeconds + 44U);
+		transmit.nPeriod = std::min(nPeriod, TX_TIMER_MASK);
 	}
 
-	s_nDmxTransmit.nInterTime = m_nDmxTransmitPeriod - nPackageLengthMicroSeconds;
+	DEBUG_PRINTF("nPortIndex=%u, nPeriod=%u, nLength=%u, nPackageLengthMicroSeconds=%u -> nPeriod=%u", nPortIndex, nPeriod, nLength, nPackageLengthMicroSeconds, transmit.nPeriod);
+}
+
+uint32_t Dmx::GetDmxPeriodTime(const uint32_t nPortIndex) const {
+	assert(nPortIndex < dmx::config::max::PORTS);
+	return s_DmxTransmit[nPortIndex].nPeriod;
+}
 
-	DEBUG_PRINTF("nPeriod=%u, nLengthMax=%u, m_nDmxTransmitPeriod=%u, nPackageLengthMicroSeconds=%u -> s_nDmxTransmit.nInterTime=%u", nPeriod, nLengthMax, m_nDmxTransmitPeriod, nPackageLengthMicroSeconds, s_nDmxTransmit.nInterTime);
+uint32_t Dmx::GetDmxPeriodTimeRequested(const uint32_t nPortIndex) const {
+	assert(nPortIndex < dmx::config::max::PORTS);
+	return s_DmxTransmit[nPortIndex].nPeriodRequested;
 }
 
-void Dmx::SetDmxSlots(uint16_t nSlots) {
+void Dmx::SetDmxSlots(const uint32_t nPortIndex, const uint16_t nSlots) {
+	assert(nPortIndex < dmx::config::max::PORTS);
+
 	if ((nSlots >= 2) && (nSlots <= dmx::max::CHANNELS)) {
-		m_nDmxTransmitSlots = nSlots;
+		s_DmxTransmit[nPortIndex].nSlots = nSlots;
+		m_nDmxTransmissionLength[nPortIndex] = std::min(m_nDmxTransmissionLength[nPortIndex], static_cast<uint32_t>(nSlots));
+		SetDmxPeriodTime(nPortIndex, s_DmxTransmit[nPortIndex].nPeriodRequested);
+	}
+}
 
-		for (uint32_t i = 0; i < dmx::config::max::PORTS; i++) {
-			m_nDmxTransmissionLength[i] = std::min(m_nDmxTransmissionLength[i], static_cast<uint32_t>(nSlots));
-		}
+uint16_t Dmx::GetDmxSlots(const uint32_t nPortIndex) const {
+	assert(nPortIndex < dmx::config::max::PORTS);
+	return static_cast<uint16_t>(s_DmxTransmit[nPortIndex].nSlots);
+}
+
+void Dmx::SetDmxBreakTime(const uint32_t nBreakTime) {
+	for (uint32_t nPortIndex = 0; nPortIndex < dmx::config::max::PORTS; nPortIndex++) {
+		SetDmxBreakTime(nPortIndex, nBreakTime);
+	}
+}
+
+void Dmx::SetDmxMabTime(const uint32_t nMabTime) {
+	for (uint32_t nPortIndex = 0; nPortIndex < dmx::config::max::PORTS; nPortIndex++) {
+		SetDmxMabTime(nPortIndex, nMabTime);
+	}
+}
+
+void Dmx::SetDmxPeriodTime(const uint32_t nPeriod) {
+	for (uint32_t nPortIndex = 0; nPortIndex < dmx::config::max::PORTS; nPortIndex++) {
+		SetDmxPeriodTime(nPortIndex, nPeriod);
+	}
+}
 
-		SetDmxPeriodTime(m_nDmxTransmitPeriodRequested);
+void Dmx::SetDmxSlots(const uint16_t nSlots) {
+	for (uint32_t nPortIndex = 0; nPortIndex < dmx::config::max::PORTS; nPortIndex++) {
+		SetDmxSlots(nPortIndex, nSlots);
 	}
 }
 
@@ -1821,36 +2554,42 @@ dmx::OutputStyle Dmx::GetOutputStyle(const uint32_t nPortIndex) const {
 void Dmx::SetSendData(const uint32_t nPortIndex, const uint8_t *pData, uint32_t nLength) {
 	assert(nPortIndex < dmx::config::max::PORTS);
 
-	auto &p = s_TxBuffer[nPortIndex];
-	auto *pDst = p.dmx.data;
+	auto &txBuffer = s_TxBuffer[nPortIndex];
+	auto &dmx = tx_back_begin(txBuffer);
+	auto *pDst = dmx.data;
 
-	nLength = std::min(nLength, static_cast<uint32_t>(m_nDmxTransmitSlots));
-	p.dmx.nLength = nLength + 1;
+	nLength = std::min(nLength, s_DmxTransmit[nPortIndex].nSlots);
+	dmx.nLength = nLength + 1;
 
 	memcpy(pDst, pData, nLength);
 
+	tx_back_end(txBuffer);
+
 	if (nLength != m_nDmxTransmissionLength[nPortIndex]) {
 		m_nDmxTransmissionLength[nPortIndex] = nLength;
-		SetDmxPeriodTime(m_nDmxTransmitPeriodRequested);
+		SetDmxPeriodTime(nPortIndex, s_DmxTransmit[nPortIndex].nPeriodRequested);
 	}
 }
 
 void Dmx::SetSendDataWithoutSC(const uint32_t nPortIndex, const uint8_t *pData, uint32_t nLength) {
 	assert(nPortIndex < dmx::config::max::PORTS);
 
-	auto &p = s_TxBuffer[nPortIndex];
-	auto *pDst = p.dmx.data;
+	auto &txBuffer = s_TxBuffer[nPortIndex];
+	auto &dmx = tx_back_begin(txBuffer);
+	auto *pDst = dmx.data;
 
-	nLength = std::min(nLength, static_cast<uint32_t>(m_nDmxTransmitSlots));
-	p.dmx.nLength = nLength + 1;
-	p.dmx.bDataPending = true;
+	nLength = std::min(nLength, s_DmxTransmit[nPortIndex].nSlots);
+	dmx.nLength = nLength + 1;
 
 	pDst[0] = START_CODE;
 	memcpy(&pDst[1], pData, nLength);
 
+	tx_back_end(txBuffer);
+	txBuffer.bDataPending = true;
+
 	if (nLength != m_nDmxTransmissionLength[nPortIndex]) {
 		m_nDmxTransmissionLength[nPortIndex] = nLength;
-		SetDmxPeriodTime(m_nDmxTransmitPeriodRequested);
+		SetDmxPeriodTime(nPortIndex, s_DmxTransmit[nPortIndex].nPeriodRequested);
 	}
 }
 
@@ -1859,9 +2598,11 @@ void Dmx::Blackout() {
 
 	for (uint32_t nPortIndex = 0; nPortIndex < DMX_MAX_PORTS; nPortIndex++) {
 		if (m_dmxPortDirection[nPortIndex] == dmx::PortDirection::OUTP) {
-			StopData(nPortIndex);
 			ClearData(nPortIndex);
-			StartData(nPortIndex);
+
+			if (sv_PortState[nPortIndex] == PortState::IDLE) {
+				StartData(nPortIndex);
+			}
 		}
 	}
 
@@ -1873,19 +2614,22 @@ void Dmx::FullOn() {
 
 	for (uint32_t nPortIndex = 0; nPortIndex < DMX_MAX_PORTS; nPortIndex++) {
 		if (m_dmxPortDirection[nPortIndex] == dmx::PortDirection::OUTP) {
-			StopData(nPortIndex);
-
-			auto * __restrict__ p = &s_TxBuffer[nPortIndex];
-			auto *p32 = reinterpret_cast<uint32_t *>(p->dmx.data);
+			auto &txBuffer = s_TxBuffer[nPortIndex];
+			auto &dmx = tx_back_begin(txBuffer);
+			auto *p32 = reinterpret_cast<uint32_t *>(dmx.data);
 
 			for (auto i = 0; i < dmx::buffer::SIZE / 4; i++) {
 				*p32++ = UINT32_MAX;
 			}
 
-			p->dmx.data[0] = dmx::START_CODE;
-			p->dmx.nLength = 513;
+			dmx.data[0] = dmx::START_CODE;
+			dmx.nLength = 513;
+
+			tx_back_end(txBuffer);
 
-			StartData(nPortIndex);
+			if (sv_PortState[nPortIndex] == PortState::IDLE) {
+				StartData(nPortIndex);
+			}
 		}
 	}
 
@@ -1904,11 +2648,11 @@ void Dmx::Sync() {
 	for (uint32_t nPortIndex = 0; nPortIndex < dmx::config::max::PORTS; nPortIndex++) {
 		auto &txBuffer = s_TxBuffer[nPortIndex];
 
-		if (!txBuffer.dmx.bDataPending) {
+		if (!txBuffer.bDataPending) {
 			continue;
 		}
 
-		txBuffer.dmx.bDataPending = false;
+		txBuffer.bDataPending = false;
 
 		if ((sv_PortState[nPortIndex] == dmx::PortState::TX)) {
 			if ((txBuffer.outputStyle == dmx::OutputStyle::DELTA) && (txBuffer.State == dmx::TxRxState::IDLE)) {
@@ -2014,6 +2758,16 @@ const uint8_t *Dmx::GetDmxCurrentData(const uint32_t nPortIndex) {
 	return const_cast<const uint8_t *>(sv_RxBuffer[nPortIndex].Dmx.current.data);
 }
 
+uint32_t Dmx::GetDmxRefreshRate(const uint32_t nPortIndex) const {
+	assert(nPortIndex < dmx::config::max::PORTS);
+	return sv_nTxDmxPackets[nPortIndex].nPerSecond;
+}
+
+uint32_t Dmx::GetDmxPeriodTimeMeasured(const uint32_t nPortIndex) const {
+	assert(nPortIndex < dmx::config::max::PORTS);
+	return sv_TxPeriod[nPortIndex].nMeasured;
+}
+
 uint32_t Dmx::GetDmxUpdatesPerSecond([[maybe_unused]] uint32_t nPortIndex) {
 	assert(nPortIndex < dmx::config::max::PORTS);
 #if !defined(CONFIG_DMX_TRANSMIT_ONLY)
@@ -2023,6 +2777,37 @@ uint32_t Dmx::GetDmxUpdatesPerSecond([[maybe_unused]] uint32_t nPortIndex) {
 #endif
 }
 
+uint32_t Dmx::GetRxIrqsPerSecond([[maybe_unused]] uint32_t nPortIndex) {
+	assert(nPortIndex < dmx::config::max::PORTS);
+#if !defined(CONFIG_DMX_TRANSMIT_ONLY)
+	return sv_nRxIrqs[nPortIndex].nPerSecond;
+#else
+	return 0;
+#endif
+}
+
+#if defined (CONFIG_DMX_RX_ANALYZER)
+void Dmx::GetRxAnalyzer(const uint32_t nPortIndex, const dmx::analyzer::Metric metric, dmx::analyzer::Statistics& statistics) {
+	assert(nPortIndex < dmx::config::max::PORTS);
+	assert(metric < dmx::analyzer::Metric::LAST);
+
+	__disable_irq();
+	statistics = s_RxAnalyzer[nPortIndex].statistics[static_cast<uint32_t>(metric)];
+	__enable_irq();
+}
+
+void Dmx::ResetRxAnalyzer(const uint32_t nPortIndex) {
+	assert(nPortIndex < dmx::config::max::PORTS);
+
+	__disable_irq();
+	for (auto& statistics : s_RxAnalyzer[nPortIndex].statistics) {
+		statistics.Reset();
+	}
+	s_RxAnalyzer[nPortIndex].bHaveBreak = false;
+	__enable_irq();
+}
+#endif
+
 // RDM Send
 
 template <uint32_t nPortIndex, uint32_t nUart>
@@ -2205,6 +2990,52 @@ void Dmx::RdmSendRaw(const uint32_t nPortIndex, const uint8_t *pRdmData, uint32_
 	}
 }
 
+bool Dmx::RdmSendRawQueued([[maybe_unused]] const uint32_t nPortIndex, [[maybe_unused]] const uint8_t *pRdmData, [[maybe_unused]] uint32_t nLength, [[maybe_unused]] const uint32_t nTag) {
+	assert(nPortIndex < dmx::config::max::PORTS);
+	assert(pRdmData != nullptr);
+	assert(nLength != 0);
+
+#if !defined(CONFIG_DMX_TRANSMIT_ONLY)
+	const auto& txBuffer = s_TxBuffer[nPortIndex];
+
+	if ((sv_PortState[nPortIndex] != PortState::TX) || (txBuffer.outputStyle != dmx::OutputStyle::CONTINOUS) || (txBuffer.State == TxRxState::IDLE)) {
+		return false;
+	}
+
+	auto& queue = s_RdmQueue[nPortIndex];
+
+	/*
+	 * When the queue is full, the request is dropped.
+	 * For the controller this is a lost response.
+	 */
+	if (((queue.nHead - queue.nTail) >= dmx::rdm::QUEUE_SIZE) || (nLength > sizeof(queue.request[0].data))) {
+		return true;
+	}
+
+	auto& request = queue.request[queue.nHead & (dmx::rdm::QUEUE_SIZE - 1)];
+
+	memcpy(request.data, pRdmData, nLength);
+	request.nLength = nLength;
+	request.nTag = nTag;
+
+	// There is no response for a broadcast (device id 0xFFFFFFFF)
+	const auto *pRdmMessage = reinterpret_cast<const struct TRdmMessage *>(pRdmData);
+	request.bExpectResponse = (memcmp(&pRdmMessage->destination_uid[2], &UID_ALL[2], RDM_UID_SIZE - 2) != 0);
+
+	__DMB();
+	queue.nHead = queue.nHead + 1;
+
+	return true;
+#else
+	return false;
+#endif
+}
+
+uint32_t Dmx::GetRdmQueueDepth(const uint32_t nPortIndex) const {
+	assert(nPortIndex < dmx::config::max::PORTS);
+	return s_RdmQueue[nPortIndex].nHead - s_RdmQueue[nPortIndex].nTail;
+}
+
 void Dmx::RdmSendDiscoveryRespondMessage(uint32_t nPortIndex, const uint8_t *pRdmData, uint32_t nLength) {
 	assert(nPortIndex < dmx::config::max::PORTS);
 	assert(pRdmData != nullptr);
@@ -2290,6 +3121,33 @@ const uint8_t *Dmx::RdmReceive(const uint32_t nPortIndex) {
 	return p;
 }
 
+/**
+ * The response for a request sent with RdmSendRawQueued.
+ * The next queued request is sent after the response has been read.
+ */
+const uint8_t *Dmx::RdmReceiveQueued([[maybe_unused]] const uint32_t nPortIndex, [[maybe_unused]] uint32_t& nTag) {
+	assert(nPortIndex < dmx::config::max::PORTS);
+
+#if !defined(CONFIG_DMX_TRANSMIT_ONLY)
+	auto& queue = s_RdmQueue[nPortIndex];
+
+	if (!queue.bResponsePending) {
+		return nullptr;
+	}
+
+	nTag = queue.nResponseTag;
+
+	const auto *p = RdmReceive(nPortIndex);
+
+	__DMB();
+	queue.bResponsePending = false;
+
+	return p;
+#else
+	return nullptr;
+#endif
+}
+
 const uint8_t *Dmx::RdmReceiveTimeOut(const uint32_t nPortIndex, uint16_t nTimeOut) {
 	assert(nPortIndex < dmx::config::max::PORTS);
 
@@ -0,0 +1,102 @@
+/**
+ * @file json_get_analyzer.cpp
+ *
+ */
+/* Copyright (C) 2024 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#if defined (CONFIG_DMX_RX_ANALYZER)
+#include <cstdint>
+#include <cstdio>
+
+#include "dmx.h"
+#include "dmxanalyzer.h"
+
+namespace remoteconfig {
+namespace dmx {
+static uint32_t get_array(const uint32_t *pValues, const uint32_t nCount, char *pOutBuffer, const uint32_t nOutBufferSize) {
+	uint32_t nLength = 0;
+
+	for (uint32_t i = 0; (i < nCount) && (nLength < nOutBufferSize); i++) {
+		nLength += static_cast<uint32_t>(snprintf(&pOutBuffer[nLength], nOutBufferSize - nLength, "%s%u", (i == 0) ? "" : ",", static_cast<unsigned int>(pValues[i])));
+	}
+
+	return nLength;
+}
+
+static uint32_t get_statistics(const ::dmx::analyzer::Metric metric, const ::dmx::analyzer::Statistics& statistics, char *pOutBuffer, const uint32_t nOutBufferSize) {
+	auto nLength = static_cast<uint32_t>(snprintf(pOutBuffer, nOutBufferSize,
+			"\"%s\":{\"count\":\"%u\",\"min\":\"%u\",\"max\":\"%u\",\"mean\":\"%u\",\"limits\":[",
+			::dmx::analyzer::METRIC_NAME[static_cast<uint32_t>(metric)],
+			static_cast<unsigned int>(statistics.nCount),
+			static_cast<unsigned int>(statistics.GetMin()),
+			static_cast<unsigned int>(statistics.nMax),
+			static_cast<unsigned int>(statistics.GetMean())));
+
+	if (nLength < nOutBufferSize) {
+		nLength += get_array(::dmx::analyzer::BUCKET_LIMITS[static_cast<uint32_t>(metric)], ::dmx::analyzer::BUCKETS - 1, &pOutBuffer[nLength], nOutBufferSize - nLength);
+	}
+
+	if (nLength < nOutBufferSize) {
+		nLength += static_cast<uint32_t>(snprintf(&pOutBuffer[nLength], nOutBufferSize - nLength, "],\"histogram\":["));
+	}
+
+	if (nLength < nOutBufferSize) {
+		nLength += get_array(statistics.nBucket, ::dmx::analyzer::BUCKETS, &pOutBuffer[nLength], nOutBufferSize - nLength);
+	}
+
+	if (nLength < nOutBufferSize) {
+		nLength += static_cast<uint32_t>(snprintf(&pOutBuffer[nLength], nOutBufferSize - nLength, "]},"));
+	}
+
+	return nLength;
+}
+
+/**
+ * histogram[i] counts the values from limits[i - 1] up to limits[i], the last bucket counts the values from the last limit.
+ */
+uint32_t json_get_analyzer(const char cPort, char *pOutBuffer, const uint32_t nOutBufferSize) {
+	const auto nPortIndex = static_cast<uint32_t>((cPort | 0x20) - 'a');
+
+	if (nPortIndex >= ::dmx::config::max::PORTS) {
+		return 0;
+	}
+
+	auto nLength = static_cast<uint32_t>(snprintf(pOutBuffer, nOutBufferSize, "{\"port\":\"%c\",", static_cast<char>('A' + nPortIndex)));
+
+	for (uint32_t i = 0; (i < static_cast<uint32_t>(::dmx::analyzer::Metric::LAST)) && (nLength < nOutBufferSize); i++) {
+		const auto metric = static_cast<::dmx::analyzer::Metric>(i);
+		::dmx::analyzer::Statistics statistics;
+		Dmx::Get()->GetRxAnalyzer(nPortIndex, metric, statistics);
+		nLength += get_statistics(metric, statistics, &pOutBuffer[nLength], nOutBufferSize - nLength);
+	}
+
+	if (nLength >= nOutBufferSize) {
+		return 0;
+	}
+
+	pOutBuffer[nLength - 1] = '}';
+
+	return nLength;
+}
+}  // namespace dmx
+}  // namespace remoteconfig
+#endif
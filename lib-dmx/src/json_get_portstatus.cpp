@@ -38,11 +38,19 @@ uint32_t json_get_portstatus(const char cPort, char *pOutBuffer, const uint32_t
 		auto& statistics = Dmx::Get()->GetTotalStatistics(nPortIndex);
 		auto nLength = static_cast<uint32_t>(snprintf(pOutBuffer, nOutBufferSize,
 				"{\"port\":\"%c\","
-				"\"dmx\":{\"sent\":\"%u\",\"received\":\"%u\"},"
-				"\"rdm\":{\"sent\":{\"class\":\"%u\",\"discovery\":\"%u\"},\"received\":{\"good\":\"%u\",\"bad\":\"%u\",\"discovery\":\"%u\"}}}",
+				"\"dmx\":{\"sent\":\"%u\",\"received\":\"%u\",\"refresh\":\"%u\",\"period\":{\"configured\":\"%u\",\"measured\":\"%u\"},"
+				"\"break\":\"%u\",\"mab\":\"%u\",\"slots\":\"%u\"},"
+				"\"rdm\":{\"queue\":\"%u\",\"sent\":{\"class\":\"%u\",\"discovery\":\"%u\"},\"received\":{\"good\":\"%u\",\"bad\":\"%u\",\"discovery\":\"%u\"}}}",
 				static_cast<char>('A' + nPortIndex),
 				static_cast<unsigned int>(statistics.Dmx.Sent),
 				static_cast<unsigned int>(statistics.Dmx.Received),
+				static_cast<unsigned int>(Dmx::Get()->GetDmxRefreshRate(nPortIndex)),
+				static_cast<unsigned int>(Dmx::Get()->GetDmxPeriodTime(nPortIndex)),
+				static_cast<unsigned int>(Dmx::Get()->GetDmxPeriodTimeMeasured(nPortIndex)),
+				static_cast<unsigned int>(Dmx::Get()->GetDmxBreakTime(nPortIndex)),
+				static_cast<unsigned int>(Dmx::Get()->GetDmxMabTime(nPortIndex)),
+				static_cast<unsigned int>(Dmx::Get()->GetDmxSlots(nPortIndex)),
+				static_cast<unsigned int>(Dmx::Get()->GetRdmQueueDepth(nPortIndex)),
 				static_cast<unsigned int>(statistics.Rdm.Sent.Class),
 				static_cast<unsigned int>(statistics.Rdm.Sent.DiscoveryResponse),
 				static_cast<unsigned int>(statistics.Rdm.Received.Good),
@@ -0,0 +1,193 @@
+/**
+ * @file analyzer_histogram.cpp
+ *
+ * Host test: DMX input line analyzer statistics, histogram buckets and JSON
+ */
+/* Copyright (C) 2024 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+#include "dmx.h"
+#include "dmxanalyzer.h"
+
+namespace remoteconfig {
+namespace dmx {
+uint32_t json_get_analyzer(const char cPort, char *pOutBuffer, const uint32_t nOutBufferSize);
+}  // namespace dmx
+}  // namespace remoteconfig
+
+using dmx::analyzer::BUCKETS;
+using dmx::analyzer::BUCKET_LIMITS;
+using dmx::analyzer::Metric;
+using dmx::analyzer::Statistics;
+
+static constexpr auto METRICS = static_cast<uint32_t>(Metric::LAST);
+
+static constexpr bool is_ascending() {
+	for (uint32_t m = 0; m < METRICS; m++) {
+		for (uint32_t i = 1; i < (BUCKETS - 1); i++) {
+			if (BUCKET_LIMITS[m][i] <= BUCKET_LIMITS[m][i - 1]) {
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+static_assert(is_ascending(), "BUCKET_LIMITS must be ascending");
+
+static int s_nFailed;
+
+static void check(const bool isOk, const char *pName, const uint32_t nValue, const uint32_t nExpected) {
+	if (!isOk) {
+		s_nFailed++;
+		printf("FAIL %s: %u, expected %u\n", pName, static_cast<unsigned>(nValue), static_cast<unsigned>(nExpected));
+	}
+}
+
+static void check_equal(const char *pName, const uint32_t nValue, const uint32_t nExpected) {
+	check(nValue == nExpected, pName, nValue, nExpected);
+}
+
+/**
+ * Each limit is the first value of the next bucket
+ */
+static void test_buckets() {
+	for (uint32_t m = 0; m < METRICS; m++) {
+		const auto metric = static_cast<Metric>(m);
+		const auto *pName = dmx::analyzer::METRIC_NAME[m];
+
+		check_equal(pName, Statistics::GetBucket(0, metric), 0);
+
+		for (uint32_t i = 0; i < (BUCKETS - 1); i++) {
+			check_equal(pName, Statistics::GetBucket(BUCKET_LIMITS[m][i] - 1, metric), i);
+			check_equal(pName, Statistics::GetBucket(BUCKET_LIMITS[m][i], metric), i + 1);
+		}
+
+		check_equal(pName, Statistics::GetBucket(UINT32_MAX, metric), BUCKETS - 1);
+	}
+
+	puts("buckets: done");
+}
+
+static void test_statistics() {
+	Statistics statistics;
+	statistics.Reset();
+
+	check_equal("empty count", statistics.nCount, 0);
+	check_equal("empty min", statistics.GetMin(), 0);
+	check_equal("empty mean", statistics.GetMean(), 0);
+	check_equal("empty max", statistics.nMax, 0);
+
+	/*
+	 * 1000 frames: 900 with a 176us BREAK, 99 with 100us, 1 short BREAK of 60us.
+	 * A value equal to a limit is counted in the next bucket.
+	 */
+	for (uint32_t i = 0; i < 900; i++) {
+		statistics.Add(176, Metric::BREAK);
+	}
+	for (uint32_t i = 0; i < 99; i++) {
+		statistics.Add(100, Metric::BREAK);
+	}
+	statistics.Add(60, Metric::BREAK);
+
+	check_equal("count", statistics.nCount, 1000);
+	check_equal("min", statistics.GetMin(), 60);
+	check_equal("max", statistics.nMax, 176);
+	check_equal("mean", statistics.GetMean(), (900 * 176 + 99 * 100 + 60) / 1000);
+
+	const uint32_t histogram[BUCKETS] = { 1, 0, 99, 0, 900, 0, 0, 0 };
+	uint32_t nTotal = 0;
+
+	for (uint32_t i = 0; i < BUCKETS; i++) {
+		check_equal("histogram", statistics.nBucket[i], histogram[i]);
+		nTotal += statistics.nBucket[i];
+	}
+
+	check_equal("histogram total", nTotal, statistics.nCount);
+
+	statistics.Reset();
+
+	check_equal("reset count", statistics.nCount, 0);
+	check_equal("reset min", statistics.GetMin(), 0);
+
+	for (uint32_t i = 0; i < BUCKETS; i++) {
+		check_equal("reset histogram", statistics.nBucket[i], 0);
+	}
+
+	puts("statistics: done");
+}
+
+static void test_json() {
+	auto *pDmx = Dmx::Get();
+
+	for (auto& port : pDmx->m_Statistics) {
+		for (auto& statistics : port) {
+			statistics.Reset();
+		}
+	}
+
+	auto& brk = pDmx->m_Statistics[1][static_cast<uint32_t>(Metric::BREAK)];
+	brk.Add(92, Metric::BREAK);
+	brk.Add(108, Metric::BREAK);
+
+	auto& period = pDmx->m_Statistics[1][static_cast<uint32_t>(Metric::PERIOD)];
+	period.Add(22754, Metric::PERIOD);
+
+	char buffer[1024];
+	const auto nLength = remoteconfig::dmx::json_get_analyzer('b', buffer, sizeof(buffer));
+
+	static constexpr char EXPECTED[] =
+			"{\"port\":\"B\","
+			"\"break\":{\"count\":\"2\",\"min\":\"92\",\"max\":\"108\",\"mean\":\"100\",\"limits\":[88,100,120,176,500,1000,10000],\"histogram\":[0,1,1,0,0,0,0,0]},"
+			"\"mab\":{\"count\":\"0\",\"min\":\"0\",\"max\":\"0\",\"mean\":\"0\",\"limits\":[8,12,16,24,88,1000,10000],\"histogram\":[0,0,0,0,0,0,0,0]},"
+			"\"interslot\":{\"count\":\"0\",\"min\":\"0\",\"max\":\"0\",\"mean\":\"0\",\"limits\":[1,2,4,8,16,32,100],\"histogram\":[0,0,0,0,0,0,0,0]},"
+			"\"period\":{\"count\":\"1\",\"min\":\"22754\",\"max\":\"22754\",\"mean\":\"22754\",\"limits\":[1204,10000,22728,25000,33334,100000,1000000],\"histogram\":[0,0,0,1,0,0,0,0]}}";
+
+	check_equal("json length", nLength, sizeof(EXPECTED) - 1);
+
+	if ((nLength != sizeof(EXPECTED) - 1) || (memcmp(buffer, EXPECTED, nLength) != 0)) {
+		s_nFailed++;
+		printf("FAIL json\n%.*s\n", static_cast<int>(nLength), buffer);
+	}
+
+	check_equal("json port out of range", remoteconfig::dmx::json_get_analyzer('e', buffer, sizeof(buffer)), 0);
+	check_equal("json buffer too small", remoteconfig::dmx::json_get_analyzer('a', buffer, 64), 0);
+
+	puts("json: done");
+}
+
+int main() {
+	test_buckets();
+	test_statistics();
+	test_json();
+
+	if (s_nFailed != 0) {
+		printf("%d failed\n", s_nFailed);
+		return 1;
+	}
+
+	puts("ok");
+	return 0;
+}
@@ -0,0 +1,36 @@
+/**
+ * @file dmx.h
+ *
+ * Host stub, the analyzer statistics are set by the test
+ */
+
+#ifndef DMX_H_
+#define DMX_H_
+
+#include <cstdint>
+
+#include "dmxanalyzer.h"
+
+namespace dmx {
+namespace config {
+namespace max {
+static constexpr uint32_t PORTS = 4;
+}  // namespace max
+}  // namespace config
+}  // namespace dmx
+
+class Dmx {
+public:
+	void GetRxAnalyzer(const uint32_t nPortIndex, const dmx::analyzer::Metric metric, dmx::analyzer::Statistics& statistics) {
+		statistics = m_Statistics[nPortIndex][static_cast<uint32_t>(metric)];
+	}
+
+	dmx::analyzer::Statistics m_Statistics[dmx::config::max::PORTS][static_cast<uint32_t>(dmx::analyzer::Metric::LAST)];
+
+	static Dmx *Get() {
+		static Dmx s_Dmx;
+		return &s_Dmx;
+	}
+};
+
+#endif /* DMX_H_ */
@@ -42,6 +42,11 @@ struct OptionsMask {
 	static constexpr auto FORCE_SYNCHRONIZATION = (1U << 5);///< Force Synchronization: Bit 5
 };
 
+namespace startcode {
+static constexpr uint8_t DMX = 0x00;
+static constexpr uint8_t PER_ADDRESS_PRIORITY = 0xDD;	///< ETC: 1 priority per slot, 0 = the slot is not sourced
+}  // namespace startcode
+
 namespace universe {
 static constexpr auto DEFAULT = 1;
 static constexpr auto MAX = 63999;
@@ -36,6 +36,7 @@
 
 #include "lightset.h"
 #include "lightsetdata.h"
+#include "lightsetportindex.h"
 
 #if !(ARTNET_VERSION >= 4)
 # if defined(OUTPUT_DMX_SEND) || defined(OUTPUT_DMX_SEND_MULTI)
@@ -66,6 +67,11 @@ namespace e131bridge {
  static constexpr uint32_t MAX_PORTS = LIGHTSET_PORTS;
 #endif
 
+/**
+ * The depth of the per port source table. A source that does not fit is dropped.
+ */
+static constexpr uint32_t MAX_SOURCES = lightset::MAX_SOURCES;
+
  enum class Status : uint8_t {
  	OFF, STANDBY, ON
  };
@@ -74,11 +80,8 @@ struct State {
 	uint32_t SynchronizationTime;
 	uint32_t DiscoveryTime;
 	uint16_t DiscoveryPacketLength;
-	uint16_t nSynchronizationAddressSourceA;
-	uint16_t nSynchronizationAddressSourceB;
 	uint8_t nEnabledInputPorts;
 	uint8_t nEnableOutputPorts;
-	uint8_t nPriority;
 	uint8_t nReceivingDmx;
 	lightset::FailSafe failsafe;
 	e131bridge::Status status;
@@ -101,14 +104,31 @@ struct Bridge {
 
 struct Source {
 	uint32_t nMillis;
-	uint32_t nIp;
+	uint32_t nIp;					///< 0 = slot is free
 	uint8_t cid[e131::CID_LENGTH];
+	uint16_t nSynchronizationAddress;
 	uint8_t nSequenceNumberData;
+#if defined (E131_HAVE_PER_ADDRESS_PRIORITY)
+	uint8_t nPriority;				///< Packet priority, the slot priority when no 0xDD is received
+	uint32_t nSlotPriorityMillis;	///< Latest 0xDD received
+#endif
 };
 
+/**
+ * All the sources in the table have the priority nPriority, the highest received.
+ * These are merged, a source with a lower priority is ignored.
+ */
 struct OutputPort {
-	Source sourceA ALIGNED;
-	Source sourceB ALIGNED;
+	Source source[MAX_SOURCES] ALIGNED;
+	uint32_t nSourcesJoined;
+	uint32_t nSourcesLeft;
+	uint32_t nSourcesDropped;		///< The source table was full
+	uint8_t nPriority;
+	uint8_t nPriorityThreshold;		///< Sources with a lower priority are ignored
+#if defined (E131_HAVE_PER_ADDRESS_PRIORITY)
+	uint32_t nSlotPriorityMask;		///< Bit n is set when source n sends per-address priority (0xDD)
+	bool bSlotPriority;				///< The sources are merged with the slot priorities
+#endif
 	lightset::MergeMode mergeMode;
 	lightset::OutputStyle outputStyle;
 	bool IsMerging;
@@ -240,6 +260,48 @@ public:
 		return m_InputPort[nPortIndex].nPriority;
 	}
 
+	/**
+	 * Output port: sources with a priority below nPriority are ignored.
+	 */
+	void SetPriorityThreshold(const uint32_t nPortIndex, uint8_t nPriority) {
+		assert(nPortIndex < e131bridge::MAX_PORTS);
+		if (nPriority <= e131::priority::HIGHEST) {
+			m_OutputPort[nPortIndex].nPriorityThreshold = nPriority;
+		}
+	}
+	uint8_t GetPriorityThreshold(const uint32_t nPortIndex) const {
+		assert(nPortIndex < e131bridge::MAX_PORTS);
+		return m_OutputPort[nPortIndex].nPriorityThreshold;
+	}
+
+	/**
+	 * Output port: the priority of the sources being merged.
+	 */
+	uint8_t GetOutputPriority(const uint32_t nPortIndex) const {
+		assert(nPortIndex < e131bridge::MAX_PORTS);
+		return m_OutputPort[nPortIndex].nPriority;
+	}
+
+	uint32_t GetActiveSources(const uint32_t nPortIndex) const {
+		assert(nPortIndex < e131bridge::MAX_PORTS);
+		return static_cast<uint32_t>(__builtin_popcount(GetSourceMask(nPortIndex)));
+	}
+
+	uint32_t GetSourcesJoined(const uint32_t nPortIndex) const {
+		assert(nPortIndex < e131bridge::MAX_PORTS);
+		return m_OutputPort[nPortIndex].nSourcesJoined;
+	}
+
+	uint32_t GetSourcesLeft(const uint32_t nPortIndex) const {
+		assert(nPortIndex < e131bridge::MAX_PORTS);
+		return m_OutputPort[nPortIndex].nSourcesLeft;
+	}
+
+	uint32_t GetSourcesDropped(const uint32_t nPortIndex) const {
+		assert(nPortIndex < e131bridge::MAX_PORTS);
+		return m_OutputPort[nPortIndex].nSourcesDropped;
+	}
+
 	void SetInputDisabled(const uint32_t nPortIndex, const bool bDisable) {
 		assert(nPortIndex < e131bridge::MAX_PORTS);
 		m_InputPort[nPortIndex].IsDisabled = bDisable;
@@ -299,12 +361,22 @@ public:
 
 	void Run() {
 		uint16_t nForeignPort;
-
-		const auto nBytesReceived = Network::Get()->RecvFrom(m_nHandle, const_cast<const void **>(reinterpret_cast<void **>(&m_pReceiveBuffer)), &m_nIpAddressFrom, &nForeignPort) ;
+		uint32_t nPacketsReceived = 0;
 
 		m_nCurrentPacketMillis = Hardware::Get()->Millis();
 
-		if (__builtin_expect((nBytesReceived == 0), 1)) {
+		/*
+		 * Drain all the pending packets
+		 */
+		while (Network::Get()->RecvFrom(m_nHandle, const_cast<const void **>(reinterpret_cast<void **>(&m_pReceiveBuffer)), &m_nIpAddressFrom, &nForeignPort) != 0) {
+			nPacketsReceived++;
+
+			if (__builtin_expect((IsValidRoot()), 1)) {
+				Process();
+			}
+		}
+
+		if (__builtin_expect((nPacketsReceived == 0), 1)) {
 			if (m_State.nEnableOutputPorts != 0) {
 				if ((m_nCurrentPacketMillis - m_nPreviousPacketMillis) >= static_cast<uint32_t>(e131::NETWORK_DATA_LOSS_TIMEOUT_SECONDS * 1000)) {
 					if ((m_pLightSet != nullptr) && (!m_State.IsNetworkDataLoss)) {
@@ -334,12 +406,6 @@ public:
 			return;
 		}
 
-		if (__builtin_expect((!IsValidRoot()), 0)) {
-			return;
-		}
-
-		Process();
-
 #if !(ARTNET_VERSION >= 4)
 		if ((m_nCurrentPacketMillis - m_nPreviousLedpanelMillis) > 200) {
 			m_nPreviousLedpanelMillis = m_nCurrentPacketMillis;
@@ -375,19 +441,54 @@ private:
 	bool IsValidRoot();
 	bool IsValidDataPacket();
 
-	void SetNetworkDataLossCondition(bool bSourceA = true, bool bSourceB = true);
+	void SetNetworkDataLossCondition();
+	void SetPortDataLossCondition(const uint32_t nPortIndex);
+	void ApplyFailSafe();
+
+	void SetSynchronizationAddress(e131bridge::Source& source, const uint16_t nSynchronizationAddress);
+	bool IsSynchronizationAddress(const uint16_t nSynchronizationAddress) const;
 
-	void SetSynchronizationAddress(bool bSourceA, bool bSourceB, uint16_t nSynchronizationAddress);
+	uint32_t GetSourceMask(const uint32_t nPortIndex) const {
+		uint32_t nSourceMask = 0;
 
-	void CheckMergeTimeouts(uint32_t nPortIndex);
-	bool IsPriorityTimeOut(uint32_t nPortIndex) const;
-	bool isIpCidMatch(const e131bridge::Source *const) const;
+		for (uint32_t nSourceIndex = 0; nSourceIndex < e131bridge::MAX_SOURCES; nSourceIndex++) {
+			if (m_OutputPort[nPortIndex].source[nSourceIndex].nIp != 0) {
+				nSourceMask |= (1U << nSourceIndex);
+			}
+		}
+
+		return nSourceMask;
+	}
+
+	uint32_t FindSource(const uint32_t nPortIndex) const;
+	uint32_t JoinSource(const uint32_t nPortIndex);
+	void LeaveSource(const uint32_t nPortIndex, const uint32_t nSourceIndex);
+	void LeaveSources(const uint32_t nPortIndex, const uint32_t nKeepSourceIndex = e131bridge::MAX_SOURCES);
+
+	bool IsSlotPriority([[maybe_unused]] const uint32_t nPortIndex, [[maybe_unused]] const uint8_t nStartCode) const {
+#if defined (E131_HAVE_PER_ADDRESS_PRIORITY)
+		return m_OutputPort[nPortIndex].bSlotPriority || (nStartCode == e131::startcode::PER_ADDRESS_PRIORITY);
+#else
+		return false;
+#endif
+	}
+
+#if defined (E131_HAVE_PER_ADDRESS_PRIORITY)
+	void SetSlotPriority(const uint32_t nPortIndex, const uint32_t nSourceIndex, const uint8_t *pPriority, const uint32_t nLength);
+	void SetSourcePriority(const uint32_t nPortIndex, const uint32_t nSourceIndex, const uint8_t nPriority);
+	void CheckSlotPriorityTimeouts(const uint32_t nPortIndex);
+	void MergeSlotPriority(const uint32_t nPortIndex, const uint32_t nSourceIndex, const uint8_t *pData, const uint32_t nLength);
+#endif
+
+	void CheckMergeTimeouts(const uint32_t nPortIndex, const uint32_t nSourceIndex);
+	bool IsPriorityTimeOut(const uint32_t nPortIndex, const uint32_t nSourceIndex) const;
 	void UpdateMergeStatus(const uint32_t nPortIndex);
 
 	void HandleDmx();
 	void HandleSynchronization();
 
 	void LeaveUniverse(uint32_t nPortIndex, uint16_t nUniverse);
+	void UpdatePortIndex();
 
 	void HandleDmxIn();
 	void SetLocalMerging();
@@ -407,6 +508,10 @@ private:
 	e131bridge::Bridge m_Bridge;
 	e131bridge::OutputPort m_OutputPort[e131bridge::MAX_PORTS];
 	e131bridge::InputPort m_InputPort[e131bridge::MAX_PORTS];
+	lightset::PortIndex<e131bridge::MAX_PORTS> m_PortIndex;	///< Universe -> enabled ports
+#if defined (E131_HAVE_PER_ADDRESS_PRIORITY)
+	uint8_t m_SlotPriority[e131bridge::MAX_PORTS][e131bridge::MAX_SOURCES][lightset::dmx::UNIVERSE_SIZE] ALIGNED;
+#endif
 
 	bool m_bEnableDataIndicator { true };
 
@@ -69,8 +69,12 @@ struct Params {
 	uint32_t nDestinationIp[e131params::MAX_PORTS];
 	// sACN E1.31
 	uint8_t nPriority[e131params::MAX_PORTS];
+	// Per slot merge mode
+	uint16_t nLtpSlots[e131params::MAX_PORTS][2];	///< first and last LTP slot, 1 based
+	// sACN E1.31 output
+	uint8_t nPriorityThreshold[e131params::MAX_PORTS];
 	// Reserved
-	uint8_t Filler2[40];
+	uint8_t Filler2[20];
 } __attribute__((packed));
 
  static_assert(sizeof(struct Params) <= 320, "struct Params is too large");
@@ -96,6 +100,10 @@ struct Mask {
 	static constexpr uint32_t LABEL_C   			= (1U << 9);
 	static constexpr uint32_t LABEL_D   			= (1U << 10);
 	static constexpr uint32_t DISABLE_MERGE_TIMEOUT	= (1U << 11);
+	static constexpr uint32_t LTP_SLOTS_A			= (1U << 12);
+	static constexpr uint32_t LTP_SLOTS_B			= (1U << 13);
+	static constexpr uint32_t LTP_SLOTS_C			= (1U << 14);
+	static constexpr uint32_t LTP_SLOTS_D			= (1U << 15);
 	// Art-Net 4
 	static constexpr uint32_t ENABLE_RDM    		= (1U << 16);
 	static constexpr uint32_t MAP_UNIVERSE0 		= (1U << 17);
@@ -105,9 +113,13 @@ struct Mask {
 	static constexpr uint32_t DESTINATION_IP_D    	= (1U << 21);
 	// sACN E1.31
 	static constexpr uint32_t PRIORITY_A    		= (1U << 22);
-	static constexpr uint32_t PRIORITY_B    		= (1U << 22);
-	static constexpr uint32_t PRIORITY_C    		= (1U << 23);
-	static constexpr uint32_t PRIORITY_D    		= (1U << 24);
+	static constexpr uint32_t PRIORITY_B    		= (1U << 23);
+	static constexpr uint32_t PRIORITY_C    		= (1U << 24);
+	static constexpr uint32_t PRIORITY_D    		= (1U << 25);
+	static constexpr uint32_t PRIORITY_THRESHOLD_A	= (1U << 26);
+	static constexpr uint32_t PRIORITY_THRESHOLD_B	= (1U << 27);
+	static constexpr uint32_t PRIORITY_THRESHOLD_C	= (1U << 28);
+	static constexpr uint32_t PRIORITY_THRESHOLD_D	= (1U << 29);
 };
 }
 
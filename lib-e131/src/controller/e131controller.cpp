@@ -214,19 +214,28 @@ void E131Controller::HandleDmxOut(uint16_t nUniverse, const uint8_t *pDmxData, u
 	// Data Layer
 	m_pE131DataPacket->DMPLayer.FlagsLength = __builtin_bswap16(static_cast<uint16_t>((0x07 << 12) | (DATA_LAYER_LENGTH(1U + nLength))));
 
+	m_pE131DataPacket->DMPLayer.PropertyValueCount = __builtin_bswap16(static_cast<uint16_t>(1 + nLength));
+
+	/*
+	 * Zero-copy: the layers up to and including the START Code are copied into the Tx buffer,
+	 * the slots are written in place.
+	 */
+	auto *pE131DataPacket = reinterpret_cast<struct TE131DataPacket *>(Network::Get()->GetSendBuffer(m_nHandle, nIp, e131::UDP_PORT));
+	memcpy(pE131DataPacket, m_pE131DataPacket, DATA_PACKET_SIZE(1U));
+
+	auto *pSlots = &pE131DataPacket->DMPLayer.PropertyValues[1];
+
 	if (__builtin_expect((m_nMaster == DMX_MAX_VALUE), 1)) {
-		memcpy(&m_pE131DataPacket->DMPLayer.PropertyValues[1], pDmxData, nLength);
+		memcpy(pSlots, pDmxData, nLength);
 	} else if (m_nMaster == 0) {
-		memset(&m_pE131DataPacket->DMPLayer.PropertyValues[1], 0, nLength);
+		memset(pSlots, 0, nLength);
 	} else {
 		for (uint32_t i = 0; i < nLength; i++) {
-			m_pE131DataPacket->DMPLayer.PropertyValues[1 + i] = static_cast<uint8_t>((m_nMaster * pDmxData[i]) / DMX_MAX_VALUE);
+			pSlots[i] = static_cast<uint8_t>((m_nMaster * pDmxData[i]) / DMX_MAX_VALUE);
 		}
 	}
 
-	m_pE131DataPacket->DMPLayer.PropertyValueCount = __builtin_bswap16(static_cast<uint16_t>(1 + nLength));
-
-	Network::Get()->SendTo(m_nHandle, m_pE131DataPacket, static_cast<uint16_t>(DATA_PACKET_SIZE(1U + nLength)), nIp, e131::UDP_PORT);
+	Network::Get()->SendBuffer(DATA_PACKET_SIZE(1U + nLength));
 }
 
 void E131Controller::HandleSync() {
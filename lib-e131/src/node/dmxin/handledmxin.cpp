@@ -61,10 +61,25 @@ void E131Bridge::FillDataPacket() {
 }
 
 static uint32_t s_ReceivingMask = 0;
+static uint32_t s_nPortIndexResume = 0;	///< The port where the previous call stopped, the Tx descriptor ring was full
 
 void E131Bridge::HandleDmxIn() {
-	for (uint32_t nPortIndex = 0 ; nPortIndex < e131bridge::MAX_PORTS; nPortIndex++) {
+	for (uint32_t i = 0; i < e131bridge::MAX_PORTS; i++) {
+		auto nPortIndex = s_nPortIndexResume + i;
+
+		if (nPortIndex >= e131bridge::MAX_PORTS) {
+			nPortIndex -= e131bridge::MAX_PORTS;
+		}
+
 		if ((m_Bridge.Port[nPortIndex].direction == lightset::PortDir::INPUT) && (!m_InputPort[nPortIndex].IsDisabled)) {
+			/*
+			 * The Tx descriptor ring is full, the next call starts with this port.
+			 * The changed data is kept by GetDmxChanged.
+			 */
+			if (__builtin_expect((Network::Get()->GetSendAvailable() == 0), 0)) {
+				s_nPortIndexResume = nPortIndex;
+				return;
+			}
 
 			const auto *const pDmxData = reinterpret_cast<const struct Data *>(Dmx::Get()->GetDmxChanged(nPortIndex));
 
@@ -67,12 +67,15 @@ E131Bridge::E131Bridge() {
 		port.direction = lightset::PortDir::DISABLE;
 	}
 
+	UpdatePortIndex();
+
 	memset(&m_State, 0, sizeof(e131bridge::State));
-	m_State.nPriority = e131::priority::LOWEST;
 	m_State.failsafe = lightset::FailSafe::HOLD;
 
 	for (uint32_t i = 0; i < e131bridge::MAX_PORTS; i++) {
 		memset(&m_OutputPort[i], 0, sizeof(e131bridge::OutputPort));
+		m_OutputPort[i].nPriority = e131::priority::LOWEST;
+		m_OutputPort[i].nPriorityThreshold = e131::priority::LOWEST;
 		memset(&m_InputPort[i], 0, sizeof(e131bridge::InputPort));
 		m_InputPort[i].nPriority = 100;
 	}
@@ -153,42 +156,49 @@ void E131Bridge::Stop() {
 	Hardware::Get()->SetMode(hardware::ledblink::Mode::OFF_OFF);
 }
 
-void E131Bridge::SetSynchronizationAddress(bool bSourceA, bool bSourceB, uint16_t nSynchronizationAddress) {
+void E131Bridge::SetSynchronizationAddress(e131bridge::Source& source, const uint16_t nSynchronizationAddress) {
 	DEBUG_ENTRY
-	DEBUG_PRINTF("bSourceA=%d, bSourceB=%d, nSynchronizationAddress=%d", bSourceA, bSourceB, nSynchronizationAddress);
+	DEBUG_PRINTF("nSynchronizationAddress=%d", nSynchronizationAddress);
 
 	assert(nSynchronizationAddress != 0);
 
-	uint16_t *pSynchronizationAddressSource;
-
-	if (bSourceA) {
-		pSynchronizationAddressSource = &m_State.nSynchronizationAddressSourceA;
-	} else if (bSourceB) {
-		pSynchronizationAddressSource = &m_State.nSynchronizationAddressSourceB;
-	} else {
+	if (source.nSynchronizationAddress == nSynchronizationAddress) {
+		DEBUG_PUTS("Already received SynchronizationAddress");
 		DEBUG_EXIT
-		return; // Just make the compiler happy
+		return;
 	}
 
-	if (*pSynchronizationAddressSource == 0) {
-		*pSynchronizationAddressSource = nSynchronizationAddress;
-		DEBUG_PUTS("SynchronizationAddressSource == 0");
-	} else if (*pSynchronizationAddressSource != nSynchronizationAddress) {
+	const auto nPreviousSynchronizationAddress = source.nSynchronizationAddress;
+	source.nSynchronizationAddress = 0;
+
+	const auto isJoined = IsSynchronizationAddress(nSynchronizationAddress);
+
+	if ((nPreviousSynchronizationAddress != 0) && !IsSynchronizationAddress(nPreviousSynchronizationAddress)) {
 		// e131bridge::MAX_PORTS forces to check all ports
-		LeaveUniverse(e131bridge::MAX_PORTS, *pSynchronizationAddressSource);
-		*pSynchronizationAddressSource = nSynchronizationAddress;
-		DEBUG_PUTS("SynchronizationAddressSource != nSynchronizationAddress");
-	} else {
-		DEBUG_PUTS("Already received SynchronizationAddress");
-		DEBUG_EXIT
-		return;
+		LeaveUniverse(e131bridge::MAX_PORTS, nPreviousSynchronizationAddress);
 	}
 
-	Network::Get()->JoinGroup(m_nHandle, e131::universe_to_multicast_ip(nSynchronizationAddress));
+	source.nSynchronizationAddress = nSynchronizationAddress;
+
+	if (!isJoined) {
+		Network::Get()->JoinGroup(m_nHandle, e131::universe_to_multicast_ip(nSynchronizationAddress));
+	}
 
 	DEBUG_EXIT
 }
 
+bool E131Bridge::IsSynchronizationAddress(const uint16_t nSynchronizationAddress) const {
+	for (const auto& outputPort : m_OutputPort) {
+		for (const auto& source : outputPort.source) {
+			if ((source.nIp != 0) && (source.nSynchronizationAddress == nSynchronizationAddress)) {
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
 void E131Bridge::LeaveUniverse(uint32_t nPortIndex, uint16_t nUniverse) {
 	DEBUG_ENTRY
 	DEBUG_PRINTF("nPortIndex=%d, nUniverse=%d", nPortIndex, nUniverse);
@@ -235,12 +245,12 @@ void E131Bridge::SetLocalMerging() {
 
 			if (m_Bridge.Port[nInputPortIndex].nUniverse == m_Bridge.Port[nOutputPortIndex].nUniverse) {
 
-				if (!m_Bridge.Port[nOutputPortIndex].bLocalMerge) {
-					m_OutputPort[nOutputPortIndex].sourceA.nIp = Network::Get()->GetIp();
-					DEBUG_PUTS("Local merge Source A");
-				} else {
-					m_OutputPort[nOutputPortIndex].sourceB.nIp = Network::Get()->GetIp();
-					DEBUG_PUTS("Local merge Source B");
+				for (auto& source : m_OutputPort[nOutputPortIndex].source) {
+					if (source.nIp == 0) {
+						source.nIp = Network::Get()->GetIp();
+						DEBUG_PUTS("Local merge source");
+						break;
+					}
 				}
 
 				DEBUG_PUTS("");
@@ -280,6 +290,7 @@ void E131Bridge::SetUniverse(const uint32_t nPortIndex, const lightset::PortDir
 #endif
 
 		m_Bridge.Port[nPortIndex].direction = lightset::PortDir::DISABLE;
+		UpdatePortIndex();
 
 		DEBUG_EXIT
 		return;
@@ -300,6 +311,7 @@ void E131Bridge::SetUniverse(const uint32_t nPortIndex, const lightset::PortDir
 		m_Bridge.Port[nPortIndex].direction = lightset::PortDir::INPUT;
 		m_Bridge.Port[nPortIndex].nUniverse = nUniverse;
 		m_InputPort[nPortIndex].nMulticastIp = e131::universe_to_multicast_ip(nUniverse);
+		UpdatePortIndex();
 
 		DEBUG_EXIT
 		return;
@@ -323,84 +335,247 @@ void E131Bridge::SetUniverse(const uint32_t nPortIndex, const lightset::PortDir
 
 		m_Bridge.Port[nPortIndex].direction = lightset::PortDir::OUTPUT;
 		m_Bridge.Port[nPortIndex].nUniverse = nUniverse;
+		UpdatePortIndex();
+	}
+}
+
+void E131Bridge::UpdatePortIndex() {
+	m_PortIndex.Clear();
 
+	for (uint32_t nPortIndex = 0; nPortIndex < e131bridge::MAX_PORTS; nPortIndex++) {
+		if (m_Bridge.Port[nPortIndex].direction != lightset::PortDir::DISABLE) {
+			m_PortIndex.Add(m_Bridge.Port[nPortIndex].nUniverse, nPortIndex);
+		}
 	}
 }
 
 void E131Bridge::UpdateMergeStatus(const uint32_t nPortIndex) {
-	if (!m_State.IsMergeMode) {
-		m_State.IsMergeMode = true;
+	m_OutputPort[nPortIndex].IsMerging = (GetActiveSources(nPortIndex) > 1);
+
+	auto bIsMerging = false;
+
+	for (uint32_t i = 0; i < e131bridge::MAX_PORTS; i++) {
+		bIsMerging |= m_OutputPort[i].IsMerging;
+	}
+
+	if (bIsMerging != m_State.IsMergeMode) {
+		m_State.IsMergeMode = bIsMerging;
 		m_State.IsChanged = true;
 	}
+}
+
+/**
+ * @return the source index of the sender of the received packet, or e131bridge::MAX_SOURCES when unknown
+ */
+uint32_t E131Bridge::FindSource(const uint32_t nPortIndex) const {
+	const auto *const pRaw = reinterpret_cast<TE131RawPacket *>(m_pReceiveBuffer);
 
-	m_OutputPort[nPortIndex].IsMerging = true;
+	for (uint32_t nSourceIndex = 0; nSourceIndex < e131bridge::MAX_SOURCES; nSourceIndex++) {
+		const auto& source = m_OutputPort[nPortIndex].source[nSourceIndex];
+
+		if ((source.nIp == m_nIpAddressFrom) && (memcmp(source.cid, pRaw->RootLayer.Cid, e131::CID_LENGTH) == 0)) {
+			return nSourceIndex;
+		}
+	}
+
+	return e131bridge::MAX_SOURCES;
 }
 
-void E131Bridge::CheckMergeTimeouts(uint32_t nPortIndex) {
-	assert(nPortIndex < e131bridge::MAX_PORTS);
+/**
+ * Adds the sender of the received packet to the source table.
+ * @return the source index, or e131bridge::MAX_SOURCES when the table is full
+ */
+uint32_t E131Bridge::JoinSource(const uint32_t nPortIndex) {
+	auto& outputPort = m_OutputPort[nPortIndex];
+
+	for (uint32_t nSourceIndex = 0; nSourceIndex < e131bridge::MAX_SOURCES; nSourceIndex++) {
+		auto& source = outputPort.source[nSourceIndex];
+
+		if (source.nIp == 0) {
+			const auto *const pRaw = reinterpret_cast<TE131RawPacket *>(m_pReceiveBuffer);
+
+			source.nIp = m_nIpAddressFrom;
+			memcpy(source.cid, pRaw->RootLayer.Cid, e131::CID_LENGTH);
+			source.nSynchronizationAddress = 0;
+#if defined (E131_HAVE_PER_ADDRESS_PRIORITY)
+			// The slot priorities must match nPriority, SetSourcePriority only updates them on a change
+			source.nPriority = 0;
+			memset(m_SlotPriority[nPortIndex][nSourceIndex], 0, lightset::dmx::UNIVERSE_SIZE);
+#endif
 
-	const auto timeOutA = m_nCurrentPacketMillis - m_OutputPort[nPortIndex].sourceA.nMillis;
+			outputPort.nSourcesJoined++;
+			UpdateMergeStatus(nPortIndex);
 
-	if (timeOutA > (e131::MERGE_TIMEOUT_SECONDS * 1000U)) {
-		m_OutputPort[nPortIndex].sourceA.nIp = 0;
-		memset(m_OutputPort[nPortIndex].sourceA.cid, 0, e131::CID_LENGTH);
-		m_OutputPort[nPortIndex].IsMerging = false;
+			return nSourceIndex;
+		}
 	}
 
-	const auto timeOutB = m_nCurrentPacketMillis - m_OutputPort[nPortIndex].sourceB.nMillis;
+	outputPort.nSourcesDropped++;
+	return e131bridge::MAX_SOURCES;
+}
+
+void E131Bridge::LeaveSource(const uint32_t nPortIndex, const uint32_t nSourceIndex) {
+	assert(nSourceIndex < e131bridge::MAX_SOURCES);
+
+	auto& outputPort = m_OutputPort[nPortIndex];
+	auto& source = outputPort.source[nSourceIndex];
 
-	if (timeOutB > (e131::MERGE_TIMEOUT_SECONDS * 1000U)) {
-		m_OutputPort[nPortIndex].sourceB.nIp = 0;
-		memset(m_OutputPort[nPortIndex].sourceB.cid, 0, e131::CID_LENGTH);
-		m_OutputPort[nPortIndex].IsMerging = false;
+	if (source.nIp == 0) {
+		return;
 	}
 
-	auto bIsMerging = false;
+	source.nIp = 0;
+	memset(source.cid, 0, e131::CID_LENGTH);
 
-	for (uint32_t i = 0; i < e131bridge::MAX_PORTS; i++) {
-		bIsMerging |= m_OutputPort[i].IsMerging;
+	const auto nSynchronizationAddress = source.nSynchronizationAddress;
+	source.nSynchronizationAddress = 0;
+
+	if ((nSynchronizationAddress != 0) && !IsSynchronizationAddress(nSynchronizationAddress)) {
+		// e131bridge::MAX_PORTS forces to check all ports
+		LeaveUniverse(e131bridge::MAX_PORTS, nSynchronizationAddress);
 	}
 
-	if (!bIsMerging) {
-		m_State.IsChanged = true;
-		m_State.IsMergeMode = false;
+#if defined (E131_HAVE_PER_ADDRESS_PRIORITY)
+	outputPort.nSlotPriorityMask &= ~(1U << nSourceIndex);
+#endif
+
+	outputPort.nSourcesLeft++;
+	UpdateMergeStatus(nPortIndex);
+}
+
+/**
+ * All sources, except nKeepSourceIndex, leave.
+ */
+void E131Bridge::LeaveSources(const uint32_t nPortIndex, const uint32_t nKeepSourceIndex) {
+	for (uint32_t nSourceIndex = 0; nSourceIndex < e131bridge::MAX_SOURCES; nSourceIndex++) {
+		if (nSourceIndex != nKeepSourceIndex) {
+			LeaveSource(nPortIndex, nSourceIndex);
+		}
 	}
 }
 
-bool E131Bridge::IsPriorityTimeOut(uint32_t nPortIndex) const {
+/**
+ * Each source times out on its own. The source of the received packet, nSourceIndex, is alive.
+ */
+void E131Bridge::CheckMergeTimeouts(const uint32_t nPortIndex, const uint32_t nSourceIndex) {
 	assert(nPortIndex < e131bridge::MAX_PORTS);
 
-	const auto timeOutA = m_nCurrentPacketMillis - m_OutputPort[nPortIndex].sourceA.nMillis;
-	const auto timeOutB = m_nCurrentPacketMillis - m_OutputPort[nPortIndex].sourceB.nMillis;
+	for (uint32_t i = 0; i < e131bridge::MAX_SOURCES; i++) {
+		const auto& source = m_OutputPort[nPortIndex].source[i];
 
-	if ( (m_OutputPort[nPortIndex].sourceA.nIp != 0) && (m_OutputPort[nPortIndex].sourceB.nIp != 0) ) {
-		if ( (timeOutA < (e131::PRIORITY_TIMEOUT_SECONDS * 1000U)) || (timeOutB < (e131::PRIORITY_TIMEOUT_SECONDS * 1000U)) ) {
-			return false;
-		} else {
-			return true;
+		if ((i != nSourceIndex) && (source.nIp != 0) && ((m_nCurrentPacketMillis - source.nMillis) > (e131::MERGE_TIMEOUT_SECONDS * 1000U))) {
+			LeaveSource(nPortIndex, i);
 		}
-	} else if ( (m_OutputPort[nPortIndex].sourceA.nIp != 0) && (m_OutputPort[nPortIndex].sourceB.nIp == 0) ) {
-		if (timeOutA > (e131::PRIORITY_TIMEOUT_SECONDS * 1000U)) {
-			return true;
+	}
+}
+
+#if defined (E131_HAVE_PER_ADDRESS_PRIORITY)
+/**
+ * Start code 0xDD: the slots not sent are not sourced.
+ */
+void E131Bridge::SetSlotPriority(const uint32_t nPortIndex, const uint32_t nSourceIndex, const uint8_t *pPriority, uint32_t nLength) {
+	assert(nSourceIndex < e131bridge::MAX_SOURCES);
+
+	auto& outputPort = m_OutputPort[nPortIndex];
+	auto *pSlotPriority = m_SlotPriority[nPortIndex][nSourceIndex];
+
+	nLength = std::min(nLength, lightset::dmx::UNIVERSE_SIZE);
+
+	memcpy(pSlotPriority, pPriority, nLength);
+	memset(&pSlotPriority[nLength], 0, lightset::dmx::UNIVERSE_SIZE - nLength);
+
+	outputPort.source[nSourceIndex].nSlotPriorityMillis = m_nCurrentPacketMillis;
+	outputPort.nSlotPriorityMask |= (1U << nSourceIndex);
+	outputPort.bSlotPriority = true;
+}
+
+/**
+ * A source without 0xDD has its packet priority for all the slots.
+ */
+void E131Bridge::SetSourcePriority(const uint32_t nPortIndex, const uint32_t nSourceIndex, const uint8_t nPriority) {
+	auto& outputPort = m_OutputPort[nPortIndex];
+	auto& source = outputPort.source[nSourceIndex];
+
+	if (source.nPriority == nPriority) {
+		return;
+	}
+
+	source.nPriority = nPriority;
+
+	if ((outputPort.nSlotPriorityMask & (1U << nSourceIndex)) == 0) {
+		memset(m_SlotPriority[nPortIndex][nSourceIndex], nPriority, lightset::dmx::UNIVERSE_SIZE);
+	}
+}
+
+/**
+ * When the 0xDD of a source times out, the source falls back to its packet priority.
+ * When none of the sources sends 0xDD anymore, only the sources with the highest packet priority are kept.
+ */
+void E131Bridge::CheckSlotPriorityTimeouts(const uint32_t nPortIndex) {
+	auto& outputPort = m_OutputPort[nPortIndex];
+
+	if (!outputPort.bSlotPriority) {
+		return;
+	}
+
+	auto nSlotPriorityMask = outputPort.nSlotPriorityMask;
+
+	while (nSlotPriorityMask != 0) {
+		const auto nSourceIndex = static_cast<uint32_t>(__builtin_ctz(nSlotPriorityMask));
+		nSlotPriorityMask &= (nSlotPriorityMask - 1);
+
+		const auto& source = outputPort.source[nSourceIndex];
+
+		if ((m_nCurrentPacketMillis - source.nSlotPriorityMillis) > static_cast<uint32_t>(e131::NETWORK_DATA_LOSS_TIMEOUT_SECONDS * 1000)) {
+			DEBUG_PRINTF("nPortIndex=%u, nSourceIndex=%u -> 0xDD timeout", nPortIndex, nSourceIndex);
+			outputPort.nSlotPriorityMask &= ~(1U << nSourceIndex);
+			memset(m_SlotPriority[nPortIndex][nSourceIndex], source.nPriority, lightset::dmx::UNIVERSE_SIZE);
 		}
-	} else if ( (m_OutputPort[nPortIndex].sourceA.nIp == 0) && (m_OutputPort[nPortIndex].sourceB.nIp != 0) ) {
-		if (timeOutB > (e131::PRIORITY_TIMEOUT_SECONDS * 1000U)) {
-			return true;
+	}
+
+	if (outputPort.nSlotPriorityMask != 0) {
+		return;
+	}
+
+	outputPort.bSlotPriority = false;
+	outputPort.nPriority = e131::priority::LOWEST;
+
+	for (const auto& source : outputPort.source) {
+		if ((source.nIp != 0) && (source.nPriority > outputPort.nPriority)) {
+			outputPort.nPriority = source.nPriority;
 		}
 	}
 
-	return false;
+	for (uint32_t nSourceIndex = 0; nSourceIndex < e131bridge::MAX_SOURCES; nSourceIndex++) {
+		if (outputPort.source[nSourceIndex].nPriority < outputPort.nPriority) {
+			LeaveSource(nPortIndex, nSourceIndex);
+		}
+	}
 }
 
-bool E131Bridge::isIpCidMatch(const e131bridge::Source *const source) const {
-	if (source->nIp != m_nIpAddressFrom) {
-		return false;
+void E131Bridge::MergeSlotPriority(const uint32_t nPortIndex, const uint32_t nSourceIndex, const uint8_t *pData, const uint32_t nLength) {
+	const uint8_t *pSlotPriority[e131bridge::MAX_SOURCES];
+
+	for (uint32_t i = 0; i < e131bridge::MAX_SOURCES; i++) {
+		pSlotPriority[i] = m_SlotPriority[nPortIndex][i];
 	}
 
-	const auto *const pRaw = reinterpret_cast<TE131RawPacket *>(m_pReceiveBuffer);
+	lightset::Data::MergeSourcePriority(nPortIndex, nSourceIndex, pData, nLength, GetSourceMask(nPortIndex), pSlotPriority);
+}
+#endif
 
-	if (memcmp(source->cid, pRaw->RootLayer.Cid, e131::CID_LENGTH) != 0) {
-		return false;
+/**
+ * @return true when none of the sources, except nSourceIndex, has been received within the priority timeout
+ */
+bool E131Bridge::IsPriorityTimeOut(const uint32_t nPortIndex, const uint32_t nSourceIndex) const {
+	assert(nPortIndex < e131bridge::MAX_PORTS);
+
+	for (uint32_t i = 0; i < e131bridge::MAX_SOURCES; i++) {
+		const auto& source = m_OutputPort[nPortIndex].source[i];
+
+		if ((i != nSourceIndex) && (source.nIp != 0) && ((m_nCurrentPacketMillis - source.nMillis) < (e131::PRIORITY_TIMEOUT_SECONDS * 1000U))) {
+			return false;
+		}
 	}
 
 	return true;
@@ -410,39 +585,40 @@ void E131Bridge::HandleDmx() {
 	const auto *const pData = reinterpret_cast<TE131DataPacket *>(m_pReceiveBuffer);
 	const auto *const pDmxData = &pData->DMPLayer.PropertyValues[1];
 	const auto nDmxSlots = __builtin_bswap16(pData->DMPLayer.PropertyValueCount) - 1U;
+	const auto nStartCode = pData->DMPLayer.PropertyValues[0];
 
-	for (uint32_t nPortIndex = 0; nPortIndex < e131bridge::MAX_PORTS; nPortIndex++) {
-		if (m_Bridge.Port[nPortIndex].direction == lightset::PortDir::OUTPUT) {
-			// Frame layer
-			// 8.2 Association of Multicast Addresses and Universe
-			// Note: The identity of the universe shall be determined by the universe number in the
-			// packet and not assumed from the multicast address.
-			if (pData->FrameLayer.Universe != __builtin_bswap16(m_Bridge.Port[nPortIndex].nUniverse)) {
-				continue;
-			}
+#if defined (E131_HAVE_PER_ADDRESS_PRIORITY)
+	if ((nStartCode != e131::startcode::DMX) && (nStartCode != e131::startcode::PER_ADDRESS_PRIORITY)) {
+		return;
+	}
+#else
+	if (nStartCode != e131::startcode::DMX) {
+		return;
+	}
+#endif
 
-			auto *pSourceA = &m_OutputPort[nPortIndex].sourceA;
-			auto *pSourceB = &m_OutputPort[nPortIndex].sourceB;
+	// Frame layer
+	// 8.2 Association of Multicast Addresses and Universe
+	// Note: The identity of the universe shall be determined by the universe number in the
+	// packet and not assumed from the multicast address.
+	auto nPortMask = m_PortIndex.Get(__builtin_bswap16(pData->FrameLayer.Universe));
 
-			const auto ipA = pSourceA->nIp;
-			const auto ipB = pSourceB->nIp;
+	while (nPortMask != 0) {
+		const auto nPortIndex = lightset::next_port(nPortMask);
 
-			const auto isSourceA = isIpCidMatch(pSourceA);
-			const auto isSourceB = isIpCidMatch(pSourceB);
+		if (m_Bridge.Port[nPortIndex].direction == lightset::PortDir::OUTPUT) {
+			auto& outputPort = m_OutputPort[nPortIndex];
+			auto nSourceIndex = FindSource(nPortIndex);
+			const auto isKnownSource = (nSourceIndex < e131bridge::MAX_SOURCES);
 
 			// 6.9.2 Sequence Numbering
 			// Having first received a packet with sequence number A, a second packet with sequence number B
 			// arrives. If, using signed 8-bit binary arithmetic, B – A is less than or equal to 0, but greater than -20 then
 			// the packet containing sequence number B shall be deemed out of sequence and discarded
-			if (isSourceA) {
-				const auto diff = static_cast<int8_t>(pData->FrameLayer.SequenceNumber - pSourceA->nSequenceNumberData);
-				pSourceA->nSequenceNumberData = pData->FrameLayer.SequenceNumber;
-				if ((diff <= 0) && (diff > -20)) {
-					continue;
-				}
-			} else if (isSourceB) {
-				const auto diff = static_cast<int8_t>(pData->FrameLayer.SequenceNumber - pSourceB->nSequenceNumberData);
-				pSourceB->nSequenceNumberData = pData->FrameLayer.SequenceNumber;
+			if (isKnownSource) {
+				auto& source = outputPort.source[nSourceIndex];
+				const auto diff = static_cast<int8_t>(pData->FrameLayer.SequenceNumber - source.nSequenceNumberData);
+				source.nSequenceNumberData = pData->FrameLayer.SequenceNumber;
 				if ((diff <= 0) && (diff > -20)) {
 					continue;
 				}
@@ -457,89 +633,76 @@ void E131Bridge::HandleDmx() {
 			// Upon receipt of a packet containing this bit set to a value of 1, receiver shall enter network data loss condition.
 			// Any property values in these packets shall be ignored.
 			if ((pData->FrameLayer.Options & e131::OptionsMask::STREAM_TERMINATED) != 0) {
-				if (isSourceA || isSourceB) {
-					SetNetworkDataLossCondition(isSourceA, isSourceB);
+				if (isKnownSource) {
+					LeaveSource(nPortIndex, nSourceIndex);
+
+					if (GetSourceMask(nPortIndex) == 0) {
+						SetPortDataLossCondition(nPortIndex);
+					}
 				}
 				continue;
 			}
 
-			if (m_State.IsMergeMode) {
-				if (__builtin_expect((!m_State.bDisableMergeTimeout), 1)) {
-					CheckMergeTimeouts(nPortIndex);
-				}
+			if (__builtin_expect((!m_State.bDisableMergeTimeout), 1)) {
+				CheckMergeTimeouts(nPortIndex, nSourceIndex);
 			}
 
-			if (pData->FrameLayer.Priority < m_State.nPriority ){
-				if (!IsPriorityTimeOut(nPortIndex)) {
+#if defined (E131_HAVE_PER_ADDRESS_PRIORITY)
+			CheckSlotPriorityTimeouts(nPortIndex);
+#endif
+
+			const auto nPriority = pData->FrameLayer.Priority;
+
+			if (nPriority < outputPort.nPriorityThreshold) {
+				continue;
+			}
+
+			if (IsSlotPriority(nPortIndex, nStartCode)) {
+				// The priority is per slot, a source does not replace the others
+				if (nPriority > outputPort.nPriority) {
+					outputPort.nPriority = nPriority;
+				}
+			} else if (nPriority < outputPort.nPriority) {
+				if (!IsPriorityTimeOut(nPortIndex, nSourceIndex)) {
 					continue;
 				}
-				m_State.nPriority = pData->FrameLayer.Priority;
-			} else if (pData->FrameLayer.Priority > m_State.nPriority) {
-				m_OutputPort[nPortIndex].sourceA.nIp = 0;
-				m_OutputPort[nPortIndex].sourceB.nIp = 0;
-				m_State.IsMergeMode = false;
-				m_State.nPriority = pData->FrameLayer.Priority;
+				LeaveSources(nPortIndex, nSourceIndex);
+				outputPort.nPriority = nPriority;
+			} else if (nPriority > outputPort.nPriority) {
+				LeaveSources(nPortIndex, nSourceIndex);
+				outputPort.nPriority = nPriority;
 			}
 
-			if ((ipA == 0) && (ipB == 0)) {
-//				printf("1. First package from Source\n");
-				pSourceA->nIp = m_nIpAddressFrom;
-				pSourceA->nSequenceNumberData = pData->FrameLayer.SequenceNumber;
-				memcpy(pSourceA->cid, pData->RootLayer.Cid, 16);
-				pSourceA->nMillis = m_nCurrentPacketMillis;
-				lightset::Data::SetSourceA(nPortIndex, pDmxData, nDmxSlots);
-			} else if (isSourceA && (ipB == 0)) {
-//				printf("2. Continue package from SourceA\n");
-				pSourceA->nSequenceNumberData = pData->FrameLayer.SequenceNumber;
-				pSourceA->nMillis = m_nCurrentPacketMillis;
-				lightset::Data::SetSourceA(nPortIndex, pDmxData, nDmxSlots);
-			} else if ((ipA == 0) && isSourceB) {
-//				printf("3. Continue package from SourceB\n");
-				pSourceB->nSequenceNumberData = pData->FrameLayer.SequenceNumber;
-				pSourceB->nMillis = m_nCurrentPacketMillis;
-				lightset::Data::SetSourceB(nPortIndex, pDmxData, nDmxSlots);
-			} else if (!isSourceA && (ipB == 0)) {
-//				printf("4. New ip, start merging\n");
-				pSourceB->nIp = m_nIpAddressFrom;
-				pSourceB->nSequenceNumberData = pData->FrameLayer.SequenceNumber;
-				memcpy(pSourceB->cid, pData->RootLayer.Cid, 16);
-				pSourceB->nMillis = m_nCurrentPacketMillis;
-				UpdateMergeStatus(nPortIndex);
-				lightset::Data::MergeSourceB(nPortIndex, pDmxData, nDmxSlots, m_OutputPort[nPortIndex].mergeMode);
-			} else if ((ipA == 0) && !isSourceB) {
-//				printf("5. New ip, start merging\n");
-				pSourceA->nIp = m_nIpAddressFrom;
-				pSourceA->nSequenceNumberData = pData->FrameLayer.SequenceNumber;
-				memcpy(pSourceA->cid, pData->RootLayer.Cid, 16);
-				pSourceA->nMillis = m_nCurrentPacketMillis;
-				UpdateMergeStatus(nPortIndex);
-				lightset::Data::MergeSourceA(nPortIndex, pDmxData, nDmxSlots, m_OutputPort[nPortIndex].mergeMode);
-			} else if (isSourceA && !isSourceB) {
-//				printf("6. Continue merging\n");
-				pSourceA->nSequenceNumberData = pData->FrameLayer.SequenceNumber;
-				pSourceA->nMillis = m_nCurrentPacketMillis;
-				UpdateMergeStatus(nPortIndex);
-				lightset::Data::MergeSourceA(nPortIndex, pDmxData, nDmxSlots, m_OutputPort[nPortIndex].mergeMode);
-			} else if (!isSourceA && isSourceB) {
-//				printf("7. Continue merging\n");
-				pSourceB->nSequenceNumberData = pData->FrameLayer.SequenceNumber;
-				pSourceB->nMillis = m_nCurrentPacketMillis;
-				UpdateMergeStatus(nPortIndex);
-				lightset::Data::MergeSourceB(nPortIndex, pDmxData, nDmxSlots, m_OutputPort[nPortIndex].mergeMode);
+			if (!isKnownSource) {
+				nSourceIndex = JoinSource(nPortIndex);
+
+				if (nSourceIndex == e131bridge::MAX_SOURCES) {
+					DEBUG_PUTS("Source table is full, discarding data");
+					continue;
+				}
 			}
-#ifndef NDEBUG
-			else if (isSourceA && isSourceB) {
-				puts("WARN: 8. Source matches both ip, discarding data");
-				return;
-			} else if (!isSourceA && !isSourceB) {
-				puts("WARN: 9. More than two sources, discarding data");
-				return;
+
+			auto& source = outputPort.source[nSourceIndex];
+			source.nSequenceNumberData = pData->FrameLayer.SequenceNumber;
+			source.nMillis = m_nCurrentPacketMillis;
+
+#if defined (E131_HAVE_PER_ADDRESS_PRIORITY)
+			if (nStartCode == e131::startcode::PER_ADDRESS_PRIORITY) {
+				SetSlotPriority(nPortIndex, nSourceIndex, pDmxData, nDmxSlots);
+				continue;
 			}
-			else {
-				puts("ERROR: 0. No cases matched, this shouldn't happen!");
-				return;
+
+			SetSourcePriority(nPortIndex, nSourceIndex, nPriority);
+
+			if (outputPort.bSlotPriority) {
+				MergeSlotPriority(nPortIndex, nSourceIndex, pDmxData, nDmxSlots);
+			} else {
+				lightset::Data::MergeSource(nPortIndex, nSourceIndex, pDmxData, nDmxSlots, outputPort.mergeMode, GetSourceMask(nPortIndex));
 			}
+#else
+			lightset::Data::MergeSource(nPortIndex, nSourceIndex, pDmxData, nDmxSlots, outputPort.mergeMode, GetSourceMask(nPortIndex));
 #endif
+
 			// This bit indicates whether to lock or revert to an unsynchronized state when synchronization is lost
 			// (See Section 11 on Universe Synchronization and 11.1 for discussion on synchronization states).
 			// When set to 0, components that had been operating in a synchronized state shall not update with any
@@ -553,11 +716,7 @@ void E131Bridge::HandleDmx() {
 				// Receivers shall ignore E1.31 Synchronization Packets containing a Synchronization Address of 0.
 				if (pData->FrameLayer.SynchronizationAddress != 0) {
 					if (!m_State.IsForcedSynchronized) {
-						if (!(isSourceA || isSourceB)) {
-							SetSynchronizationAddress((pSourceA->nIp != 0), (pSourceB->nIp != 0), __builtin_bswap16(pData->FrameLayer.SynchronizationAddress));
-						} else {
-							SetSynchronizationAddress(isSourceA, isSourceB, __builtin_bswap16(pData->FrameLayer.SynchronizationAddress));
-						}
+						SetSynchronizationAddress(source, __builtin_bswap16(pData->FrameLayer.SynchronizationAddress));
 						m_State.IsForcedSynchronized = true;
 						m_State.IsSynchronized = true;
 					}
@@ -586,74 +745,78 @@ void E131Bridge::HandleDmx() {
 	}
 }
 
-void E131Bridge::SetNetworkDataLossCondition(bool bSourceA, bool bSourceB) {
+void E131Bridge::SetNetworkDataLossCondition() {
 	DEBUG_ENTRY
-	DEBUG_PRINTF("%d %d", bSourceA, bSourceB);
 
 	m_State.IsChanged = true;
-	auto doFailsafe = false;
+	m_State.IsNetworkDataLoss = true;
+	m_State.IsSynchronized = false;
+	m_State.IsForcedSynchronized = false;
 
-	if (bSourceA && bSourceB) {
-		m_State.IsNetworkDataLoss = true;
-		m_State.IsMergeMode = false;
-		m_State.IsSynchronized = false;
-		m_State.IsForcedSynchronized = false;
-		m_State.nPriority = e131::priority::LOWEST;
-
-		for (uint32_t i = 0; i < e131bridge::MAX_PORTS; i++) {
-			if (m_OutputPort[i].IsTransmitting) {
-				doFailsafe = true;
-				m_OutputPort[i].sourceA.nIp = 0;
-				memset(m_OutputPort[i].sourceA.cid, 0, e131::CID_LENGTH);
-				m_OutputPort[i].sourceB.nIp = 0;
-				memset(m_OutputPort[i].sourceB.cid, 0, e131::CID_LENGTH);
-				lightset::Data::ClearLength(i);
-				m_OutputPort[i].IsTransmitting = false;
-				m_OutputPort[i].IsMerging = false;
-			}
-		}
-	} else {
-		for (uint32_t i = 0; i < e131bridge::MAX_PORTS; i++) {
-			if (m_OutputPort[i].IsTransmitting) {
-				if ((bSourceA) && (m_OutputPort[i].sourceA.nIp != 0)) {
-					m_OutputPort[i].sourceA.nIp = 0;
-					memset(m_OutputPort[i].sourceA.cid, 0, e131::CID_LENGTH);
-					m_OutputPort[i].IsMerging = false;
-				}
+	auto doFailsafe = false;
 
-				if ((bSourceB) && (m_OutputPort[i].sourceB.nIp != 0)) {
-					m_OutputPort[i].sourceB.nIp = 0;
-					memset(m_OutputPort[i].sourceB.cid, 0, e131::CID_LENGTH);
-					m_OutputPort[i].IsMerging = false;
-				}
+	for (uint32_t i = 0; i < e131bridge::MAX_PORTS; i++) {
+		LeaveSources(i);
+		m_OutputPort[i].nPriority = e131::priority::LOWEST;
+#if defined (E131_HAVE_PER_ADDRESS_PRIORITY)
+		m_OutputPort[i].bSlotPriority = false;
+#endif
 
-				if (!m_State.IsMergeMode) {
-					doFailsafe = true;
-					lightset::Data::ClearLength(i);
-					m_OutputPort[i].IsTransmitting = false;
-				}
-			}
+		if (m_OutputPort[i].IsTransmitting) {
+			doFailsafe = true;
+			lightset::Data::ClearLength(i);
+			m_OutputPort[i].IsTransmitting = false;
 		}
 	}
 
 	if (doFailsafe) {
-		switch (m_State.failsafe) {
-		case lightset::FailSafe::HOLD:
-			break;
-		case lightset::FailSafe::OFF:
-			m_pLightSet->Blackout(true);
-			break;
-		case lightset::FailSafe::ON:
-			m_pLightSet->FullOn();
-			break;
-		default:
-			DEBUG_PRINTF("m_State.failsafe=%u", static_cast<uint32_t>(m_State.failsafe));
-			assert(0);
-			__builtin_unreachable();
-			break;
+		ApplyFailSafe();
+	}
+
+	Hardware::Get()->SetMode(hardware::ledblink::Mode::NORMAL);
+	hal::panel_led_off(hal::panelled::SACN);
+
+	m_State.nReceivingDmx &= static_cast<uint8_t>(~(1U << static_cast<uint8_t>(lightset::PortDir::OUTPUT)));
+
+#if defined (E131_HAVE_DMXIN)
+	SetLocalMerging();
+#endif
+
+	DEBUG_EXIT
+}
+
+/**
+ * The last source of the port has terminated its stream.
+ * The fail-safe is applied when none of the ports is transmitting anymore.
+ */
+void E131Bridge::SetPortDataLossCondition(const uint32_t nPortIndex) {
+	DEBUG_ENTRY
+	DEBUG_PRINTF("nPortIndex=%u", nPortIndex);
+
+	auto& outputPort = m_OutputPort[nPortIndex];
+	outputPort.nPriority = e131::priority::LOWEST;
+#if defined (E131_HAVE_PER_ADDRESS_PRIORITY)
+	outputPort.bSlotPriority = false;
+#endif
+
+	if (!outputPort.IsTransmitting) {
+		DEBUG_EXIT
+		return;
+	}
+
+	m_State.IsChanged = true;
+	lightset::Data::ClearLength(nPortIndex);
+	outputPort.IsTransmitting = false;
+
+	for (const auto& port : m_OutputPort) {
+		if (port.IsTransmitting) {
+			DEBUG_EXIT
+			return;
 		}
 	}
 
+	ApplyFailSafe();
+
 	Hardware::Get()->SetMode(hardware::ledblink::Mode::NORMAL);
 	hal::panel_led_off(hal::panelled::SACN);
 
@@ -666,6 +829,24 @@ void E131Bridge::SetNetworkDataLossCondition(bool bSourceA, bool bSourceB) {
 	DEBUG_EXIT
 }
 
+void E131Bridge::ApplyFailSafe() {
+	switch (m_State.failsafe) {
+	case lightset::FailSafe::HOLD:
+		break;
+	case lightset::FailSafe::OFF:
+		m_pLightSet->Blackout(true);
+		break;
+	case lightset::FailSafe::ON:
+		m_pLightSet->FullOn();
+		break;
+	default:
+		DEBUG_PRINTF("m_State.failsafe=%u", static_cast<uint32_t>(m_State.failsafe));
+		assert(0);
+		__builtin_unreachable();
+		break;
+	}
+}
+
 bool E131Bridge::IsValidRoot() {
 	const auto *const pRaw = reinterpret_cast<TE131RawPacket *>(m_pReceiveBuffer);
 	// 5 E1.31 use of the ACN Root Layer Protocol
@@ -43,7 +43,7 @@ void E131Bridge::HandleSynchronization() {
 	const auto *const pSynchronizationPacket = reinterpret_cast<TE131SynchronizationPacket *>(m_pReceiveBuffer);
 	const auto nSynchronizationAddress = __builtin_bswap16(pSynchronizationPacket->FrameLayer.UniverseNumber);
 
-	if ((nSynchronizationAddress != m_State.nSynchronizationAddressSourceA) && (nSynchronizationAddress != m_State.nSynchronizationAddressSourceB)) {
+	if (!IsSynchronizationAddress(nSynchronizationAddress)) {
 		Hardware::Get()->SetMode(hardware::ledblink::Mode::NORMAL);
 		DEBUG_PUTS("");
 		return;
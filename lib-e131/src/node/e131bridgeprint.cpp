@@ -56,7 +56,7 @@ void E131Bridge::Print() {
 		for (uint32_t nPortIndex = 0; nPortIndex < e131bridge::MAX_PORTS; nPortIndex++) {
 			uint16_t nUniverse;
 			if (GetUniverse(nPortIndex, nUniverse, lightset::PortDir::OUTPUT)) {
-				printf("  Port %-2u %-4u %s\n", static_cast<unsigned int>(nPortIndex), static_cast<unsigned int>(nUniverse), lightset::get_merge_mode(m_OutputPort[nPortIndex].mergeMode, true));
+				printf("  Port %-2u %-4u %s >=%-3u\n", static_cast<unsigned int>(nPortIndex), static_cast<unsigned int>(nUniverse), lightset::get_merge_mode(m_OutputPort[nPortIndex].mergeMode, true), GetPriorityThreshold(nPortIndex));
 			}
 		}
 	}
@@ -74,6 +74,8 @@ void E131Bridge::Print() {
 	}
 #endif
 
+	printf(" Sources  : %u per port\n", static_cast<unsigned int>(e131bridge::MAX_SOURCES));
+
 	if (m_State.bDisableSynchronize) {
 		printf(" Synchronize is disabled\n");
 	}
@@ -44,6 +44,7 @@
 #include "propertiesbuilder.h"
 
 #include "lightset.h"
+#include "lightsetdata.h"
 #include "lightsetparamsconst.h"
 
 #include "debug.h"
@@ -172,6 +173,22 @@ void E131Params::callbackFunction(const char *pLine) {
 			return;
 		}
 
+		nLength = 7;
+
+		if (Sscan::Char(pLine, LightSetParamsConst::LTP_SLOTS_PORT[nPortIndex], aValue, nLength) == Sscan::OK) {
+			aValue[nLength] = '\0';
+			uint16_t nSlotFirst, nSlotLast;
+
+			if (lightset::get_slot_range(aValue, nSlotFirst, nSlotLast)) {
+				m_Params.nLtpSlots[nPortIndex][0] = nSlotFirst;
+				m_Params.nLtpSlots[nPortIndex][1] = nSlotLast;
+				m_Params.nSetList |= (Mask::LTP_SLOTS_A << nPortIndex);
+			} else {
+				m_Params.nSetList &= ~(Mask::LTP_SLOTS_A << nPortIndex);
+			}
+			return;
+		}
+
 		nLength = lightset::node::LABEL_NAME_LENGTH - 1;
 
 		if (Sscan::Char(pLine, LightSetParamsConst::NODE_LABEL[nPortIndex], reinterpret_cast<char*>(m_Params.aLabel[nPortIndex]), nLength) == Sscan::OK) {
@@ -224,6 +241,17 @@ void E131Params::callbackFunction(const char *pLine) {
 		}
 #endif
 
+		if (Sscan::Uint8(pLine, LightSetParamsConst::PRIORITY_THRESHOLD[nPortIndex], value8) == Sscan::OK) {
+			if ((value8 >= e131::priority::LOWEST) && (value8 <= e131::priority::HIGHEST)) {
+				m_Params.nPriorityThreshold[nPortIndex] = value8;
+				m_Params.nSetList |= (Mask::PRIORITY_THRESHOLD_A << nPortIndex);
+			} else {
+				m_Params.nPriorityThreshold[nPortIndex] = 0;
+				m_Params.nSetList &= ~(Mask::PRIORITY_THRESHOLD_A << nPortIndex);
+			}
+			return;
+		}
+
 #if defined (OUTPUT_HAVE_STYLESWITCH)
 		nLength = 6;
 
@@ -284,6 +312,12 @@ void E131Params::Builder(const struct Params *pParams, char *pBuffer, uint32_t n
 		const auto isDefault = (mergeMode == lightset::MergeMode::HTP);
 		builder.Add(LightSetParamsConst::MERGE_MODE_PORT[nPortIndex], lightset::get_merge_mode(mergeMode), !isDefault);
 
+		const auto isLtpSlotsSet = isMaskSet(Mask::LTP_SLOTS_A << nPortIndex);
+		char aLtpSlots[8];
+		snprintf(aLtpSlots, sizeof(aLtpSlots), "%u-%u", isLtpSlotsSet ? m_Params.nLtpSlots[nPortIndex][0] : 0U, isLtpSlotsSet ? m_Params.nLtpSlots[nPortIndex][1] : 0U);
+		builder.Add(LightSetParamsConst::LTP_SLOTS_PORT[nPortIndex], aLtpSlots, isLtpSlotsSet);
+		builder.Add(LightSetParamsConst::PRIORITY_THRESHOLD[nPortIndex], m_Params.nPriorityThreshold[nPortIndex], isMaskSet(Mask::PRIORITY_THRESHOLD_A << nPortIndex));
+
 #if defined (OUTPUT_HAVE_STYLESWITCH)
 		const auto isSet = isOutputStyleSet(1U << nPortIndex);
 		builder.Add(LightSetParamsConst::OUTPUT_STYLE[nPortIndex], lightset::get_output_style(static_cast<lightset::OutputStyle>(isSet)), isSet);
@@ -332,6 +366,16 @@ void E131Params::Set() {
 
 		p->SetMergeMode(nOffset, mergemode_get(nPortIndex));
 
+		lightset::Data::ClearSlotMergeMode(nOffset);
+
+		if (isMaskSet(Mask::LTP_SLOTS_A << nPortIndex)) {
+			for (uint32_t nSlot = m_Params.nLtpSlots[nPortIndex][0]; nSlot <= m_Params.nLtpSlots[nPortIndex][1]; nSlot++) {
+				lightset::Data::SetSlotMergeMode(nOffset, nSlot - 1, lightset::MergeMode::LTP);
+			}
+		}
+
+		p->SetPriorityThreshold(nOffset, isMaskSet(Mask::PRIORITY_THRESHOLD_A << nPortIndex) ? m_Params.nPriorityThreshold[nPortIndex] : e131::priority::LOWEST);
+
 #if defined (E131_HAVE_DMXIN)
 		if (isMaskSet(Mask::PRIORITY_A << nPortIndex)) {
 			p->SetPriority(nPortIndex, m_Params.nPriority[nPortIndex]);
@@ -374,6 +418,12 @@ void E131Params::Dump() {
 		printf(" %s=%s\n", LightSetParamsConst::MERGE_MODE_PORT[i], lightset::get_merge_mode(mergemode_get(i)));
 	}
 
+	for (uint32_t i = 0; i < e131params::MAX_PORTS; i++) {
+		if (isMaskSet(e131params::Mask::LTP_SLOTS_A << i)) {
+			printf(" %s=%u-%u\n", LightSetParamsConst::LTP_SLOTS_PORT[i], m_Params.nLtpSlots[i][0], m_Params.nLtpSlots[i][1]);
+		}
+	}
+
 	for (uint32_t i = 0; i < e131params::MAX_PORTS; i++) {
 		const auto portDir = static_cast<lightset::PortDir>(e131params::portdir_shif_right(m_Params.nDirection, i));
 		printf(" %s=%d [%s]\n", LightSetParamsConst::DIRECTION[i], e131params::portdir_shif_right(m_Params.nDirection, i), lightset::get_direction(portDir));
@@ -385,6 +435,12 @@ void E131Params::Dump() {
 		}
 	}
 
+	for (uint32_t i = 0; i < e131params::MAX_PORTS; i++) {
+		if (isMaskSet(e131params::Mask::PRIORITY_THRESHOLD_A << i)) {
+			printf(" %s=%d\n", LightSetParamsConst::PRIORITY_THRESHOLD[i], m_Params.nPriorityThreshold[i]);
+		}
+	}
+
 	for (uint32_t i = 0; i < e131params::MAX_PORTS; i++) {
 		const auto nOutputStyle = static_cast<uint32_t>(isOutputStyleSet(1U << i));
 		printf(" %s=%u [%s]\n", LightSetParamsConst::OUTPUT_STYLE[i], static_cast<unsigned int>(nOutputStyle), lightset::get_output_style(static_cast<lightset::OutputStyle>(nOutputStyle)));
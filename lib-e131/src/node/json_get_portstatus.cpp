@@ -0,0 +1,64 @@
+/**
+ * @file json_get_portstatus.cpp
+ *
+ */
+/* Copyright (C) 2024 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <cstdint>
+#include <cstdio>
+
+#include "e131bridge.h"
+
+namespace remoteconfig {
+namespace e131 {
+uint32_t json_get_portstatus(const char cPort, char *pOutBuffer, const uint32_t nOutBufferSize) {
+	const uint32_t nPortIndex = static_cast<uint32_t>((cPort | 0x20) - 'a');
+
+	if (nPortIndex < e131bridge::MAX_PORTS) {
+		const auto *pBridge = E131Bridge::Get();
+		uint16_t nUniverse;
+
+		if (!pBridge->GetUniverse(nPortIndex, nUniverse, lightset::PortDir::OUTPUT)) {
+			return 0;
+		}
+
+		auto nLength = static_cast<uint32_t>(snprintf(pOutBuffer, nOutBufferSize,
+				"{\"port\":\"%c\",\"universe\":%u,\"merging\":%d,"
+				"\"priority\":{\"threshold\":%u,\"output\":%u},"
+				"\"sources\":{\"active\":%u,\"joined\":%u,\"left\":%u,\"dropped\":%u}}",
+				static_cast<char>('A' + nPortIndex),
+				static_cast<unsigned int>(nUniverse),
+				pBridge->IsMerging(nPortIndex),
+				static_cast<unsigned int>(pBridge->GetPriorityThreshold(nPortIndex)),
+				static_cast<unsigned int>(pBridge->GetOutputPriority(nPortIndex)),
+				static_cast<unsigned int>(pBridge->GetActiveSources(nPortIndex)),
+				static_cast<unsigned int>(pBridge->GetSourcesJoined(nPortIndex)),
+				static_cast<unsigned int>(pBridge->GetSourcesLeft(nPortIndex)),
+				static_cast<unsigned int>(pBridge->GetSourcesDropped(nPortIndex))));
+
+		return nLength;
+	}
+
+	return 0;
+}
+}  // namespace e131
+}  // namespace remoteconfig
@@ -0,0 +1,300 @@
+/**
+ * @file e131_replay.cpp
+ *
+ * Host test: E131Bridge with synthetic multi-source streams.
+ * Redundant consoles and a media server on one universe, a per-port priority,
+ * the priority threshold, the source table depth, the source and priority timeouts,
+ * and the throughput of E131Bridge::Run().
+ */
+/* Copyright (C) 2024 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <chrono>
+#if defined (__x86_64__) || defined (__i386__)
+# include <x86intrin.h>
+#endif
+
+#include "e131_test.h"
+
+static void test_replay(E131Bridge& bridge) {
+	Sender main { network::convert_to_uint(10, 0, 0, 11), 0, {}, {} };
+	Sender backup { network::convert_to_uint(10, 0, 0, 12), 0, {}, {} };
+	Sender media { network::convert_to_uint(10, 0, 0, 13), 0, {}, {} };
+	Sender other { network::convert_to_uint(10, 0, 0, 14), 0, {}, {} };
+
+	/*
+	 * Universe 1: main and media server at priority 120, the backup console at 100.
+	 * Universe 2: only the backup console at 100, this port has its own priority.
+	 */
+	for (uint32_t nFrame = 0; nFrame < 80; nFrame++) {
+		const auto nLevel = static_cast<uint8_t>(nFrame);
+		set_level(main, nLevel);
+		set_level(backup, static_cast<uint8_t>(nLevel + 1));
+		set_level(media, static_cast<uint8_t>(nLevel + 2));
+		set_level(other, static_cast<uint8_t>(nLevel + 3));
+		queue(main, 1, 120);
+		queue(backup, 1, 100);
+		queue(media, 1, 120);
+		queue(other, 2, 100);
+		run(bridge, FRAME_MILLIS);
+	}
+
+	const auto nMainLastMillis = s_nMillis;
+
+	check(is_output(0, { &main, &media }), "universe 1 is main HTP media", s_nMillis);
+	check(is_output(1, { &other }), "universe 2 is not affected by universe 1", s_nMillis);
+	check(bridge.GetActiveSources(0) == 2, "universe 1 has 2 sources", s_nMillis);
+	check(bridge.GetOutputPriority(0) == 120, "universe 1 priority 120", s_nMillis);
+	check(bridge.GetOutputPriority(1) == 100, "universe 2 priority 100", s_nMillis);
+	check(bridge.IsMerging(0) && !bridge.IsMerging(1), "merging", s_nMillis);
+
+	/*
+	 * A packet out of sequence is discarded
+	 */
+	main.nSequence = static_cast<uint8_t>(main.nSequence - 2);
+	set_level(main, 0xFF);
+	queue(main, 1, 120);
+	run(bridge, 1);
+	set_level(main, 79);
+	check(is_output(0, { &main, &media }), "out of sequence is discarded", s_nMillis);
+	main.nSequence = static_cast<uint8_t>(main.nSequence + 2);
+
+	/*
+	 * The main console stops sending, it times out on its own
+	 */
+	const auto nLeft = bridge.GetSourcesLeft(0);
+	uint32_t nTimeoutMillis = 0;
+
+	for (uint32_t nFrame = 0; nFrame < ((e131::MERGE_TIMEOUT_SECONDS * 1000U) / FRAME_MILLIS) + 4; nFrame++) {
+		set_level(media, static_cast<uint8_t>(nFrame));
+		queue(backup, 1, 100);
+		queue(media, 1, 120);
+		queue(other, 2, 100);
+		run(bridge, FRAME_MILLIS);
+
+		if ((nTimeoutMillis == 0) && (bridge.GetActiveSources(0) == 1)) {
+			nTimeoutMillis = s_nMillis - nMainLastMillis;
+		}
+	}
+
+	check(bridge.GetSourcesLeft(0) == nLeft + 1, "main left", s_nMillis);
+	check(is_output(0, { &media }), "universe 1 is media", s_nMillis);
+	check(nTimeoutMillis > (e131::MERGE_TIMEOUT_SECONDS * 1000U), "main timeout", nTimeoutMillis);
+
+	printf("main console timeout after %u ms\n", static_cast<unsigned>(nTimeoutMillis));
+
+	/*
+	 * The media server stops sending, the backup console takes over after the priority timeout
+	 */
+	const auto nMediaLastMillis = s_nMillis;
+	uint32_t nTakeOverMillis = 0;
+
+	for (uint32_t nFrame = 0; nFrame < ((e131::PRIORITY_TIMEOUT_SECONDS * 1000U) / FRAME_MILLIS) + 4; nFrame++) {
+		set_level(backup, static_cast<uint8_t>(nFrame));
+		queue(backup, 1, 100);
+		queue(other, 2, 100);
+		run(bridge, FRAME_MILLIS);
+
+		if ((nTakeOverMillis == 0) && (bridge.GetOutputPriority(0) == 100)) {
+			nTakeOverMillis = s_nMillis - nMediaLastMillis;
+		}
+	}
+
+	check(is_output(0, { &backup }), "universe 1 is backup", s_nMillis);
+	check(bridge.GetActiveSources(0) == 1, "universe 1 has 1 source", s_nMillis);
+	check(nTakeOverMillis >= (e131::PRIORITY_TIMEOUT_SECONDS * 1000U), "backup takes over", nTakeOverMillis);
+
+	printf("backup console takes over after %u ms\n", static_cast<unsigned>(nTakeOverMillis));
+
+	/*
+	 * The main console is back, a higher priority replaces the backup at once
+	 */
+	set_level(main, 7);
+	queue(main, 1, 120);
+	queue(backup, 1, 100);
+	run(bridge, FRAME_MILLIS);
+
+	check(is_output(0, { &main }), "main is back", s_nMillis);
+	check(bridge.GetOutputPriority(0) == 120, "universe 1 priority 120 again", s_nMillis);
+
+	/*
+	 * Priority threshold on universe 2: the backup console at 100 is ignored
+	 */
+	bridge.SetPriorityThreshold(1, 150);
+	const auto nUpdates = s_LightSet.m_nUpdates[1];
+	set_level(other, 0x55);
+	queue(other, 2, 100);
+	run(bridge, FRAME_MILLIS);
+
+	check(s_LightSet.m_nUpdates[1] == nUpdates, "threshold", s_nMillis);
+
+	bridge.SetPriorityThreshold(1, e131::priority::LOWEST);
+	queue(other, 2, 100);
+	run(bridge, FRAME_MILLIS);
+
+	check(is_output(1, { &other }), "threshold removed", s_nMillis);
+
+	/*
+	 * Stream terminated: only that source leaves
+	 */
+	queue(main, 1, 120);
+	queue(media, 1, 120);
+	run(bridge, FRAME_MILLIS);
+	check(bridge.GetActiveSources(0) == 2, "main and media", s_nMillis);
+
+	queue(media, 1, 120, e131::OptionsMask::STREAM_TERMINATED);
+	run(bridge, FRAME_MILLIS);
+	check(bridge.GetActiveSources(0) == 1, "media terminated", s_nMillis);
+
+	puts("replay: done");
+}
+
+/**
+ * More senders than the source table depth
+ */
+static void test_table_full(E131Bridge& bridge) {
+	static constexpr uint32_t SENDERS = e131bridge::MAX_SOURCES + 1;
+	Sender senders[SENDERS];
+
+	for (uint32_t i = 0; i < SENDERS; i++) {
+		senders[i].nIp = network::convert_to_uint(10, 0, 1, static_cast<uint8_t>(i + 1));
+		senders[i].nSequence = 0;
+		set_level(senders[i], static_cast<uint8_t>(i));
+	}
+
+	const auto nJoined = bridge.GetSourcesJoined(1);
+	const auto nDropped = bridge.GetSourcesDropped(1);
+
+	for (uint32_t nFrame = 0; nFrame < 10; nFrame++) {
+		for (auto& sender : senders) {
+			queue(sender, 2, 180);
+		}
+		run(bridge, FRAME_MILLIS);
+	}
+
+	check(bridge.GetActiveSources(1) == e131bridge::MAX_SOURCES, "table is full", s_nMillis);
+	check(bridge.GetSourcesJoined(1) - nJoined == e131bridge::MAX_SOURCES, "joined", s_nMillis);
+	check(bridge.GetSourcesDropped(1) - nDropped == 10, "dropped", s_nMillis);
+
+	bool isMerged = true;
+
+	for (uint32_t i = 0; i < SIZE; i++) {
+		uint8_t nExpected = 0;
+		for (uint32_t j = 0; j < e131bridge::MAX_SOURCES; j++) {
+			nExpected = std::max(nExpected, senders[j].data[i]);
+		}
+		isMerged &= (s_LightSet.m_Data[1][i] == nExpected);
+	}
+
+	check(isMerged, "first sources are merged", s_nMillis);
+
+	printf("table full: joined %u, left %u, dropped %u, active %u\n",
+			static_cast<unsigned>(bridge.GetSourcesJoined(1)),
+			static_cast<unsigned>(bridge.GetSourcesLeft(1)),
+			static_cast<unsigned>(bridge.GetSourcesDropped(1)),
+			static_cast<unsigned>(bridge.GetActiveSources(1)));
+
+	puts("table full: done");
+}
+
+#if defined (__x86_64__) || defined (__i386__)
+static constexpr char CYCLES[] = "TSC cycles";
+
+static uint64_t cycles() {
+	return __rdtsc();
+}
+#else
+static constexpr char CYCLES[] = "ns";
+
+static uint64_t cycles() {
+	return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+#endif
+
+/**
+ * Universe 1 with 1 to MAX_SOURCES sources at the same priority, all 512 slots
+ */
+static void benchmark(E131Bridge& bridge) {
+	static constexpr uint32_t FRAMES = 2000;
+
+	for (uint32_t nSources = 1; nSources <= e131bridge::MAX_SOURCES; nSources++) {
+		Sender senders[e131bridge::MAX_SOURCES];
+
+		for (uint32_t i = 0; i < nSources; i++) {
+			senders[i].nIp = network::convert_to_uint(10, 0, 2, static_cast<uint8_t>(i + 1));
+			senders[i].nSequence = 0;
+			set_level(senders[i], static_cast<uint8_t>(i));
+		}
+
+		// Previous sources time out
+		run(bridge, (e131::MERGE_TIMEOUT_SECONDS + e131::PRIORITY_TIMEOUT_SECONDS) * 1000U);
+
+		uint64_t nCycles = 0;
+		const auto start = std::chrono::steady_clock::now();
+
+		for (uint32_t nFrame = 0; nFrame < FRAMES; nFrame++) {
+			for (uint32_t i = 0; i < nSources; i++) {
+				senders[i].data[nFrame & 0x1FF] = static_cast<uint8_t>(nFrame);
+				queue(senders[i], 1, 150);
+			}
+
+			const auto nStart = cycles();
+			run(bridge, FRAME_MILLIS);
+			nCycles += cycles() - nStart;
+		}
+
+		const auto end = std::chrono::steady_clock::now();
+		const auto nPackets = FRAMES * nSources;
+		const auto fSeconds = std::chrono::duration<double>(end - start).count();
+
+		check(bridge.GetActiveSources(0) == nSources, "benchmark sources", s_nMillis);
+
+		printf("%u source(s): %u %s per packet, %.0f packets/s including the packet build (host)\n",
+				static_cast<unsigned>(nSources),
+				static_cast<unsigned>(nCycles / nPackets),
+				CYCLES,
+				nPackets / fSeconds);
+	}
+}
+
+int main() {
+	E131Bridge bridge;
+
+	bridge.SetOutput(&s_LightSet);
+	bridge.SetUniverse(0, lightset::PortDir::OUTPUT, 1);
+	bridge.SetUniverse(1, lightset::PortDir::OUTPUT, 2);
+	bridge.SetDisableSynchronize(true);
+	bridge.Start();
+
+	test_replay(bridge);
+	test_table_full(bridge);
+	benchmark(bridge);
+
+	if (s_nFailed != 0) {
+		printf("%d failed\n", s_nFailed);
+		return 1;
+	}
+
+	puts("ok");
+	return 0;
+}
@@ -0,0 +1,207 @@
+/**
+ * @file e131_slot_priority.cpp
+ *
+ * Host test: E131Bridge with per-address priority (start code 0xDD).
+ * The per slot merge, the fall back to the packet priority when the 0xDD of a source
+ * times out, a source leaving mid-merge, and a reused source slot.
+ */
+/* Copyright (C) 2024 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+#include "e131_test.h"
+
+#if !defined (E131_HAVE_PER_ADDRESS_PRIORITY)
+# error "E131_HAVE_PER_ADDRESS_PRIORITY"
+#endif
+
+static constexpr uint16_t UNIVERSE = 1;
+static constexpr uint32_t PRIORITY_FRAMES = 40;	///< 0xDD once a second
+static constexpr uint32_t SLOT_PRIORITY_TIMEOUT_MILLIS = static_cast<uint32_t>(e131::NETWORK_DATA_LOSS_TIMEOUT_SECONDS * 1000);
+
+struct Source {
+	const Sender *pSender;
+	const uint8_t *pPriority;	///< The priority per slot the bridge should use
+};
+
+/**
+ * For each slot the sources with the highest priority are merged HTP, priority 0 is not sourced
+ */
+static bool is_merged(std::initializer_list<Source> sources) {
+	for (uint32_t i = 0; i < SIZE; i++) {
+		uint8_t nPriority = 0;
+		uint8_t nExpected = 0;
+
+		for (const auto& source : sources) {
+			const auto nSlotPriority = source.pPriority[i];
+
+			if (nSlotPriority == 0) {
+				continue;
+			}
+
+			if (nSlotPriority > nPriority) {
+				nPriority = nSlotPriority;
+				nExpected = source.pSender->data[i];
+			} else if (nSlotPriority == nPriority) {
+				nExpected = std::max(nExpected, source.pSender->data[i]);
+			}
+		}
+
+		if (s_LightSet.m_Data[0][i] != nExpected) {
+			printf("slot %u: %u, expected %u\n", static_cast<unsigned>(i), s_LightSet.m_Data[0][i], nExpected);
+			return false;
+		}
+	}
+
+	return true;
+}
+
+static void set_priority(Sender& sender, const uint8_t nFirstHalf, const uint8_t nSecondHalf) {
+	memset(sender.priority, nFirstHalf, SIZE / 2);
+	memset(&sender.priority[SIZE / 2], nSecondHalf, SIZE / 2);
+}
+
+struct Stream {
+	Sender *pSender;
+	uint8_t nPriority;	///< Packet priority
+	bool doSlotPriority;
+};
+
+/**
+ * 40 DMX frames a second, 0xDD once a second before the DMX frame
+ */
+static void play(E131Bridge& bridge, const uint32_t nMillis, std::initializer_list<Stream> streams) {
+	for (uint32_t nFrame = 0; nFrame < (nMillis / FRAME_MILLIS); nFrame++) {
+		for (const auto& stream : streams) {
+			set_level(*stream.pSender, static_cast<uint8_t>(nFrame));
+
+			if (stream.doSlotPriority && ((nFrame % PRIORITY_FRAMES) == 0)) {
+				queue(*stream.pSender, UNIVERSE, stream.nPriority, 0, e131::startcode::PER_ADDRESS_PRIORITY);
+			}
+
+			queue(*stream.pSender, UNIVERSE, stream.nPriority);
+		}
+
+		run(bridge, FRAME_MILLIS);
+	}
+}
+
+int main() {
+	E131Bridge bridge;
+
+	bridge.SetOutput(&s_LightSet);
+	bridge.SetUniverse(0, lightset::PortDir::OUTPUT, UNIVERSE);
+	bridge.SetDisableSynchronize(true);
+	bridge.Start();
+
+	Sender a { network::convert_to_uint(10, 0, 0, 21), 0, {}, {} };
+	Sender b { network::convert_to_uint(10, 0, 0, 22), 0, {}, {} };
+	Sender d { network::convert_to_uint(10, 0, 0, 23), 0, {}, {} };
+
+	uint8_t priority30[SIZE];
+	uint8_t priority100[SIZE];
+	memset(priority30, 30, SIZE);
+	memset(priority100, 100, SIZE);
+
+	/*
+	 * A is high on the first half, B on the second half, equal on the first 10 slots
+	 */
+	set_priority(a, 200, 50);
+	set_priority(b, 50, 200);
+	memset(a.priority, 150, 10);
+	memset(b.priority, 150, 10);
+
+	play(bridge, 2000, { { &a, 100, true }, { &b, 30, true } });
+
+	check(bridge.GetActiveSources(0) == 2, "A and B", s_nMillis);
+	check(is_merged({ { &a, a.priority }, { &b, b.priority } }), "per slot merge", s_nMillis);
+
+	/*
+	 * B stops sending 0xDD, B keeps its 0xDD until the timeout, then falls back to its packet priority 30
+	 */
+	play(bridge, SLOT_PRIORITY_TIMEOUT_MILLIS - 1000, { { &a, 100, true }, { &b, 30, false } });
+	check(is_merged({ { &a, a.priority }, { &b, b.priority } }), "B 0xDD before the timeout", s_nMillis);
+
+	play(bridge, 1000, { { &a, 100, true }, { &b, 30, false } });
+	check(is_merged({ { &a, a.priority }, { &b, priority30 } }), "B falls back to its packet priority", s_nMillis);
+	check(bridge.GetActiveSources(0) == 2, "A and B after the B 0xDD timeout", s_nMillis);
+
+	/*
+	 * A stops sending 0xDD as well: the highest packet priority wins, B leaves
+	 */
+	const auto nLeft = bridge.GetSourcesLeft(0);
+
+	play(bridge, SLOT_PRIORITY_TIMEOUT_MILLIS + 1000, { { &a, 100, false }, { &b, 30, false } });
+	check(bridge.GetActiveSources(0) == 1, "only A", s_nMillis);
+	check(bridge.GetSourcesLeft(0) == nLeft + 1, "B left", s_nMillis);
+	check(bridge.GetOutputPriority(0) == 100, "packet priority 100", s_nMillis);
+	check(is_merged({ { &a, priority100 } }), "A without 0xDD", s_nMillis);
+
+	/*
+	 * A source leaves mid-merge: B terminates its stream, then B is back and goes silent
+	 */
+	play(bridge, 2000, { { &a, 100, true }, { &b, 30, true } });
+	check(bridge.GetActiveSources(0) == 2, "B is back with 0xDD", s_nMillis);
+	check(is_merged({ { &a, a.priority }, { &b, b.priority } }), "per slot merge again", s_nMillis);
+
+	queue(b, UNIVERSE, 30, e131::OptionsMask::STREAM_TERMINATED);
+	play(bridge, FRAME_MILLIS, { { &a, 100, true } });
+	check(bridge.GetActiveSources(0) == 1, "B terminated", s_nMillis);
+	check(is_merged({ { &a, a.priority } }), "A alone after B terminated", s_nMillis);
+
+	play(bridge, 2000, { { &a, 100, true }, { &b, 30, true } });
+	check(is_merged({ { &a, a.priority }, { &b, b.priority } }), "B is back", s_nMillis);
+
+	play(bridge, (e131::MERGE_TIMEOUT_SECONDS * 1000U) + 1000, { { &a, 100, true } });
+	check(bridge.GetActiveSources(0) == 1, "B timed out", s_nMillis);
+	check(is_merged({ { &a, a.priority } }), "A alone after B timed out", s_nMillis);
+
+	/*
+	 * Slot reuse: D takes the source slot of B, D sends packet priority 0 without 0xDD.
+	 * The slots of D are not sourced, the 0xDD of B must not be used for D.
+	 */
+	bridge.SetPriorityThreshold(0, 0);
+	memset(a.priority, 100, SIZE);
+	memset(b.priority, 150, SIZE);
+
+	play(bridge, 2000, { { &a, 100, true }, { &b, 0, true } });
+	check(is_merged({ { &a, a.priority }, { &b, b.priority } }), "B wins", s_nMillis);
+
+	queue(b, UNIVERSE, 0, e131::OptionsMask::STREAM_TERMINATED);
+	play(bridge, 1000, { { &a, 100, true }, { &d, 0, false } });
+
+	uint8_t priority0[SIZE];
+	memset(priority0, 0, SIZE);
+
+	check(bridge.GetActiveSources(0) == 2, "A and D", s_nMillis);
+	check(is_merged({ { &a, a.priority }, { &d, priority0 } }), "D does not use the 0xDD of B", s_nMillis);
+
+	if (s_nFailed != 0) {
+		printf("%d failed\n", s_nFailed);
+		return 1;
+	}
+
+	puts("ok");
+	return 0;
+}
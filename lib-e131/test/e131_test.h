@@ -0,0 +1,141 @@
+/**
+ * @file e131_test.h
+ *
+ * Host tests: synthetic sACN senders and the captured output
+ */
+/* Copyright (C) 2024 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef E131_TEST_H_
+#define E131_TEST_H_
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
+#include <initializer_list>
+
+#include "e131bridge.h"
+#include "e131packets.h"
+#include "e117const.h"
+
+#include "lightset.h"
+
+#include "network.h"
+#include "hardware.h"
+
+static constexpr uint32_t SIZE = lightset::dmx::UNIVERSE_SIZE;
+static constexpr uint32_t FRAME_MILLIS = 25;	///< 40 Hz
+
+inline int s_nFailed;
+
+inline void check(const bool isOk, const char *pName, const uint32_t nMillis) {
+	if (!isOk) {
+		printf("FAIL %s at %u ms\n", pName, static_cast<unsigned>(nMillis));
+		s_nFailed++;
+	}
+}
+
+class TestLightSet final : public LightSet {
+public:
+	void Start(const uint32_t) override {}
+	void Stop(const uint32_t) override {}
+
+	void SetData(const uint32_t nPortIndex, const uint8_t *pData, uint32_t nLength, const bool) override {
+		memcpy(m_Data[nPortIndex], pData, nLength);
+		m_nUpdates[nPortIndex]++;
+	}
+
+	void Sync(const uint32_t) override {}
+	void Sync() override {}
+
+	uint8_t m_Data[e131bridge::MAX_PORTS][SIZE];
+	uint32_t m_nUpdates[e131bridge::MAX_PORTS];
+};
+
+struct Sender {
+	uint32_t nIp;
+	uint8_t nSequence;
+	uint8_t data[SIZE];
+	uint8_t priority[SIZE];	///< Start code 0xDD
+};
+
+inline TestLightSet s_LightSet;
+inline uint32_t s_nMillis;
+
+inline void set_level(Sender& sender, const uint8_t nLevel) {
+	for (uint32_t i = 0; i < SIZE; i++) {
+		// Each sender is highest on a different part of the universe, nIp >> 24 is the last octet
+		sender.data[i] = static_cast<uint8_t>((i * (sender.nIp >> 24) + nLevel) & 0xFF);
+	}
+}
+
+inline void queue(Sender& sender, const uint16_t nUniverse, const uint8_t nPriority, const uint8_t nOptions = 0, const uint8_t nStartCode = e131::startcode::DMX) {
+	TE131DataPacket packet;
+	memset(&packet, 0, sizeof(packet));
+
+	packet.RootLayer.PreAmbleSize = __builtin_bswap16(0x10);
+	memcpy(packet.RootLayer.ACNPacketIdentifier, E117Const::ACN_PACKET_IDENTIFIER, e117::PACKET_IDENTIFIER_LENGTH);
+	packet.RootLayer.Vector = __builtin_bswap32(e131::vector::root::DATA);
+	memcpy(packet.RootLayer.Cid, &sender.nIp, sizeof(sender.nIp));
+
+	packet.FrameLayer.Vector = __builtin_bswap32(e131::vector::data::PACKET);
+	packet.FrameLayer.Priority = nPriority;
+	packet.FrameLayer.SequenceNumber = ++sender.nSequence;
+	packet.FrameLayer.Options = nOptions;
+	packet.FrameLayer.Universe = __builtin_bswap16(nUniverse);
+
+	packet.DMPLayer.Vector = e131::vector::dmp::SET_PROPERTY;
+	packet.DMPLayer.Type = 0xa1;
+	packet.DMPLayer.AddressIncrement = __builtin_bswap16(0x0001);
+	packet.DMPLayer.PropertyValueCount = __builtin_bswap16(SIZE + 1);
+	packet.DMPLayer.PropertyValues[0] = nStartCode;
+	memcpy(&packet.DMPLayer.PropertyValues[1], (nStartCode == e131::startcode::DMX) ? sender.data : sender.priority, SIZE);
+
+	Network::Get()->Queue(sender.nIp, &packet, sizeof(packet));
+}
+
+/**
+ * Advance the time, the bridge handles what is queued
+ */
+inline void run(E131Bridge& bridge, const uint32_t nMillis) {
+	s_nMillis += nMillis;
+	Hardware::Get()->SetMillis(s_nMillis);
+	bridge.Run();
+}
+
+inline bool is_output(const uint32_t nPortIndex, std::initializer_list<const Sender *> senders) {
+	for (uint32_t i = 0; i < SIZE; i++) {
+		uint8_t nExpected = 0;
+
+		for (const auto *pSender : senders) {
+			nExpected = std::max(nExpected, pSender->data[i]);
+		}
+
+		if (s_LightSet.m_Data[nPortIndex][i] != nExpected) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+#endif /* E131_TEST_H_ */
@@ -0,0 +1,48 @@
+/**
+ * @file hardware.h
+ *
+ * Host stub, the time is set by the test
+ */
+
+#ifndef HARDWARE_H_
+#define HARDWARE_H_
+
+#include <cstdint>
+
+namespace hardware {
+namespace ledblink {
+enum class Mode {
+	OFF_OFF, OFF_ON, NORMAL, DATA, FAST, REBOOT, UNKNOWN
+};
+}  // namespace ledblink
+}  // namespace hardware
+
+class Hardware {
+public:
+	void SetMode(const hardware::ledblink::Mode mode) {
+		m_Mode = mode;
+	}
+
+	hardware::ledblink::Mode GetMode() const {
+		return m_Mode;
+	}
+
+	uint32_t Millis() const {
+		return m_nMillis;
+	}
+
+	void SetMillis(const uint32_t nMillis) {
+		m_nMillis = nMillis;
+	}
+
+	static Hardware *Get() {
+		static Hardware s_Hardware;
+		return &s_Hardware;
+	}
+
+private:
+	hardware::ledblink::Mode m_Mode { hardware::ledblink::Mode::UNKNOWN };
+	uint32_t m_nMillis { 0 };
+};
+
+#endif /* HARDWARE_H_ */
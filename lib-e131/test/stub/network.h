@@ -0,0 +1,96 @@
+/**
+ * @file network.h
+ *
+ * Host stub, one UDP port.
+ * RecvFrom returns the packets queued with Queue(), in order.
+ */
+
+#ifndef NETWORK_H_
+#define NETWORK_H_
+
+#include <cstdint>
+#include <cstring>
+
+namespace network {
+static constexpr uint32_t convert_to_uint(const uint8_t a, const uint8_t b, const uint8_t c, const uint8_t d) {
+	return static_cast<uint32_t>(a) | static_cast<uint32_t>(b) << 8 | static_cast<uint32_t>(c) << 16 | static_cast<uint32_t>(d) << 24;
+}
+}  // namespace network
+
+class Network {
+public:
+	static constexpr uint32_t QUEUE_SIZE = 64;
+	static constexpr uint32_t BUFFER_SIZE = 640;
+
+	int32_t Begin(const uint16_t) {
+		return 0;
+	}
+
+	uint32_t RecvFrom(const int32_t, const void **ppBuffer, uint32_t *pFromIp, uint16_t *pFromPort) {
+		if (m_nHead == m_nTail) {
+			return 0;
+		}
+
+		auto& entry = m_Queue[m_nTail++ % QUEUE_SIZE];
+
+		*ppBuffer = entry.buffer;
+		*pFromIp = entry.nFromIp;
+		*pFromPort = 5568;
+
+		return entry.nLength;
+	}
+
+	void JoinGroup(const int32_t, const uint32_t) {
+		m_nJoined++;
+	}
+
+	void LeaveGroup(const int32_t, const uint32_t) {
+		m_nLeft++;
+	}
+
+	uint32_t GetIp() const {
+		return network::convert_to_uint(10, 0, 0, 1);
+	}
+
+	const char *GetHostName() const {
+		return "test";
+	}
+
+	/**
+	 * @return false when the queue is full
+	 */
+	bool Queue(const uint32_t nFromIp, const void *pBuffer, const uint32_t nLength) {
+		if ((m_nHead - m_nTail) == QUEUE_SIZE) {
+			return false;
+		}
+
+		auto& entry = m_Queue[m_nHead++ % QUEUE_SIZE];
+
+		memcpy(entry.buffer, pBuffer, nLength);
+		entry.nLength = nLength;
+		entry.nFromIp = nFromIp;
+
+		return true;
+	}
+
+	static Network *Get() {
+		static Network s_Network;
+		return &s_Network;
+	}
+
+	uint32_t m_nJoined { 0 };
+	uint32_t m_nLeft { 0 };
+
+private:
+	struct Entry {
+		uint8_t buffer[BUFFER_SIZE] __attribute__ ((aligned (4)));
+		uint32_t nLength;
+		uint32_t nFromIp;
+	};
+
+	Entry m_Queue[QUEUE_SIZE];
+	uint32_t m_nHead { 0 };
+	uint32_t m_nTail { 0 };
+};
+
+#endif /* NETWORK_H_ */
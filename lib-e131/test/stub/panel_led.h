@@ -0,0 +1,22 @@
+/**
+ * @file panel_led.h
+ *
+ * Host stub
+ */
+
+#ifndef PANEL_LED_H_
+#define PANEL_LED_H_
+
+#include <cstdint>
+
+namespace hal {
+namespace panelled {
+static constexpr uint32_t SACN = (1U << 0);
+static constexpr uint32_t PORT_A_TX = (1U << 1);
+}  // namespace panelled
+
+inline void panel_led_on(const uint32_t) {}
+inline void panel_led_off(const uint32_t) {}
+}  // namespace hal
+
+#endif /* PANEL_LED_H_ */
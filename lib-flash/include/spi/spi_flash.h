@@ -34,10 +34,29 @@ int spi_flash_probe(unsigned int cs, unsigned int max_hz, unsigned int spi_mode)
 const char *spi_flash_get_name();
 uint32_t spi_flash_get_size();
 uint32_t spi_flash_get_sector_size();
+uint32_t spi_flash_get_page_size();
 
 int spi_flash_cmd_read_fast(uint32_t offset, size_t len, uint8_t *data);
 int spi_flash_cmd_write_multi(uint32_t offset, size_t len, const uint8_t *buf);
 int spi_flash_cmd_erase(uint32_t offset, size_t len);
 int spi_flash_cmd_write_status(uint8_t sr);
 
+/*
+ * Asynchronous API, one operation at a time. Submitting while busy returns -1.
+ * The buffer must stay valid until the operation is finished.
+ * The data phase is done with DMA, when available.
+ * The operation is progressed by a 1ms software timer and by spi_flash_async_is_busy().
+ * A write or erase is finished when the flash chip is ready.
+ * The callback is called with the result (0 or -1) when the operation is finished.
+ * The blocking API above first finishes a running asynchronous operation.
+ */
+typedef void (*spi_flash_callback_t)(int nResult);
+
+int spi_flash_async_read(uint32_t offset, size_t len, uint8_t *data, spi_flash_callback_t callback = nullptr);
+int spi_flash_async_write(uint32_t offset, size_t len, const uint8_t *buf, spi_flash_callback_t callback = nullptr);
+int spi_flash_async_erase(uint32_t offset, size_t len, spi_flash_callback_t callback = nullptr);
+bool spi_flash_async_is_busy();
+int spi_flash_async_get_result();
+void spi_flash_async_run();
+
 #endif /* SPI_FLASH_H_ */
@@ -24,15 +24,74 @@
  */
 
 #include <cstdint>
+#include <cassert>
 
 #include "./../../spi/spi_flash_internal.h"
 
 #include "gd32_spi.h"
 #include "gd32_gpio.h"
 #include "gd32.h"
+#if defined (SPI_RX_DMA_CHx)
+# include "gd32_dma.h"
+#endif
 
 #include "debug.h"
 
+#if defined (SPI_RX_DMA_CHx)
+/*
+ * The data phase of a read or program is done with the SPI RX and TX DMA channels.
+ * A read transmits s_nDummy, a write receives into s_nDummy (no memory increment).
+ */
+static uint8_t s_nDummy;
+
+static void spi_dma_config(const dma_channel_enum channelx, const dma_subperipheral_enum nSubPeri, const uint32_t nDirection) {
+	dma_deinit(SPI_DMAx, channelx);
+
+	DMA_PARAMETER_STRUCT dma_init_struct;
+	dma_single_data_para_struct_init(&dma_init_struct);
+
+	dma_init_struct.direction = nDirection;
+	dma_init_struct.memory_inc = DMA_MEMORY_INCREASE_ENABLE;
+	dma_init_struct.periph_addr = SPI_PERIPH + 0x0CU;
+	dma_init_struct.periph_inc = DMA_PERIPH_INCREASE_DISABLE;
+	dma_init_struct.periph_memory_width = DMA_PERIPHERAL_WIDTH_8BIT;
+	dma_init_struct.priority = DMA_PRIORITY_LOW;
+	dma_init(SPI_DMAx, channelx, &dma_init_struct);
+
+	dma_circulation_disable(SPI_DMAx, channelx);
+	dma_channel_subperipheral_select(SPI_DMAx, channelx, nSubPeri);
+
+	DMA_CHCNT(SPI_DMAx, channelx) = 0;
+}
+
+static void spi_dma_channel_start(const dma_channel_enum channelx, const uint8_t *pBuffer, const bool doIncrease, const uint32_t nLength) {
+	dma_flag_clear(SPI_DMAx, channelx, DMA_FLAG_FTF);
+
+	auto nDmaChCTL = DMA_CHCTL(SPI_DMAx, channelx);
+	nDmaChCTL &= ~DMA_CHXCTL_CHEN;
+	DMA_CHCTL(SPI_DMAx, channelx) = nDmaChCTL;
+
+	if (doIncrease) {
+		nDmaChCTL |= DMA_CHXCTL_MNAGA;
+	} else {
+		nDmaChCTL &= ~DMA_CHXCTL_MNAGA;
+	}
+
+	DMA_CHMADDR(SPI_DMAx, channelx) = reinterpret_cast<uint32_t>(pBuffer);
+	DMA_CHCNT(SPI_DMAx, channelx) = nLength;
+
+	nDmaChCTL |= DMA_CHXCTL_CHEN;
+	DMA_CHCTL(SPI_DMAx, channelx) = nDmaChCTL;
+}
+
+/**
+ * The TCM SRAM (stack) cannot be accessed by the DMA
+ */
+static bool is_dma_memory(const uint8_t *pBuffer) {
+	return (pBuffer == nullptr) || ((reinterpret_cast<uint32_t>(pBuffer) & 0xF0000000) != 0x10000000);
+}
+#endif
+
 int spi_init() {
 	gd32_spi_begin();
 	gd32_spi_chipSelect(GD32_SPI_CS_NONE);
@@ -42,6 +101,17 @@ int spi_init() {
 	gpio_fsel(SPI_FLASH_CS_GPIOx, SPI_FLASH_CS_GPIO_PINx, GPIO_FSEL_OUTPUT);
 	gpio_bit_set(SPI_FLASH_CS_GPIOx, SPI_FLASH_CS_GPIO_PINx);
 
+#if defined (SPI_RX_DMA_CHx)
+	if (SPI_DMAx == DMA0) {
+		rcu_periph_clock_enable(RCU_DMA0);
+	} else {
+		rcu_periph_clock_enable(RCU_DMA1);
+	}
+
+	spi_dma_config(SPI_RX_DMA_CHx, SPI_RX_DMA_SUBPERIx, DMA_PERIPH_TO_MEMORY);
+	spi_dma_config(SPI_DMA_CHx, SPI_DMA_SUBPERIx, DMA_MEMORY_TO_PERIPHERAL);
+#endif
+
 #if defined (SPI_FLASH_WP_GPIO_PINx)
 	gpio_fsel(SPI_GPIOx, SPI_FLASH_WP_GPIO_PINx, GPIO_FSEL_OUTPUT);
 	gpio_bit_set(SPI_GPIOx, SPI_FLASH_WP_GPIO_PINx);
@@ -81,3 +151,48 @@ int spi_xfer(uint32_t nLength, const uint8_t *pOut, uint8_t *pIn, uint32_t nFlag
 
 	return 0;
 }
+
+void spi_xfer_dma_start(uint32_t nLength, const uint8_t *pOut, uint8_t *pIn) {
+	assert(nLength != 0);
+	assert(nLength <= SPI_XFER_DMA_MAX);
+
+#if defined (SPI_RX_DMA_CHx)
+	if (is_dma_memory(pOut) && is_dma_memory(pIn)) {
+		s_nDummy = 0xFF;
+
+		while (RESET != (SPI_STAT(SPI_PERIPH) & SPI_FLAG_RBNE)) {
+			(void) SPI_DATA(SPI_PERIPH);
+		}
+
+		if (pIn == nullptr) {
+			spi_dma_channel_start(SPI_RX_DMA_CHx, &s_nDummy, false, nLength);
+		} else {
+			spi_dma_channel_start(SPI_RX_DMA_CHx, pIn, true, nLength);
+		}
+
+		if (pOut == nullptr) {
+			spi_dma_channel_start(SPI_DMA_CHx, &s_nDummy, false, nLength);
+		} else {
+			spi_dma_channel_start(SPI_DMA_CHx, pOut, true, nLength);
+		}
+
+		spi_dma_enable(SPI_PERIPH, SPI_DMA_RECEIVE);
+		spi_dma_enable(SPI_PERIPH, SPI_DMA_TRANSMIT);
+		return;
+	}
+#endif
+
+	spi_xfer(nLength, pOut, pIn, 0);
+}
+
+bool spi_xfer_dma_is_active() {
+#if defined (SPI_RX_DMA_CHx)
+	if (DMA_CHCNT(SPI_DMAx, SPI_RX_DMA_CHx) != 0) {
+		return true;
+	}
+
+	spi_dma_disable(SPI_PERIPH, SPI_DMA_TRANSMIT);
+	spi_dma_disable(SPI_PERIPH, SPI_DMA_RECEIVE);
+#endif
+	return false;
+}
@@ -33,12 +33,14 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include <stdio.h>
-#include <time.h>
+#include <cassert>
 
 #include "spi/spi_flash.h"
 
 #include "spi_flash_internal.h"
 
+#include "hardware.h"
+
 #include "debug.h"
 
 static struct spi_flash s_flash = { "", 0, 0, 0, CMD_READ_STATUS };
@@ -91,14 +93,6 @@ static const struct {
 };
 #define IDCODE_LEN (IDCODE_CONT_LEN + IDCODE_PART_LEN)
 
-static uint32_t get_timer(uint32_t base) {
-	if (0 == base) {
-		return static_cast<uint32_t>(time(nullptr));
-	}
-
-	return static_cast<uint32_t>(time(nullptr)) - base;
-}
-
 uint32_t spi_flash_get_size() {
 	return s_flash.size;
 }
@@ -107,6 +101,10 @@ uint32_t spi_flash_get_sector_size() {
 	return s_flash.sector_size;
 }
 
+uint32_t spi_flash_get_page_size() {
+	return s_flash.page_size;
+}
+
 const char *spi_flash_get_name() {
 	return s_flash.name;
 }
@@ -151,218 +149,307 @@ static inline int spi_flash_cmd_write_enable() {
 	return spi_flash_cmd(CMD_WRITE_ENABLE, nullptr, 0);
 }
 
-static int spi_flash_cmd_wait_ready(unsigned long timeout) {
-	unsigned long timebase;
+/*
+ * Asynchronous operations, one at a time.
+ * An operation is a sequence of steps. A step never waits: the busy status of the
+ * flash chip and the end of the DMA data phase are polled on the next step.
+ */
+
+enum class Operation {
+	NONE, READ, WRITE, ERASE
+};
+
+enum class Phase {
+	WAIT_READY, COMMAND, DATA
+};
+
+static struct {
+	Operation operation;
+	Phase phase;
+	uint32_t offset;
+	size_t remaining;
+	size_t chunk_len;
+	const uint8_t *out;
+	uint8_t *in;
+	spi_flash_callback_t callback;
+	uint32_t timebase;
+	uint32_t timeout;
+	int result;
+} s_async;
+
+static int32_t s_nTimerId = -1;
+
+static bool spi_flash_is_ready() {
+	const uint8_t cmd = s_flash.poll_cmd;
 	uint8_t status;
-	uint8_t check_status = 0x0;
-	uint8_t poll_bit = STATUS_WIP;
-	uint8_t cmd = s_flash.poll_cmd;
+
+	spi_flash_cmd_read(&cmd, 1, &status, 1);
 
 	if (cmd == CMD_FLAG_STATUS) {
-		poll_bit = STATUS_PEC;
-		check_status = poll_bit;
+		return (status & STATUS_PEC) == STATUS_PEC;
 	}
 
-	spi_xfer(1, &cmd, nullptr, SPI_XFER_BEGIN);
+	return (status & STATUS_WIP) == 0;
+}
 
-	timebase = get_timer(0);
+static void spi_flash_async_complete(int ret) {
+	s_async.operation = Operation::NONE;
+	s_async.result = ret;
 
-	do {
-		spi_xfer(1, nullptr, &status, 0);
+	if (s_async.callback != nullptr) {
+		auto callback = s_async.callback;
+		s_async.callback = nullptr;
+		callback(ret);
+	}
+}
+
+static void spi_flash_async_wait_ready(uint32_t timeout) {
+	s_async.phase = Phase::WAIT_READY;
+	s_async.timebase = Hardware::Get()->Millis();
+	s_async.timeout = timeout;
+}
 
-		if ((status & poll_bit) == check_status) {
-			break;
+/**
+ * @return true when the next step can be done immediately
+ */
+static bool spi_flash_async_step() {
+	switch (s_async.phase) {
+	case Phase::WAIT_READY:
+		if (!spi_flash_is_ready()) {
+			if ((Hardware::Get()->Millis() - s_async.timebase) >= s_async.timeout) {
+				DEBUG_PUTS("time out");
+				spi_flash_async_complete(-1);
+			}
+			return false;
 		}
 
-	} while (get_timer(timebase) < timeout);
+		if (s_async.remaining == 0) {
+			spi_flash_async_complete(0);
+			return false;
+		}
 
-	spi_xfer(0, nullptr, nullptr, SPI_XFER_END);
+		s_async.phase = Phase::COMMAND;
+		return true;
+	case Phase::COMMAND: {
+		uint8_t cmd[5];
 
-	if ((status & poll_bit) == check_status) {
-		return 0;
-	}
+		spi_flash_addr(s_async.offset, cmd);
 
-	DEBUG_PUTS("time out");
-	return -1;
-}
+		if (s_async.operation == Operation::READ) {
+			cmd[0] = CMD_READ_ARRAY_FAST;
+			cmd[4] = 0x00;
 
-static int spi_flash_write_common(const uint8_t *cmd, size_t cmd_len, const uint8_t *buf, size_t buf_len, bool wait_ready) {
-	unsigned long timeout = SPI_FLASH_PROG_TIMEOUT;
-	int ret;
+			const size_t remain_len = SPI_FLASH_16MB_BOUN - (s_async.offset % SPI_FLASH_16MB_BOUN);
+			s_async.chunk_len = min(min(s_async.remaining, remain_len), static_cast<size_t>(SPI_XFER_DMA_MAX));
 
-	if (buf == nullptr) {
-		timeout = SPI_FLASH_PAGE_ERASE_TIMEOUT;
-	}
+			spi_xfer(sizeof(cmd), cmd, nullptr, SPI_XFER_BEGIN);
+			spi_xfer_dma_start(static_cast<uint32_t>(s_async.chunk_len), nullptr, s_async.in);
 
-	ret = spi_flash_cmd_write_enable();
+			s_async.phase = Phase::DATA;
+			return true;
+		}
 
-	if (ret < 0) {
-		DEBUG_PUTS("enabling write failed");
-		return ret;
-	}
+		if (spi_flash_cmd_write_enable() < 0) {
+			DEBUG_PUTS("enabling write failed");
+			spi_flash_async_complete(-1);
+			return false;
+		}
 
-	ret = spi_flash_cmd_write(cmd, cmd_len, buf, buf_len);
+		if (s_async.operation == Operation::WRITE) {
+			cmd[0] = CMD_PAGE_PROGRAM;
 
-	if (ret < 0) {
-		DEBUG_PUTS("write cmd failed");
-		return ret;
-	}
+			const size_t page_size = s_flash.page_size;
+			s_async.chunk_len = min(s_async.remaining, page_size - (s_async.offset % page_size));
 
-	if (wait_ready) {
-		ret = spi_flash_cmd_wait_ready(timeout);
+			spi_xfer(4, cmd, nullptr, SPI_XFER_BEGIN);
+			spi_xfer_dma_start(static_cast<uint32_t>(s_async.chunk_len), s_async.out, nullptr);
 
-		if (ret < 0) {
-			DEBUG_PRINTF("write %s timed out", timeout == SPI_FLASH_PROG_TIMEOUT ? "program" : "page erase");
-			return ret;
+			s_async.phase = Phase::DATA;
+			return true;
 		}
-	}
 
-	return ret;
-}
+		assert(s_async.operation == Operation::ERASE);
 
-int spi_flash_cmd_write_multi(uint32_t offset, size_t len, const uint8_t *buf) {
-	DEBUG_ENTRY
+		cmd[0] = (s_flash.sector_size == 4096) ? CMD_ERASE_4K : CMD_ERASE_64K;
 
-	unsigned long byte_addr, page_size;
-	size_t chunk_len, actual;
-	uint8_t cmd[4];
-	int ret = -1;
+		DEBUG_PRINTF("erase %2x %2x %2x %2x (%x)", cmd[0], cmd[1], cmd[2], cmd[3], s_async.offset);
 
-	page_size = s_flash.page_size;
+		spi_flash_cmd_write(cmd, 4, nullptr, 0);
 
-	cmd[0] = CMD_PAGE_PROGRAM;
+		s_async.offset += s_flash.sector_size;
+		s_async.remaining -= s_flash.sector_size;
 
-	spi_flash_cmd_wait_ready(SPI_FLASH_SECTOR_ERASE_TIMEOUT);
+		spi_flash_async_wait_ready(SPI_FLASH_PAGE_ERASE_TIMEOUT);
+		return true;
+	}
+	case Phase::DATA:
+		if (spi_xfer_dma_is_active()) {
+			return false;
+		}
 
-	for (actual = 0; actual < len; actual += chunk_len) {
-		byte_addr = offset % page_size;
-		chunk_len = min(len - actual, page_size - byte_addr);
+		spi_xfer(0, nullptr, nullptr, SPI_XFER_END);
 
-		spi_flash_addr(offset, cmd);
+		s_async.offset += static_cast<uint32_t>(s_async.chunk_len);
+		s_async.remaining -= s_async.chunk_len;
 
-		DEBUG_PRINTF("0x%p => cmd = { 0x%02x 0x%02x%02x%02x } actual=%d, chunk_len=%d", buf + actual, cmd[0], cmd[1], cmd[2], cmd[3], static_cast<int>(actual),static_cast<int>(chunk_len));
+		if (s_async.operation == Operation::READ) {
+			s_async.in += s_async.chunk_len;
+		} else {
+			s_async.out += s_async.chunk_len;
+		}
 
-		ret = spi_flash_write_common(cmd, sizeof(cmd), buf + actual, chunk_len, ((actual + chunk_len) != len));
+		spi_flash_async_wait_ready(SPI_FLASH_PROG_TIMEOUT);
+		return true;
+	default:
+		assert(0);
+		__builtin_unreachable();
+		break;
+	}
 
-		if (ret < 0) {
-			DEBUG_PUTS("write failed");
-			break;
-		}
+	return false;
+}
 
-		offset += chunk_len;
+static int spi_flash_async_submit(Operation operation, uint32_t offset, size_t len, const uint8_t *out, uint8_t *in, spi_flash_callback_t callback) {
+	if (s_async.operation != Operation::NONE) {
+		DEBUG_PUTS("Busy");
+		return -1;
 	}
 
-	DEBUG_EXIT
-	return ret;
+	if ((operation == Operation::ERASE) && ((offset % s_flash.sector_size) || (len % s_flash.sector_size))) {
+		DEBUG_PUTS("Erase offset/length not multiple of erase size");
+		return -1;
+	}
+
+	s_async.operation = operation;
+	s_async.offset = offset;
+	s_async.remaining = len;
+	s_async.out = out;
+	s_async.in = in;
+	s_async.callback = callback;
+	s_async.result = 0;
+
+	// A previous erase could still be running
+	spi_flash_async_wait_ready(SPI_FLASH_SECTOR_ERASE_TIMEOUT);
+
+	return 0;
 }
 
+/**
+ * Blocking: runs the steps until the current operation, and the ones started from its callback, are done
+ */
+static int spi_flash_async_wait() {
+	while (s_async.operation != Operation::NONE) {
+		spi_flash_async_run();
+	}
 
-int spi_flash_read_common(const uint8_t *cmd, size_t cmd_len, uint8_t *data, size_t data_len) {
-	int ret;
+	return s_async.result;
+}
 
-	ret = spi_flash_cmd_read(cmd, cmd_len, data, data_len);
+static int spi_flash_async_start(Operation operation, uint32_t offset, size_t len, const uint8_t *out, uint8_t *in, spi_flash_callback_t callback) {
+	if (spi_flash_async_submit(operation, offset, len, out, in, callback) < 0) {
+		return -1;
+	}
 
-	return ret;
+	if (s_nTimerId < 0) {
+		s_nTimerId = Hardware::Get()->SoftwareTimerAdd(1, spi_flash_async_run);
+	}
+
+	spi_flash_async_run();
+	return 0;
 }
 
-int spi_flash_cmd_read_fast(uint32_t offset, size_t len, uint8_t *data) {
-	DEBUG_ENTRY
+void spi_flash_async_run() {
+	while ((s_async.operation != Operation::NONE) && spi_flash_async_step())
+		;
+}
 
-	uint8_t cmd[5], bank_sel = 0;
-	uint32_t remain_len, read_len;
-	int ret = -1;
+int spi_flash_async_read(uint32_t offset, size_t len, uint8_t *data, spi_flash_callback_t callback) {
+	return spi_flash_async_start(Operation::READ, offset, len, nullptr, data, callback);
+}
 
-	cmd[0] = CMD_READ_ARRAY_FAST;
-	cmd[4] = 0x00;
+int spi_flash_async_write(uint32_t offset, size_t len, const uint8_t *buf, spi_flash_callback_t callback) {
+	return spi_flash_async_start(Operation::WRITE, offset, len, buf, nullptr, callback);
+}
 
-	spi_flash_cmd_wait_ready(SPI_FLASH_PROG_TIMEOUT);
+int spi_flash_async_erase(uint32_t offset, size_t len, spi_flash_callback_t callback) {
+	return spi_flash_async_start(Operation::ERASE, offset, len, nullptr, nullptr, callback);
+}
 
-	while (len) {
-		remain_len = (SPI_FLASH_16MB_BOUN * static_cast<uint32_t>(bank_sel + 1) - offset);
+bool spi_flash_async_is_busy() {
+	spi_flash_async_run();
+	return s_async.operation != Operation::NONE;
+}
 
-		if (len < remain_len) {
-			read_len = len;
-		}
-		else {
-			read_len = remain_len;
-		}
+int spi_flash_async_get_result() {
+	return s_async.result;
+}
 
-		spi_flash_addr(offset, cmd);
+/*
+ * Blocking API
+ */
 
-		ret = spi_flash_read_common(cmd, sizeof(cmd), data, read_len);
+int spi_flash_cmd_read_fast(uint32_t offset, size_t len, uint8_t *data) {
+	DEBUG_ENTRY
 
-		if (ret < 0) {
-			DEBUG_PUTS("Read failed");
-			DEBUG_EXIT
-			break;
-		}
+	spi_flash_async_wait();
 
-		offset += read_len;
-		len -= read_len;
-		data += read_len;
+	if (spi_flash_async_submit(Operation::READ, offset, len, nullptr, data, nullptr) < 0) {
+		DEBUG_EXIT
+		return -1;
 	}
 
+	const auto ret = spi_flash_async_wait();
+
 	DEBUG_EXIT
 	return ret;
 }
 
-int spi_flash_cmd_erase(uint32_t offset, size_t len) {
+int spi_flash_cmd_write_multi(uint32_t offset, size_t len, const uint8_t *buf) {
 	DEBUG_ENTRY
 
-	uint32_t erase_size;
-	uint8_t cmd[4];
-	int ret = -1;
+	spi_flash_async_wait();
 
-	erase_size = s_flash.sector_size;
-
-	if (offset % erase_size || len % erase_size) {
-		DEBUG_PUTS("Erase offset/length not multiple of erase size");
+	if (spi_flash_async_submit(Operation::WRITE, offset, len, buf, nullptr, nullptr) < 0) {
 		DEBUG_EXIT
 		return -1;
 	}
 
-	if (erase_size == 4096) {
-		cmd[0] = CMD_ERASE_4K;
-	} else {
-		cmd[0] = CMD_ERASE_64K;
-	}
-
-	spi_flash_cmd_wait_ready(SPI_FLASH_PROG_TIMEOUT);
-
-	while (len) {
-		spi_flash_addr(offset, cmd);
+	const auto ret = spi_flash_async_wait();
 
-		DEBUG_PRINTF("erase %2x %2x %2x %2x (%x)", cmd[0], cmd[1], cmd[2], cmd[3], offset);
+	DEBUG_EXIT
+	return ret;
+}
 
-		ret = spi_flash_write_common(cmd, sizeof(cmd), nullptr, 0, (len != erase_size));
+int spi_flash_cmd_erase(uint32_t offset, size_t len) {
+	DEBUG_ENTRY
 
-		if (ret < 0) {
-			DEBUG_PUTS("Erase failed");
-			DEBUG_EXIT
-			break;
-		}
+	spi_flash_async_wait();
 
-		offset += erase_size;
-		len -= erase_size;
+	if (spi_flash_async_submit(Operation::ERASE, offset, len, nullptr, nullptr, nullptr) < 0) {
+		DEBUG_EXIT
+		return -1;
 	}
 
+	const auto ret = spi_flash_async_wait();
+
 	DEBUG_EXIT
 	return ret;
 }
 
 int spi_flash_cmd_write_status(uint8_t sr) {
-	uint8_t cmd;
-	int ret;
+	spi_flash_async_wait();
 
-	cmd = CMD_WRITE_STATUS;
-	ret = spi_flash_write_common(&cmd, 1, &sr, 1, false);
+	const uint8_t cmd = CMD_WRITE_STATUS;
 
-	if (ret < 0) {
+	if ((spi_flash_cmd_write_enable() < 0) || (spi_flash_cmd_write(&cmd, 1, &sr, 1) < 0)) {
 		DEBUG_PUTS("Fail to write status register");
-		return ret;
+		return -1;
 	}
 
-	return 0;
+	// Nothing to write, wait for the status register write to finish
+	spi_flash_async_submit(Operation::WRITE, 0, 0, nullptr, nullptr, nullptr);
+
+	return spi_flash_async_wait();
 }
 
 int spi_flash_probe([[maybe_unused]] unsigned int cs, [[maybe_unused]] unsigned int max_hz, [[maybe_unused]] unsigned int spi_mode) {
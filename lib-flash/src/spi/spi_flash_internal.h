@@ -42,9 +42,10 @@ struct spi_flash {
 
 #define ARRAY_SIZE(x) (sizeof(x) / sizeof((x)[0]))
 
-#define SPI_FLASH_PROG_TIMEOUT			(2)
-#define SPI_FLASH_PAGE_ERASE_TIMEOUT	(5)
-#define SPI_FLASH_SECTOR_ERASE_TIMEOUT	(10)
+/* Timeouts in milliseconds */
+#define SPI_FLASH_PROG_TIMEOUT			(2000U)
+#define SPI_FLASH_PAGE_ERASE_TIMEOUT	(5000U)
+#define SPI_FLASH_SECTOR_ERASE_TIMEOUT	(10000U)
 
 /* Common commands */
 #define CMD_READ_ID			0x9f
@@ -74,9 +75,18 @@ struct spi_flash {
 
 #define SPI_XFER_SPEED_HZ	6000000	///< 6MHz
 
+#define SPI_XFER_DMA_MAX	0xFFFF	///< DMA transfer count is 16 bits
+
 extern int spi_init();
 extern int spi_xfer(uint32_t bitlen, const uint8_t *dout, uint8_t *din, uint32_t flags);
 
+/*
+ * Data phase, CS is not changed. Without DMA support the transfer is done
+ * before spi_xfer_dma_start() returns.
+ */
+extern void spi_xfer_dma_start(uint32_t nLength, const uint8_t *pOut, uint8_t *pIn);
+extern bool spi_xfer_dma_is_active();
+
 //#define CONFIG_SPI_FLASH_MACRONIX
 //int spi_flash_probe_macronix(struct spi_flash *flash, uint8_t *idcode);
 
@@ -107,6 +107,9 @@
 # define SPI_NSS_GPIO_PINx	SPI2_NSS_GPIO_PINx
 # define SPI_DMAx			SPI2_DMAx
 # define SPI_DMA_CHx		SPI2_TX_DMA_CHx
+# define SPI_DMA_SUBPERIx	SPI2_TX_DMA_SUBPERIx
+# define SPI_RX_DMA_CHx		SPI2_RX_DMA_CHx
+# define SPI_RX_DMA_SUBPERIx	SPI2_RX_DMA_SUBPERIx
 #else
 # define SPI0_REMAP
 # if defined (SPI0_REMAP)
@@ -126,6 +129,8 @@
 # define SPI_DMAx			SPI0_DMAx
 # define SPI_DMA_CHx		SPI0_TX_DMA_CHx
 # define SPI_DMA_SUBPERIx	SPI0_TX_DMA_SUBPERIx
+# define SPI_RX_DMA_CHx		SPI0_RX_DMA_CHx
+# define SPI_RX_DMA_SUBPERIx	SPI0_RX_DMA_SUBPERIx
 #endif
 
 /**
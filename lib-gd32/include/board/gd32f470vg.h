@@ -102,6 +102,8 @@
 #define SPI_DMAx			SPI2_DMAx
 #define SPI_DMA_CHx			SPI2_TX_DMA_CHx
 #define SPI_DMA_SUBPERIx	SPI2_TX_DMA_SUBPERIx
+#define SPI_RX_DMA_CHx		SPI2_RX_DMA_CHx
+#define SPI_RX_DMA_SUBPERIx	SPI2_RX_DMA_SUBPERIx
 
 /**
  * Panel LEDs
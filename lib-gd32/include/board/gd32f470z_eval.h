@@ -112,6 +112,8 @@
 #define SPI_DMAx			SPI5_DMAx
 #define SPI_DMA_CHx			SPI5_TX_DMA_CHx
 #define SPI_DMA_SUBPERIx	SPI5_TX_DMA_SUBPERIx
+#define SPI_RX_DMA_CHx		SPI5_RX_DMA_CHx
+#define SPI_RX_DMA_SUBPERIx	SPI5_RX_DMA_SUBPERIx
 
 /**
  * U(S)ART
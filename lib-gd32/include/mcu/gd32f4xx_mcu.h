@@ -355,28 +355,40 @@
  */
 
 #define SPI0_DMAx				DMA1
-#define SPI0_TX_DMA_CHx			DMA_CH2
+#define SPI0_TX_DMA_CHx			DMA_CH3
 #define SPI0_TX_DMA_SUBPERIx    DMA_SUBPERI3
+#define SPI0_RX_DMA_CHx			DMA_CH0
+#define SPI0_RX_DMA_SUBPERIx    DMA_SUBPERI3
 
 #define SPI1_DMAx				DMA0
 #define SPI1_TX_DMA_CHx			DMA_CH4
 #define SPI1_TX_DMA_SUBPERIx    DMA_SUBPERI0
+#define SPI1_RX_DMA_CHx			DMA_CH3
+#define SPI1_RX_DMA_SUBPERIx    DMA_SUBPERI0
 
 #define SPI2_DMAx				DMA0
 #define SPI2_TX_DMA_CHx			DMA_CH5
 #define SPI2_TX_DMA_SUBPERIx	DMA_SUBPERI0
+#define SPI2_RX_DMA_CHx			DMA_CH2
+#define SPI2_RX_DMA_SUBPERIx	DMA_SUBPERI0
 
 #define SPI3_DMAx               DMA1
 #define SPI3_TX_DMA_CHx         DMA_CH1
 #define SPI3_TX_DMA_SUBPERIx    DMA_SUBPER4
+#define SPI3_RX_DMA_CHx         DMA_CH0
+#define SPI3_RX_DMA_SUBPERIx    DMA_SUBPERI4
 
 #define SPI4_DMAx               DMA1
 #define SPI4_TX_DMA_CHx         DMA_CH4
 #define SPI4_TX_DMA_SUBPERIx    DMA_SUBPERI2
+#define SPI4_RX_DMA_CHx         DMA_CH3
+#define SPI4_RX_DMA_SUBPERIx    DMA_SUBPERI2
 
 #define SPI5_DMAx               DMA1
 #define SPI5_TX_DMA_CHx         DMA_CH5
 #define SPI5_TX_DMA_SUBPERIx    DMA_SUBPERI1
+#define SPI5_RX_DMA_CHx         DMA_CH6
+#define SPI5_RX_DMA_SUBPERIx    DMA_SUBPERI1
 
 #define TIMER2_RCU_DMAx         RCU_DMA0
 #define TIMER2_DMAx             DMA0
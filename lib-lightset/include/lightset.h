@@ -90,6 +90,37 @@ inline const char *get_merge_mode(const unsigned m, const bool bToUpper = false)
 	return get_merge_mode(static_cast<MergeMode>(m), bToUpper);
 }
 
+/**
+ * Slot range "first-last" or "slot", 1 based.
+ * @return false when the range is not within 1-512
+ */
+inline bool get_slot_range(const char *pRange, uint16_t& nSlotFirst, uint16_t& nSlotLast) {
+	uint32_t nFirst = 0;
+
+	while ((*pRange >= '0') && (*pRange <= '9') && (nFirst <= dmx::UNIVERSE_SIZE)) {
+		nFirst = nFirst * 10 + static_cast<uint32_t>(*pRange++ - '0');
+	}
+
+	auto nLast = nFirst;
+
+	if (*pRange == '-') {
+		pRange++;
+		nLast = 0;
+
+		while ((*pRange >= '0') && (*pRange <= '9') && (nLast <= dmx::UNIVERSE_SIZE)) {
+			nLast = nLast * 10 + static_cast<uint32_t>(*pRange++ - '0');
+		}
+	}
+
+	if ((nFirst == 0) || (nFirst > nLast) || (nLast > dmx::UNIVERSE_SIZE)) {
+		return false;
+	}
+
+	nSlotFirst = static_cast<uint16_t>(nFirst);
+	nSlotLast = static_cast<uint16_t>(nLast);
+	return true;
+}
+
 inline PortDir get_direction(const char *pPortDir) {
 	if (pPortDir != nullptr) {
 		if (((pPortDir[0] | 0x20) == 'i')
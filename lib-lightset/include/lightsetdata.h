@@ -28,10 +28,10 @@
 
 #include <cstdint>
 #include <cstring>
-#include <algorithm>
 #include <cassert>
 
 #include "lightset.h"
+#include "lightsetmerge.h"
 
 #if defined (GD32)
 /**
@@ -46,7 +46,17 @@
 #else
 # define SECTION_LIGHTSET
 #endif
+#if !defined (LIGHTSET_MAX_SOURCES)
+# define LIGHTSET_MAX_SOURCES 2
+#endif
+
 namespace lightset {
+/**
+ * The number of sources per port that can be merged.
+ * Source index 0 and 1 are the sources A and B.
+ */
+static constexpr uint32_t MAX_SOURCES = LIGHTSET_MAX_SOURCES;
+static_assert((MAX_SOURCES >= 2) && (MAX_SOURCES <= 32), "MAX_SOURCES");
 
 class Data {
 public:
@@ -73,6 +83,22 @@ public:
 		 Get().IMergeSourceB(nPortIndex, pData, nLength, mergeMode);
 	}
 
+	/**
+	 * Merge with the sources in nSourceMask, bit n is source index n.
+	 * With HTP, the output is the highest level of the sources in nSourceMask, including nSourceIndex.
+	 */
+	static void MergeSource(const uint32_t nPortIndex, const uint32_t nSourceIndex, const uint8_t *pData, const uint32_t nLength, const MergeMode mergeMode, const uint32_t nSourceMask) {
+		Get().IMergeSource(nPortIndex, nSourceIndex, pData, nLength, mergeMode, nSourceMask);
+	}
+
+	/**
+	 * Merge with the sources in nSourceMask, for each slot the sources with the highest slot priority are merged HTP.
+	 * ppPriority[n] are the slot priorities of source index n, 4 bytes aligned, dmx::UNIVERSE_SIZE long.
+	 */
+	static void MergeSourcePriority(const uint32_t nPortIndex, const uint32_t nSourceIndex, const uint8_t *pData, const uint32_t nLength, const uint32_t nSourceMask, const uint8_t *const *ppPriority) {
+		Get().IMergeSourcePriority(nPortIndex, nSourceIndex, pData, nLength, nSourceMask, ppPriority);
+	}
+
 	static void Set(LightSet *const pLightSet, uint32_t nPortIndex) {
 		Get().ISet(pLightSet, nPortIndex);
 	}
@@ -93,6 +119,17 @@ public:
 		return Get().IGetLength(nPortIndex);
 	}
 
+	/**
+	 * Per slot merge mode, used when the port is in HTP merge mode.
+	 */
+	static void SetSlotMergeMode(const uint32_t nPortIndex, const uint32_t nSlot, const MergeMode mergeMode) {
+		Get().ISetSlotMergeMode(nPortIndex, nSlot, mergeMode);
+	}
+
+	static void ClearSlotMergeMode(const uint32_t nPortIndex) {
+		Get().IClearSlotMergeMode(nPortIndex);
+	}
+
 	static const uint8_t *Backup(const uint32_t nPortIndex) {
 		return Get().IBackup(nPortIndex);
 	}
@@ -108,40 +145,117 @@ private:
 		assert(nPortIndex < PORTS);
 		assert(pData != nullptr);
 
-		memcpy(m_OutputPort[nPortIndex].sourceA.data, pData, nLength);
+		auto &outputPort = m_OutputPort[nPortIndex];
+		outputPort.nLength = nLength;
+
+		if (mergeMode == MergeMode::HTP) {
+			merge::htp(outputPort.source[0].data, outputPort.data, pData, outputPort.source[1].data, GetLtpMask(outputPort), nLength);
+			return;
+		}
+
+		merge::ltp(outputPort.source[0].data, outputPort.data, pData, nLength);
+	}
+
+	void IMergeSourceB(const uint32_t nPortIndex, const uint8_t *pData, const uint32_t nLength, const MergeMode mergeMode) {
+		assert(nPortIndex < PORTS);
+		assert(pData != nullptr);
 
-		m_OutputPort[nPortIndex].nLength = nLength;
+		auto &outputPort = m_OutputPort[nPortIndex];
+		outputPort.nLength = nLength;
 
 		if (mergeMode == MergeMode::HTP) {
-			for (uint32_t i = 0; i < nLength; i++) {
-				const auto data = std::max(m_OutputPort[nPortIndex].sourceA.data[i], m_OutputPort[nPortIndex].sourceB.data[i]);
-				m_OutputPort[nPortIndex].data[i] = data;
-			}
+			merge::htp(outputPort.source[1].data, outputPort.data, pData, outputPort.source[0].data, GetLtpMask(outputPort), nLength);
+			return;
+		}
 
+		merge::ltp(outputPort.source[1].data, outputPort.data, pData, nLength);
+	}
+
+	void IMergeSource(const uint32_t nPortIndex, const uint32_t nSourceIndex, const uint8_t *pData, const uint32_t nLength, const MergeMode mergeMode, uint32_t nSourceMask) {
+		assert(nPortIndex < PORTS);
+		assert(nSourceIndex < MAX_SOURCES);
+		assert(pData != nullptr);
+
+		auto &outputPort = m_OutputPort[nPortIndex];
+		outputPort.nLength = nLength;
+
+		nSourceMask &= ~(1U << nSourceIndex);
+
+		if ((mergeMode == MergeMode::LTP) || (nSourceMask == 0)) {
+			merge::ltp(outputPort.source[nSourceIndex].data, outputPort.data, pData, nLength);
 			return;
 		}
 
-		memcpy(m_OutputPort[nPortIndex].data, pData, nLength);
+		const auto *pLtpMask = GetLtpMask(outputPort);
+		const auto nOther = static_cast<uint32_t>(__builtin_ctz(nSourceMask));
+		nSourceMask &= (nSourceMask - 1);
+
+		merge::htp(outputPort.source[nSourceIndex].data, outputPort.data, pData, outputPort.source[nOther].data, pLtpMask, nLength);
+
+		while (nSourceMask != 0) {
+			const auto nNext = static_cast<uint32_t>(__builtin_ctz(nSourceMask));
+			nSourceMask &= (nSourceMask - 1);
+			merge::htp_add(outputPort.data, outputPort.source[nNext].data, pLtpMask, nLength);
+		}
 	}
 
-	void IMergeSourceB(const uint32_t nPortIndex, const uint8_t *pData, const uint32_t nLength, const MergeMode mergeMode) {
+	void IMergeSourcePriority(const uint32_t nPortIndex, const uint32_t nSourceIndex, const uint8_t *pData, const uint32_t nLength, uint32_t nSourceMask, const uint8_t *const *ppPriority) {
 		assert(nPortIndex < PORTS);
+		assert(nSourceIndex < MAX_SOURCES);
 		assert(pData != nullptr);
+		assert(ppPriority != nullptr);
 
-		memcpy(m_OutputPort[nPortIndex].sourceB.data, pData, nLength);
+		auto &outputPort = m_OutputPort[nPortIndex];
+		outputPort.nLength = nLength;
 
-		m_OutputPort[nPortIndex].nLength = nLength;
+		merge::ltp(outputPort.source[nSourceIndex].data, outputPort.data, pData, nLength);
 
-		if (mergeMode == MergeMode::HTP) {
-			for (uint32_t i = 0; i < nLength; i++) {
-				const auto data = std::max(m_OutputPort[nPortIndex].sourceA.data[i], m_OutputPort[nPortIndex].sourceB.data[i]);
-				m_OutputPort[nPortIndex].data[i] = data;
-			}
+		const uint8_t *pSourceData[MAX_SOURCES];
+		const uint8_t *pSourcePriority[MAX_SOURCES];
+		uint32_t nSources = 0;
+
+		nSourceMask |= (1U << nSourceIndex);
 
+		while (nSourceMask != 0) {
+			const auto nNext = static_cast<uint32_t>(__builtin_ctz(nSourceMask));
+			nSourceMask &= (nSourceMask - 1);
+			pSourceData[nSources] = outputPort.source[nNext].data;
+			pSourcePriority[nSources] = ppPriority[nNext];
+			nSources++;
+		}
+
+		merge::htp_priority(outputPort.data, pSourceData, pSourcePriority, nSources, nLength);
+	}
+
+	void ISetSlotMergeMode(const uint32_t nPortIndex, const uint32_t nSlot, const MergeMode mergeMode) {
+		assert(nPortIndex < PORTS);
+		assert(nSlot < dmx::UNIVERSE_SIZE);
+
+		auto &outputPort = m_OutputPort[nPortIndex];
+		const auto nBit = 1U << (nSlot & 31);
+
+		if (mergeMode == MergeMode::LTP) {
+			outputPort.ltpMask[nSlot / 32] |= nBit;
+			outputPort.hasLtpSlots = true;
 			return;
 		}
 
-		memcpy(m_OutputPort[nPortIndex].data, pData, nLength);
+		outputPort.ltpMask[nSlot / 32] &= ~nBit;
+		outputPort.hasLtpSlots = false;
+
+		for (const auto nMask : outputPort.ltpMask) {
+			if (nMask != 0) {
+				outputPort.hasLtpSlots = true;
+				return;
+			}
+		}
+	}
+
+	void IClearSlotMergeMode(const uint32_t nPortIndex) {
+		assert(nPortIndex < PORTS);
+
+		memset(m_OutputPort[nPortIndex].ltpMask, 0, sizeof(m_OutputPort[nPortIndex].ltpMask));
+		m_OutputPort[nPortIndex].hasLtpSlots = false;
 	}
 
 	void ISet(LightSet *const pLightSet, const uint32_t nPortIndex) const {
@@ -205,12 +319,17 @@ private:
 	};
 
 	struct OutputPort {
-		Source sourceA;
-		Source sourceB;
+		Source source[MAX_SOURCES];
 		uint8_t data[dmx::UNIVERSE_SIZE] __attribute__ ((aligned (4)));
+		uint32_t ltpMask[dmx::UNIVERSE_SIZE / 32];	///< 1 bit per slot, 1 = LTP when the port is HTP
 		uint32_t nLength;
+		bool hasLtpSlots;
 	};
 
+	static const uint32_t *GetLtpMask(const OutputPort& outputPort) {
+		return outputPort.hasLtpSlots ? outputPort.ltpMask : nullptr;
+	}
+
 	OutputPort m_OutputPort[PORTS];
 };
 
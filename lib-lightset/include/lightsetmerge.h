@@ -0,0 +1,228 @@
+/**
+ * @file lightsetmerge.h
+ *
+ */
+/* Copyright (C) 2024 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef LIGHTSETMERGE_H_
+#define LIGHTSETMERGE_H_
+
+#include <cstdint>
+#include <cassert>
+
+namespace lightset::merge {
+/**
+ * Unsigned maximum of 4 packed bytes
+ */
+inline uint32_t max_u8x4(const uint32_t a, const uint32_t b) {
+#if defined (__ARM_FEATURE_SIMD32)
+	/*
+	 * USUB8 sets the GE flags for each byte a >= b, SEL picks the byte from a when GE is set.
+	 * Both in one asm statement, as the compiler does not know about the GE flags.
+	 */
+	uint32_t r;
+	asm ("usub8 %0, %1, %2\n\tsel %0, %1, %2" : "=&r" (r) : "r" (a), "r" (b) : "cc");
+	return r;
+#else
+	constexpr uint32_t H = 0x80808080U;
+	// bit 7 of each byte: (a & 0x7F) >= (b & 0x7F), there is no borrow between the bytes
+	const auto lo = ((a | H) - (b & ~H)) & H;
+	// bit 7 of each byte: a >= b
+	const auto ge = (a & ~b & H) | (~(a ^ b) & lo & H);
+	const auto mask = (ge >> 7) * 0xFFU;
+	return (a & mask) | (b & ~mask);
+#endif
+}
+
+/**
+ * 0xFF for each byte where a == b, 0x00 otherwise
+ */
+inline uint32_t eq_u8x4(const uint32_t a, const uint32_t b) {
+	constexpr uint32_t L = 0x7F7F7F7FU;
+	const auto x = a ^ b;
+	// bit 7 of each byte: the byte of x is zero, there is no carry between the bytes
+	const auto zero = ~(((x & L) + L) | x | L);
+	return (zero >> 7) * 0xFFU;
+}
+
+/**
+ * 0xFF for each byte where a > b, 0x00 otherwise
+ */
+inline uint32_t gt_u8x4(const uint32_t a, const uint32_t b) {
+	return ~eq_u8x4(max_u8x4(a, b), b);
+}
+
+/**
+ * Expand 4 bits into 4 byte masks (little endian)
+ */
+inline constexpr uint32_t expand_nibble(const uint32_t nNibble) {
+	return ((nNibble & 1U) ? 0x000000FFU : 0U)
+		 | ((nNibble & 2U) ? 0x0000FF00U : 0U)
+		 | ((nNibble & 4U) ? 0x00FF0000U : 0U)
+		 | ((nNibble & 8U) ? 0xFF000000U : 0U);
+}
+
+inline uint32_t load_u32(const uint8_t *p) {
+	uint32_t n;
+	__builtin_memcpy(&n, p, sizeof(uint32_t));	// pIn is not always 4 bytes aligned
+	return n;
+}
+
+/**
+ * One pass copy and HTP merge.
+ * pSource[i] = pIn[i]
+ * pOutput[i] = max(pIn[i], pOther[i]), or pIn[i] when the slot bit in pLtpMask is set
+ *
+ * @param pSource	data of the source sending pIn, 4 bytes aligned
+ * @param pOutput	merged output, 4 bytes aligned
+ * @param pIn		received data
+ * @param pOther	data of the other source, 4 bytes aligned
+ * @param pLtpMask	1 bit per slot, 1 = LTP. Can be nullptr.
+ */
+inline void htp(uint8_t *pSource, uint8_t *pOutput, const uint8_t *pIn, const uint8_t *pOther, const uint32_t *pLtpMask, const uint32_t nLength) {
+	assert((reinterpret_cast<uintptr_t>(pSource) & 0x3) == 0);
+	assert((reinterpret_cast<uintptr_t>(pOutput) & 0x3) == 0);
+	assert((reinterpret_cast<uintptr_t>(pOther) & 0x3) == 0);
+
+	auto *pSource32 = reinterpret_cast<uint32_t *>(pSource);
+	auto *pOutput32 = reinterpret_cast<uint32_t *>(pOutput);
+	const auto *pOther32 = reinterpret_cast<const uint32_t *>(pOther);
+	const auto nWords = nLength / 4;
+
+	if (pLtpMask == nullptr) {
+		for (uint32_t i = 0; i < nWords; i++) {
+			const auto in = load_u32(&pIn[i * 4]);
+			pSource32[i] = in;
+			pOutput32[i] = max_u8x4(in, pOther32[i]);
+		}
+	} else {
+		for (uint32_t i = 0; i < nWords; i++) {
+			const auto in = load_u32(&pIn[i * 4]);
+			const auto ltp = expand_nibble((pLtpMask[i / 8] >> ((i & 7U) * 4)) & 0xFU);
+			pSource32[i] = in;
+			pOutput32[i] = (max_u8x4(in, pOther32[i]) & ~ltp) | (in & ltp);
+		}
+	}
+
+	for (auto i = nWords * 4; i < nLength; i++) {
+		const auto in = pIn[i];
+		const auto isLtp = (pLtpMask != nullptr) && ((pLtpMask[i / 32] & (1U << (i & 31))) != 0);
+		pSource[i] = in;
+		pOutput[i] = (isLtp || (in > pOther[i])) ? in : pOther[i];
+	}
+}
+
+/**
+ * HTP merge of an additional source into an already merged output.
+ * pOutput[i] = max(pOutput[i], pOther[i]), unchanged when the slot bit in pLtpMask is set
+ *
+ * @param pOutput	merged output, 4 bytes aligned
+ * @param pOther	data of the additional source, 4 bytes aligned
+ * @param pLtpMask	1 bit per slot, 1 = LTP. Can be nullptr.
+ */
+inline void htp_add(uint8_t *pOutput, const uint8_t *pOther, const uint32_t *pLtpMask, const uint32_t nLength) {
+	assert((reinterpret_cast<uintptr_t>(pOutput) & 0x3) == 0);
+	assert((reinterpret_cast<uintptr_t>(pOther) & 0x3) == 0);
+
+	auto *pOutput32 = reinterpret_cast<uint32_t *>(pOutput);
+	const auto *pOther32 = reinterpret_cast<const uint32_t *>(pOther);
+	const auto nWords = nLength / 4;
+
+	if (pLtpMask == nullptr) {
+		for (uint32_t i = 0; i < nWords; i++) {
+			pOutput32[i] = max_u8x4(pOutput32[i], pOther32[i]);
+		}
+	} else {
+		for (uint32_t i = 0; i < nWords; i++) {
+			const auto ltp = expand_nibble((pLtpMask[i / 8] >> ((i & 7U) * 4)) & 0xFU);
+			pOutput32[i] = (max_u8x4(pOutput32[i], pOther32[i]) & ~ltp) | (pOutput32[i] & ltp);
+		}
+	}
+
+	for (auto i = nWords * 4; i < nLength; i++) {
+		const auto isLtp = (pLtpMask != nullptr) && ((pLtpMask[i / 32] & (1U << (i & 31))) != 0);
+		if (!isLtp && (pOther[i] > pOutput[i])) {
+			pOutput[i] = pOther[i];
+		}
+	}
+}
+
+/**
+ * Per slot priority selection, HTP among the sources with the highest priority for a slot.
+ * A slot priority of 0 means that the source does not send that slot, when no source sends the slot the output is 0.
+ *
+ * @param pOutput		merged output, 4 bytes aligned
+ * @param ppData		data of each source, 4 bytes aligned
+ * @param ppPriority	slot priorities of each source, 4 bytes aligned
+ * @param nSources		number of entries in ppData and ppPriority
+ */
+inline void htp_priority(uint8_t *pOutput, const uint8_t *const *ppData, const uint8_t *const *ppPriority, const uint32_t nSources, const uint32_t nLength) {
+	assert((reinterpret_cast<uintptr_t>(pOutput) & 0x3) == 0);
+
+	auto *pOutput32 = reinterpret_cast<uint32_t *>(pOutput);
+	const auto nWords = (nLength + 3) / 4;
+
+	for (uint32_t i = 0; i < nWords; i++) {
+		uint32_t nOutput = 0;
+		uint32_t nPriority = 0;	// The highest priority for each slot so far
+
+		for (uint32_t nSource = 0; nSource < nSources; nSource++) {
+			const auto data = reinterpret_cast<const uint32_t *>(ppData[nSource])[i];
+			const auto priority = reinterpret_cast<const uint32_t *>(ppPriority[nSource])[i];
+
+			const auto higher = gt_u8x4(priority, nPriority);
+			const auto equal = eq_u8x4(priority, nPriority) & ~eq_u8x4(priority, 0);
+
+			nOutput = (data & higher) | (max_u8x4(nOutput, data) & equal) | (nOutput & ~(higher | equal));
+			nPriority = max_u8x4(nPriority, priority);
+		}
+
+		pOutput32[i] = nOutput;
+	}
+}
+
+/**
+ * One pass copy for LTP.
+ * pSource[i] = pOutput[i] = pIn[i]
+ */
+inline void ltp(uint8_t *pSource, uint8_t *pOutput, const uint8_t *pIn, const uint32_t nLength) {
+	assert((reinterpret_cast<uintptr_t>(pSource) & 0x3) == 0);
+	assert((reinterpret_cast<uintptr_t>(pOutput) & 0x3) == 0);
+
+	auto *pSource32 = reinterpret_cast<uint32_t *>(pSource);
+	auto *pOutput32 = reinterpret_cast<uint32_t *>(pOutput);
+	const auto nWords = nLength / 4;
+
+	for (uint32_t i = 0; i < nWords; i++) {
+		const auto in = load_u32(&pIn[i * 4]);
+		pSource32[i] = in;
+		pOutput32[i] = in;
+	}
+
+	for (auto i = nWords * 4; i < nLength; i++) {
+		pSource[i] = pIn[i];
+		pOutput[i] = pIn[i];
+	}
+}
+}  // namespace lightset::merge
+
+#endif /* LIGHTSETMERGE_H_ */
@@ -40,9 +40,11 @@ struct LightSetParamsConst {
 
 	static const char UNIVERSE_PORT[lightsetparams::MAX_PORTS][16];
 	static const char MERGE_MODE_PORT[lightsetparams::MAX_PORTS][18];
+	static const char LTP_SLOTS_PORT[lightsetparams::MAX_PORTS][17];
 	static const char DIRECTION[lightsetparams::MAX_PORTS][18];
 	static const char OUTPUT_STYLE[lightsetparams::MAX_PORTS][16];
 	static const char PRIORITY[lightsetparams::MAX_PORTS][16];
+	static const char PRIORITY_THRESHOLD[lightsetparams::MAX_PORTS][26];
 
 	static const char DMX_START_ADDRESS[];
 	static const char DMX_SLOT_INFO[];
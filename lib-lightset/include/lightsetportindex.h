@@ -0,0 +1,118 @@
+/**
+ * @file lightsetportindex.h
+ *
+ */
+/* Copyright (C) 2024 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef LIGHTSETPORTINDEX_H_
+#define LIGHTSETPORTINDEX_H_
+
+#include <cstdint>
+#include <cassert>
+
+namespace lightset {
+/**
+ * Returns the lowest port index in nPortMask and clears it.
+ * Usage: while (nPortMask != 0) { const auto nPortIndex = next_port(nPortMask); ... }
+ */
+inline uint32_t next_port(uint32_t& nPortMask) {
+	assert(nPortMask != 0);
+	const auto nPortIndex = static_cast<uint32_t>(__builtin_ctz(nPortMask));
+	nPortMask &= (nPortMask - 1);
+	return nPortIndex;
+}
+
+/**
+ * Universe (Port-Address) -> port bitmask.
+ * Open addressing with linear probing, the table is at most half full.
+ * A slot with nPortMask == 0 is empty.
+ * The index is rebuilt (Clear + Add) when the port configuration changes.
+ */
+template<uint32_t MAX_PORTS>
+class PortIndex {
+	static_assert(MAX_PORTS <= 32, "nPortMask is 32 bits");
+
+	static constexpr uint32_t table_size(const uint32_t n) {
+		return (n < (2 * MAX_PORTS)) ? table_size(2 * n) : n;
+	}
+
+	static constexpr uint32_t SIZE = table_size(2);
+	static constexpr uint32_t MASK = SIZE - 1;
+
+	struct Entry {
+		uint32_t nPortMask;
+		uint16_t nUniverse;
+	};
+
+	static uint32_t Hash(const uint16_t nUniverse) {
+		return (static_cast<uint32_t>(nUniverse) * 2654435761U) >> 16;
+	}
+
+public:
+	void Clear() {
+		for (auto& entry : m_Table) {
+			entry.nPortMask = 0;
+		}
+	}
+
+	void Add(const uint16_t nUniverse, const uint32_t nPortIndex) {
+		assert(nPortIndex < MAX_PORTS);
+
+		for (auto i = Hash(nUniverse);; i++) {
+			auto& entry = m_Table[i & MASK];
+
+			if (entry.nPortMask == 0) {
+				entry.nUniverse = nUniverse;
+				entry.nPortMask = 1U << nPortIndex;
+				return;
+			}
+
+			if (entry.nUniverse == nUniverse) {
+				entry.nPortMask |= 1U << nPortIndex;
+				return;
+			}
+		}
+	}
+
+	/**
+	 * @return bit n is set when port n is mapped to nUniverse, 0 when there is no port
+	 */
+	uint32_t Get(const uint16_t nUniverse) const {
+		for (auto i = Hash(nUniverse);; i++) {
+			const auto& entry = m_Table[i & MASK];
+
+			if (entry.nPortMask == 0) {
+				return 0;
+			}
+
+			if (entry.nUniverse == nUniverse) {
+				return entry.nPortMask;
+			}
+		}
+	}
+
+private:
+	Entry m_Table[SIZE];
+};
+}  // namespace lightset
+
+#endif /* LIGHTSETPORTINDEX_H_ */
@@ -41,6 +41,13 @@ const char LightSetParamsConst::MERGE_MODE_PORT[lightsetparams::MAX_PORTS][18] =
 		"merge_mode_port_d"
 };
 
+const char LightSetParamsConst::LTP_SLOTS_PORT[lightsetparams::MAX_PORTS][17] = {
+		"ltp_slots_port_a",
+		"ltp_slots_port_b",
+		"ltp_slots_port_c",
+		"ltp_slots_port_d"
+};
+
 const char LightSetParamsConst::DIRECTION[lightsetparams::MAX_PORTS][18] = {
 		"direction_port_a",
 		"direction_port_b",
@@ -62,6 +69,13 @@ const char LightSetParamsConst::PRIORITY[lightsetparams::MAX_PORTS][16] = {
 		"priority_port_d"
 };
 
+const char LightSetParamsConst::PRIORITY_THRESHOLD[lightsetparams::MAX_PORTS][26] = {
+		"priority_threshold_port_a",
+		"priority_threshold_port_b",
+		"priority_threshold_port_c",
+		"priority_threshold_port_d"
+};
+
 const char LightSetParamsConst::NODE_LABEL[lightsetparams::MAX_PORTS][14] = {
 		"label_port_a",
 		"label_port_b",
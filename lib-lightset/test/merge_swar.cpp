@@ -0,0 +1,360 @@
+/**
+ * @file merge_swar.cpp
+ *
+ * Host test: the word-wide merge kernels (lightsetmerge.h) against a scalar reference,
+ * the LTP slot mask, and the cycles per universe.
+ */
+/* Copyright (C) 2024 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <algorithm>
+#if defined (GD32)
+# include "gd32.h"
+#elif defined (__x86_64__) || defined (__i386__)
+# include <x86intrin.h>
+#else
+# include <chrono>
+#endif
+
+#include "lightsetmerge.h"
+#include "lightsetdata.h"
+
+namespace merge = lightset::merge;
+
+static constexpr uint32_t SIZE = lightset::dmx::UNIVERSE_SIZE;
+
+static std::mt19937 s_Random(12345);
+static int s_nFailed;
+
+static void check(const bool isOk, const char *pName, const uint32_t nLength, const uint32_t nIndex) {
+	if (!isOk) {
+		if (s_nFailed < 10) {
+			printf("FAIL %s: length %u, index %u\n", pName, static_cast<unsigned>(nLength), static_cast<unsigned>(nIndex));
+		}
+		s_nFailed++;
+	}
+}
+
+/**
+ * Random levels, with many equal values and the extremes
+ */
+static void fill(uint8_t *pData, const uint32_t nLength) {
+	for (uint32_t i = 0; i < nLength; i++) {
+		switch (s_Random() % 4) {
+		case 0:
+			pData[i] = 0;
+			break;
+		case 1:
+			pData[i] = 0xFF;
+			break;
+		case 2:
+			pData[i] = static_cast<uint8_t>(0x7F + (s_Random() % 3));
+			break;
+		default:
+			pData[i] = static_cast<uint8_t>(s_Random());
+			break;
+		}
+	}
+}
+
+static uint32_t lane(const uint32_t nWord, const uint32_t nLane) {
+	return (nWord >> (nLane * 8)) & 0xFF;
+}
+
+/**
+ * All byte pairs in each lane, the other lanes random
+ */
+static void test_u8x4() {
+	for (uint32_t a = 0; a < 256; a++) {
+		for (uint32_t b = 0; b < 256; b++) {
+			for (uint32_t nLane = 0; nLane < 4; nLane++) {
+				const auto nShift = nLane * 8;
+				const auto nMask = ~(0xFFU << nShift);
+				const auto x = (static_cast<uint32_t>(s_Random()) & nMask) | (a << nShift);
+				const auto y = (static_cast<uint32_t>(s_Random()) & nMask) | (b << nShift);
+
+				check(lane(merge::max_u8x4(x, y), nLane) == std::max(a, b), "max_u8x4", a, b);
+				check(lane(merge::eq_u8x4(x, y), nLane) == ((a == b) ? 0xFFU : 0U), "eq_u8x4", a, b);
+				check(lane(merge::gt_u8x4(x, y), nLane) == ((a > b) ? 0xFFU : 0U), "gt_u8x4", a, b);
+			}
+		}
+	}
+
+	puts("u8x4: done");
+}
+
+static bool is_ltp(const uint32_t *pLtpMask, const uint32_t nSlot) {
+	return (pLtpMask != nullptr) && ((pLtpMask[nSlot / 32] & (1U << (nSlot & 31))) != 0);
+}
+
+/**
+ * Each length, pIn at each alignment, without and with a random LTP mask
+ */
+static void test_kernels() {
+	alignas(4) uint8_t source[SIZE];
+	alignas(4) uint8_t output[SIZE];
+	alignas(4) uint8_t other[SIZE];
+	alignas(4) uint8_t in[SIZE + 4];
+	uint32_t ltpMask[SIZE / 32];
+
+	for (uint32_t nLength = 0; nLength <= SIZE; nLength++) {
+		for (uint32_t nOffset = 0; nOffset < 8; nOffset++) {
+			const auto *pIn = &in[nOffset & 3];
+			const auto *pLtpMask = (nOffset < 4) ? nullptr : ltpMask;
+			fill(in, sizeof(in));
+			fill(other, SIZE);
+			fill(source, SIZE);
+			fill(output, SIZE);
+
+			for (auto& nMask : ltpMask) {
+				nMask = static_cast<uint32_t>(s_Random());
+			}
+
+			merge::htp(source, output, pIn, other, pLtpMask, nLength);
+
+			for (uint32_t i = 0; i < nLength; i++) {
+				check(source[i] == pIn[i], "htp source", nLength, i);
+				check(output[i] == (is_ltp(pLtpMask, i) ? pIn[i] : std::max(pIn[i], other[i])), "htp output", nLength, i);
+			}
+
+			uint8_t expected[SIZE];
+
+			for (uint32_t i = 0; i < nLength; i++) {
+				expected[i] = is_ltp(pLtpMask, i) ? output[i] : std::max(output[i], other[i]);
+			}
+
+			merge::htp_add(output, other, pLtpMask, nLength);
+
+			check(memcmp(output, expected, nLength) == 0, "htp_add", nLength, nOffset);
+
+			merge::ltp(source, output, pIn, nLength);
+
+			check((memcmp(source, pIn, nLength) == 0) && (memcmp(output, pIn, nLength) == 0), "ltp", nLength, nOffset);
+		}
+	}
+
+	puts("kernels: done");
+}
+
+static void test_htp_priority() {
+	static constexpr uint32_t SOURCES = 4;
+	alignas(4) uint8_t data[SOURCES][SIZE];
+	alignas(4) uint8_t priority[SOURCES][SIZE];
+	alignas(4) uint8_t output[SIZE];
+
+	const uint8_t *ppData[SOURCES];
+	const uint8_t *ppPriority[SOURCES];
+
+	for (uint32_t nRun = 0; nRun < 200; nRun++) {
+		for (uint32_t nSource = 0; nSource < SOURCES; nSource++) {
+			fill(data[nSource], SIZE);
+
+			for (uint32_t i = 0; i < SIZE; i++) {
+				// 0 is not sourced, a few distinct priorities to have equal ones
+				priority[nSource][i] = static_cast<uint8_t>((s_Random() % 4) * 50);
+			}
+
+			ppData[nSource] = data[nSource];
+			ppPriority[nSource] = priority[nSource];
+		}
+
+		const auto nSources = 1 + (nRun % SOURCES);
+		const auto nLength = 1 + static_cast<uint32_t>(s_Random() % SIZE);
+
+		merge::htp_priority(output, ppData, ppPriority, nSources, nLength);
+
+		for (uint32_t i = 0; i < nLength; i++) {
+			uint8_t nHighest = 0;
+			uint8_t nExpected = 0;
+
+			for (uint32_t nSource = 0; nSource < nSources; nSource++) {
+				const auto nPriority = priority[nSource][i];
+
+				if (nPriority == 0) {
+					continue;
+				}
+
+				if (nPriority > nHighest) {
+					nHighest = nPriority;
+					nExpected = data[nSource][i];
+				} else if (nPriority == nHighest) {
+					nExpected = std::max(nExpected, data[nSource][i]);
+				}
+			}
+
+			check(output[i] == nExpected, "htp_priority", nLength, i);
+		}
+	}
+
+	puts("htp_priority: done");
+}
+
+/**
+ * lightset::Data with 4 sources, HTP, and HTP with LTP slots
+ */
+static void test_data() {
+	static constexpr uint32_t SOURCES = lightset::MAX_SOURCES;
+	uint8_t data[SOURCES][SIZE];
+	uint32_t ltpMask[SIZE / 32] = {};
+
+	for (uint32_t nSource = 0; nSource < SOURCES; nSource++) {
+		fill(data[nSource], SIZE);
+		lightset::Data::MergeSource(0, nSource, data[nSource], SIZE, lightset::MergeMode::LTP, 0);
+	}
+
+	for (uint32_t nRun = 0; nRun < 3000; nRun++) {
+		if (nRun == 1000) {
+			for (uint32_t nSlot = 16; nSlot < 48; nSlot++) {
+				lightset::Data::SetSlotMergeMode(0, nSlot, lightset::MergeMode::LTP);
+				ltpMask[nSlot / 32] |= (1U << (nSlot & 31));
+			}
+			lightset::Data::SetSlotMergeMode(0, 511, lightset::MergeMode::LTP);
+			ltpMask[511 / 32] |= (1U << (511 & 31));
+		} else if (nRun == 2000) {
+			// Back to HTP slot by slot, then the mask is not used anymore
+			for (uint32_t nSlot = 0; nSlot < SIZE; nSlot++) {
+				lightset::Data::SetSlotMergeMode(0, nSlot, lightset::MergeMode::HTP);
+			}
+			memset(ltpMask, 0, sizeof(ltpMask));
+		}
+
+		const auto nSourceIndex = static_cast<uint32_t>(s_Random() % SOURCES);
+		const auto nSourceMask = static_cast<uint32_t>(s_Random() % (1U << SOURCES)) | (1U << nSourceIndex);
+
+		fill(data[nSourceIndex], SIZE);
+		lightset::Data::MergeSource(0, nSourceIndex, data[nSourceIndex], SIZE, lightset::MergeMode::HTP, nSourceMask);
+
+		const auto *pOutput = lightset::Data::Backup(0);
+
+		for (uint32_t i = 0; i < SIZE; i++) {
+			uint8_t nExpected = 0;
+
+			if (is_ltp(ltpMask, i)) {
+				nExpected = data[nSourceIndex][i];
+			} else {
+				for (uint32_t nSource = 0; nSource < SOURCES; nSource++) {
+					if ((nSourceMask & (1U << nSource)) != 0) {
+						nExpected = std::max(nExpected, data[nSource][i]);
+					}
+				}
+			}
+
+			check(pOutput[i] == nExpected, "Data::MergeSource", nRun, i);
+		}
+	}
+
+	lightset::Data::ClearSlotMergeMode(0);
+
+	puts("Data::MergeSource: done");
+}
+
+/**
+ * The byte loop that was replaced
+ */
+__attribute__ ((noinline)) static void htp_scalar(uint8_t *pSource, uint8_t *pOutput, const uint8_t *pIn, const uint8_t *pOther, const uint32_t nLength) {
+	memcpy(pSource, pIn, nLength);
+
+	for (uint32_t i = 0; i < nLength; i++) {
+		pOutput[i] = std::max(pSource[i], pOther[i]);
+	}
+}
+
+__attribute__ ((noinline)) static void htp_word(uint8_t *pSource, uint8_t *pOutput, const uint8_t *pIn, const uint8_t *pOther, const uint32_t nLength) {
+	merge::htp(pSource, pOutput, pIn, pOther, nullptr, nLength);
+}
+
+static uint32_t s_LtpMask[SIZE / 32] = { 0x0000FFFF };
+
+__attribute__ ((noinline)) static void htp_word_ltp(uint8_t *pSource, uint8_t *pOutput, const uint8_t *pIn, const uint8_t *pOther, const uint32_t nLength) {
+	merge::htp(pSource, pOutput, pIn, pOther, s_LtpMask, nLength);
+}
+
+/**
+ * On the target DWT->CYCCNT (enabled by udelay_init), on a x86 host the TSC.
+ */
+#if defined (GD32)
+static constexpr char CYCLES[] = "cycles";
+
+static uint64_t cycles() {
+	return DWT->CYCCNT;
+}
+#elif defined (__x86_64__) || defined (__i386__)
+static constexpr char CYCLES[] = "TSC cycles";
+
+static uint64_t cycles() {
+	return __rdtsc();
+}
+#else
+static constexpr char CYCLES[] = "ns";
+
+static uint64_t cycles() {
+	return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+#endif
+
+/**
+ * The minimum of the runs, so an interrupt or a context switch does not count
+ */
+template<typename F>
+static uint32_t measure(F function) {
+	static constexpr uint32_t RUNS = 20000;
+	alignas(4) static uint8_t source[SIZE];
+	alignas(4) static uint8_t output[SIZE];
+	alignas(4) static uint8_t other[SIZE];
+	alignas(4) static uint8_t in[SIZE];
+
+	fill(other, SIZE);
+	fill(in, SIZE);
+
+	auto nMin = UINT64_MAX;
+
+	for (uint32_t i = 0; i < RUNS; i++) {
+		in[i & 0x1FF] = static_cast<uint8_t>(i);
+		const auto nStart = cycles();
+		function(source, output, in, other, SIZE);
+		asm volatile("" : : "r" (output) : "memory");
+		nMin = std::min(nMin, cycles() - nStart);
+	}
+
+	return static_cast<uint32_t>(nMin);
+}
+
+int main() {
+	test_u8x4();
+	test_kernels();
+	test_htp_priority();
+	test_data();
+
+	printf("htp 512 slots: scalar %u, word %u, word with LTP slots %u %s (the compiler may vectorize the scalar loop on a host)\n",
+			static_cast<unsigned>(measure(htp_scalar)), static_cast<unsigned>(measure(htp_word)), static_cast<unsigned>(measure(htp_word_ltp)), CYCLES);
+
+	if (s_nFailed != 0) {
+		printf("%d failed\n", s_nFailed);
+		return 1;
+	}
+
+	puts("ok");
+	return 0;
+}
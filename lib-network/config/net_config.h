@@ -28,9 +28,18 @@
 
 #if defined(__linux__) || defined (__APPLE__)
 # define UDP_MAX_PORTS_ALLOWED			16
+# define UDP_RX_QUEUE_ENTRIES			8
+# define UDP_TX_TEMPLATES				16
 # define IGMP_MAX_JOINS_ALLOWED			(4 + (8 * 4)) /* 8 outputs x 4 Universes */
 # define TCP_MAX_TCBS_ALLOWED			16
 # define TCP_MAX_PORTS_ALLOWED			2
+# define TCP_RX_QUEUE_ENTRIES			8
+# define TCP_TX_QUEUE_SIZE				8192
+# define ARP_MAX_RECORDS				128
+# define ARP_MAX_PENDING				4
+# define ARP_PENDING_BUFFERS			16
+# define NET_RX_MAX_FRAMES				16
+# define NET_RX_BUDGET_US				1000
 #else
 # define TCP_MAX_PORTS_ALLOWED			1
 # if defined (H3)
@@ -38,8 +47,17 @@
 #   define HOST_NAME_PREFIX				"allwinner_"
 #  endif
 #  define UDP_MAX_PORTS_ALLOWED			16
+#  define UDP_RX_QUEUE_ENTRIES			4
+#  define UDP_TX_TEMPLATES				16
 #  define IGMP_MAX_JOINS_ALLOWED		(4 + (8 * 4)) /* 8 outputs x 4 Universes */
 #  define TCP_MAX_TCBS_ALLOWED			16
+#  define TCP_RX_QUEUE_ENTRIES			8
+#  define TCP_TX_QUEUE_SIZE				8192
+#  define ARP_MAX_RECORDS				128
+#  define ARP_MAX_PENDING				4
+#  define ARP_PENDING_BUFFERS			16
+#  define NET_RX_MAX_FRAMES				16
+#  define NET_RX_BUDGET_US				500
 # elif defined (GD32)
 /*
  * Supports checking IPv4 header checksum and TCP, UDP, or ICMP checksum encapsulated in IPv4 or IPv6 datagram.
@@ -51,12 +69,77 @@
 #  if !defined (UDP_MAX_PORTS_ALLOWED)
 #   define UDP_MAX_PORTS_ALLOWED		8
 #  endif
+/*
+ * The UDP receive queues are in TCMSRAM (.network)
+ * Each entry is sizeof(struct data_entry) ~ 1484 bytes, UDP_MAX_PORTS_ALLOWED x UDP_RX_QUEUE_ENTRIES entries
+ * With CONFIG_NET_ENABLE_ZERO_COPY_RX an entry refers to a lent Rx DMA descriptor (~16 bytes)
+ * Without, the frames for a full queue wait in the Rx descriptor ring (ENET_RXBUF_NUM)
+ */
+#  if !defined (UDP_RX_QUEUE_ENTRIES)
+#   if defined (CONFIG_NET_ENABLE_ZERO_COPY_RX)
+#    define UDP_RX_QUEUE_ENTRIES		8
+#   else
+#    define UDP_RX_QUEUE_ENTRIES		1
+#   endif
+#  endif
+/*
+ * With CONFIG_NET_ENABLE_ZERO_COPY_RX a port holds up to UDP_RX_LEND_MAX lent Rx descriptors,
+ * the other entries are copied in one of the UDP_RX_COPY_BUFFERS shared buffers (~1.5K each, TCMSRAM)
+ */
+#  if !defined (UDP_RX_LEND_MAX)
+#   define UDP_RX_LEND_MAX				2
+#  endif
+#  if !defined (UDP_RX_COPY_BUFFERS)
+#   define UDP_RX_COPY_BUFFERS			4
+#  endif
+/*
+ * The UDP transmit header templates are in TCMSRAM (.network), each template is ~56 bytes
+ */
+#  if !defined (UDP_TX_TEMPLATES)
+#   define UDP_TX_TEMPLATES				8
+#  endif
 #  if !defined (IGMP_MAX_JOINS_ALLOWED)
 #   define IGMP_MAX_JOINS_ALLOWED		(4 + (8 * 4)) /* 8 outputs x 4 Universes */
 #  endif
 #  if !defined (TCP_MAX_TCBS_ALLOWED)
 #   define TCP_MAX_TCBS_ALLOWED			6
 #  endif
+/*
+ * The TCP receive queue (per port) is in TCMSRAM (.network), each entry is ~1424 bytes
+ * The TCP send queue is per TCB, in SRAM: TCP_MAX_TCBS_ALLOWED x TCP_TX_QUEUE_SIZE bytes
+ */
+#  if !defined (TCP_RX_QUEUE_ENTRIES)
+#   define TCP_RX_QUEUE_ENTRIES			4
+#  endif
+#  if !defined (TCP_TX_QUEUE_SIZE)
+#   define TCP_TX_QUEUE_SIZE			2048
+#  endif
+/*
+ * The ARP cache is in TCMSRAM (.network), a hash table filled up to 3/4, each record is ~24 bytes
+ * Each record holds up to ARP_MAX_PENDING packets while the address is resolved,
+ * the packets are in a pool of ARP_PENDING_BUFFERS frames (~1.5K each, SRAM)
+ */
+#  if !defined (ARP_MAX_RECORDS)
+#   define ARP_MAX_RECORDS				64
+#  endif
+#  if !defined (ARP_MAX_PENDING)
+#   define ARP_MAX_PENDING				2
+#  endif
+#  if !defined (ARP_PENDING_BUFFERS)
+#   define ARP_PENDING_BUFFERS			4
+#  endif
+/*
+ * net_handle drains the Rx descriptor ring (ENET_RXBUF_NUM) up to NET_RX_MAX_FRAMES frames,
+ * it returns to the main loop when NET_RX_BUDGET_US has elapsed.
+ * The first frame is always handled.
+ * A UDP frame for a port with a full queue (UDP_RX_QUEUE_ENTRIES) stays in the descriptor ring.
+ */
+#  if !defined (NET_RX_MAX_FRAMES)
+#   define NET_RX_MAX_FRAMES			8
+#  endif
+#  if !defined (NET_RX_BUDGET_US)
+#   define NET_RX_BUDGET_US				250
+#  endif
 # else
 #  error
 # endif
@@ -66,6 +149,31 @@
 # error
 #endif
 
+#if !defined (UDP_RX_QUEUE_ENTRIES)
+# error
+#endif
+
+#if (UDP_RX_QUEUE_ENTRIES < 1)
+# error UDP_RX_QUEUE_ENTRIES
+#endif
+
+#if defined (CONFIG_NET_ENABLE_ZERO_COPY_RX)
+# if !defined (UDP_RX_LEND_MAX) || !defined (UDP_RX_COPY_BUFFERS)
+#  error
+# endif
+# if (UDP_RX_COPY_BUFFERS < 1) || (UDP_RX_COPY_BUFFERS > 32)
+#  error UDP_RX_COPY_BUFFERS
+# endif
+#endif
+
+#if !defined (UDP_TX_TEMPLATES)
+# error
+#endif
+
+#if (UDP_TX_TEMPLATES < 1)
+# error UDP_TX_TEMPLATES
+#endif
+
 #if !defined (IGMP_MAX_JOINS_ALLOWED)
 # error
 #endif
@@ -78,4 +186,56 @@
 # error
 #endif
 
+#if !defined (TCP_RX_QUEUE_ENTRIES)
+# error
+#endif
+
+#if (TCP_RX_QUEUE_ENTRIES < 2) || ((TCP_RX_QUEUE_ENTRIES & (TCP_RX_QUEUE_ENTRIES - 1)) != 0)
+# error TCP_RX_QUEUE_ENTRIES must be a power of 2
+#endif
+
+#if !defined (TCP_TX_QUEUE_SIZE)
+# error
+#endif
+
+#if ((TCP_TX_QUEUE_SIZE & (TCP_TX_QUEUE_SIZE - 1)) != 0)
+# error TCP_TX_QUEUE_SIZE must be a power of 2
+#endif
+
+#if !defined (ARP_MAX_RECORDS)
+# error
+#endif
+
+#if (ARP_MAX_RECORDS < 4) || ((ARP_MAX_RECORDS & (ARP_MAX_RECORDS - 1)) != 0)
+# error ARP_MAX_RECORDS must be a power of 2
+#endif
+
+#if !defined (ARP_MAX_PENDING)
+# error
+#endif
+
+#if (ARP_MAX_PENDING < 1) || (ARP_MAX_PENDING > 255)
+# error ARP_MAX_PENDING
+#endif
+
+#if !defined (ARP_PENDING_BUFFERS)
+# error
+#endif
+
+#if (ARP_PENDING_BUFFERS < 1) || (ARP_PENDING_BUFFERS > 32)
+# error ARP_PENDING_BUFFERS
+#endif
+
+#if !defined (NET_RX_MAX_FRAMES)
+# error
+#endif
+
+#if (NET_RX_MAX_FRAMES < 1)
+# error NET_RX_MAX_FRAMES
+#endif
+
+#if !defined (NET_RX_BUDGET_US)
+# error
+#endif
+
 #endif /* NET_CONFIG_H_ */
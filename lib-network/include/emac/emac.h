@@ -28,6 +28,8 @@
 
 #include <cstdint>
 
+#include "net.h"
+
 /** \defgroup platform Platform implementation
   @{
 */
@@ -51,6 +53,12 @@ void emac_config();
  *
  */
 void emac_start(uint8_t macAddress[], net::Link& link);
+
+/**
+ * The missed frame and overflow counters of the DMA are accumulated
+ * @param[out] statistics
+ */
+void emac_get_statistics(net::emac::Statistics& statistics);
 /** @} */
 
 #endif /* EMAC_EMAC_H_ */
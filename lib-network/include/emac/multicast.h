@@ -0,0 +1,78 @@
+/**
+ * @file multicast.h
+ *
+ */
+/* Copyright (C) 2024 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef EMAC_MULTICAST_H_
+#define EMAC_MULTICAST_H_
+
+#include <cstdint>
+
+#include "net/protocol/ethernet.h"
+
+namespace emac::multicast {
+static constexpr uint32_t HASH_BITS = 64;
+
+/**
+ * The MAC computes the Ethernet CRC-32 over the destination address.
+ * The 6 most significant bits of the bit reversed CRC select one of the 64 bits in the hash table.
+ * Bit 5 of the index selects the high register, bits 4:0 select the bit in the register.
+ */
+inline uint32_t hash_index(const uint8_t *pMacAddress) {
+	uint32_t nCrc = 0xFFFFFFFF;
+
+	for (uint32_t i = 0; i < ETH_ADDR_LEN; i++) {
+		nCrc ^= pMacAddress[i];
+
+		for (uint32_t nBit = 0; nBit < 8; nBit++) {
+			nCrc = (nCrc >> 1) ^ (0xEDB88320 & (0U - (nCrc & 1U)));
+		}
+	}
+
+	nCrc = ~nCrc;
+
+	// Bit reverse of the 6 least significant bits
+	uint32_t nIndex = 0;
+
+	for (uint32_t nBit = 0; nBit < 6; nBit++) {
+		nIndex = (nIndex << 1) | ((nCrc >> nBit) & 1U);
+	}
+
+	return nIndex;
+}
+
+/**
+ * @param pIp multicast group address, network order
+ * @param pMacAddress 01:00:5E followed by the 23 least significant bits of the group address
+ */
+inline void mac_from_ip(const uint8_t *pIp, uint8_t *pMacAddress) {
+	pMacAddress[0] = 0x01;
+	pMacAddress[1] = 0x00;
+	pMacAddress[2] = 0x5E;
+	pMacAddress[3] = pIp[1] & 0x7F;
+	pMacAddress[4] = pIp[2];
+	pMacAddress[5] = pIp[3];
+}
+}  // namespace emac::multicast
+
+#endif /* EMAC_MULTICAST_H_ */
@@ -210,6 +210,27 @@ public:
 		net::udp_send_timestamp(nHandle, reinterpret_cast<const uint8_t *>(pBuffer), nLength, to_ip, remote_port);
 	}
 
+	/**
+	 * Zero-copy send: the payload is written in the returned buffer, followed by SendBuffer.
+	 * Nothing else can be sent in between.
+	 */
+	void *GetSendBuffer(int32_t nHandle, uint32_t to_ip, uint16_t remote_port) {
+		return net::udp_get_send_buffer(nHandle, to_ip, remote_port);
+	}
+
+	void SendBuffer(uint32_t nLength) {
+		if (__builtin_expect((GetIp() != 0), 1)) {
+			net::udp_send_buffer(nLength);
+		}
+	}
+
+	/**
+	 * A caller sending a burst can postpone the rest when this is 0, SendTo waits for the wire
+	 */
+	uint32_t GetSendAvailable() {
+		return net::udp_send_available();
+	}
+
 	/*
 	 * TCP/IP
 	 */
@@ -224,8 +245,12 @@ public:
 		return net::tcp_read(nHandleListen, ppBuffer, HandleConnection);
 	}
 
-	void TcpWrite(const int32_t nHandleListen, const uint8_t *pBuffer, uint32_t nLength, const uint32_t HandleConnection) {
-		net::tcp_write(nHandleListen, pBuffer, nLength, HandleConnection);
+	uint32_t TcpWrite(const int32_t nHandleListen, const uint8_t *pBuffer, uint32_t nLength, const uint32_t HandleConnection) {
+		return net::tcp_write(nHandleListen, pBuffer, nLength, HandleConnection);
+	}
+
+	bool TcpIsConnected(const int32_t nHandleListen, const uint32_t HandleConnection) {
+		return net::tcp_is_connected(nHandleListen, HandleConnection);
 	}
 
 	/*
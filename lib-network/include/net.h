@@ -39,6 +39,57 @@ namespace network {
 void mdns_shutdown();
 }  // namespace network
 
+namespace net::udp {
+struct Statistics {
+	uint32_t nReceived;
+	uint32_t nDropped;		///< Queue full
+	uint32_t nHighWaterMark;	///< Maximum number of entries queued
+};
+}  // namespace net::udp
+
+namespace net::tcp {
+struct Statistics {
+	uint32_t nRetransmits;		///< Retransmission timeouts
+	uint32_t nFastRetransmits;	///< Third duplicate ACK
+	uint32_t nZeroWindowProbes;
+	uint32_t nAborts;			///< Too many retransmissions, the connection is reset
+	uint32_t nTxQueueFull;		///< tcp_write could not queue all data
+	uint32_t nRxQueueFull;		///< Segment dropped, the peer will retransmit
+	uint32_t nRttMillis;		///< Last smoothed round-trip time
+};
+}  // namespace net::tcp
+
+namespace net::arp {
+struct Statistics {
+	uint32_t nHits;
+	uint32_t nMisses;		///< Not resolved, the packet is queued
+	uint32_t nEvictions;	///< Cache full
+	uint32_t nRequests;		///< ARP requests sent
+	uint32_t nRateLimited;	///< Request postponed to the next second
+	uint32_t nTimeouts;		///< Resolution failed
+	uint32_t nDropped;		///< Queued packets dropped, the queue was full or the resolution failed
+	uint32_t nEntries;
+};
+}  // namespace net::arp
+
+namespace net::emac {
+struct Statistics {
+	uint32_t nRxBufferUnavailable;	///< The DMA reached a descriptor it does not own, the Rx ring was full
+	uint32_t nRxMissedFrames;		///< Dropped by the DMA, no Rx descriptor available
+	uint32_t nRxFifoOverflows;		///< Dropped by the Rx FIFO
+	uint32_t nTxRingFull;			///< A frame was sent while all Tx descriptors were owned by the DMA
+	uint32_t nTxWaitMicros;			///< Time spent waiting for a free Tx descriptor
+	uint32_t nTxErrors;
+};
+}  // namespace net::emac
+
+namespace net::igmp {
+struct Statistics {
+	uint32_t nGroups;			///< Groups joined
+	uint32_t nNotSubscribed;	///< Multicast frames passed by the hash filter, dropped in software
+};
+}  // namespace net::igmp
+
 namespace net {
 void tcp_shutdown();
 void igmp_shutdown();
@@ -63,15 +114,24 @@ int udp_begin(uint16_t);
 int udp_end(uint16_t);
 uint32_t udp_recv1(int, uint8_t *, uint32_t, uint32_t *, uint16_t *);
 uint32_t udp_recv2(int, const uint8_t **, uint32_t *, uint16_t *);
+uint32_t udp_pending(int);
+void udp_get_statistics(int, net::udp::Statistics&);
+void arp_get_statistics(net::arp::Statistics&);
 void udp_send(int, const uint8_t *, uint32_t, uint32_t, uint16_t);
 void udp_send_timestamp(int, const uint8_t *, uint32_t, uint32_t, uint16_t);
+uint32_t udp_send_available();
+uint8_t *udp_get_send_buffer(int, uint32_t, uint16_t);
+void udp_send_buffer(uint32_t);
 
 void igmp_join(uint32_t);
 void igmp_leave(uint32_t);
+void igmp_get_statistics(net::igmp::Statistics&);
 
 int tcp_begin(const uint16_t);
 uint16_t tcp_read(const int32_t, const uint8_t **, uint32_t &);
-void tcp_write(const int32_t, const uint8_t *, uint32_t, const uint32_t);
+uint32_t tcp_write(const int32_t, const uint8_t *, uint32_t, const uint32_t);
+bool tcp_is_connected(const int32_t, const uint32_t);
+void tcp_get_statistics(net::tcp::Statistics&);
 
 /**
  * Must be provided by the application
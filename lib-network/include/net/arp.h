@@ -41,6 +41,7 @@ enum class Flags {
 void arp_init();
 void arp_handle(struct t_arp *);
 void arp_send(struct t_udp *, const uint32_t, const uint32_t);
+bool arp_resolve(const uint32_t, uint8_t *);
 #if defined CONFIG_ENET_ENABLE_PTP
 void arp_send_timestamp(struct t_udp *, const uint32_t, const uint32_t);
 #endif
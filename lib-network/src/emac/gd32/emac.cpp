@@ -41,6 +41,7 @@ void console_error(const char *);
 extern void enet_gpio_config();
 extern enet_descriptors_struct txdesc_tab[ENET_TXBUF_NUM];
 extern void mac_address_get(uint8_t paddr[]);
+extern void emac_multicast_filter_apply();
 
 #if defined (CONFIG_ENET_ENABLE_PTP)
 # include "gd32_ptp.h"
@@ -130,6 +131,8 @@ void emac_adjust_link(const net::PhyStatus phyStatus) {
 
     DEBUG_PRINTF("enet_init_status=%s", enet_init_status == SUCCESS ? "SUCCES" : "ERROR" );
 
+	emac_multicast_filter_apply();
+
 #ifndef NDEBUG
 	{
 		uint16_t phy_value;
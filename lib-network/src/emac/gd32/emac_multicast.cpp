@@ -0,0 +1,119 @@
+/**
+ * @file emac_multicast.cpp
+ *
+ */
+/* Copyright (C) 2024 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <cstdint>
+#include <cstring>
+
+#include "gd32.h"
+
+#include "emac/multicast.h"
+
+#include "debug.h"
+
+/*
+ * The first multicast addresses get a perfect filter slot (MAC address 1-3),
+ * the others are passed by the 64-bit hash filter.
+ * A hash match can be a group which is not joined, these frames are dropped in software.
+ */
+
+static constexpr uint32_t PERFECT_SLOTS = 3;
+static constexpr enet_macaddress_enum s_PerfectSlot[PERFECT_SLOTS] = { ENET_MAC_ADDRESS1, ENET_MAC_ADDRESS2, ENET_MAC_ADDRESS3 };
+
+static uint8_t s_PerfectAddress[PERFECT_SLOTS][ETH_ADDR_LEN];
+static uint32_t s_nPerfectCount;
+static uint32_t s_nHashHigh;
+static uint32_t s_nHashLow;
+
+/**
+ * Called after enet_init, which passes all multicast frames (ENET_CUSTOM)
+ */
+void emac_multicast_filter_apply() {
+	for (uint32_t i = 0; i < PERFECT_SLOTS; i++) {
+#if defined (GD32H7XX)
+		if (i < s_nPerfectCount) {
+			enet_mac_address_set(ENETx, s_PerfectSlot[i], s_PerfectAddress[i]);
+			enet_address_filter_config(ENETx, s_PerfectSlot[i], 0, ENET_ADDRESS_FILTER_DA);
+			enet_address_filter_enable(ENETx, s_PerfectSlot[i]);
+		} else {
+			enet_address_filter_disable(ENETx, s_PerfectSlot[i]);
+		}
+#else
+		if (i < s_nPerfectCount) {
+			enet_mac_address_set(s_PerfectSlot[i], s_PerfectAddress[i]);
+			enet_address_filter_config(s_PerfectSlot[i], 0, ENET_ADDRESS_FILTER_DA);
+			enet_address_filter_enable(s_PerfectSlot[i]);
+		} else {
+			enet_address_filter_disable(s_PerfectSlot[i]);
+		}
+#endif
+	}
+
+#if defined (GD32H7XX)
+	ENET_MAC_HLH(ENETx) = s_nHashHigh;
+	ENET_MAC_HLL(ENETx) = s_nHashLow;
+	enet_fliter_feature_disable(ENETx, ENET_MULTICAST_FILTER_PASS);
+	enet_fliter_feature_enable(ENETx, ENET_MULTICAST_FILTER_HASH_MODE | ENET_FILTER_MODE_EITHER);
+#else
+	ENET_MAC_HLH = s_nHashHigh;
+	ENET_MAC_HLL = s_nHashLow;
+	enet_fliter_feature_disable(ENET_MULTICAST_FILTER_PASS);
+	enet_fliter_feature_enable(ENET_MULTICAST_FILTER_HASH_MODE | ENET_FILTER_MODE_EITHER);
+#endif
+}
+
+/**
+ * @param pMacAddresses nCount multicast MAC addresses of ETH_ADDR_LEN bytes
+ */
+void emac_multicast_filter_set(const uint8_t *pMacAddresses, const uint32_t nCount) {
+	DEBUG_ENTRY
+	DEBUG_PRINTF("nCount=%u", nCount);
+
+	s_nPerfectCount = 0;
+	s_nHashHigh = 0;
+	s_nHashLow = 0;
+
+	for (uint32_t i = 0; i < nCount; i++) {
+		const auto *pMacAddress = &pMacAddresses[i * ETH_ADDR_LEN];
+
+		if (s_nPerfectCount < PERFECT_SLOTS) {
+			memcpy(s_PerfectAddress[s_nPerfectCount++], pMacAddress, ETH_ADDR_LEN);
+			continue;
+		}
+
+		const auto nIndex = emac::multicast::hash_index(pMacAddress);
+
+		if (nIndex >= 32) {
+			s_nHashHigh |= (1U << (nIndex - 32));
+		} else {
+			s_nHashLow |= (1U << nIndex);
+		}
+	}
+
+	DEBUG_PRINTF("s_nPerfectCount=%u, s_nHashHigh=%.8x, s_nHashLow=%.8x", s_nPerfectCount, s_nHashHigh, s_nHashLow);
+
+	emac_multicast_filter_apply();
+
+	DEBUG_EXIT
+}
@@ -35,6 +35,8 @@
 #include "gd32.h"
 #include "../src/net/net_memcpy.h"
 
+#include "emac/emac.h"
+
 #include "debug.h"
 
 #if defined (CONFIG_ENET_ENABLE_PTP)
@@ -51,7 +53,134 @@ extern uint32_t ptpTimestamp[2];
 extern enet_descriptors_struct *dma_current_rxdesc;
 extern enet_descriptors_struct *dma_current_txdesc;
 
+static net::emac::Statistics s_Statistics;
+
+static void rx_counters_update() {
+	/* the counters are cleared on read */
+	const auto nCounters = ENET_DMA_MFBOCNT;
+
+	s_Statistics.nRxMissedFrames += GET_DMA_MFBOCNT_MSFC(nCounters);
+	s_Statistics.nRxFifoOverflows += GET_DMA_MFBOCNT_MSFA(nCounters);
+}
+
+/**
+ * The DMA is suspended when it reaches a descriptor it does not own, frames arriving meanwhile are missed.
+ */
+inline static void rx_resume() {
+	/* check Rx buffer unavailable flag status */
+	if (0 != (ENET_DMA_STAT & ENET_DMA_STAT_RBU)) {
+		/* clear RBU flag */
+		ENET_DMA_STAT = ENET_DMA_STAT_RBU;
+		/* resume DMA reception by writing to the RPEN register*/
+		ENET_DMA_RPEN = 0U;
+
+		s_Statistics.nRxBufferUnavailable++;
+		rx_counters_update();
+	}
+}
+
+void emac_get_statistics(net::emac::Statistics& statistics) {
+	rx_counters_update();
+	statistics = s_Statistics;
+}
+
+/*
+ * Tx descriptor ring
+ * dma_current_txdesc is the next descriptor to fill, the s_nTxQueued descriptors before it are owned by the DMA.
+ * The completed descriptors are reaped lazily, when a frame is sent or the free descriptors are requested.
+ */
+
+extern enet_descriptors_struct txdesc_tab[ENET_TXBUF_NUM];
+
+static constexpr uint32_t TICKS_PER_US = (MCU_CLOCK_FREQ / 1000000U);
+
+static uint32_t s_nTxQueued;
+
+/**
+ * The DMA completes the descriptors in order.
+ * The descriptors are indexed, with PTP the DMA writes the timestamp over the next descriptor address.
+ */
+static void tx_reap() {
+	while (s_nTxQueued != 0) {
+		const auto nCurrent = static_cast<uint32_t>(dma_current_txdesc - txdesc_tab);
+		const auto nOldest = (nCurrent + ENET_TXBUF_NUM - s_nTxQueued) % ENET_TXBUF_NUM;
+		const auto nStatus = txdesc_tab[nOldest].status;
+
+		if (0 != (nStatus & ENET_TDES0_DAV)) {
+			return;
+		}
+
+		if (__builtin_expect((0 != (nStatus & ENET_TDES0_ES)), 0)) {
+			s_Statistics.nTxErrors++;
+		}
+
+		s_nTxQueued--;
+	}
+}
+
+/**
+ * Only when the ring is full the DMA has to transmit the oldest frame first.
+ */
+static void tx_wait() {
+	tx_reap();
+
+	if (__builtin_expect((s_nTxQueued < ENET_TXBUF_NUM), 1)) {
+		return;
+	}
+
+	s_Statistics.nTxRingFull++;
+
+	const auto nTicks = DWT->CYCCNT;
+
+	while (0 != (dma_current_txdesc->status & ENET_TDES0_DAV)) {
+		__DMB();
+	}
+
+	s_Statistics.nTxWaitMicros += (DWT->CYCCNT - nTicks) / TICKS_PER_US;
+
+	tx_reap();
+}
+
+uint32_t emac_eth_send_available() {
+	tx_reap();
+	return ENET_TXBUF_NUM - s_nTxQueued;
+}
+
+#if defined (CONFIG_NET_ENABLE_ZERO_COPY_RX)
+# if defined (CONFIG_ENET_ENABLE_PTP)
+#  error CONFIG_NET_ENABLE_ZERO_COPY_RX is not supported with CONFIG_ENET_ENABLE_PTP
+# endif
+# if (ENET_RXBUF_NUM > 32)
+#  error ENET_RXBUF_NUM
+# endif
+/*
+ * The lent Rx descriptors are not available for the DMA.
+ * Lending stops when fewer than RXBUF_RESERVED descriptors would be left,
+ * these are for the non UDP traffic (ARP, ICMP, TCP). The UDP frame is copied instead.
+ */
+static_assert(ENET_RXBUF_NUM >= 8, "CONFIG_NET_ENABLE_ZERO_COPY_RX needs a larger Rx descriptor ring");
+static constexpr uint32_t RXBUF_RESERVED = 4;
+static constexpr uint32_t RXBUF_LEND_MAX = ENET_RXBUF_NUM - RXBUF_RESERVED;
+
+extern enet_descriptors_struct rxdesc_tab[ENET_RXBUF_NUM];
+
+static uint32_t s_nLentMask;
+static uint32_t s_nLentCount;
+
+static uint32_t rxdesc_index(const enet_descriptors_struct *pDesc) {
+	return static_cast<uint32_t>(pDesc - rxdesc_tab);
+}
+#endif
+
 int emac_eth_recv(uint8_t **ppPacket) {
+#if defined (CONFIG_NET_ENABLE_ZERO_COPY_RX)
+	/*
+	 * The descriptor is still lent to the UDP consumer, the DMA is stalled here as well.
+	 */
+	if (__builtin_expect(((s_nLentMask & (1U << rxdesc_index(dma_current_rxdesc))) != 0), 0)) {
+		return -1;
+	}
+#endif
 	const auto nLength = enet_desc_information_get(dma_current_rxdesc, RXDESC_FRAME_LENGTH);
 
 	if (nLength > 0) {
@@ -75,12 +204,7 @@ static void ptpframe_receive_normal_mode() {
 	dma_current_rxdesc->buffer2_next_desc_addr = dma_current_ptp_rxdesc->buffer2_next_desc_addr;
 	dma_current_rxdesc->status = ENET_RDES0_DAV;
 
-	if (0 != (ENET_DMA_STAT & ENET_DMA_STAT_RBU)) {
-		/* clear RBU flag */
-		ENET_DMA_STAT = ENET_DMA_STAT_RBU;
-		/* resume DMA reception by writing to the RPEN register*/
-		ENET_DMA_RPEN = 0U;
-	}
+	rx_resume();
 
 	 assert(0 != (dma_current_rxdesc->control_buffer_size & ENET_RDES1_RCHM));
 
@@ -98,13 +222,7 @@ static void ptpframe_receive_normal_mode() {
 static void frame_receive() {
 	dma_current_rxdesc->status = ENET_RDES0_DAV;
 
-	/* check Rx buffer unavailable flag status */
-	if (0 != (ENET_DMA_STAT & ENET_DMA_STAT_RBU)) {
-		/* clear RBU flag */
-		ENET_DMA_STAT = ENET_DMA_STAT_RBU;
-		/* resume DMA reception by writing to the RPEN register*/
-		ENET_DMA_RPEN = 0U;
-	}
+	rx_resume();
 
 	assert(0 != (dma_current_rxdesc->control_buffer_size & ENET_RDES1_RCHM));
 
@@ -112,10 +230,54 @@ static void frame_receive() {
 }
 #endif
 
+#if defined (CONFIG_NET_ENABLE_ZERO_COPY_RX)
+/**
+ * Lend the current Rx descriptor to the caller.
+ * The descriptor is given back to the DMA with emac_release_pkt().
+ * @return descriptor index, or -1 when the lending limit is reached
+ */
+int32_t emac_lend_pkt() {
+	if (__builtin_expect((s_nLentCount >= RXBUF_LEND_MAX), 0)) {
+		return -1;
+	}
+
+	const auto nIndex = rxdesc_index(dma_current_rxdesc);
+
+	s_nLentMask |= (1U << nIndex);
+	s_nLentCount++;
+
+	return static_cast<int32_t>(nIndex);
+}
+
+void emac_release_pkt(const int32_t nIndex) {
+	assert(nIndex >= 0);
+	assert(nIndex < static_cast<int32_t>(ENET_RXBUF_NUM));
+	assert((s_nLentMask & (1U << nIndex)) != 0);
+
+	s_nLentMask &= ~(1U << nIndex);
+	s_nLentCount--;
+
+	/*
+	 * The descriptors are given back out of order.
+	 * The DMA stops at a descriptor it does not own (RBU), so resume it.
+	 */
+	rxdesc_tab[nIndex].status = ENET_RDES0_DAV;
+
+	rx_resume();
+}
+#endif
+
 void emac_free_pkt() {
     while(0 != (dma_current_rxdesc->status & ENET_RDES0_DAV)) {
         __DMB();
     }
+#if defined (CONFIG_NET_ENABLE_ZERO_COPY_RX)
+	if ((s_nLentMask & (1U << rxdesc_index(dma_current_rxdesc))) != 0) {
+		/* Lent, skip the descriptor without giving it back to the DMA */
+		dma_current_rxdesc = reinterpret_cast<enet_descriptors_struct *>(dma_current_rxdesc->buffer2_next_desc_addr);
+		return;
+	}
+#endif
 #if defined (CONFIG_ENET_ENABLE_PTP)
     ptpframe_receive_normal_mode();
 #else
@@ -129,13 +291,17 @@ inline static void ptpframe_transmit(const uint8_t *pBuffer, const uint32_t nLen
 	assert(nLength <= ENET_MAX_FRAME_SIZE);
 
 	auto *pDst = reinterpret_cast<uint8_t *>(dma_current_ptp_txdesc->buffer1_addr);
-	net::memcpy(pDst, pBuffer, nLength);
+
+	if (pDst != pBuffer) {
+		net::memcpy(pDst, pBuffer, nLength);
+	}
 
     dma_current_txdesc->control_buffer_size = (nLength & (uint32_t)0x1FFF);
     /* set the segment of frame, frame is transmitted in one descriptor */
     dma_current_txdesc->status |= ENET_TDES0_LSG | ENET_TDES0_FSG;
     /* enable the DMA transmission */
     dma_current_txdesc->status |= ENET_TDES0_DAV;
+    s_nTxQueued++;
 
     /* check Tx buffer unavailable flag status */
     const auto dma_tbu_flag = (ENET_DMA_STAT & ENET_DMA_STAT_TBU);
@@ -184,9 +350,7 @@ inline static void ptpframe_transmit(const uint8_t *pBuffer, const uint32_t nLen
 }
 
 void emac_eth_send(void *pBuffer, uint32_t nLength) {
-	while (0 != (dma_current_txdesc->status & ENET_TDES0_DAV)) {
-        __DMB();
-	}
+	tx_wait();
 
 	auto nStatus = dma_current_txdesc->status;
 	nStatus &= ~ENET_TDES0_TTSEN;
@@ -196,9 +360,7 @@ void emac_eth_send(void *pBuffer, uint32_t nLength) {
 }
 
 void emac_eth_send_timestamp(void *pBuffer, uint32_t nLength) {
-	while (0 != (dma_current_txdesc->status & ENET_TDES0_DAV)) {
-        __DMB();
-	}
+	tx_wait();
 
 	auto nStatus = dma_current_txdesc->status;
 	nStatus |= ENET_TDES0_TTSEN;
@@ -206,17 +368,26 @@ void emac_eth_send_timestamp(void *pBuffer, uint32_t nLength) {
 
 	ptpframe_transmit(reinterpret_cast<uint8_t *>(pBuffer), nLength, true);
 }
-#else
-void emac_eth_send(void *pBuffer, uint32_t nLength) {
-	assert(nullptr != pBuffer);
-	assert(nLength <= static_cast<int>(ENET_MAX_FRAME_SIZE));
 
-	while (0 != (dma_current_txdesc->status & ENET_TDES0_DAV)) {
-		__DMB();
-	}
+/**
+ * The frame is written in place, the Tx buffer is valid until the next send
+ */
+uint8_t *emac_alloc_pkt() {
+	tx_wait();
 
-	auto *pDst = reinterpret_cast<uint8_t *>(dma_current_txdesc->buffer1_addr);
-	net::memcpy(pDst, pBuffer, nLength);
+	auto nStatus = dma_current_txdesc->status;
+	nStatus &= ~ENET_TDES0_TTSEN;
+	dma_current_txdesc->status = nStatus;
+
+	return reinterpret_cast<uint8_t *>(dma_current_ptp_txdesc->buffer1_addr);
+}
+
+void emac_send_pkt(const uint32_t nLength) {
+	ptpframe_transmit(reinterpret_cast<uint8_t *>(dma_current_ptp_txdesc->buffer1_addr), nLength, false);
+}
+#else
+static void frame_transmit(const uint32_t nLength) {
+	assert(nLength <= static_cast<int>(ENET_MAX_FRAME_SIZE));
 
 	/* set the frame length */
 	dma_current_txdesc->control_buffer_size = nLength;
@@ -224,6 +395,7 @@ void emac_eth_send(void *pBuffer, uint32_t nLength) {
 	dma_current_txdesc->status |= ENET_TDES0_LSG | ENET_TDES0_FSG;
 	/* enable the DMA transmission */
 	dma_current_txdesc->status |= ENET_TDES0_DAV;
+	s_nTxQueued++;
 
 	/* check Tx buffer unavailable flag status */
 	const auto dma_tbu_flag = (ENET_DMA_STAT & ENET_DMA_STAT_TBU);
@@ -241,4 +413,27 @@ void emac_eth_send(void *pBuffer, uint32_t nLength) {
 	/* update the current TxDMA descriptor pointer to the next descriptor in TxDMA descriptor table*/
 	dma_current_txdesc = reinterpret_cast<enet_descriptors_struct *>(dma_current_txdesc->buffer2_next_desc_addr);
 }
+
+void emac_eth_send(void *pBuffer, uint32_t nLength) {
+	assert(nullptr != pBuffer);
+
+	tx_wait();
+
+	auto *pDst = reinterpret_cast<uint8_t *>(dma_current_txdesc->buffer1_addr);
+	net::memcpy(pDst, pBuffer, nLength);
+
+	frame_transmit(nLength);
+}
+
+/**
+ * The frame is written in place, the Tx buffer is valid until the next send
+ */
+uint8_t *emac_alloc_pkt() {
+	tx_wait();
+	return reinterpret_cast<uint8_t *>(dma_current_txdesc->buffer1_addr);
+}
+
+void emac_send_pkt(const uint32_t nLength) {
+	frame_transmit(nLength);
+}
 #endif
@@ -46,6 +46,7 @@
 
 #include "../../config/net_config.h"
 
+#include "net.h"
 #include "net_memcpy.h"
 #include "net_private.h"
 
@@ -59,11 +60,9 @@
 
 #include "debug.h"
 
-#if !defined ARP_MAX_RECORDS
-static constexpr auto MAX_RECORDS = 16;
-#else
-static constexpr auto MAX_RECORDS = ARP_MAX_RECORDS;
-#endif
+static constexpr uint32_t MAX_RECORDS = ARP_MAX_RECORDS;
+static constexpr uint32_t MAX_PENDING = ARP_MAX_PENDING;
+static constexpr uint32_t PENDING_BUFFERS = ARP_PENDING_BUFFERS;
 
 namespace net {
 namespace globals {
@@ -72,17 +71,26 @@ extern uint32_t nOnNetworkMask;
 
 namespace arp {
 static constexpr uint32_t TIMER_INTERVAL	= 1000;			///< 1 second
-static constexpr uint32_t MAX_PROBING 		= 2;			///< 2 * 1 second
+static constexpr uint32_t MAX_PROBING 		= 3;			///< Requests, 1 second apart, before the resolution fails
 static constexpr uint32_t MAX_REACHABLE 	= (10 * 60);	///< (10 * 60) * 1 second = 10 minutes
 static constexpr uint32_t MAX_STALE 		= ( 5 * 60);	///< ( 5 * 60) * 1 second =  5 minutes
+static constexpr uint32_t MAX_USED			= (MAX_RECORDS * 3) / 4;	///< Keeps the probe sequences short
+static constexpr uint32_t MAX_REQUESTS		= MAX_USED;		///< Per second, the others are postponed
+static constexpr uint32_t HASH_SHIFT		= 32 - __builtin_ctz(MAX_RECORDS);
 
-enum class State {
-	STATE_EMPTY, STATE_PROBE, STATE_REACHABLE, STATE_STALE,
+/**
+ * INCOMPLETE: resolving, the packets are queued
+ * REACHABLE : resolved
+ * STALE     : not confirmed for MAX_REACHABLE, still used; the next send starts a refresh
+ * REFRESH   : still used, a unicast request is sent
+ */
+enum class State : uint8_t {
+	STATE_EMPTY, STATE_INCOMPLETE, STATE_REACHABLE, STATE_STALE, STATE_REFRESH
 };
 
 struct Packet {
-	uint8_t *p;
-	uint32_t nSize;
+	uint16_t nSize;
+	uint8_t nBuffer;	///< Index in s_PendingBuffers
 #if defined CONFIG_ENET_ENABLE_PTP
 	bool isTimestamp;
 #endif
@@ -90,32 +98,53 @@ struct Packet {
 
 struct Record {
 	uint32_t nIp;
-	Packet packet;
+	Packet packets[MAX_PENDING];
 	uint8_t mac_address[ETH_ADDR_LEN];
 	uint16_t nAge;
+	uint8_t nPending;
+	uint8_t nRequests;
+	bool isUsed;		///< Sent to in the current second
 	State state;
 };
 }  // namespace arp
 
+/*
+ * Open addressing with linear probing.
+ * A record is removed with backward shift deletion, there are no tombstones.
+ */
 static net::arp::Record s_ArpRecords[MAX_RECORDS] SECTION_NETWORK ALIGNED;
+static uint32_t s_nUsed SECTION_NETWORK ALIGNED;
+static uint32_t s_nRequestTokens SECTION_NETWORK ALIGNED;
+static net::arp::Statistics s_Statistics SECTION_NETWORK ALIGNED;
+
+/*
+ * The packets waiting for the address resolution, a free buffer has its bit set in s_nPendingFree
+ * The buffers are copied into the Tx frames by the CPU, they are not in TCMSRAM (.network)
+ */
+struct PendingBuffer {
+	struct t_udp udp;
+} ALIGNED;
+
+static struct PendingBuffer s_PendingBuffers[PENDING_BUFFERS] ALIGNED;
+static uint32_t s_nPendingFree SECTION_NETWORK ALIGNED;
 
 static struct t_arp s_arp_request ALIGNED ;
 static struct t_arp s_arp_reply ALIGNED;
 
 #ifndef NDEBUG
-static constexpr char STATE[4][12] = { "EMPTY", "PROBE", "REACHABLE", "STALE", };
+static constexpr char STATE[5][12] = { "EMPTY", "INCOMPLETE", "REACHABLE", "STALE", "REFRESH" };
 
 void static arp_cache_record_dump(net::arp::Record *pRecord) {
-	printf("%p %-4d %c " MACSTR " %-10s " IPSTR  "\n", pRecord, pRecord->nAge, pRecord->packet.p == nullptr ? '-' : 'Q' , MAC2STR(pRecord->mac_address), STATE[static_cast<unsigned>(pRecord->state)], IP2STR(pRecord->nIp));
+	printf("%p %-4d %u " MACSTR " %-10s " IPSTR  "\n", pRecord, pRecord->nAge, pRecord->nPending, MAC2STR(pRecord->mac_address), STATE[static_cast<unsigned>(pRecord->state)], IP2STR(pRecord->nIp));
 }
 
 void static arp_cache_dump() {
 	uint32_t nIndex = 0;
 	for (auto &record : s_ArpRecords) {
-		printf("%p %02d %-4d" MACSTR " %-10s " IPSTR  "\n", &record, nIndex++, record.nAge, MAC2STR(record.mac_address), STATE[static_cast<unsigned>(record.state)], IP2STR(record.nIp));
-		if (nIndex ==6) {
-			return;
+		if (record.state != net::arp::State::STATE_EMPTY) {
+			printf("%p %02d %-4d" MACSTR " %-10s " IPSTR  "\n", &record, nIndex, record.nAge, MAC2STR(record.mac_address), STATE[static_cast<unsigned>(record.state)], IP2STR(record.nIp));
 		}
+		nIndex++;
 	}
 }
 #else
@@ -123,194 +152,357 @@ void static arp_cache_record_dump([[maybe_unused]] net::arp::Record *pRecord) {}
 void static arp_cache_dump() {}
 #endif
 
-static net::arp::Record *arp_find_record(const uint32_t nDestinationIp, [[maybe_unused]] const arp::Flags flag) {
-	DEBUG_ENTRY
+static uint32_t arp_hash(const uint32_t nIp) {
+	return (nIp * 0x9E3779B1U) >> net::arp::HASH_SHIFT;
+}
 
-	net::arp::Record *pStale = nullptr;
-	net::arp::Record *pReachable = nullptr;
-	uint32_t nAgeStale = 0;
-	uint32_t nAgeReachable = 0;
+static net::arp::Record *arp_cache_lookup(const uint32_t nIp) {
+	auto nIndex = arp_hash(nIp);
 
-	for (auto &record : s_ArpRecords) {
-		if (record.nIp == nDestinationIp) {
-			DEBUG_EXIT
-			return &record;
+	for (;;) {
+		auto& record = s_ArpRecords[nIndex];
+
+		if (record.state == net::arp::State::STATE_EMPTY) {
+			return nullptr;
 		}
 
-		if (flag == arp::Flags::FLAG_UPDATE) {
-			continue;
+		if (record.nIp == nIp) {
+			return &record;
 		}
 
+		nIndex = (nIndex + 1) & (MAX_RECORDS - 1);
+	}
+}
+
+static int32_t pending_alloc() {
+	if (__builtin_expect((s_nPendingFree == 0), 0)) {
+		return -1;
+	}
+
+	const auto nBuffer = __builtin_ctz(s_nPendingFree);
+	s_nPendingFree &= ~(1U << nBuffer);
+
+	return nBuffer;
+}
+
+static void pending_free(const uint32_t nBuffer) {
+	assert(nBuffer < PENDING_BUFFERS);
+	assert((s_nPendingFree & (1U << nBuffer)) == 0);
+
+	s_nPendingFree |= (1U << nBuffer);
+}
+
+static void arp_cache_free_pending(net::arp::Record& record) {
+	for (uint32_t i = 0; i < record.nPending; i++) {
+		pending_free(record.packets[i].nBuffer);
+	}
+
+	s_Statistics.nDropped += record.nPending;
+	record.nPending = 0;
+}
+
+static void arp_cache_remove(uint32_t nIndex) {
+	DEBUG_PRINTF("%u " IPSTR, nIndex, IP2STR(s_ArpRecords[nIndex].nIp));
+
+	arp_cache_free_pending(s_ArpRecords[nIndex]);
+
+	auto nNext = nIndex;
+
+	for (;;) {
+		nNext = (nNext + 1) & (MAX_RECORDS - 1);
+
+		const auto& record = s_ArpRecords[nNext];
+
 		if (record.state == net::arp::State::STATE_EMPTY) {
-			record.nIp = nDestinationIp;
-			DEBUG_EXIT
-			return &record;
+			break;
 		}
 
-		if (record.state == net::arp::State::STATE_REACHABLE) {
-			if (record.nAge > nAgeReachable) {
-				nAgeReachable = record.nAge;
-				pReachable = &record;
-			}
+		const auto nHome = arp_hash(record.nIp);
+
+		// The record stays when its home slot is cyclically in (nIndex, nNext]
+		if ((nIndex <= nNext) ? ((nIndex < nHome) && (nHome <= nNext)) : ((nIndex < nHome) || (nHome <= nNext))) {
 			continue;
 		}
 
+		s_ArpRecords[nIndex] = record;
+		nIndex = nNext;
+	}
 
-		if (record.state == net::arp::State::STATE_STALE) {
-			if (record.nAge > nAgeStale) {
-				nAgeStale = record.nAge;
-				pStale = &record;
+	memset(&s_ArpRecords[nIndex], 0, sizeof(struct net::arp::Record));
+	s_nUsed--;
+}
+
+/**
+ * The victim is the oldest STALE record, else the oldest REACHABLE or REFRESH record which was not used in the current second.
+ * A record which is resolving or in use is not evicted.
+ */
+static bool arp_cache_evict() {
+	uint32_t nVictim = 0;
+	uint32_t nScoreVictim = 0;
+
+	for (uint32_t nIndex = 0; nIndex < MAX_RECORDS; nIndex++) {
+		const auto& record = s_ArpRecords[nIndex];
+		uint32_t nScore;
+
+		switch (record.state) {
+		case net::arp::State::STATE_STALE:
+			nScore = 2U << 16;
+			break;
+		case net::arp::State::STATE_REACHABLE:
+		case net::arp::State::STATE_REFRESH:
+			if (record.isUsed) {
+				continue;
 			}
+			nScore = 1U << 16;
+			break;
+		default:
 			continue;
 		}
+
+		nScore |= record.nAge;
+
+		if (nScore > nScoreVictim) {
+			nScoreVictim = nScore;
+			nVictim = nIndex;
+		}
 	}
 
-	if (pStale != nullptr) {
-		DEBUG_EXIT
-		return pStale;
+	if (nScoreVictim == 0) {
+		return false;
 	}
 
-	if (pReachable != nullptr) {
-		DEBUG_EXIT
-		return pReachable;
+	s_Statistics.nEvictions++;
+	arp_cache_remove(nVictim);
+
+	return true;
+}
+
+/**
+ * @return nullptr when the cache is full with records which are resolving or in use
+ */
+static net::arp::Record *arp_cache_insert(const uint32_t nIp, const net::arp::State state) {
+	if ((s_nUsed >= net::arp::MAX_USED) && !arp_cache_evict()) {
+		return nullptr;
 	}
 
-	DEBUG_EXIT
-	return nullptr;
+	auto nIndex = arp_hash(nIp);
+
+	while (s_ArpRecords[nIndex].state != net::arp::State::STATE_EMPTY) {
+		nIndex = (nIndex + 1) & (MAX_RECORDS - 1);
+	}
+
+	auto *pRecord = &s_ArpRecords[nIndex];
+
+	pRecord->nIp = nIp;
+	pRecord->nAge = 0;
+	pRecord->nPending = 0;
+	pRecord->nRequests = 0;
+	pRecord->isUsed = false;
+	pRecord->state = state;
+
+	s_nUsed++;
+
+	return pRecord;
+}
+
+static void arp_send_request_unicast(const uint32_t nIp, const uint8_t *pMacAddress) {
+	DEBUG_PRINTF(IPSTR, IP2STR(nIp));
+
+	net::memcpy(s_arp_request.ether.dst, pMacAddress , ETH_ADDR_LEN);
+	net::memcpy_ip(s_arp_request.arp.target_ip, nIp);
+
+	emac_eth_send(reinterpret_cast<void *>(&s_arp_request), sizeof(struct t_arp));
+
+	memset(s_arp_request.ether.dst, 0xFF , ETH_ADDR_LEN);
+}
+
+static void arp_send_request(const uint32_t nIp) {
+	DEBUG_PRINTF(IPSTR, IP2STR(nIp));
+
+	net::memcpy_ip(s_arp_request.arp.target_ip, nIp);
+
+	emac_eth_send(reinterpret_cast<void *>(&s_arp_request), sizeof(struct t_arp));
+}
+
+/**
+ * A refresh is sent unicast to the cached MAC address.
+ * Without a token the request is sent by the timer.
+ */
+static void arp_request(net::arp::Record& record) {
+	if (s_nRequestTokens == 0) {
+		s_Statistics.nRateLimited++;
+		return;
+	}
+
+	s_nRequestTokens--;
+	s_Statistics.nRequests++;
+	record.nRequests++;
+
+	if (record.state == net::arp::State::STATE_REFRESH) {
+		arp_send_request_unicast(record.nIp, record.mac_address);
+	} else {
+		arp_send_request(record.nIp);
+	}
 }
 
 static void arp_cache_update(const uint8_t *pMacAddress, const uint32_t nIp, const arp::Flags flag) {
 	DEBUG_ENTRY
 	DEBUG_PRINTF(MACSTR " " IPSTR " flag=%d", MAC2STR(pMacAddress), IP2STR(nIp), flag);
 
-	auto *record = arp_find_record(nIp, flag);
+	auto *record = arp_cache_lookup(nIp);
 
 	if (record == nullptr) {
-		assert(flag == arp::Flags::FLAG_UPDATE);
-		DEBUG_EXIT
-		return;
+		if (flag == arp::Flags::FLAG_UPDATE) {
+			DEBUG_EXIT
+			return;
+		}
+
+		record = arp_cache_insert(nIp, net::arp::State::STATE_REACHABLE);
+
+		if (record == nullptr) {
+			DEBUG_EXIT
+			return;
+		}
 	}
 
 	record->state = net::arp::State::STATE_REACHABLE;
 	record->nAge = 0;
+	record->nRequests = 0;
 	std::memcpy(record->mac_address, pMacAddress, ETH_ADDR_LEN);
 
 	arp_cache_record_dump(record);
 
-	if (record->packet.p != nullptr) {
-		auto *udp = reinterpret_cast<struct t_udp *>(record->packet.p);
+	for (uint32_t i = 0; i < record->nPending; i++) {
+		auto& packet = record->packets[i];
+		auto *udp = &s_PendingBuffers[packet.nBuffer].udp;
 		std::memcpy(udp->ether.dst, record->mac_address, ETH_ADDR_LEN);
 		udp->ip4.chksum = 0;
 #if !defined (CHECKSUM_BY_HARDWARE)
 		udp->ip4.chksum = net_chksum(reinterpret_cast<void *>(&udp->ip4), sizeof(udp->ip4));
 #endif
 #if defined CONFIG_ENET_ENABLE_PTP
-		if (!record->packet.isTimestamp) {
+		if (!packet.isTimestamp) {
 #endif
-			emac_eth_send(record->packet.p, record->packet.nSize);
+			emac_eth_send(udp, packet.nSize);
 #if defined CONFIG_ENET_ENABLE_PTP
 		} else {
-			emac_eth_send_timestamp(record->packet.p, record->packet.nSize);
+			emac_eth_send_timestamp(udp, packet.nSize);
 		}
 #endif
-		delete [] record->packet.p;
-		record->packet.p = nullptr;
+		pending_free(packet.nBuffer);
 	}
 
-	DEBUG_EXIT
-}
+	record->nPending = 0;
 
-static void arp_send_request(const uint32_t nIp) {
-	DEBUG_PRINTF(IPSTR, IP2STR(nIp));
-
-	net::memcpy_ip(s_arp_request.arp.target_ip, nIp);
-
-	emac_eth_send(reinterpret_cast<void *>(&s_arp_request), sizeof(struct t_arp));
+	DEBUG_EXIT
 }
 
+/**
+ * The packet is queued until the address is resolved, a full queue drops the oldest packet.
+ * The packet is dropped when there is no free pending buffer.
+ */
 template<net::arp::EthSend S>
-static void arp_query(const uint32_t nDestinationIp, struct t_udp *pPacket, const uint32_t nSize, [[maybe_unused]] const arp::Flags flag) {
+static void arp_query(net::arp::Record *pRecord, const uint32_t nDestinationIp, struct t_udp *pPacket, const uint32_t nSize) {
 	DEBUG_ENTRY
-	DEBUG_PRINTF(IPSTR " %c", IP2STR(nDestinationIp), flag == arp::Flags::FLAG_UPDATE ? 'U' : 'I');
+	DEBUG_PRINTF(IPSTR, IP2STR(nDestinationIp));
 
-	auto *recordFound = arp_find_record(nDestinationIp, flag);
-	assert(recordFound != nullptr);
+	if (pRecord == nullptr) {
+		pRecord = arp_cache_insert(nDestinationIp, net::arp::State::STATE_INCOMPLETE);
 
-	arp_cache_record_dump(recordFound);
+		if (pRecord == nullptr) {
+			s_Statistics.nDropped++;
+			DEBUG_EXIT
+			return;
+		}
 
-	if (recordFound->state == net::arp::State::STATE_EMPTY) {
-		recordFound->state = net::arp::State::STATE_PROBE;
-		recordFound->nAge = 0;
-		arp_send_request(nDestinationIp);
+		arp_request(*pRecord);
 	}
 
-	if (recordFound->state == net::arp::State::STATE_PROBE) {
-		if (recordFound->packet.p != nullptr) {
-			delete[] recordFound->packet.p;
+	assert(pRecord->state == net::arp::State::STATE_INCOMPLETE);
+
+	arp_cache_record_dump(pRecord);
+
+	if (pRecord->nPending == MAX_PENDING) {
+		pending_free(pRecord->packets[0].nBuffer);
+
+		for (uint32_t i = 1; i < MAX_PENDING; i++) {
+			pRecord->packets[i - 1] = pRecord->packets[i];
 		}
 
-		recordFound->packet.p = new uint8_t[nSize];
-		assert(recordFound->packet.p != nullptr);
+		pRecord->nPending--;
+		s_Statistics.nDropped++;
+	}
+
+	assert(nSize <= sizeof(struct t_udp));
+
+	const auto nBuffer = pending_alloc();
+
+	if (nBuffer < 0) {
+		s_Statistics.nDropped++;
+		DEBUG_EXIT
+		return;
+	}
+
+	auto& packet = pRecord->packets[pRecord->nPending];
 
-		net::memcpy(recordFound->packet.p, pPacket, nSize);
-		recordFound->packet.nSize = nSize;
+	packet.nBuffer = static_cast<uint8_t>(nBuffer);
+	packet.nSize = static_cast<uint16_t>(nSize);
+	net::memcpy(&s_PendingBuffers[nBuffer].udp, pPacket, nSize);
 #if defined CONFIG_ENET_ENABLE_PTP
-		recordFound->packet.isTimestamp = (S != net::arp::EthSend::IS_NORMAL);
+	packet.isTimestamp = (S != net::arp::EthSend::IS_NORMAL);
 #endif
-	}
+
+	pRecord->nPending++;
 
 	DEBUG_EXIT
 }
 
-static void arp_cache_clean_record(net::arp::Record& record) {
-	if (record.packet.p != nullptr) {
-		delete[] record.packet.p;
-	}
-	memset(&record, 0, sizeof(struct net::arp::Record));
-}
+static void arp_timer() {
+	s_nRequestTokens = net::arp::MAX_REQUESTS;
 
-static void arp_send_request_unicast(const uint32_t nIp, const uint8_t *pMacAddress) {
-	DEBUG_PRINTF(IPSTR, IP2STR(nIp));
+	uint32_t nIndex = 0;
 
-	net::memcpy(s_arp_request.ether.dst, pMacAddress , ETH_ADDR_LEN);
-	net::memcpy_ip(s_arp_request.arp.target_ip, nIp);
+	while (nIndex < MAX_RECORDS) {
+		auto &record = s_ArpRecords[nIndex];
 
-	emac_eth_send(reinterpret_cast<void *>(&s_arp_request), sizeof(struct t_arp));
+		if (record.state == net::arp::State::STATE_EMPTY) {
+			nIndex++;
+			continue;
+		}
 
-	memset(s_arp_request.ether.dst, 0xFF , ETH_ADDR_LEN);
-}
+		record.nAge++;
+		record.isUsed = false;
 
-static void arp_timer() {
-	for (auto &record : s_ArpRecords) {
-		const auto state = record.state;
-		if (state != net::arp::State::STATE_EMPTY) {
-			record.nAge++;
-
-			switch (state) {
-			case net::arp::State::STATE_PROBE:
-				if (record.nAge > net::arp::MAX_PROBING) {
-					arp_cache_clean_record(record);
-				}
-				break;
-
-			case net::arp::State::STATE_REACHABLE:
-				if (record.nAge > net::arp::MAX_REACHABLE) {
-					record.state = net::arp::State::STATE_STALE;
-					record.nAge = 0;
-				}
-				break;
-
-			case net::arp::State::STATE_STALE:
-				if (record.nAge > net::arp::MAX_STALE) {
-					record.state = net::arp::State::STATE_PROBE;
-					arp_send_request_unicast(record.nIp, record.mac_address);
-				}
-				break;
-
-			default:
-				break;
+		switch (record.state) {
+		case net::arp::State::STATE_INCOMPLETE:
+		case net::arp::State::STATE_REFRESH:
+			if (record.nRequests >= net::arp::MAX_PROBING) {
+				s_Statistics.nTimeouts++;
+				arp_cache_remove(nIndex);
+				continue;	// A record can be shifted into this slot
 			}
+			arp_request(record);
+			break;
+
+		case net::arp::State::STATE_REACHABLE:
+			if (record.nAge > net::arp::MAX_REACHABLE) {
+				record.state = net::arp::State::STATE_STALE;
+				record.nAge = 0;
+			}
+			break;
+
+		case net::arp::State::STATE_STALE:
+			if (record.nAge > net::arp::MAX_STALE) {
+				arp_cache_remove(nIndex);
+				continue;	// A record can be shifted into this slot
+			}
+			break;
+
+		default:
+			break;
 		}
+
+		nIndex++;
 	}
 
 	arp_cache_dump();
@@ -341,6 +533,12 @@ void __attribute__((cold)) arp_init() {
 		std::memset(&record, 0, sizeof(struct net::arp::Record));
 	}
 
+	s_nPendingFree = 0xFFFFFFFF >> (32 - PENDING_BUFFERS);
+
+	s_nUsed = 0;
+	s_nRequestTokens = net::arp::MAX_REQUESTS;
+	std::memset(&s_Statistics, 0, sizeof(struct net::arp::Statistics));
+
 	// ARP Request template
 	// Ethernet header
 	std::memcpy(s_arp_request.ether.src, net::globals::netif_default.hwaddr, ETH_ADDR_LEN);
@@ -425,6 +623,44 @@ __attribute__((hot)) void arp_handle(struct t_arp *pArp) {
 	}
 }
 
+/**
+ * A destination which is not on the network is reached through the gateway
+ */
+static uint32_t arp_next_hop(const uint32_t nRemoteIp) {
+	if  (__builtin_expect((net::globals::nOnNetworkMask != (nRemoteIp & net::globals::nOnNetworkMask)), 0)) {
+	      /* According to RFC 3297, chapter 2.6.2 (Forwarding Rules), a packet with
+	         a link-local source address must always be "directly to its destination
+	         on the same physical link. The host MUST NOT send the packet to any
+	         router for forwarding". */
+		if (!network::is_linklocal_ip(nRemoteIp)) {
+			DEBUG_PUTS("");
+			return net::globals::netif_default.gw.addr;
+		}
+	}
+
+	return nRemoteIp;
+}
+
+/**
+ * A resolved record is marked as used, a stale record is refreshed
+ */
+static bool arp_cache_hit(net::arp::Record *pRecord) {
+	if (__builtin_expect(((pRecord != nullptr) && (pRecord->state != net::arp::State::STATE_INCOMPLETE)), 1)) {
+		s_Statistics.nHits++;
+		pRecord->isUsed = true;
+
+		if (pRecord->state == net::arp::State::STATE_STALE) {
+			pRecord->state = net::arp::State::STATE_REFRESH;
+			pRecord->nRequests = 0;
+			arp_request(*pRecord);
+		}
+
+		return true;
+	}
+
+	return false;
+}
+
 template<net::arp::EthSend S>
 static void arp_send_implementation(struct t_udp *pPacket, const uint32_t nSize, const uint32_t nRemoteIp) {
 	DEBUG_ENTRY
@@ -436,39 +672,27 @@ static void arp_send_implementation(struct t_udp *pPacket, const uint32_t nSize,
 	pPacket->ip4.chksum = net_chksum(reinterpret_cast<void *>(&pPacket->ip4), sizeof(pPacket->ip4));
 #endif
 
-	auto nDestinationIp = nRemoteIp;
+	const auto nDestinationIp = arp_next_hop(nRemoteIp);
+	auto *pRecord = arp_cache_lookup(nDestinationIp);
 
-	if  (__builtin_expect((net::globals::nOnNetworkMask != (nRemoteIp & net::globals::nOnNetworkMask)), 0)) {
-	      /* According to RFC 3297, chapter 2.6.2 (Forwarding Rules), a packet with
-	         a link-local source address must always be "directly to its destination
-	         on the same physical link. The host MUST NOT send the packet to any
-	         router for forwarding". */
-		if (!network::is_linklocal_ip(nRemoteIp)) {
-			nDestinationIp = net::globals::netif_default.gw.addr;
-			DEBUG_PUTS("");
-		}
-	}
+	if (arp_cache_hit(pRecord)) {
+		std::memcpy(pPacket->ether.dst, pRecord->mac_address, ETH_ADDR_LEN);
 
-	for (auto &record : s_ArpRecords) {
-		if (record.state >= net::arp::State::STATE_REACHABLE) {
-			if (record.nIp == nDestinationIp) {
-				std::memcpy(pPacket->ether.dst, record.mac_address, ETH_ADDR_LEN);
-
-				if (S == net::arp::EthSend::IS_NORMAL) {
-					emac_eth_send(reinterpret_cast<void *>(pPacket), nSize);
-				}
+		if (S == net::arp::EthSend::IS_NORMAL) {
+			emac_eth_send(reinterpret_cast<void *>(pPacket), nSize);
+		}
 #if defined CONFIG_ENET_ENABLE_PTP
-				else if (S == net::arp::EthSend::IS_TIMESTAMP) {
-					emac_eth_send_timestamp(reinterpret_cast<void *>(pPacket), nSize);
-				}
-#endif
-				DEBUG_EXIT
-				return;
-			}
+		else if (S == net::arp::EthSend::IS_TIMESTAMP) {
+			emac_eth_send_timestamp(reinterpret_cast<void *>(pPacket), nSize);
 		}
+#endif
+		DEBUG_EXIT
+		return;
 	}
 
-	arp_query<S>(nDestinationIp, pPacket, nSize, arp::Flags::FLAG_INSERT);
+	s_Statistics.nMisses++;
+
+	arp_query<S>(pRecord, nDestinationIp, pPacket, nSize);
 
 	DEBUG_EXIT
 	return;
@@ -484,6 +708,25 @@ void arp_send_timestamp(struct t_udp *pPacket, const uint32_t nSize, const uint3
 }
 #endif
 
+/**
+ * @return false when the address is not resolved, arp_send queues the packet and resolves the address
+ */
+bool arp_resolve(const uint32_t nRemoteIp, uint8_t *pMacAddress) {
+	auto *pRecord = arp_cache_lookup(arp_next_hop(nRemoteIp));
+
+	if (arp_cache_hit(pRecord)) {
+		std::memcpy(pMacAddress, pRecord->mac_address, ETH_ADDR_LEN);
+		return true;
+	}
+
+	return false;
+}
+
+void arp_get_statistics(net::arp::Statistics& statistics) {
+	statistics = s_Statistics;
+	statistics.nEntries = s_nUsed;
+}
+
 /*
  *  The Sender IP is set to all zeros,
  *  which means it cannot map to the Sender MAC address.
@@ -44,6 +44,7 @@
 #include "netif.h"
 #include "net/igmp.h"
 #include "net/protocol/igmp.h"
+#include "emac/multicast.h"
 
 #include "net_memcpy.h"
 #include "net_private.h"
@@ -81,8 +82,22 @@ static struct t_igmp s_leave SECTION_NETWORK ALIGNED;
 static uint8_t s_multicast_mac[ETH_ADDR_LEN] SECTION_NETWORK ALIGNED;
 static struct t_group_info s_groups[IGMP_MAX_JOINS_ALLOWED] SECTION_NETWORK ALIGNED;
 static uint16_t s_id SECTION_NETWORK ALIGNED;
+static uint32_t s_nNotSubscribed;
 static int32_t nTimerId;
 
+/*
+ * Always passed by the hardware filter
+ */
+static constexpr uint8_t s_FixedMacAddresses[][ETH_ADDR_LEN] = {
+		{ 0x01, 0x00, 0x5E, 0x00, 0x00, 0x01 }	// 224.0.0.1 all-systems, IGMP general query
+#if defined (CONFIG_ENET_ENABLE_PTP)
+		, { 0x01, 0x1B, 0x19, 0x00, 0x00, 0x00 }	// PTP
+		, { 0x01, 0x80, 0xC2, 0x00, 0x00, 0x0E }	// PTP peer delay
+#endif
+};
+
+static constexpr uint32_t FIXED_MAC_ADDRESSES = sizeof(s_FixedMacAddresses) / ETH_ADDR_LEN;
+
 void igmp_set_ip() {
 	net::memcpy_ip(s_report.ip4.src, net::globals::netif_default.ip.addr);
 	net::memcpy_ip(s_leave.ip4.src, net::globals::netif_default.ip.addr);
@@ -119,6 +134,27 @@ static void igmp_send_report(const uint32_t nGroupAddress) {
 	DEBUG_EXIT
 }
 
+/**
+ * Keeps the hardware multicast filter in sync with the joined groups
+ */
+static void igmp_update_filter() {
+	uint8_t macAddresses[FIXED_MAC_ADDRESSES + IGMP_MAX_JOINS_ALLOWED][ETH_ADDR_LEN];
+
+	std::memcpy(macAddresses, s_FixedMacAddresses, sizeof(s_FixedMacAddresses));
+
+	uint32_t nCount = FIXED_MAC_ADDRESSES;
+
+	for (const auto& group : s_groups) {
+		if (group.nGroupAddress != 0) {
+			_pcast32 multicast_ip;
+			multicast_ip.u32 = group.nGroupAddress;
+			::emac::multicast::mac_from_ip(multicast_ip.u8, macAddresses[nCount++]);
+		}
+	}
+
+	emac_multicast_filter_set(&macAddresses[0][0], nCount);
+}
+
 static void igmp_start_timer(struct t_group_info &group, const uint32_t max_time) {
 	group.nTimer = (max_time > 2 ? (random() % max_time) : 1);
 
@@ -200,6 +236,8 @@ void __attribute__((cold)) igmp_init() {
 
 	nTimerId = Hardware::Get()->SoftwareTimerAdd(IGMP_TMR_INTERVAL, igmp_timer);
 	assert(nTimerId >= 0);
+
+	igmp_update_filter();
 }
 
 void __attribute__((cold)) igmp_shutdown() {
@@ -298,18 +336,21 @@ void igmp_join(uint32_t nGroupAddress) {
 		return;
 	}
 
-	for (int i = 0; i < IGMP_MAX_JOINS_ALLOWED; i++) {
-		if (s_groups[i].nGroupAddress == nGroupAddress) {
+	for (const auto& group : s_groups) {
+		if (group.nGroupAddress == nGroupAddress) {
 			DEBUG_EXIT
 			return;
 		}
+	}
 
+	for (int i = 0; i < IGMP_MAX_JOINS_ALLOWED; i++) {
 		if (s_groups[i].nGroupAddress == 0) {
 			s_groups[i].nGroupAddress = nGroupAddress;
 			s_groups[i].state = DELAYING_MEMBER;
 			s_groups[i].nTimer = 2; // TODO
 
 			igmp_send_report(nGroupAddress);
+			igmp_update_filter();
 
 			DEBUG_EXIT
 			return;
@@ -335,6 +376,8 @@ void igmp_leave(uint32_t nGroupAddress) {
 			group.state = NON_MEMBER;
 			group.nTimer = 0;
 
+			igmp_update_filter();
+
 			DEBUG_EXIT
 			return;
 		}
@@ -347,6 +390,33 @@ void igmp_leave(uint32_t nGroupAddress) {
 	DEBUG_EXIT
 }
 
+/**
+ * The hash filter passes groups which are not joined
+ * @return false when the frame must be dropped
+ */
+__attribute__((hot)) bool igmp_is_member(const uint32_t nGroupAddress) {
+	for (const auto& group : s_groups) {
+		if (group.nGroupAddress == nGroupAddress) {
+			return true;
+		}
+	}
+
+	s_nNotSubscribed++;
+	return false;
+}
+
+void igmp_get_statistics(net::igmp::Statistics& statistics) {
+	statistics.nGroups = 0;
+
+	for (const auto& group : s_groups) {
+		if (group.nGroupAddress != 0) {
+			statistics.nGroups++;
+		}
+	}
+
+	statistics.nNotSubscribed = s_nNotSubscribed;
+}
+
 void igmp_report_groups() {
 	for (auto& group : s_groups) {
 		igmp_delaying_member(group, IGMP_JOIN_DELAYING_MEMBER_TMR);
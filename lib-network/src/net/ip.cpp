@@ -38,6 +38,7 @@
 #include "../../config/net_config.h"
 
 #include "net.h"
+#include "net_memcpy.h"
 #include "net_private.h"
 
 #include "debug.h"
@@ -72,6 +73,11 @@ __attribute__((hot)) void ip_handle(struct t_ip4 *p_ip4) {
 
 	switch (p_ip4->ip4.proto) {
 	case IPv4_PROTO_UDP:
+		if ((p_ip4->ip4.dst[0] & 0xF0) == 0xE0) {
+			if (!igmp_is_member(net::memcpy_ip(p_ip4->ip4.dst))) {
+				return;
+			}
+		}
 		udp_handle(reinterpret_cast<struct t_udp *>(p_ip4));
 		break;
 	case IPv4_PROTO_IGMP:
@@ -83,7 +89,6 @@ __attribute__((hot)) void ip_handle(struct t_ip4 *p_ip4) {
 #if defined (ENABLE_HTTPD)
 	case IPv4_PROTO_TCP:
 		tcp_handle(reinterpret_cast<struct t_tcp *>(p_ip4));
-		tcp_run();
 		break;
 #endif
 	default:
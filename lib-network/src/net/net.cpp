@@ -47,6 +47,8 @@
 #include "net/acd.h"
 #include "net/dhcp.h"
 
+#include "hardware.h"
+
 #include "debug.h"
 
 static struct net::acd::Acd s_acd;
@@ -156,27 +158,77 @@ void __attribute__((cold)) net_init(const net::Link link, ip4_addr_t ipaddr, ip4
 	DEBUG_EXIT
 }
 
+__attribute__((hot)) static void frame_handle(uint8_t *pFrame, const int nLength) {
+	const auto *const eth = reinterpret_cast<struct ether_header *>(pFrame);
+
+#if defined (CONFIG_ENET_ENABLE_PTP)
+	if (eth->type == __builtin_bswap16(ETHER_TYPE_PTP)) {
+		net::ptp_handle(const_cast<const uint8_t *>(pFrame), static_cast<uint32_t>(nLength));
+	} else
+#endif
+		if (eth->type == __builtin_bswap16(ETHER_TYPE_IPv4)) {
+			ip_handle(reinterpret_cast<struct t_ip4 *>(pFrame));
+		} else if (eth->type == __builtin_bswap16(ETHER_TYPE_ARP)) {
+			net::arp_handle(reinterpret_cast<struct t_arp *>(pFrame));
+		} else {
+			DEBUG_PRINTF("type %04x is not implemented", __builtin_bswap16(eth->type));
+		}
+}
+
+/**
+ * A UDP frame for a port with a full receive queue is not handled,
+ * it stays in the Rx descriptor ring until the application has read the queue.
+ */
+static bool is_backpressure(const uint8_t *pFrame) {
+	const auto *const pUdp = reinterpret_cast<const struct t_udp *>(pFrame);
+
+	if ((pUdp->ether.type != __builtin_bswap16(ETHER_TYPE_IPv4)) || (pUdp->ip4.proto != IPv4_PROTO_UDP)) {
+		return false;
+	}
+
+	return udp_is_queue_full(pUdp);
+}
+
+/**
+ * Drains the Rx descriptor ring, a burst (ArtDmx for all universes followed by ArtSync)
+ * is handled before the ring is full.
+ * It returns after NET_RX_MAX_FRAMES frames, when NET_RX_BUDGET_US has elapsed
+ * or when the next frame is for a UDP port with a full receive queue.
+ * The first frame is always handled, a port which is not read does not stall the ring.
+ */
 __attribute__((hot)) void net_handle() {
+#if defined (CONFIG_NET_ENABLE_ZERO_COPY_RX)
+	udp_release_pending();
+#endif
 	uint8_t *s_p;
-	const auto nLength = emac_eth_recv(&s_p);
+	auto nLength = emac_eth_recv(&s_p);
 
 	if (__builtin_expect((nLength > 0), 0)) {
-		const auto *const eth = reinterpret_cast<struct ether_header *>(s_p);
+		const auto nMicrosStart = Hardware::Get()->Micros();
+		uint32_t nFrames = 0;
 
-#if defined (CONFIG_ENET_ENABLE_PTP)
-		if (eth->type == __builtin_bswap16(ETHER_TYPE_PTP)) {
-			net::ptp_handle(const_cast<const uint8_t *>(s_p), nLength);
-		} else
-#endif
-			if (eth->type == __builtin_bswap16(ETHER_TYPE_IPv4)) {
-				ip_handle(reinterpret_cast<struct t_ip4 *>(s_p));
-			} else if (eth->type == __builtin_bswap16(ETHER_TYPE_ARP)) {
-				net::arp_handle(reinterpret_cast<struct t_arp *>(s_p));
-			} else {
-				DEBUG_PRINTF("type %04x is not implemented", __builtin_bswap16(eth->type));
+		do {
+			frame_handle(s_p, nLength);
+			emac_free_pkt();
+
+			if (++nFrames == NET_RX_MAX_FRAMES) {
+				break;
 			}
 
-		emac_free_pkt();
+			if ((Hardware::Get()->Micros() - nMicrosStart) >= NET_RX_BUDGET_US) {
+				break;
+			}
+
+			nLength = emac_eth_recv(&s_p);
+
+			if ((nLength > 0) && is_backpressure(s_p)) {
+				break;
+			}
+		} while (nLength > 0);
 	}
+
+#if defined (ENABLE_HTTPD)
+	tcp_run();
+#endif
 }
 }  // namespace net
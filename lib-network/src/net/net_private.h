@@ -55,8 +55,16 @@ void emac_eth_send(void *, uint32_t);
 #if defined CONFIG_ENET_ENABLE_PTP
 void emac_eth_send_timestamp(void *, uint32_t);
 #endif
+uint32_t emac_eth_send_available();
+uint8_t *emac_alloc_pkt();
+void emac_send_pkt(const uint32_t);
 int emac_eth_recv(uint8_t **);
 void emac_free_pkt();
+void emac_multicast_filter_set(const uint8_t *, const uint32_t);
+#if defined (CONFIG_NET_ENABLE_ZERO_COPY_RX)
+int32_t emac_lend_pkt();
+void emac_release_pkt(const int32_t);
+#endif
 
 namespace net {
 void net_handle();
@@ -72,11 +80,16 @@ void ip_handle(struct t_ip4 *);
 void udp_init();
 void udp_set_ip();
 void udp_handle(struct t_udp *);
+bool udp_is_queue_full(const struct t_udp *);
 void udp_shutdown();
+#if defined (CONFIG_NET_ENABLE_ZERO_COPY_RX)
+void udp_release_pending();
+#endif
 
 void igmp_init();
 void igmp_set_ip();
 void igmp_handle(struct t_igmp *);
+bool igmp_is_member(const uint32_t);
 void igmp_shutdown();
 
 void icmp_handle(struct t_icmp *);
@@ -61,10 +61,23 @@
 
 namespace net {
 #define TCP_RX_MSS						(TCP_DATA_SIZE)
-#define TCP_RX_MAX_ENTRIES				(1U << 1) // Must always be a power of 2
+#define TCP_RX_MAX_ENTRIES				(TCP_RX_QUEUE_ENTRIES) // Must always be a power of 2
 #define TCP_RX_MAX_ENTRIES_MASK			(TCP_RX_MAX_ENTRIES - 1)
 #define TCP_MAX_RX_WND 					(TCP_RX_MAX_ENTRIES * TCP_RX_MSS);
 #define TCP_TX_MSS						(TCP_DATA_SIZE)
+#define TCP_TX_QUEUE_MASK				(TCP_TX_QUEUE_SIZE - 1)
+
+static_assert((TCP_RX_MAX_ENTRIES * TCP_RX_MSS) <= UINT16_MAX, "The receive window is 16-bit");
+
+/**
+ * RFC 6298 Computing TCP's Retransmission Timer
+ * The minimum is lower than the 1 second of the RFC, as on a LAN the round-trip time is well below that.
+ */
+static constexpr uint32_t TCP_RTO_INITIAL = 1000;	///< Milliseconds
+static constexpr uint32_t TCP_RTO_MIN = 200;		///< Milliseconds
+static constexpr uint32_t TCP_RTO_MAX = 60000;		///< Milliseconds
+static constexpr uint32_t TCP_MAX_RETRANSMITS = 8;	///< Then the connection is reset
+static constexpr uint32_t TCP_DUP_ACK_THRESHOLD = 3;
 
 /**
  * Transmission control block (TCB)
@@ -89,6 +102,7 @@ struct tcb {
 	} SND;
 
 	uint32_t ISS;		/* initial send sequence number */
+	uint32_t MAX;		/* highest sequence number sent, SND.NXT goes back on a retransmission timeout */
 
 	struct {
 		uint32_t Recent; /* holds a timestamp to be echoed in TSecr whenever a segment is sent */
@@ -101,6 +115,30 @@ struct tcb {
 		uint16_t size;
 	} TX;
 
+	/* Send queue, the data from SND.UNA onwards. Sent and not acknowledged, followed by not yet sent. */
+	struct {
+		uint8_t *pBuffer;
+		uint32_t nStart;	/* offset of SND.UNA in pBuffer */
+		uint32_t nLength;	/* bytes queued */
+		bool bFinSent;
+	} TXQ;
+
+	/* Retransmission timer */
+	struct {
+		uint32_t nSRTT;		/* smoothed round-trip time << 3, milliseconds */
+		uint32_t nRTTVAR;	/* round-trip time variation << 2, milliseconds */
+		uint32_t nRTO;		/* milliseconds */
+		uint32_t nStart;	/* timer started, milliseconds */
+		uint32_t nRttSeq;	/* the segment being timed, Karn's algorithm */
+		uint32_t nRttStart;
+		uint32_t nRecover;	/* SND.NXT at the fast retransmit */
+		uint8_t nRetransmits;
+		uint8_t nDupAcks;
+		bool bRunning;
+		bool bRttTiming;
+		bool bRecovery;
+	} RTX;
+
 	/* Receive Sequence Variables */
 	struct {
 		uint32_t NXT; 	/* receive next */
@@ -126,7 +164,7 @@ struct QueueEntry {
 };
 
 struct ReceiveQueue {
-	uint16_t nHead;
+	uint16_t nHead;	/* free running, the entry index is masked */
 	uint16_t nTail;
 	QueueEntry Entries[TCP_RX_MAX_ENTRIES];
 };
@@ -140,6 +178,10 @@ struct Port {
 static struct Port s_Port[TCP_MAX_PORTS_ALLOWED] SECTION_NETWORK ALIGNED;
 static uint16_t s_id SECTION_NETWORK ALIGNED;
 static struct t_tcp s_tcp SECTION_NETWORK ALIGNED;
+/* The send queues are copied into the Tx frames by the CPU, they are not in TCMSRAM (.network) */
+static uint8_t s_TxQueue[TCP_MAX_PORTS_ALLOWED][TCP_MAX_TCBS_ALLOWED][TCP_TX_QUEUE_SIZE] ALIGNED;
+static uint32_t s_nMillisPrevious;
+static struct tcp::Statistics s_Statistics;
 
 #if !defined (NDEBUG)
 static const char *s_aStateName[] = {
@@ -307,6 +349,8 @@ static void _bswap32(struct t_tcp *p_tcp) {
 }
 
 static void _init_tcb(struct tcb *pTcb, const uint16_t nLocalPort) {
+	auto *pBuffer = pTcb->TXQ.pBuffer;
+
 	memset(pTcb, 0, sizeof(struct tcb));
 
 	pTcb->nLocalPort = nLocalPort;
@@ -318,6 +362,10 @@ static void _init_tcb(struct tcb *pTcb, const uint16_t nLocalPort) {
 	pTcb->SND.UNA = pTcb->ISS;
 	pTcb->SND.NXT = pTcb->ISS;
 	pTcb->SND.WL2 = pTcb->ISS;
+	pTcb->MAX = pTcb->ISS;
+
+	pTcb->TXQ.pBuffer = pBuffer;
+	pTcb->RTX.nRTO = TCP_RTO_INITIAL;
 
 	NEW_STATE(pTcb, STATE_LISTEN);
 }
@@ -489,6 +537,273 @@ static void send_reset(struct t_tcp *pTcp, const struct tcb *pTcb) {
 	DEBUG_EXIT
 }
 
+/**
+ * Sends data from the send queue, starting at sequence number nSeq
+ * A segment does not wrap around the end of the queue.
+ * @return the number of bytes sent
+ */
+static uint32_t send_data(struct tcb *pTCB, const uint32_t nSeq, uint32_t nLength, const bool isPush) {
+	const auto nOffset = (pTCB->TXQ.nStart + (nSeq - pTCB->SND.UNA)) & TCP_TX_QUEUE_MASK;
+	nLength = std::min(nLength, static_cast<uint32_t>(TCP_TX_QUEUE_SIZE) - nOffset);
+
+	pTCB->TX.data = &pTCB->TXQ.pBuffer[nOffset];
+	pTCB->TX.size = static_cast<uint16_t>(nLength);
+
+	struct SendInfo info;
+	info.SEQ = nSeq;
+	info.ACK = pTCB->RCV.NXT;
+	info.CTL = Control::ACK;
+	if (isPush) {
+		info.CTL |= Control::PSH;
+	}
+
+	send_package(pTCB, info);
+
+	pTCB->TX.data = nullptr;
+	pTCB->TX.size = 0;
+
+	return nLength;
+}
+
+static uint32_t get_send_mss(const struct tcb *pTCB) {
+	return (pTCB->SendMSS != 0) ? pTCB->SendMSS : static_cast<uint32_t>(TCP_TX_MSS);
+}
+
+/**
+ * Sends the first unacknowledged segment again
+ */
+static void retransmit_first(struct tcb *pTCB) {
+	const auto nLength = std::min(pTCB->SND.NXT - pTCB->SND.UNA, pTCB->TXQ.nLength);
+
+	if (nLength != 0) {
+		send_data(pTCB, pTCB->SND.UNA, std::min(nLength, get_send_mss(pTCB)), false);
+	}
+}
+
+static void timer_restart(struct tcb *pTCB) {
+	pTCB->RTX.nStart = Hardware::Get()->Millis();
+	pTCB->RTX.bRunning = true;
+}
+
+/**
+ * RFC 6298 2. The Basic Algorithm
+ * SRTT is scaled by 8 and RTTVAR by 4, the clock granularity G is 1 millisecond.
+ */
+static void rtt_update(struct tcb *pTCB, const uint32_t nRtt) {
+	auto& rtx = pTCB->RTX;
+
+	if ((rtx.nSRTT == 0) && (rtx.nRTTVAR == 0)) {
+		// SRTT <- R, RTTVAR <- R/2
+		rtx.nSRTT = nRtt << 3;
+		rtx.nRTTVAR = nRtt << 1;
+	} else {
+		// RTTVAR <- (1 - beta) * RTTVAR + beta * |SRTT - R'|, beta = 1/4
+		// SRTT <- (1 - alpha) * SRTT + alpha * R', alpha = 1/8
+		const auto nSRTT = rtx.nSRTT >> 3;
+		const auto nDelta = (nSRTT > nRtt) ? nSRTT - nRtt : nRtt - nSRTT;
+		rtx.nRTTVAR = rtx.nRTTVAR - (rtx.nRTTVAR >> 2) + nDelta;
+		rtx.nSRTT = rtx.nSRTT - (rtx.nSRTT >> 3) + nRtt;
+	}
+
+	// RTO <- SRTT + max (G, K*RTTVAR), K = 4
+	rtx.nRTO = std::min(std::max((rtx.nSRTT >> 3) + std::max(1U, rtx.nRTTVAR), TCP_RTO_MIN), TCP_RTO_MAX);
+
+	s_Statistics.nRttMillis = rtx.nSRTT >> 3;
+}
+
+/**
+ * SND.UNA < SEG.ACK =< SND.MAX
+ */
+static void ack_received(struct tcb *pTCB, const uint32_t SEG_ACK) {
+	auto& txq = pTCB->TXQ;
+	auto& rtx = pTCB->RTX;
+
+	const auto nAcked = SEG_ACK - pTCB->SND.UNA;
+	const auto nData = std::min(nAcked, txq.nLength);
+
+	txq.nStart = (txq.nStart + nData) & TCP_TX_QUEUE_MASK;
+	txq.nLength -= nData;
+
+	if ((nAcked > nData) && (pTCB->state == STATE_LAST_ACK)) {
+		txq.bFinSent = true;	// the FIN is acknowledged
+	}
+
+	pTCB->SND.UNA = SEG_ACK;
+
+	// Data sent before a retransmission timeout has arrived
+	if (SEQ_GT(SEG_ACK, pTCB->SND.NXT)) {
+		pTCB->SND.NXT = SEG_ACK;
+	}
+
+	if (rtx.bRttTiming && SEQ_LT(rtx.nRttSeq, SEG_ACK)) {
+		rtx.bRttTiming = false;
+		rtt_update(pTCB, Hardware::Get()->Millis() - rtx.nRttStart);
+	}
+
+	rtx.nRetransmits = 0;
+	rtx.nDupAcks = 0;
+
+	// RFC 6582 NewReno, a partial acknowledgment: the next segment is lost as well
+	if (rtx.bRecovery) {
+		if (SEQ_LT(SEG_ACK, rtx.nRecover)) {
+			retransmit_first(pTCB);
+		} else {
+			rtx.bRecovery = false;
+		}
+	}
+
+	if (pTCB->SND.UNA == pTCB->MAX) {
+		rtx.bRunning = false;
+	} else {
+		timer_restart(pTCB);
+	}
+}
+
+/**
+ * Sends the queued data as far as the window of the peer allows.
+ * When the peer has closed and all data is sent, the FIN follows.
+ * @param isProbe send 1 byte into a zero window
+ */
+static void tcp_output(struct tcb *pTCB, const bool isProbe = false) {
+	if ((pTCB->state != STATE_ESTABLISHED) && (pTCB->state != STATE_CLOSE_WAIT) && (pTCB->state != STATE_LAST_ACK)) {
+		return;
+	}
+
+	auto& txq = pTCB->TXQ;
+
+	if (txq.bFinSent) {
+		return;
+	}
+
+	const auto nMSS = get_send_mss(pTCB);
+
+	for (;;) {
+		const auto nInFlight = pTCB->SND.NXT - pTCB->SND.UNA;
+		const auto nUnsent = txq.nLength - nInFlight;
+
+		if (nUnsent == 0) {
+			break;
+		}
+
+		auto nWindow = (pTCB->SND.WND > nInFlight) ? pTCB->SND.WND - nInFlight : 0;
+
+		if (nWindow == 0) {
+			if (!isProbe || (nInFlight != 0)) {
+				break;
+			}
+			nWindow = 1;
+			s_Statistics.nZeroWindowProbes++;
+		}
+
+		auto& rtx = pTCB->RTX;
+
+		// Karn's algorithm, only time new data
+		if (!rtx.bRttTiming && (pTCB->SND.NXT == pTCB->MAX)) {
+			rtx.nRttSeq = pTCB->SND.NXT;
+			rtx.nRttStart = Hardware::Get()->Millis();
+			rtx.bRttTiming = true;
+		}
+
+		const auto nLength = std::min(std::min(nUnsent, nMSS), nWindow);
+
+		pTCB->SND.NXT += send_data(pTCB, pTCB->SND.NXT, nLength, nLength == nUnsent);
+
+		if (SEQ_GT(pTCB->SND.NXT, pTCB->MAX)) {
+			pTCB->MAX = pTCB->SND.NXT;
+		}
+
+		if (!rtx.bRunning) {
+			timer_restart(pTCB);
+		}
+
+		if (isProbe) {
+			return;
+		}
+	}
+
+	if (((pTCB->state == STATE_CLOSE_WAIT) || (pTCB->state == STATE_LAST_ACK)) && ((pTCB->SND.NXT - pTCB->SND.UNA) == txq.nLength)) {
+		struct SendInfo info;
+		info.SEQ = pTCB->SND.NXT;
+		info.ACK = pTCB->RCV.NXT;
+		info.CTL = Control::FIN | Control::ACK;
+
+		send_package(pTCB, info);
+
+		pTCB->SND.NXT++;
+
+		if (SEQ_GT(pTCB->SND.NXT, pTCB->MAX)) {
+			pTCB->MAX = pTCB->SND.NXT;
+		}
+
+		txq.bFinSent = true;
+
+		if (!pTCB->RTX.bRunning) {
+			timer_restart(pTCB);
+		}
+
+		if (pTCB->state == STATE_CLOSE_WAIT) {
+			NEW_STATE(pTCB, STATE_LAST_ACK);
+		}
+	}
+}
+
+/**
+ * RFC 6298 5. Managing the RTO Timer
+ */
+static void timer_expired(struct tcb *pTCB) {
+	auto& rtx = pTCB->RTX;
+
+	if (++rtx.nRetransmits > TCP_MAX_RETRANSMITS) {
+		struct SendInfo info;
+		info.SEQ = pTCB->SND.NXT;
+		info.ACK = pTCB->RCV.NXT;
+		info.CTL = Control::RST | Control::ACK;
+
+		send_package(pTCB, info);
+
+		s_Statistics.nAborts++;
+		_init_tcb(pTCB, pTCB->nLocalPort);
+		return;
+	}
+
+	// Back off the timer
+	rtx.nRTO = std::min(rtx.nRTO << 1, TCP_RTO_MAX);
+	rtx.bRttTiming = false;
+	rtx.bRecovery = false;
+	rtx.nDupAcks = 0;
+
+	timer_restart(pTCB);
+
+	if (pTCB->state == STATE_SYN_RECEIVED) {
+		struct SendInfo info;
+		info.SEQ = pTCB->ISS;
+		info.ACK = pTCB->RCV.NXT;
+		info.CTL = Control::SYN | Control::ACK;
+
+		send_package(pTCB, info);
+		s_Statistics.nRetransmits++;
+		return;
+	}
+
+	// Persist timer, the peer has closed its window
+	if (pTCB->SND.UNA == pTCB->MAX) {
+		tcp_output(pTCB, true);
+		return;
+	}
+
+	s_Statistics.nRetransmits++;
+
+	// Go back N, the FIN is sent again after the data
+	if (SEQ_LT(pTCB->SND.UNA, pTCB->MAX)) {
+		pTCB->TXQ.bFinSent = false;
+	}
+
+	pTCB->SND.NXT = pTCB->SND.UNA;
+
+	// With a closed window the probe is sent again
+	tcp_output(pTCB, pTCB->SND.WND == 0);
+}
+
 struct Options {
 	uint8_t nKind;
 	uint8_t nLength;
@@ -548,20 +863,38 @@ static void scan_options(struct t_tcp *pTcp, struct tcb *pTcb, const int32_t nDa
 	}
 }
 
+/**
+ * Called from net_handle, runs once per millisecond
+ */
 __attribute__((hot)) void tcp_run() {
+	const auto nMillis = Hardware::Get()->Millis();
+
+	if (__builtin_expect((nMillis == s_nMillisPrevious), 1)) {
+		return;
+	}
+
+	s_nMillisPrevious = nMillis;
+
 	for (auto& port : s_Port) {
 		for (auto& tcb : port.TCB) {
-			if (tcb.state == STATE_CLOSE_WAIT) {
-				SendInfo info;
-				info.SEQ = tcb.SND.NXT;
-				info.ACK = tcb.RCV.NXT;
-				info.CTL = Control::FIN | Control::ACK;
+			if ((tcb.state == STATE_LISTEN) || (tcb.state == STATE_CLOSED)) {
+				continue;
+			}
 
-				send_package(&tcb, info);
+			if (tcb.state == STATE_CLOSE_WAIT) {
+				tcp_output(&tcb);
+			}
 
-				NEW_STATE(&tcb, STATE_LAST_ACK);
+			if (!tcb.RTX.bRunning) {
+				// Zero window, start the persist timer
+				if ((tcb.SND.UNA == tcb.MAX) && (tcb.TXQ.nLength != 0)) {
+					timer_restart(&tcb);
+				}
+				continue;
+			}
 
-				tcb.SND.NXT++;
+			if ((nMillis - tcb.RTX.nStart) >= tcb.RTX.nRTO) {
+				timer_expired(&tcb);
 			}
 		}
 	}
@@ -740,6 +1073,12 @@ __attribute__((hot)) void tcp_handle(struct t_tcp *pTcp) {
 			// SND.NXT is set to ISS+1 and SND.UNA to ISS. The connection state should be changed to SYN-RECEIVED.
 			pTCB->SND.NXT = pTCB->ISS + 1;
 			pTCB->SND.UNA = pTCB->ISS;
+			pTCB->MAX = pTCB->SND.NXT;
+
+			pTCB->RTX.nRttSeq = pTCB->ISS;
+			pTCB->RTX.nRttStart = Hardware::Get()->Millis();
+			pTCB->RTX.bRttTiming = true;
+			timer_restart(pTCB);
 
 			NEW_STATE(pTCB, STATE_SYN_RECEIVED);
 			DEBUG_EXIT
@@ -878,7 +1217,7 @@ __attribute__((hot)) void tcp_handle(struct t_tcp *pTcp) {
 				pTCB->SND.WL1 = SEG_SEQ;
 				pTCB->SND.WL2 = SEG_ACK;
 
-				pTCB->SND.UNA = SEG_ACK;		// got ACK for SYN
+				ack_received(pTCB, SEG_ACK);	// got ACK for SYN
 
 				NEW_STATE(pTCB, STATE_ESTABLISHED);
 				return;
@@ -896,32 +1235,25 @@ __attribute__((hot)) void tcp_handle(struct t_tcp *pTcp) {
 		case STATE_CLOSING:
 			DEBUG_PRINTF("SND.UNA=%u, SEG_ACK=%u, SND.NXT=%u", pTCB->SND.UNA, SEG_ACK, pTCB->SND.NXT);
 
-			if (SEQ_BETWEEN_H(pTCB->SND.UNA, SEG_ACK, pTCB->SND.NXT)) {
-
-				auto nBytesAck = SEG_ACK - pTCB->SND.UNA;
-				pTCB->SND.UNA = SEG_ACK;
+			if (SEQ_BETWEEN_H(pTCB->SND.UNA, SEG_ACK, pTCB->MAX)) {
+				ack_received(pTCB, SEG_ACK);
 
 				if (SEG_ACK == pTCB->SND.NXT) {
 					DEBUG_PUTS("/* all segments are acknowledged */");
 				}
 
-				if (pTCB->state == STATE_FIN_WAIT_1 || pTCB->state == STATE_CLOSING) {
-					nBytesAck--;
-					DEBUG_PUTS("/* acknowledged FIN does not count */");
-				}
-
-				if (pTCB->state == STATE_ESTABLISHED && nBytesAck == 1) {
-					nBytesAck--;
-				}
-
 				// update send window
 				if ( SEQ_LT(pTCB->SND.WL1, SEG_SEQ) || (pTCB->SND.WL1 == SEG_SEQ && SEQ_LEQ(pTCB->SND.WL2, SEG_ACK))) {
 					pTCB->SND.WND = SEG_WND;
 					pTCB->SND.WL1 = SEG_SEQ;
 					pTCB->SND.WL2 = SEG_ACK;
 				}
+
+				tcp_output(pTCB);
 			} else if (SEQ_LEQ(SEG_ACK, pTCB->SND.UNA)) { /* RFC 1122 section 4.2.2.20 (g) */
 				DEBUG_PUTS("/* ignore duplicate ACK */");
+				const auto nWindowPrevious = pTCB->SND.WND;
+
 				if (SEQ_BETWEEN_LH(pTCB->SND.UNA, SEG_ACK, pTCB->SND.NXT)) {
 					// ... but update send window
 					if ( SEQ_LT(pTCB->SND.WL1, SEG_SEQ) || (pTCB->SND.WL1 == SEG_SEQ && SEQ_LEQ(pTCB->SND.WL2, SEG_ACK))) {
@@ -930,7 +1262,31 @@ __attribute__((hot)) void tcp_handle(struct t_tcp *pTcp) {
 						pTCB->SND.WL2 = SEG_ACK;
 					}
 				}
-			} else if (SEQ_GT(SEG_ACK, pTCB->SND.NXT)) {
+
+				// RFC 1122 4.2.2.17 the peer answers the probe, keep the connection open while its window is closed
+				if (pTCB->SND.WND == 0) {
+					pTCB->RTX.nRetransmits = 0;
+				}
+
+				// RFC 5681 3.2. Fast Retransmit
+				if ((SEG_ACK == pTCB->SND.UNA) && (SEG_LEN == 0) && (pTCB->SND.UNA != pTCB->SND.NXT) && (pTCB->SND.WND != 0) && (pTCB->SND.WND == nWindowPrevious)) {
+					// RFC 5827 Early Retransmit, with less than 4 segments outstanding
+					const auto nMSS = get_send_mss(pTCB);
+					const auto nSegments = (pTCB->SND.NXT - pTCB->SND.UNA + nMSS - 1) / nMSS;
+					const auto nThreshold = std::max(std::min(nSegments - 1, TCP_DUP_ACK_THRESHOLD), 1U);
+
+					if (!pTCB->RTX.bRecovery && (++pTCB->RTX.nDupAcks == nThreshold)) {
+						retransmit_first(pTCB);
+						pTCB->RTX.nRecover = pTCB->SND.NXT;
+						pTCB->RTX.bRecovery = true;
+						pTCB->RTX.bRttTiming = false;
+						timer_restart(pTCB);
+						s_Statistics.nFastRetransmits++;
+					}
+				}
+
+				tcp_output(pTCB);
+			} else if (SEQ_GT(SEG_ACK, pTCB->MAX)) {
 				DEBUG_PRINTF("SEG_ACK=%u, SND.NXT=%u", SEG_ACK,pTCB->SND.NXT);
 
 				sendInfo.SEQ = pTCB->SND.NXT;
@@ -942,8 +1298,14 @@ __attribute__((hot)) void tcp_handle(struct t_tcp *pTcp) {
 			}
 			break;
 		case STATE_LAST_ACK:
-			if (SEG_ACK == pTCB->SND.NXT) { 	// if our FIN is now acknowledged
+			if (SEQ_BETWEEN_H(pTCB->SND.UNA, SEG_ACK, pTCB->MAX)) {
+				ack_received(pTCB, SEG_ACK);
+			}
+
+			if (pTCB->TXQ.bFinSent && (SEG_ACK == pTCB->MAX)) { 	// if our FIN is now acknowledged
 				_init_tcb(pTCB, pTCB->nLocalPort);
+			} else {
+				tcp_output(pTCB);
 			}
 			break;
 		case STATE_TIME_WAIT:
@@ -971,7 +1333,16 @@ __attribute__((hot)) void tcp_handle(struct t_tcp *pTcp) {
 			if (nDataLength > 0) {
 				if (SEG_SEQ == pTCB->RCV.NXT) {
 					auto *pQueue = &s_Port[nIndexPort].receiveQueue;
-					auto *pQueueEntry = &pQueue->Entries[pQueue->nHead];
+
+					if (static_cast<uint16_t>(pQueue->nHead - pQueue->nTail) == TCP_RX_MAX_ENTRIES) {
+						// Not acknowledged, the peer will retransmit
+						s_Statistics.nRxQueueFull++;
+						DEBUG_PUTS("Receive queue full");
+						DEBUG_EXIT
+						return;
+					}
+
+					auto *pQueueEntry = &pQueue->Entries[pQueue->nHead & TCP_RX_MAX_ENTRIES_MASK];
 
 					pQueueEntry->nHandleConnection = static_cast<uint16_t>(nIndexTCB);
 					memcpy(pQueueEntry->data, reinterpret_cast<uint8_t *>(&pTcp->tcp) + nDataOffset, nDataLength);
@@ -986,7 +1357,7 @@ __attribute__((hot)) void tcp_handle(struct t_tcp *pTcp) {
 
 					send_package(pTCB, sendInfo);
 
-					pQueue->nHead = (pQueue->nHead + 1) & TCP_RX_MAX_ENTRIES_MASK;
+					pQueue->nHead++;
 				} else {
 					sendInfo.SEQ = pTCB->SND.NXT;
 					sendInfo.ACK = pTCB->RCV.NXT;
@@ -1096,6 +1467,7 @@ int tcp_begin(const uint16_t nLocalPort) {
 
 			for (uint32_t nIndexTCB = 0; nIndexTCB < TCP_MAX_TCBS_ALLOWED; nIndexTCB++) {
 				// create transmission control block's (TCB)
+				s_Port[i].TCB[nIndexTCB].TXQ.pBuffer = s_TxQueue[i][nIndexTCB];
 				_init_tcb(&s_Port[i].TCB[nIndexTCB], nLocalPort);
 			}
 
@@ -1121,71 +1493,87 @@ uint16_t tcp_read(const int32_t nHandleListen, const uint8_t **pData, uint32_t &
 		return 0;
 	}
 
-	const auto nEntry = pQueue->nTail;
-	const auto *const pQueueEntry = &pQueue->Entries[nEntry];
+	const auto *const pQueueEntry = &pQueue->Entries[pQueue->nTail & TCP_RX_MAX_ENTRIES_MASK];
 
 	nHandleConnection = pQueueEntry->nHandleConnection;
 	*pData = pQueueEntry->data;
 
 	auto *pTCB = &s_Port[nHandleListen].TCB[nHandleConnection];
 
+	const auto isWindowClosed = (pTCB->RCV.WND == 0);
+
 	pTCB->RCV.WND += TCP_DATA_SIZE;
 
-	pQueue->nTail = (pQueue->nTail + 1) & TCP_RX_MAX_ENTRIES_MASK;
+	pQueue->nTail++;
+
+	// Window update, the peer is probing a zero window
+	if (isWindowClosed && (pTCB->state == STATE_ESTABLISHED)) {
+		struct SendInfo info;
+		info.SEQ = pTCB->SND.NXT;
+		info.ACK = pTCB->RCV.NXT;
+		info.CTL = Control::ACK;
+
+		send_package(pTCB, info);
+	}
 
 	return pQueueEntry->nSize;
 }
 
-static void _write(struct tcb *pTCB, const uint8_t *pBuffer, const uint32_t nLength, const bool isLastSegment) {
-	assert(nLength != 0);
-	assert(nLength <= static_cast<uint32_t>(TCP_DATA_SIZE));
+/**
+ * The data is queued and sent as far as the window of the peer allows.
+ * Unacknowledged data is retransmitted from the queue.
+ * @return the number of bytes queued, less than nLength when the send queue is full
+ */
+uint32_t tcp_write(const int32_t nHandleListen, const uint8_t *pBuffer, uint32_t nLength, uint32_t nHandleConnection) {
+	assert(nHandleListen >= 0);
+	assert(nHandleListen < TCP_MAX_PORTS_ALLOWED);
+	assert(pBuffer != nullptr);
+	assert(nHandleConnection < TCP_MAX_TCBS_ALLOWED);
 
-	DEBUG_PRINTF("nLength=%u, pTCB->SND.WND=%u", nLength, pTCB->SND.WND);
+	auto *pTCB = &s_Port[nHandleListen].TCB[nHandleConnection];
+	assert(pTCB != nullptr);
 
-    if (nLength > pTCB->SND.WND) {
-    	console_error("Retry or queue the data for later transmission\n");
-        // TODO retry or queue the data for later transmission.
-        return;
-    }
+	if ((pTCB->state != STATE_ESTABLISHED) && (pTCB->state != STATE_CLOSE_WAIT)) {
+		DEBUG_PUTS("Not connected");
+		return 0;
+	}
 
-	pTCB->TX.data = const_cast<uint8_t *>(pBuffer);
-	pTCB->TX.size = nLength;
+	auto& txq = pTCB->TXQ;
+	const auto nFree = static_cast<uint32_t>(TCP_TX_QUEUE_SIZE) - txq.nLength;
 
-	struct SendInfo info;
-	info.SEQ = pTCB->SND.NXT;
-	info.ACK = pTCB->RCV.NXT;
-	info.CTL = Control::ACK;
-	if (isLastSegment) {
-		info.CTL |= Control::PSH;
+	if (nLength > nFree) {
+		s_Statistics.nTxQueueFull++;
+		nLength = nFree;
 	}
 
-	send_package(pTCB, info);
+	const auto nOffset = (txq.nStart + txq.nLength) & TCP_TX_QUEUE_MASK;
+	const auto nFirst = std::min(nLength, static_cast<uint32_t>(TCP_TX_QUEUE_SIZE) - nOffset);
 
-	pTCB->TX.data = nullptr;
-	pTCB->TX.size = 0;
+	memcpy(&txq.pBuffer[nOffset], pBuffer, nFirst);
+	memcpy(txq.pBuffer, &pBuffer[nFirst], nLength - nFirst);
 
-    pTCB->SND.NXT += nLength;
-    pTCB->SND.WND -= nLength;
+	txq.nLength += nLength;
+
+	tcp_output(pTCB);
+
+	return nLength;
 }
 
-void tcp_write(const int32_t nHandleListen, const uint8_t *pBuffer, uint32_t nLength, uint32_t nHandleConnection) {
+/**
+ * @return true when tcp_write can queue data for the connection
+ */
+bool tcp_is_connected(const int32_t nHandleListen, const uint32_t nHandleConnection) {
 	assert(nHandleListen >= 0);
 	assert(nHandleListen < TCP_MAX_PORTS_ALLOWED);
-	assert(pBuffer != nullptr);
 	assert(nHandleConnection < TCP_MAX_TCBS_ALLOWED);
 
-	auto *pTCB = &s_Port[nHandleListen].TCB[nHandleConnection];
-	assert(pTCB != nullptr);
+	const auto state = s_Port[nHandleListen].TCB[nHandleConnection].state;
 
-	const auto *p = pBuffer;
+	return (state == STATE_ESTABLISHED) || (state == STATE_CLOSE_WAIT);
+}
 
-	while (nLength > 0) {
-		const auto nWriteLength = (nLength > TCP_DATA_SIZE) ? TCP_DATA_SIZE : nLength;
-		const bool isLastSegment = (nLength < TCP_DATA_SIZE);
-		_write(pTCB, p, nWriteLength, isLastSegment);
-		p += nWriteLength;
-		nLength -= nWriteLength;
-	}
+void tcp_get_statistics(net::tcp::Statistics& statistics) {
+	memcpy(&statistics, &s_Statistics, sizeof(struct tcp::Statistics));
 }
 }  // namespace net
 // <---
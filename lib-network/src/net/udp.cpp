@@ -57,17 +57,89 @@ struct data_entry {
 	uint32_t from_ip;
 	uint32_t size;
 	uint16_t from_port;
+#if defined (CONFIG_NET_ENABLE_ZERO_COPY_RX)
+	int16_t nDescriptor;	///< Lent Rx descriptor, or -1 - index in s_CopyBuffers
+	const uint8_t *data;	///< Points into the lent Rx DMA buffer or into the copy buffer
+#else
 	uint8_t data[UDP_DATA_SIZE];
+#endif
+} ALIGNED;
+
+struct data_queue {
+	struct data_entry entries[UDP_RX_QUEUE_ENTRIES];
+	uint32_t nHead;
+	uint32_t nTail;
+	uint32_t nCount;
+#if defined (CONFIG_NET_ENABLE_ZERO_COPY_RX)
+	uint32_t nLent;		///< Entries with a lent Rx descriptor
+#endif
 } ALIGNED;
 
 static uint16_t s_Port[UDP_MAX_PORTS_ALLOWED] SECTION_NETWORK ALIGNED;
-static struct data_entry s_data[UDP_MAX_PORTS_ALLOWED] SECTION_NETWORK ALIGNED;
+static struct data_queue s_data[UDP_MAX_PORTS_ALLOWED] SECTION_NETWORK ALIGNED;
+static struct udp::Statistics s_Statistics[UDP_MAX_PORTS_ALLOWED] SECTION_NETWORK ALIGNED;
 static struct t_udp s_send_packet SECTION_NETWORK ALIGNED;
 static uint16_t s_id SECTION_NETWORK ALIGNED;
 static uint8_t s_multicast_mac[ETH_ADDR_LEN] SECTION_NETWORK ALIGNED;
+#if defined (CONFIG_NET_ENABLE_ZERO_COPY_RX)
+/*
+ * A port lends up to UDP_RX_LEND_MAX Rx descriptors, a lent descriptor stalls the DMA when it gets there.
+ * The other frames, or when the EMAC has no descriptor to lend, are copied in a copy buffer.
+ */
+struct copy_buffer {
+	uint8_t data[UDP_DATA_SIZE];
+} ALIGNED;
+
+static struct copy_buffer s_CopyBuffers[UDP_RX_COPY_BUFFERS] SECTION_NETWORK ALIGNED;
+static uint32_t s_nCopyFree SECTION_NETWORK ALIGNED;			///< A free copy buffer has its bit set
+static uint32_t s_nReleaseMask SECTION_NETWORK ALIGNED;		///< Rx descriptors returned by udp_recv2
+static uint32_t s_nCopyReleaseMask SECTION_NETWORK ALIGNED;	///< Copy buffers returned by udp_recv2
+#endif
+
+/*
+ * Transmit header templates, one for each (local port, destination, destination port).
+ * The Ethernet, IPv4 and UDP headers are copied in front of the payload in the Tx DMA buffer,
+ * only the lengths, the identification and the IPv4 header checksum are patched.
+ */
+
+struct udp_headers {
+	struct ether_header ether;
+	struct ip4_header ip4;
+	uint16_t source_port;
+	uint16_t destination_port;
+	uint16_t len;
+	uint16_t checksum;
+} PACKED;
+
+static_assert(sizeof(struct udp_headers) == UDP_PACKET_HEADERS_SIZE, "");
+
+struct tx_template {
+	uint32_t nRemoteIp;
+	uint16_t nLocalPort;
+	uint16_t nRemotePort;
+	uint16_t nChecksum;		///< One's complement sum of the IPv4 header, without the length and identification
+	bool isUnicast;			///< The destination MAC address is resolved for each packet
+	struct udp_headers headers;
+} ALIGNED;
+
+struct tx_buffer {
+	struct tx_template *pTemplate;	///< nullptr, the payload is in s_send_packet
+	uint8_t *pBuffer;
+	int nIndex;
+	uint32_t nRemoteIp;
+	uint16_t nRemotePort;
+};
+
+static struct tx_template s_Templates[UDP_TX_TEMPLATES] SECTION_NETWORK ALIGNED;
+static uint32_t s_nTemplates SECTION_NETWORK ALIGNED;
+static uint32_t s_nTemplateNext SECTION_NETWORK ALIGNED;
+static struct tx_buffer s_TxBuffer SECTION_NETWORK ALIGNED;
 
 void udp_set_ip() {
 	net::memcpy_ip(s_send_packet.ip4.src, net::globals::netif_default.ip.addr);
+	// The source address and the broadcast mask are in the templates
+	s_nTemplates = 0;
+	s_nTemplateNext = 0;
 }
 
 void __attribute__((cold)) udp_init() {
@@ -87,8 +159,57 @@ void __attribute__((cold)) udp_init() {
 	udp_set_ip();
 	// UDP
 	s_send_packet.udp.checksum = 0;
+#if defined (CONFIG_NET_ENABLE_ZERO_COPY_RX)
+	s_nCopyFree = 0xFFFFFFFF >> (32 - UDP_RX_COPY_BUFFERS);
+#endif
+}
+
+static constexpr uint32_t queue_next(const uint32_t nIndex) {
+	return (nIndex + 1) == UDP_RX_QUEUE_ENTRIES ? 0 : nIndex + 1;
 }
 
+#if defined (CONFIG_NET_ENABLE_ZERO_COPY_RX)
+static void entry_release(const struct data_entry& entry) {
+	if (entry.nDescriptor >= 0) {
+		emac_release_pkt(entry.nDescriptor);
+	} else {
+		s_nCopyFree |= (1U << (-1 - entry.nDescriptor));
+	}
+}
+#endif
+
+static void queue_reset(const uint32_t nPortIndex) {
+	auto &queue = s_data[nPortIndex];
+#if defined (CONFIG_NET_ENABLE_ZERO_COPY_RX)
+	while (queue.nCount != 0) {
+		entry_release(queue.entries[queue.nTail]);
+		queue.nTail = queue_next(queue.nTail);
+		queue.nCount--;
+	}
+
+	queue.nLent = 0;
+#endif
+	queue.nHead = 0;
+	queue.nTail = 0;
+	queue.nCount = 0;
+}
+
+#if defined (CONFIG_NET_ENABLE_ZERO_COPY_RX)
+/**
+ * The buffers returned by udp_recv2 are valid until the next net_handle()
+ */
+void udp_release_pending() {
+	while (s_nReleaseMask != 0) {
+		const auto nDescriptor = __builtin_ctz(s_nReleaseMask);
+		s_nReleaseMask &= ~(1U << nDescriptor);
+		emac_release_pkt(nDescriptor);
+	}
+
+	s_nCopyFree |= s_nCopyReleaseMask;
+	s_nCopyReleaseMask = 0;
+}
+#endif
+
 void __attribute__((cold)) udp_shutdown() {
 	DEBUG_ENTRY
 
@@ -100,20 +221,56 @@ __attribute__((hot)) void udp_handle(struct t_udp *pUdp) {
 
 	for (uint32_t nPortIndex = 0; nPortIndex < UDP_MAX_PORTS_ALLOWED; nPortIndex++) {
 		if (s_Port[nPortIndex] == nDestinationPort) {
-			if (__builtin_expect ((s_data[nPortIndex].size != 0), 0)) {
+			auto &queue = s_data[nPortIndex];
+			auto &statistics = s_Statistics[nPortIndex];
+
+			if (__builtin_expect((queue.nCount == UDP_RX_QUEUE_ENTRIES), 0)) {
+				statistics.nDropped++;
 				DEBUG_PRINTF(IPSTR ":%d[%x]", pUdp->ip4.src[0],pUdp->ip4.src[1],pUdp->ip4.src[2],pUdp->ip4.src[3], nDestinationPort, nDestinationPort);
+				return;
 			}
 
-			auto *p_queue_entry = &s_data[nPortIndex];
+			auto *p_queue_entry = &queue.entries[queue.nHead];
 			const auto nDataLength = static_cast<uint16_t>(__builtin_bswap16(pUdp->udp.len) - UDP_HEADER_SIZE);
 			const auto i = std::min(static_cast<uint16_t>(UDP_DATA_SIZE), nDataLength);
 
+#if defined (CONFIG_NET_ENABLE_ZERO_COPY_RX)
+			const auto nDescriptor = (queue.nLent < UDP_RX_LEND_MAX) ? emac_lend_pkt() : -1;
+
+			if (__builtin_expect((nDescriptor >= 0), 1)) {
+				queue.nLent++;
+				p_queue_entry->nDescriptor = static_cast<int16_t>(nDescriptor);
+				p_queue_entry->data = pUdp->udp.data;
+			} else {
+				if (__builtin_expect((s_nCopyFree == 0), 0)) {
+					statistics.nDropped++;
+					return;
+				}
+
+				const auto nBuffer = __builtin_ctz(s_nCopyFree);
+				s_nCopyFree &= ~(1U << nBuffer);
+
+				net::memcpy(s_CopyBuffers[nBuffer].data, pUdp->udp.data, i);
+				p_queue_entry->nDescriptor = static_cast<int16_t>(-1 - nBuffer);
+				p_queue_entry->data = s_CopyBuffers[nBuffer].data;
+			}
+#else
 			net::memcpy(p_queue_entry->data, pUdp->udp.data, i);
+#endif
 
 			p_queue_entry->from_ip = net::memcpy_ip(pUdp->ip4.src);
 			p_queue_entry->from_port = __builtin_bswap16(pUdp->udp.source_port);
 			p_queue_entry->size = static_cast<uint16_t>(i);
 
+			queue.nHead = queue_next(queue.nHead);
+			queue.nCount++;
+
+			statistics.nReceived++;
+
+			if (queue.nCount > statistics.nHighWaterMark) {
+				statistics.nHighWaterMark = queue.nCount;
+			}
+
 			return;
 		}
 	}
@@ -121,12 +278,146 @@ __attribute__((hot)) void udp_handle(struct t_udp *pUdp) {
 	DEBUG_PRINTF(IPSTR ":%d[%x] " MACSTR, pUdp->ip4.src[0],pUdp->ip4.src[1],pUdp->ip4.src[2],pUdp->ip4.src[3], nDestinationPort, nDestinationPort, MAC2STR(pUdp->ether.dst));
 }
 
+/**
+ * A frame for a port with a full queue is left in the Rx descriptor ring by net_handle
+ */
+bool udp_is_queue_full(const struct t_udp *pUdp) {
+	const auto nDestinationPort = __builtin_bswap16(pUdp->udp.destination_port);
+
+	for (uint32_t nPortIndex = 0; nPortIndex < UDP_MAX_PORTS_ALLOWED; nPortIndex++) {
+		if (s_Port[nPortIndex] == nDestinationPort) {
+			return s_data[nPortIndex].nCount == UDP_RX_QUEUE_ENTRIES;
+		}
+	}
+
+	return false;
+}
+
+static void template_build(struct tx_template& t, const uint16_t nLocalPort, const uint32_t nRemoteIp, const uint16_t nRemotePort) {
+	t.nRemoteIp = nRemoteIp;
+	t.nLocalPort = nLocalPort;
+	t.nRemotePort = nRemotePort;
+	t.isUnicast = false;
+
+	auto &headers = t.headers;
+	// Ethernet
+	std::memcpy(headers.ether.src, net::globals::netif_default.hwaddr, ETH_ADDR_LEN);
+	headers.ether.type = __builtin_bswap16(ETHER_TYPE_IPv4);
+	// IPv4
+	headers.ip4.ver_ihl = 0x45;
+	headers.ip4.tos = 0;
+	headers.ip4.len = 0;
+	headers.ip4.id = 0;
+	headers.ip4.flags_froff = __builtin_bswap16(IPv4_FLAG_DF);
+	headers.ip4.ttl = 64;
+	headers.ip4.proto = IPv4_PROTO_UDP;
+	headers.ip4.chksum = 0;
+	net::memcpy_ip(headers.ip4.src, net::globals::netif_default.ip.addr);
+	// UDP
+	headers.source_port = __builtin_bswap16(nLocalPort);
+	headers.destination_port = __builtin_bswap16(nRemotePort);
+	headers.len = 0;
+	headers.checksum = 0;
+
+	if ((nRemoteIp == network::IP4_BROADCAST) || ((nRemoteIp & net::globals::nBroadcastMask) == net::globals::nBroadcastMask)) {
+		memset(headers.ether.dst, 0xFF, ETH_ADDR_LEN);
+	} else if ((nRemoteIp & 0xF0) == 0xE0) { // Multicast, we know the MAC Address
+		std::memcpy(headers.ether.dst, s_multicast_mac, 3);
+		const auto *pIp = reinterpret_cast<const uint8_t *>(&nRemoteIp);
+		headers.ether.dst[3] = pIp[1] & 0x7F;
+		headers.ether.dst[4] = pIp[2];
+		headers.ether.dst[5] = pIp[3];
+	} else {
+		t.isUnicast = true;
+	}
+
+	if (nRemoteIp == network::IP4_BROADCAST) {
+		memset(headers.ip4.dst, 0xFF, IPv4_ADDR_LEN);
+	} else {
+		net::memcpy_ip(headers.ip4.dst, nRemoteIp);
+	}
+
+	t.nChecksum = static_cast<uint16_t>(~net_chksum(&headers.ip4, sizeof(headers.ip4)));
+}
+
+/**
+ * @return nullptr when the destination MAC address is not resolved, the packet is sent with the ARP queue
+ */
+static struct tx_template *template_get(const int nIndex, const uint32_t nRemoteIp, const uint16_t nRemotePort) {
+	const auto nLocalPort = s_Port[nIndex];
+	struct tx_template *pTemplate = nullptr;
+
+	for (uint32_t i = 0; i < s_nTemplates; i++) {
+		auto &t = s_Templates[i];
+
+		if ((t.nRemoteIp == nRemoteIp) && (t.nRemotePort == nRemotePort) && (t.nLocalPort == nLocalPort)) {
+			pTemplate = &t;
+			break;
+		}
+	}
+
+	if (__builtin_expect((pTemplate == nullptr), 0)) {
+		if (s_nTemplates < UDP_TX_TEMPLATES) {
+			pTemplate = &s_Templates[s_nTemplates++];
+		} else {
+			pTemplate = &s_Templates[s_nTemplateNext];
+			s_nTemplateNext = (s_nTemplateNext + 1) == UDP_TX_TEMPLATES ? 0 : s_nTemplateNext + 1;
+		}
+
+		template_build(*pTemplate, nLocalPort, nRemoteIp, nRemotePort);
+	}
+
+	if (pTemplate->isUnicast) {
+		if (!net::arp_resolve(nRemoteIp, pTemplate->headers.ether.dst)) {
+			return nullptr;
+		}
+	}
+
+	return pTemplate;
+}
+
+/**
+ * The headers are copied in front of the payload, the DMA buffer is word aligned
+ */
+static void template_apply(const struct tx_template& t, uint8_t *pBuffer, const uint32_t nSize) {
+	net::memcpy(pBuffer, &t.headers, sizeof(struct udp_headers));
+
+	auto *pHeaders = reinterpret_cast<struct udp_headers *>(pBuffer);
+
+	const auto nLength = __builtin_bswap16(static_cast<uint16_t>(nSize + IPv4_UDP_HEADERS_SIZE));
+	const auto nId = s_id++;
+
+	pHeaders->ip4.len = nLength;
+	pHeaders->ip4.id = nId;
+	pHeaders->len = __builtin_bswap16(static_cast<uint16_t>(nSize + UDP_HEADER_SIZE));
+#if !defined (CHECKSUM_BY_HARDWARE)
+	uint32_t nSum = static_cast<uint32_t>(t.nChecksum) + nLength + nId;
+	nSum = (nSum >> 16) + (nSum & 0xFFFF);
+	nSum += (nSum >> 16);
+	pHeaders->ip4.chksum = static_cast<uint16_t>(~nSum);
+#endif
+}
+
 template<net::arp::EthSend S>
 static void udp_send_implementation(int nIndex, const uint8_t *pData, uint32_t nSize, uint32_t nRemoteIp, uint16_t nRemotePort) {
 	assert(nIndex >= 0);
 	assert(nIndex < UDP_MAX_PORTS_ALLOWED);
 	assert(s_Port[nIndex] != 0);
 
+	if (S == net::arp::EthSend::IS_NORMAL) {
+		auto *pTemplate = template_get(nIndex, nRemoteIp, nRemotePort);
+
+		if (__builtin_expect((pTemplate != nullptr), 1)) {
+			nSize = std::min(static_cast<uint32_t>(UDP_DATA_SIZE), nSize);
+
+			auto *pBuffer = emac_alloc_pkt();
+			template_apply(*pTemplate, pBuffer, nSize);
+			net::memcpy(&pBuffer[UDP_PACKET_HEADERS_SIZE], pData, nSize);
+			emac_send_pkt(nSize + UDP_PACKET_HEADERS_SIZE);
+			return;
+		}
+	}
+
 	//IPv4
 	s_send_packet.ip4.id = s_id++;
 	s_send_packet.ip4.len = __builtin_bswap16(static_cast<uint16_t>(nSize + IPv4_UDP_HEADERS_SIZE));
@@ -139,7 +430,9 @@ static void udp_send_implementation(int nIndex, const uint8_t *pData, uint32_t n
 
 	nSize = std::min(static_cast<uint32_t>(UDP_DATA_SIZE), nSize);
 
-	net::memcpy(s_send_packet.udp.data, pData, nSize);
+	if (pData != s_send_packet.udp.data) {
+		net::memcpy(s_send_packet.udp.data, pData, nSize);
+	}
 
 	if (nRemoteIp == network::IP4_BROADCAST) {
 		memset(s_send_packet.ether.dst, 0xFF, ETH_ADDR_LEN);
@@ -202,6 +495,8 @@ int udp_begin(uint16_t nLocalPort) {
 
 		if (s_Port[i] == 0) {
 			s_Port[i] = nLocalPort;
+			queue_reset(static_cast<uint32_t>(i));
+			memset(&s_Statistics[i], 0, sizeof(s_Statistics[i]));
 
 			DEBUG_PRINTF("i=%d, local_port=%d[%x]", i, nLocalPort, nLocalPort);
 			return i;
@@ -220,7 +515,7 @@ int udp_end(uint16_t nLocalPort) {
 	for (auto i = 0; i < UDP_MAX_PORTS_ALLOWED; i++) {
 		if (s_Port[i] == nLocalPort) {
 			s_Port[i] = 0;
-			s_data[i].size = 0;
+			queue_reset(static_cast<uint32_t>(i));
 			return 0;
 		}
 	}
@@ -233,11 +528,13 @@ uint32_t udp_recv1(int nIndex, uint8_t *pData, uint32_t nSize, uint32_t *pFromIp
 	assert(nIndex >= 0);
 	assert(nIndex < UDP_MAX_PORTS_ALLOWED);
 
-	if (__builtin_expect((s_data[nIndex].size == 0), 1)) {
+	auto &queue = s_data[nIndex];
+
+	if (__builtin_expect((queue.nCount == 0), 1)) {
 		return 0;
 	}
 
-	auto *p_data = &s_data[nIndex];
+	const auto *p_data = &queue.entries[queue.nTail];
 	const auto i = std::min(nSize, p_data->size);
 
 	net::memcpy(pData, p_data->data, i);
@@ -245,36 +542,114 @@ uint32_t udp_recv1(int nIndex, uint8_t *pData, uint32_t nSize, uint32_t *pFromIp
 	*pFromIp = p_data->from_ip;
 	*FromPort = p_data->from_port;
 
-	p_data->size = 0;
+#if defined (CONFIG_NET_ENABLE_ZERO_COPY_RX)
+	if (p_data->nDescriptor >= 0) {
+		queue.nLent--;
+	}
+
+	entry_release(*p_data);
+#endif
+
+	queue.nTail = queue_next(queue.nTail);
+	queue.nCount--;
 
 	return i;
 }
 
+/**
+ * The returned buffer is valid until the next call to net::net_handle()
+ */
 uint32_t udp_recv2(int nIndex, const uint8_t **pData, uint32_t *pFromIp, uint16_t *pFromPort) {
 	assert(nIndex >= 0);
 	assert(nIndex < UDP_MAX_PORTS_ALLOWED);
 
-	auto &p_data = s_data[nIndex];
+	auto &queue = s_data[nIndex];
 
-	if (__builtin_expect((p_data.size == 0), 1)) {
+	if (__builtin_expect((queue.nCount == 0), 1)) {
 		return 0;
 	}
 
+	const auto &p_data = queue.entries[queue.nTail];
+
 	*pData = p_data.data;
 	*pFromIp = p_data.from_ip;
 	*pFromPort = p_data.from_port;
 
-	const auto nSize = p_data.size;
+#if defined (CONFIG_NET_ENABLE_ZERO_COPY_RX)
+	if (p_data.nDescriptor >= 0) {
+		queue.nLent--;
+		s_nReleaseMask |= (1U << p_data.nDescriptor);
+	} else {
+		s_nCopyReleaseMask |= (1U << (-1 - p_data.nDescriptor));
+	}
+#endif
+
+	queue.nTail = queue_next(queue.nTail);
+	queue.nCount--;
+
+	return p_data.size;
+}
+
+uint32_t udp_pending(int nIndex) {
+	assert(nIndex >= 0);
+	assert(nIndex < UDP_MAX_PORTS_ALLOWED);
 
-	p_data.size = 0;
+	return s_data[nIndex].nCount;
+}
 
-	return nSize;
+void udp_get_statistics(int nIndex, udp::Statistics& statistics) {
+	assert(nIndex >= 0);
+	assert(nIndex < UDP_MAX_PORTS_ALLOWED);
+
+	statistics = s_Statistics[nIndex];
 }
 
 void udp_send(int nIndex, const uint8_t *pData, uint32_t nSize, uint32_t nRemoteIp, uint16_t nRemotePort) {
 	udp_send_implementation<net::arp::EthSend::IS_NORMAL>(nIndex, pData, nSize, nRemoteIp, nRemotePort);
 }
 
+/**
+ * Zero-copy send, the payload is written in the returned buffer of UDP_DATA_SIZE bytes.
+ * Nothing else can be sent before udp_send_buffer.
+ */
+uint8_t *udp_get_send_buffer(int nIndex, uint32_t nRemoteIp, uint16_t nRemotePort) {
+	assert(nIndex >= 0);
+	assert(nIndex < UDP_MAX_PORTS_ALLOWED);
+	assert(s_Port[nIndex] != 0);
+
+	s_TxBuffer.pTemplate = template_get(nIndex, nRemoteIp, nRemotePort);
+	s_TxBuffer.nIndex = nIndex;
+	s_TxBuffer.nRemoteIp = nRemoteIp;
+	s_TxBuffer.nRemotePort = nRemotePort;
+
+	if (__builtin_expect((s_TxBuffer.pTemplate != nullptr), 1)) {
+		s_TxBuffer.pBuffer = emac_alloc_pkt();
+		return &s_TxBuffer.pBuffer[UDP_PACKET_HEADERS_SIZE];
+	}
+
+	// Not resolved, the packet is queued by the ARP
+	return s_send_packet.udp.data;
+}
+
+void udp_send_buffer(uint32_t nSize) {
+	if (__builtin_expect((s_TxBuffer.pTemplate != nullptr), 1)) {
+		nSize = std::min(static_cast<uint32_t>(UDP_DATA_SIZE), nSize);
+
+		template_apply(*s_TxBuffer.pTemplate, s_TxBuffer.pBuffer, nSize);
+		emac_send_pkt(nSize + UDP_PACKET_HEADERS_SIZE);
+		return;
+	}
+
+	udp_send_implementation<net::arp::EthSend::IS_NORMAL>(s_TxBuffer.nIndex, s_send_packet.udp.data, nSize, s_TxBuffer.nRemoteIp, s_TxBuffer.nRemotePort);
+}
+
+/**
+ * Back-pressure: the number of frames which can be sent without waiting for the Tx descriptor ring
+ */
+uint32_t udp_send_available() {
+	return emac_eth_send_available();
+}
+
 #if defined CONFIG_ENET_ENABLE_PTP
 void udp_send_timestamp(int nIndex, const uint8_t *pData, uint32_t nSize, uint32_t nRemoteIp, uint16_t nRemotePort) {
 	udp_send_implementation<net::arp::EthSend::IS_TIMESTAMP>(nIndex, pData, nSize, nRemoteIp, nRemotePort);
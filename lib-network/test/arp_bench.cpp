@@ -0,0 +1,200 @@
+/**
+ * @file arp_bench.cpp
+ *
+ * Host benchmark: the ARP cache with hundreds of unicast destinations.
+ * arp.cpp is compiled with the GD32 configuration of net_config.h.
+ */
+/* Copyright (C) 2024 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <chrono>
+
+#include "net.h"
+#include "netif.h"
+#include "net/arp.h"
+#include "net/protocol/arp.h"
+#include "net/protocol/udp.h"
+
+#include "hardware.h"
+
+#include "../src/net/net_private.h"
+
+static constexpr uint32_t FRAMES_PER_SECOND = 44;	///< ArtDmx refresh
+static constexpr uint32_t SECONDS = 10;
+static constexpr uint32_t PACKET_SIZE = sizeof(struct ether_header) + sizeof(struct ip4_header) + 8 + 530;
+static constexpr uint32_t MAX_REPLIES = 1024;
+
+/*
+ * 10.0.0.1/16, the destinations are 10.0.x.y
+ */
+static constexpr uint32_t OWN_IP = 0x0100000A;
+static constexpr uint32_t NETMASK = 0x0000FFFF;
+
+namespace net {
+namespace globals {
+struct netif netif_default;
+uint32_t nOnNetworkMask;
+}  // namespace globals
+
+void acd_arp_reply(struct t_arp *) {}
+}  // namespace net
+
+/*
+ * The simulated hosts answer a request in the next frame period
+ */
+static uint32_t s_Replies[MAX_REPLIES];
+static uint32_t s_nReplies;
+
+static uint32_t s_nRequests;
+static uint32_t s_nDelivered;
+static uint32_t s_nWrongMac;
+
+static void mac_from_ip(const uint32_t nIp, uint8_t *pMac) {
+	pMac[0] = 0x02;
+	pMac[1] = 0x00;
+	memcpy(&pMac[2], &nIp, 4);
+}
+
+void emac_eth_send(void *pBuffer, uint32_t) {
+	const auto *pEther = reinterpret_cast<const struct ether_header *>(pBuffer);
+
+	if (pEther->type == __builtin_bswap16(ETHER_TYPE_ARP)) {
+		const auto *pArp = reinterpret_cast<const struct t_arp *>(pBuffer);
+
+		if (pArp->arp.opcode == __builtin_bswap16(ARP_OPCODE_RQST)) {
+			s_nRequests++;
+
+			if (s_nReplies < MAX_REPLIES) {
+				memcpy(&s_Replies[s_nReplies++], pArp->arp.target_ip, 4);
+			}
+		}
+		return;
+	}
+
+	const auto *pUdp = reinterpret_cast<const struct t_udp *>(pBuffer);
+	uint32_t nIp;
+	memcpy(&nIp, pUdp->ip4.dst, 4);
+	uint8_t mac[ETH_ADDR_LEN];
+	mac_from_ip(nIp, mac);
+
+	if (memcmp(mac, pUdp->ether.dst, ETH_ADDR_LEN) == 0) {
+		s_nDelivered++;
+	} else {
+		s_nWrongMac++;
+	}
+}
+
+static void deliver_replies() {
+	struct t_arp reply;
+
+	for (uint32_t i = 0; i < s_nReplies; i++) {
+		memset(&reply, 0, sizeof(reply));
+		reply.ether.type = __builtin_bswap16(ETHER_TYPE_ARP);
+		reply.arp.hardware_type = __builtin_bswap16(ARP_HWTYPE_ETHERNET);
+		reply.arp.protocol_type = __builtin_bswap16(ARP_PRTYPE_IPv4);
+		reply.arp.hardware_size = ARP_HARDWARE_SIZE;
+		reply.arp.protocol_size = ARP_PROTOCOL_SIZE;
+		reply.arp.opcode = __builtin_bswap16(ARP_OPCODE_REPLY);
+		mac_from_ip(s_Replies[i], reply.arp.sender_mac);
+		memcpy(reply.arp.sender_ip, &s_Replies[i], 4);
+		memcpy(reply.arp.target_mac, net::globals::netif_default.hwaddr, ETH_ADDR_LEN);
+		memcpy(reply.arp.target_ip, &OWN_IP, 4);
+
+		net::arp_handle(&reply);
+	}
+
+	s_nReplies = 0;
+}
+
+static uint32_t destination(const uint32_t nIndex) {
+	const auto x = static_cast<uint8_t>(nIndex / 250);
+	const auto y = static_cast<uint8_t>(2 + (nIndex % 250));
+	return 0x0000000A | (static_cast<uint32_t>(x) << 16) | (static_cast<uint32_t>(y) << 24);
+}
+
+static struct t_udp s_Packet;
+
+/**
+ * @return false when a frame was sent with a wrong destination MAC address
+ */
+static bool run(const uint32_t nDestinations) {
+	net::arp_init();
+
+	s_nRequests = 0;
+	s_nDelivered = 0;
+	s_nWrongMac = 0;
+	s_nReplies = 0;
+
+	uint32_t nSent = 0;
+	double fNanos = 0;
+
+	for (uint32_t nFrame = 0; nFrame < (SECONDS * FRAMES_PER_SECOND); nFrame++) {
+		const auto start = std::chrono::steady_clock::now();
+
+		for (uint32_t i = 0; i < nDestinations; i++) {
+			s_Packet.ether.type = __builtin_bswap16(ETHER_TYPE_IPv4);
+			net::arp_send(&s_Packet, PACKET_SIZE, destination(i));
+		}
+
+		fNanos += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+		nSent += nDestinations;
+
+		deliver_replies();
+
+		if ((nFrame % FRAMES_PER_SECOND) == (FRAMES_PER_SECOND - 1)) {
+			Hardware::Get()->RunTimer();
+		}
+	}
+
+	net::arp::Statistics statistics;
+	net::arp_get_statistics(statistics);
+
+	printf("%4u destinations: delivered %5.1f%%, hits %6u, misses %5u, evictions %5u, requests %5u, rate limited %5u, timeouts %3u, dropped %5u, %4.0f ns/send\n",
+			nDestinations, 100.0 * s_nDelivered / nSent,
+			statistics.nHits, statistics.nMisses, statistics.nEvictions, s_nRequests, statistics.nRateLimited, statistics.nTimeouts, statistics.nDropped,
+			fNanos / nSent);
+
+	if (s_nWrongMac != 0) {
+		printf("FAIL %u frames with a wrong destination MAC address\n", s_nWrongMac);
+		return false;
+	}
+
+	return true;
+}
+
+int main() {
+	auto &netif = net::globals::netif_default;
+	netif.ip.addr = OWN_IP;
+	netif.netmask.addr = NETMASK;
+	mac_from_ip(OWN_IP, netif.hwaddr);
+	net::globals::nOnNetworkMask = OWN_IP & NETMASK;
+
+	bool isOk = true;
+
+	for (const auto nDestinations : { 16U, 40U, 48U, 100U, 300U, 500U }) {
+		isOk &= run(nDestinations);
+	}
+
+	return isOk ? 0 : 1;
+}
@@ -0,0 +1,386 @@
+/**
+ * @file igmp_filter.cpp
+ *
+ * Host test: the hardware multicast filter driven by the IGMP group table.
+ * igmp.cpp and emac_multicast.cpp are compiled with the GD32 configuration of net_config.h,
+ * stub/gd32.h holds the ENET frame filter registers.
+ * The receive decision of the MAC (perfect or hash filter) is modelled from these registers.
+ */
+/* Copyright (C) 2024 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+#include "../config/net_config.h"
+
+#include "gd32.h"
+
+#include "net.h"
+#include "netif.h"
+#include "net/protocol/igmp.h"
+#include "emac/multicast.h"
+
+#include "../src/net/net_private.h"
+
+void emac_multicast_filter_apply();
+
+namespace net {
+namespace globals {
+struct netif netif_default;
+}  // namespace globals
+}  // namespace net
+
+extern "C" void console_error(const char *) {}
+
+static uint32_t s_nReports;
+static uint32_t s_nLeaves;
+
+void emac_eth_send(void *pBuffer, uint32_t) {
+	const auto *pIgmp = reinterpret_cast<const struct t_igmp *>(pBuffer);
+
+	if (pIgmp->igmp.report.igmp.type == IGMP_TYPE_REPORT) {
+		s_nReports++;
+	} else if (pIgmp->igmp.report.igmp.type == IGMP_TYPE_LEAVE) {
+		s_nLeaves++;
+	}
+}
+
+static int s_nFailed;
+
+static void check(const bool bCondition, const char *pText) {
+	printf("%s: %s\n", bCondition ? "ok" : "FAIL", pText);
+	if (!bCondition) {
+		s_nFailed++;
+	}
+}
+
+static constexpr uint32_t UNIVERSE_MAX = 63999;
+static constexpr uint32_t ALL_SYSTEMS = 0x010000E0;	///< 224.0.0.1
+
+/**
+ * sACN 239.255.{universe high}.{universe low}, network order
+ */
+static uint32_t universe_to_ip(const uint32_t nUniverse) {
+	return 0xFFEF | ((nUniverse >> 8) << 16) | ((nUniverse & 0xFF) << 24);
+}
+
+static void ip_to_mac(const uint32_t nIp, uint8_t *pMacAddress) {
+	uint8_t ip[4];
+	memcpy(ip, &nIp, 4);
+	emac::multicast::mac_from_ip(ip, pMacAddress);
+}
+
+/*
+ * Reference: the table driven IEEE 802.3 CRC-32, the hash is the 6 most significant bits of bitrev32(CRC)
+ */
+
+static uint32_t s_CrcTable[256];
+
+static void crc_table_init() {
+	for (uint32_t i = 0; i < 256; i++) {
+		auto nCrc = i;
+		for (uint32_t nBit = 0; nBit < 8; nBit++) {
+			nCrc = (nCrc & 1U) ? (0xEDB88320 ^ (nCrc >> 1)) : (nCrc >> 1);
+		}
+		s_CrcTable[i] = nCrc;
+	}
+}
+
+static uint32_t crc32(const uint8_t *pData, const uint32_t nLength) {
+	uint32_t nCrc = 0xFFFFFFFF;
+
+	for (uint32_t i = 0; i < nLength; i++) {
+		nCrc = s_CrcTable[(nCrc ^ pData[i]) & 0xFF] ^ (nCrc >> 8);
+	}
+
+	return ~nCrc;
+}
+
+static uint32_t bitrev32(uint32_t n) {
+	uint32_t nReversed = 0;
+
+	for (uint32_t nBit = 0; nBit < 32; nBit++) {
+		nReversed = (nReversed << 1) | (n & 1U);
+		n >>= 1;
+	}
+
+	return nReversed;
+}
+
+static uint32_t reference_hash_index(const uint8_t *pMacAddress) {
+	return bitrev32(crc32(pMacAddress, ETH_ADDR_LEN)) >> 26;
+}
+
+/**
+ * The MAC receive decision for a multicast destination (HMF | HPFLT): perfect filter or hash filter
+ */
+static bool is_passed(const uint8_t *pMacAddress) {
+	if (ENET_MAC_FRMF & ENET_MAC_FRMF_MFD) {
+		return true;
+	}
+
+	for (uint32_t i = 1; i < 4; i++) {
+		if (ENET_MAC_ADDRESS_ENABLE[i] && (memcmp(ENET_MAC_ADDRESS[i], pMacAddress, ETH_ADDR_LEN) == 0)) {
+			return true;
+		}
+	}
+
+	if (ENET_MAC_FRMF & ENET_MAC_FRMF_HMF) {
+		const auto nIndex = emac::multicast::hash_index(pMacAddress);
+		const auto nHash = (nIndex >= 32) ? ENET_MAC_HLH : ENET_MAC_HLL;
+		return (nHash >> (nIndex & 31)) & 1U;
+	}
+
+	return false;
+}
+
+static bool is_passed_ip(const uint32_t nIp) {
+	uint8_t macAddress[ETH_ADDR_LEN];
+	ip_to_mac(nIp, macAddress);
+	return is_passed(macAddress);
+}
+
+/**
+ * A frame passed by the MAC reaches ip_handle, which drops it when the group is not joined
+ */
+static bool is_received(const uint32_t nIp) {
+	return is_passed_ip(nIp) && net::igmp_is_member(nIp);
+}
+
+static uint32_t get_groups() {
+	net::igmp::Statistics statistics;
+	net::igmp_get_statistics(statistics);
+	return statistics.nGroups;
+}
+
+static uint32_t get_not_subscribed() {
+	net::igmp::Statistics statistics;
+	net::igmp_get_statistics(statistics);
+	return statistics.nNotSubscribed;
+}
+
+static uint32_t hash_bits() {
+	return static_cast<uint32_t>(__builtin_popcount(ENET_MAC_HLH) + __builtin_popcount(ENET_MAC_HLL));
+}
+
+/**
+ * @return the first universe from nStart with the hash index nIndex
+ */
+static uint32_t find_universe(const uint32_t nStart, const uint32_t nIndex) {
+	for (auto nUniverse = nStart; nUniverse <= UNIVERSE_MAX; nUniverse++) {
+		uint8_t macAddress[ETH_ADDR_LEN];
+		ip_to_mac(universe_to_ip(nUniverse), macAddress);
+		if (emac::multicast::hash_index(macAddress) == nIndex) {
+			return nUniverse;
+		}
+	}
+	return 0;
+}
+
+static uint32_t hash_index(const uint32_t nUniverse) {
+	uint8_t macAddress[ETH_ADDR_LEN];
+	ip_to_mac(universe_to_ip(nUniverse), macAddress);
+	return emac::multicast::hash_index(macAddress);
+}
+
+int main() {
+	/*
+	 * The hash index against the reference for all sACN universes
+	 */
+	crc_table_init();
+	check(crc32(reinterpret_cast<const uint8_t *>("123456789"), 9) == 0xCBF43926, "reference CRC-32 check value");
+
+	uint32_t nMismatch = 0;
+	uint32_t nIndexCount[emac::multicast::HASH_BITS] = {};
+
+	for (uint32_t nUniverse = 1; nUniverse <= UNIVERSE_MAX; nUniverse++) {
+		uint8_t macAddress[ETH_ADDR_LEN];
+		ip_to_mac(universe_to_ip(nUniverse), macAddress);
+		const auto nIndex = emac::multicast::hash_index(macAddress);
+		if (nIndex != reference_hash_index(macAddress)) {
+			nMismatch++;
+		}
+		nIndexCount[nIndex & 63]++;
+	}
+
+	uint32_t nIndexUsed = 0;
+	for (const auto n : nIndexCount) {
+		nIndexUsed += (n != 0) ? 1U : 0U;
+	}
+
+	check(nMismatch == 0, "hash_index matches the reference for universes 1-63999");
+	check(nIndexUsed == emac::multicast::HASH_BITS, "all 64 hash bits are used");
+
+	/*
+	 * After igmp_init: only 224.0.0.1, multicast is filtered
+	 */
+	net::igmp_init();
+
+	check((ENET_MAC_FRMF & ENET_MAC_FRMF_MFD) == 0, "init: pass all multicast is disabled");
+	check((ENET_MAC_FRMF & (ENET_MAC_FRMF_HMF | ENET_MAC_FRMF_HPFLT)) == (ENET_MAC_FRMF_HMF | ENET_MAC_FRMF_HPFLT), "init: hash or perfect filter");
+	check(is_passed_ip(ALL_SYSTEMS), "init: 224.0.0.1 is passed");
+	check(hash_bits() == 0, "init: no hash bits");
+
+	uint32_t nPassed = 0;
+	for (uint32_t nUniverse = 1; nUniverse <= UNIVERSE_MAX; nUniverse++) {
+		nPassed += is_passed_ip(universe_to_ip(nUniverse)) ? 1U : 0U;
+	}
+	check(nPassed == 0, "init: no sACN universe is passed");
+
+	/*
+	 * enet_init sets MFD again, emac_adjust_link re-applies the filter
+	 */
+	enet_fliter_feature_enable(ENET_MULTICAST_FILTER_PASS);
+	emac_multicast_filter_apply();
+	check((ENET_MAC_FRMF & ENET_MAC_FRMF_MFD) == 0, "re-applied after enet_init");
+
+	/*
+	 * Join the maximum number of universes: 2 perfect slots are left after 224.0.0.1, the others are hashed
+	 */
+	for (uint32_t i = 0; i < IGMP_MAX_JOINS_ALLOWED; i++) {
+		net::igmp_join(universe_to_ip(1 + i));
+	}
+
+	check(get_groups() == IGMP_MAX_JOINS_ALLOWED, "joined IGMP_MAX_JOINS_ALLOWED groups");
+	check(s_nReports == IGMP_MAX_JOINS_ALLOWED, "a report for each join");
+
+	bool bAllReceived = true;
+	uint64_t nHashExpected = 0;
+
+	for (uint32_t i = 0; i < IGMP_MAX_JOINS_ALLOWED; i++) {
+		bAllReceived &= is_received(universe_to_ip(1 + i));
+		if (i >= 2) {
+			nHashExpected |= (uint64_t(1) << hash_index(1 + i));
+		}
+	}
+
+	check(bAllReceived, "all joined universes are received");
+	check((ENET_MAC_HLL == static_cast<uint32_t>(nHashExpected)) && (ENET_MAC_HLH == static_cast<uint32_t>(nHashExpected >> 32)), "hash bits are the hashed groups");
+	check(is_passed_ip(ALL_SYSTEMS), "224.0.0.1 is still passed");
+
+	/*
+	 * Not joined universes: passed by a hash collision, then dropped in software and counted
+	 */
+	const auto nNotSubscribed = get_not_subscribed();
+	uint32_t nCollisions = 0;
+	uint32_t nReceived = 0;
+
+	for (uint32_t nUniverse = 1 + IGMP_MAX_JOINS_ALLOWED; nUniverse <= UNIVERSE_MAX; nUniverse++) {
+		const auto nIp = universe_to_ip(nUniverse);
+		if (is_passed_ip(nIp)) {
+			nCollisions++;
+			nReceived += net::igmp_is_member(nIp) ? 1U : 0U;
+		}
+	}
+
+	printf("%u hash bits, %u of %u not joined universes passed by the MAC (%.1f%%)\n", hash_bits(), nCollisions,
+			UNIVERSE_MAX - IGMP_MAX_JOINS_ALLOWED, 100.0 * nCollisions / (UNIVERSE_MAX - IGMP_MAX_JOINS_ALLOWED));
+
+	check(nReceived == 0, "not joined universes are dropped in software");
+	check(get_not_subscribed() - nNotSubscribed == nCollisions, "each drop is counted as not subscribed");
+
+	/*
+	 * The table is full: the group is not joined and not received
+	 */
+	const auto nFull = universe_to_ip(1000);
+	net::igmp_join(nFull);
+	check(get_groups() == IGMP_MAX_JOINS_ALLOWED, "table full: not joined");
+	check(!is_received(nFull), "table full: not received");
+
+	/*
+	 * Leave all, the filter is back to 224.0.0.1 only
+	 */
+	net::igmp_shutdown();
+	check(get_groups() == 0, "shutdown: no groups");
+	check(s_nLeaves == IGMP_MAX_JOINS_ALLOWED, "shutdown: a leave for each group");
+	check(hash_bits() == 0, "shutdown: no hash bits");
+	check(is_passed_ip(ALL_SYSTEMS), "shutdown: 224.0.0.1 is passed");
+	check(!is_passed_ip(universe_to_ip(1)), "shutdown: universe 1 is not passed");
+
+	/*
+	 * A hash bit shared by two groups: the bit is cleared only when both have left
+	 */
+	const auto nPerfect1 = universe_to_ip(1);
+	const auto nPerfect2 = universe_to_ip(2);
+	const auto nUniverseA = 3;
+	const auto nUniverseB = find_universe(nUniverseA + 1, hash_index(nUniverseA));
+	const auto nA = universe_to_ip(nUniverseA);
+	const auto nB = universe_to_ip(nUniverseB);
+
+	printf("universe %u and %u share hash bit %u\n", nUniverseA, nUniverseB, hash_index(nUniverseA));
+
+	net::igmp_join(nPerfect1);
+	net::igmp_join(nPerfect2);
+	net::igmp_join(nA);
+	net::igmp_join(nB);
+
+	check(hash_bits() == 1, "shared: one hash bit");
+	check(is_received(nA) && is_received(nB), "shared: A and B are received");
+
+	net::igmp_leave(nA);
+	check(hash_bits() == 1, "shared: A left, the bit stays for B");
+	check(is_received(nB), "shared: B is received");
+	check(is_passed_ip(nA) && !is_received(nA), "shared: A is passed by the MAC, dropped in software");
+
+	net::igmp_leave(nB);
+	check(hash_bits() == 0, "shared: B left, the bit is cleared");
+	check(!is_passed_ip(nA) && !is_passed_ip(nB), "shared: A and B are not passed");
+
+	/*
+	 * A perfect slot is freed: the next group in the table takes it
+	 */
+	net::igmp_join(nA);
+	check(hash_bits() == 1, "perfect: A is hashed");
+
+	net::igmp_leave(nPerfect1);
+	check(hash_bits() == 0, "perfect: A moved to a perfect slot");
+	check(is_received(nA) && is_received(nPerfect2), "perfect: A and universe 2 are received");
+	check(!is_passed_ip(nPerfect1), "perfect: universe 1 is not passed");
+
+	/*
+	 * A join is idempotent, also with a free slot (universe 1) before the group in the table.
+	 * There is no reference count, a single leave removes the group.
+	 * The callers keep track of their users (E131Bridge::LeaveUniverse checks the other ports).
+	 */
+	const auto nReports = s_nReports;
+	const auto nGroups = get_groups();
+
+	net::igmp_join(nA);
+	check(get_groups() == nGroups, "join twice: one group");
+	check(s_nReports == nReports, "join twice: no second report");
+
+	net::igmp_leave(nA);
+	check(!is_passed_ip(nA), "join twice: one leave removes the group");
+
+	const auto nLeaves = s_nLeaves;
+	net::igmp_leave(nA);
+	check(s_nLeaves == nLeaves, "leave a group not joined: no leave sent");
+
+	if (s_nFailed != 0) {
+		printf("%d failed\n", s_nFailed);
+		return 1;
+	}
+
+	puts("ok");
+	return 0;
+}
@@ -0,0 +1,59 @@
+/**
+ * @file gd32.h
+ *
+ * Host stub
+ */
+
+#ifndef GD32_H_
+#define GD32_H_
+
+#include <cstdint>
+#include <cstring>
+
+/*
+ * ENET frame filter, the registers used by emac_multicast.cpp
+ */
+
+#define ENET_MAC_FRMF_HMF					(1U << 2)
+#define ENET_MAC_FRMF_MFD					(1U << 4)
+#define ENET_MAC_FRMF_HPFLT					(1U << 10)
+
+#define ENET_MULTICAST_FILTER_PASS			ENET_MAC_FRMF_MFD
+#define ENET_MULTICAST_FILTER_HASH_MODE		ENET_MAC_FRMF_HMF
+#define ENET_FILTER_MODE_EITHER				ENET_MAC_FRMF_HPFLT
+
+#define ENET_ADDRESS_FILTER_DA				0U
+
+typedef enum {
+	ENET_MAC_ADDRESS0 = 0x00, ENET_MAC_ADDRESS1 = 0x08, ENET_MAC_ADDRESS2 = 0x10, ENET_MAC_ADDRESS3 = 0x18
+} enet_macaddress_enum;
+
+inline uint32_t ENET_MAC_FRMF = ENET_MAC_FRMF_MFD;	///< enet_init with ENET_CUSTOM
+inline uint32_t ENET_MAC_HLH;
+inline uint32_t ENET_MAC_HLL;
+inline uint8_t ENET_MAC_ADDRESS[4][6];
+inline bool ENET_MAC_ADDRESS_ENABLE[4];
+
+inline void enet_mac_address_set(const enet_macaddress_enum mac_addr, const uint8_t paddr[]) {
+	memcpy(ENET_MAC_ADDRESS[mac_addr / 8], paddr, 6);
+}
+
+inline void enet_address_filter_config([[maybe_unused]] const enet_macaddress_enum mac_addr, [[maybe_unused]] const uint32_t addr_mask, [[maybe_unused]] const uint32_t filter_type) {}
+
+inline void enet_address_filter_enable(const enet_macaddress_enum mac_addr) {
+	ENET_MAC_ADDRESS_ENABLE[mac_addr / 8] = true;
+}
+
+inline void enet_address_filter_disable(const enet_macaddress_enum mac_addr) {
+	ENET_MAC_ADDRESS_ENABLE[mac_addr / 8] = false;
+}
+
+inline void enet_fliter_feature_enable(const uint32_t feature) {
+	ENET_MAC_FRMF |= feature;
+}
+
+inline void enet_fliter_feature_disable(const uint32_t feature) {
+	ENET_MAC_FRMF &= ~feature;
+}
+
+#endif /* GD32_H_ */
@@ -0,0 +1,52 @@
+/**
+ * @file hardware.h
+ *
+ * Host stub
+ */
+
+#ifndef HARDWARE_H_
+#define HARDWARE_H_
+
+#include <cstdint>
+
+namespace hal {
+typedef void (*TimerCallback)();
+}  // namespace hal
+
+/**
+ * The software timers are called by the test
+ */
+class Hardware {
+public:
+	int32_t SoftwareTimerAdd(const uint32_t nIntervalMillis, const hal::TimerCallback callback) {
+		m_nIntervalMillis = nIntervalMillis;
+		m_Callback = callback;
+		return 0;
+	}
+
+	void RunTimer() {
+		if (m_Callback != nullptr) {
+			m_Callback();
+		}
+	}
+
+	uint32_t Millis() const {
+		return m_nMillis;
+	}
+
+	void SetMillis(const uint32_t nMillis) {
+		m_nMillis = nMillis;
+	}
+
+	static Hardware *Get() {
+		static Hardware s_Hardware;
+		return &s_Hardware;
+	}
+
+private:
+	hal::TimerCallback m_Callback { nullptr };
+	uint32_t m_nIntervalMillis { 0 };
+	uint32_t m_nMillis { 0 };
+};
+
+#endif /* HARDWARE_H_ */
@@ -0,0 +1,657 @@
+/**
+ * @file tcp_lossy_link.cpp
+ *
+ * Host test: the TCP send path over a simulated link with latency and random frame loss.
+ * tcp.cpp is driven through tcp_handle, tcp_write and tcp_run, the clock is simulated.
+ * The peer acknowledges every segment and drops out of order segments.
+ * Reported are the goodput and the longest stall, checked are the retransmission
+ * timer backoff, the fast retransmit, the persist timer and the abort.
+ */
+/* Copyright (C) 2024 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
+#include <deque>
+#include <functional>
+#include <map>
+#include <random>
+#include <vector>
+
+#include "../config/net_config.h"
+
+#include "net.h"
+#include "netif.h"
+#include "net/protocol/tcp.h"
+
+#include "hardware.h"
+
+#include "../src/net/net_private.h"
+
+static constexpr uint16_t LOCAL_PORT = 80;
+static constexpr uint32_t LATENCY_MILLIS = 1;		///< Each direction
+static constexpr uint32_t PEER_MSS = 1460;
+static constexpr uint32_t PEER_RTO_MILLIS = 250;	///< SYN and FIN of the peer
+static constexpr uint32_t HOUR_MILLIS = 3600 * 1000;
+static constexpr uint8_t OWN_IP[IPv4_ADDR_LEN] = { 192, 168, 2, 10 };
+static constexpr uint8_t PEER_IP[IPv4_ADDR_LEN] = { 192, 168, 2, 100 };
+static constexpr uint8_t OWN_MAC[ETH_ADDR_LEN] = { 0x02, 0x00, 0xC0, 0xA8, 0x02, 0x0A };
+static constexpr uint8_t PEER_MAC[ETH_ADDR_LEN] = { 0x02, 0x00, 0xC0, 0xA8, 0x02, 0x64 };
+
+namespace CTL {
+static constexpr uint8_t FIN = 0x01;
+static constexpr uint8_t SYN = 0x02;
+static constexpr uint8_t RST = 0x04;
+static constexpr uint8_t ACK = 0x10;
+}  // namespace CTL
+
+namespace net {
+namespace globals {
+struct netif netif_default;
+}  // namespace globals
+}  // namespace net
+
+extern "C" void console_error(const char *) {}
+
+static int s_nFailed;
+
+static void check(const bool bCondition, const char *pText) {
+	printf("%s: %s\n", bCondition ? "ok" : "FAIL", pText);
+	if (!bCondition) {
+		s_nFailed++;
+	}
+}
+
+static uint32_t millis() {
+	return Hardware::Get()->Millis();
+}
+
+/*
+ * The link: frames are delivered after LATENCY_MILLIS, or lost
+ */
+
+struct Frame {
+	uint32_t nDeliver;
+	bool isToDevice;
+	std::vector<uint8_t> bytes;
+};
+
+static std::deque<Frame> s_Link;
+static std::mt19937 s_Random;
+static double s_fLoss;
+static uint32_t s_nFramesLost;
+/// Deterministic loss, true drops the frame
+static std::function<bool(bool isToDevice, const struct t_tcp *)> s_Drop;
+
+static void link_put(const bool isToDevice, const void *pFrame, const uint32_t nLength) {
+	const auto *pTcp = reinterpret_cast<const struct t_tcp *>(pFrame);
+
+	if ((s_Drop && s_Drop(isToDevice, pTcp)) || (std::uniform_real_distribution<double>(0, 1)(s_Random) < s_fLoss)) {
+		s_nFramesLost++;
+		return;
+	}
+
+	const auto *p = reinterpret_cast<const uint8_t *>(pFrame);
+	s_Link.push_back(Frame { millis() + LATENCY_MILLIS, isToDevice, std::vector<uint8_t>(p, p + nLength) });
+}
+
+void emac_eth_send(void *pBuffer, uint32_t nLength) {
+	link_put(false, pBuffer, nLength);
+}
+
+/*
+ * The data sent, the peer checks each byte it receives in order
+ */
+
+static constexpr uint32_t DATA_SIZE = 1024 * 1024;
+static uint8_t s_Data[DATA_SIZE];
+
+/*
+ * The peer: a client that connects, receives and closes.
+ * Each segment is acknowledged, an out of order segment is queued and gives a duplicate ACK.
+ */
+
+struct DataSegment {
+	uint32_t nMillis;
+	uint32_t nSeq;
+	uint32_t nLength;
+};
+
+static struct Peer {
+	uint16_t nPort;
+	uint32_t nIss;
+	uint32_t nSndNxt;
+	uint32_t nRcvNxt;
+	uint32_t nIrs;
+	uint32_t nBufferSize;		///< The receive window
+	uint32_t nBufferUsed;
+	uint32_t nReceived;
+	uint32_t nTotal;			///< FIN after nTotal bytes
+	uint32_t nLastProgress;
+	uint32_t nMaxStall;
+	uint32_t nFinSent;			///< Millis of the last FIN, 0 is not sent
+	uint32_t nSynSent;
+	uint32_t nRstMillis;
+	uint32_t nBadChecksum;
+	uint32_t nBadData;
+	uint32_t nBadAddress;
+	bool isEstablished;
+	bool isFinReceived;
+	bool isRstReceived;
+	bool isReading;				///< The application of the peer reads the data when it arrives
+	std::vector<DataSegment> segments;
+	std::map<uint32_t, std::vector<uint8_t>> outOfOrder;	///< Key is the offset from the IRS
+} s_Peer;
+
+static uint16_t peer_window() {
+	return static_cast<uint16_t>(std::min(s_Peer.nBufferSize - s_Peer.nBufferUsed, 65535U));
+}
+
+static void peer_send(const uint8_t nControl, const uint32_t nSeq, const bool hasMSS = false) {
+	struct t_tcp tcp;
+	memset(&tcp, 0, sizeof(struct t_tcp));
+
+	const uint32_t nHeaderLength = hasMSS ? 24 : 20;
+
+	memcpy(tcp.ether.dst, OWN_MAC, ETH_ADDR_LEN);
+	memcpy(tcp.ether.src, PEER_MAC, ETH_ADDR_LEN);
+	tcp.ether.type = __builtin_bswap16(ETHER_TYPE_IPv4);
+	tcp.ip4.ver_ihl = 0x45;
+	tcp.ip4.len = __builtin_bswap16(static_cast<uint16_t>(sizeof(struct ip4_header) + nHeaderLength));
+	tcp.ip4.proto = IPv4_PROTO_TCP;
+	memcpy(tcp.ip4.src, PEER_IP, IPv4_ADDR_LEN);
+	memcpy(tcp.ip4.dst, OWN_IP, IPv4_ADDR_LEN);
+	tcp.tcp.srcpt = __builtin_bswap16(s_Peer.nPort);
+	tcp.tcp.dstpt = __builtin_bswap16(LOCAL_PORT);
+	tcp.tcp.seqnum = __builtin_bswap32(nSeq);
+	tcp.tcp.acknum = __builtin_bswap32((nControl & CTL::SYN) ? 0 : s_Peer.nRcvNxt);
+	tcp.tcp.offset = static_cast<uint8_t>((nHeaderLength / 4) << 4);
+	tcp.tcp.control = nControl;
+	tcp.tcp.window = __builtin_bswap16(peer_window());
+
+	if (hasMSS) {
+		tcp.tcp.data[0] = 2;
+		tcp.tcp.data[1] = 4;
+		tcp.tcp.data[2] = PEER_MSS >> 8;
+		tcp.tcp.data[3] = PEER_MSS & 0xFF;
+	}
+
+	link_put(true, &tcp, static_cast<uint32_t>(sizeof(struct ether_header) + sizeof(struct ip4_header) + nHeaderLength));
+}
+
+static void peer_ack() {
+	peer_send(CTL::ACK, s_Peer.nSndNxt);
+}
+
+/**
+ * The TCP checksum with the pseudo header, 0 is valid
+ */
+static uint16_t tcp_checksum(const struct t_tcp *pTcp, const uint32_t nTcpLength) {
+	uint32_t nSum = 0;
+
+	const auto add = [&nSum](const uint8_t *p, const uint32_t nLength) {
+		for (uint32_t i = 0; i < nLength; i += 2) {
+			nSum += static_cast<uint32_t>(p[i] << 8) | ((i + 1 < nLength) ? p[i + 1] : 0U);
+		}
+	};
+
+	add(pTcp->ip4.src, IPv4_ADDR_LEN);
+	add(pTcp->ip4.dst, IPv4_ADDR_LEN);
+	nSum += IPv4_PROTO_TCP + nTcpLength;
+	add(reinterpret_cast<const uint8_t *>(&pTcp->tcp), nTcpLength);
+
+	while (nSum >> 16) {
+		nSum = (nSum & 0xFFFF) + (nSum >> 16);
+	}
+
+	return static_cast<uint16_t>(~nSum);
+}
+
+/**
+ * The queued segments from RCV.NXT onwards are received in order
+ */
+static void peer_deliver() {
+	auto& queue = s_Peer.outOfOrder;
+
+	while (!queue.empty() && (queue.begin()->first <= (s_Peer.nRcvNxt - s_Peer.nIrs))) {
+		const auto nStart = (s_Peer.nRcvNxt - s_Peer.nIrs) - queue.begin()->first;
+		const auto& segment = queue.begin()->second;
+
+		if (segment.size() > nStart) {
+			const auto nLength = static_cast<uint32_t>(segment.size() - nStart);
+			const auto nOffset = s_Peer.nReceived % DATA_SIZE;
+
+			if ((nOffset + nLength > DATA_SIZE) || (memcmp(&segment[nStart], &s_Data[nOffset], nLength) != 0)) {
+				s_Peer.nBadData++;
+			}
+
+			s_Peer.nRcvNxt += nLength;
+			s_Peer.nBufferUsed += s_Peer.isReading ? 0 : nLength;
+			s_Peer.nReceived += nLength;
+			s_Peer.nMaxStall = std::max(s_Peer.nMaxStall, millis() - s_Peer.nLastProgress);
+			s_Peer.nLastProgress = millis();
+		}
+
+		queue.erase(queue.begin());
+	}
+}
+
+static void peer_receive(const std::vector<uint8_t>& frame) {
+	const auto *pTcp = reinterpret_cast<const struct t_tcp *>(frame.data());
+	const auto nTcpLength = static_cast<uint32_t>(__builtin_bswap16(pTcp->ip4.len) - sizeof(struct ip4_header));
+	const auto nDataOffset = static_cast<uint32_t>((pTcp->tcp.offset >> 4) * 4);
+	const auto nLength = nTcpLength - nDataOffset;
+	const auto nSeq = __builtin_bswap32(pTcp->tcp.seqnum);
+	const auto nControl = pTcp->tcp.control;
+
+	if (tcp_checksum(pTcp, nTcpLength) != 0) {
+		s_Peer.nBadChecksum++;
+	}
+
+	if ((memcmp(pTcp->ether.dst, PEER_MAC, ETH_ADDR_LEN) != 0) || (memcmp(pTcp->ip4.dst, PEER_IP, IPv4_ADDR_LEN) != 0) || (__builtin_bswap16(pTcp->tcp.dstpt) != s_Peer.nPort)) {
+		s_Peer.nBadAddress++;
+	}
+
+	if (nControl & CTL::RST) {
+		s_Peer.isRstReceived = true;
+		s_Peer.nRstMillis = millis();
+		return;
+	}
+
+	if (nControl & CTL::SYN) {
+		s_Peer.nIrs = nSeq;
+		s_Peer.nRcvNxt = nSeq + 1;
+		s_Peer.nSndNxt = s_Peer.nIss + 1;
+		s_Peer.isEstablished = true;
+		peer_ack();
+		return;
+	}
+
+	if (nLength != 0) {
+		s_Peer.segments.push_back(DataSegment { millis(), nSeq, nLength });
+
+		const auto nEnd = nSeq + nLength;
+
+		// Within the window: in order, or queued as a host does
+		if (static_cast<int32_t>(nEnd - s_Peer.nRcvNxt) > 0 && ((s_Peer.nBufferSize - s_Peer.nBufferUsed) >= (nEnd - s_Peer.nRcvNxt))) {
+			const auto *pData = reinterpret_cast<const uint8_t *>(&pTcp->tcp) + nDataOffset;
+			auto& segment = s_Peer.outOfOrder[nSeq - s_Peer.nIrs];
+
+			if (segment.size() < nLength) {
+				segment.assign(pData, pData + nLength);
+			}
+		}
+
+		peer_deliver();
+	}
+
+	if ((nControl & CTL::FIN) && (nSeq + nLength == s_Peer.nRcvNxt) && !s_Peer.isFinReceived) {
+		s_Peer.nRcvNxt++;
+		s_Peer.isFinReceived = true;
+	}
+
+	if ((nLength != 0) || (nControl & CTL::FIN)) {
+		peer_ack();
+	}
+}
+
+/**
+ * The SYN and the FIN of the peer are sent again until answered
+ */
+static void peer_run() {
+	if (!s_Peer.isEstablished && ((millis() - s_Peer.nSynSent) >= PEER_RTO_MILLIS)) {
+		s_Peer.nSynSent = millis();
+		peer_send(CTL::SYN, s_Peer.nIss, true);
+	}
+
+	if (s_Peer.isEstablished && (s_Peer.nReceived == s_Peer.nTotal) && !s_Peer.isFinReceived) {
+		if (s_Peer.nFinSent == 0) {
+			s_Peer.nFinSent = millis();
+			peer_send(CTL::FIN | CTL::ACK, s_Peer.nSndNxt);
+			s_Peer.nSndNxt++;
+		} else if ((millis() - s_Peer.nFinSent) >= PEER_RTO_MILLIS) {
+			s_Peer.nFinSent = millis();
+			peer_send(CTL::FIN | CTL::ACK, s_Peer.nSndNxt - 1);
+		}
+	}
+
+	// The application of the peer reads again, a window update
+	if (s_Peer.isReading && (s_Peer.nBufferUsed != 0)) {
+		s_Peer.nBufferUsed = 0;
+		peer_ack();
+	}
+}
+
+/*
+ * The simulation, one step per millisecond
+ */
+
+static uint32_t s_nWritten;
+static uint32_t s_nToWrite;	///< Set when the connection is established
+
+static void step() {
+	Hardware::Get()->SetMillis(millis() + 1);
+
+	while (!s_Link.empty() && (s_Link.front().nDeliver <= millis())) {
+		auto frame = std::move(s_Link.front());
+		s_Link.pop_front();
+
+		if (frame.isToDevice) {
+			net::tcp_handle(reinterpret_cast<struct t_tcp *>(frame.bytes.data()));
+		} else {
+			peer_receive(frame.bytes);
+		}
+	}
+
+	peer_run();
+
+	// The application of the device writes as much as the send queue takes
+	while (net::tcp_is_connected(0, 0) && (s_nWritten < s_nToWrite)) {
+		const auto nOffset = s_nWritten % DATA_SIZE;
+		const auto nLength = std::min(std::min(1024U, s_nToWrite - s_nWritten), DATA_SIZE - nOffset);
+		const auto nQueued = net::tcp_write(0, &s_Data[nOffset], nLength, 0);
+
+		s_nWritten += nQueued;
+
+		if (nQueued < nLength) {
+			break;
+		}
+	}
+
+	net::tcp_run();
+}
+
+static net::tcp::Statistics get_statistics() {
+	net::tcp::Statistics statistics;
+	net::tcp_get_statistics(statistics);
+	return statistics;
+}
+
+/**
+ * A new connection from the next peer port
+ */
+static void connect(const uint32_t nTotal, const uint32_t nBufferSize, const bool isReading, const double fLoss, const uint32_t nSeed) {
+	static uint16_t s_nPort = 50000;
+
+	s_Link.clear();
+	s_Random.seed(nSeed);
+	s_fLoss = fLoss;
+	s_nFramesLost = 0;
+	s_Drop = nullptr;
+	s_nWritten = 0;
+	s_nToWrite = 0;
+
+	s_Peer = Peer {};
+	s_Peer.nPort = s_nPort++;
+	s_Peer.nIss = millis() * 7919;
+	s_Peer.nBufferSize = nBufferSize;
+	s_Peer.isReading = isReading;
+	s_Peer.nTotal = nTotal;
+	s_Peer.nSynSent = millis();
+
+	peer_send(CTL::SYN, s_Peer.nIss, true);
+
+	while (!net::tcp_is_connected(0, 0) && ((millis() - s_Peer.nSynSent) < 10000)) {
+		step();
+	}
+
+	s_Peer.nLastProgress = millis();
+	s_nToWrite = nTotal;
+}
+
+/**
+ * The peer resets the connection, the TCB is in LISTEN again
+ */
+static void reset() {
+	if (net::tcp_is_connected(0, 0)) {
+		s_fLoss = 0;
+		s_Drop = nullptr;
+		peer_send(CTL::RST, s_Peer.nSndNxt);
+		step();
+		step();
+	}
+	s_Link.clear();
+}
+
+static uint32_t run_until(const std::function<bool()>& isDone, const uint32_t nMaxMillis) {
+	const auto nStart = millis();
+
+	while (!isDone() && ((millis() - nStart) < nMaxMillis)) {
+		step();
+	}
+
+	return millis() - nStart;
+}
+
+/*
+ * Goodput over a lossy link, the transfer ends with the close from the peer
+ */
+
+static void test_goodput(const double fLoss) {
+	const auto before = get_statistics();
+
+	connect(DATA_SIZE, 65535, true, fLoss, 1);
+
+	const auto nStart = millis();
+	const auto isClosed = [] { return s_Peer.isFinReceived && !net::tcp_is_connected(0, 0) && s_Link.empty(); };
+	run_until(isClosed, HOUR_MILLIS);
+
+	const auto after = get_statistics();
+	const auto nMillis = s_Peer.nLastProgress - nStart;
+	const auto fSeconds = static_cast<double>(nMillis) / 1000;
+
+	printf("loss %3.0f%%: %7u bytes in %6.3f s, goodput %7.1f KB/s, longest stall %4u ms, frames lost %4u, timeouts %3u, fast retransmits %3u, RTT %u ms\n",
+			fLoss * 100, s_Peer.nReceived, fSeconds, static_cast<double>(s_Peer.nReceived) / 1024 / fSeconds, s_Peer.nMaxStall, s_nFramesLost,
+			after.nRetransmits - before.nRetransmits, after.nFastRetransmits - before.nFastRetransmits, after.nRttMillis);
+
+	char aText[128];
+
+	snprintf(aText, sizeof(aText), "loss %.0f%%: all data received in order, intact", fLoss * 100);
+	check((s_Peer.nReceived == DATA_SIZE) && (s_Peer.nBadData == 0), aText);
+
+	snprintf(aText, sizeof(aText), "loss %.0f%%: the checksum and the addresses of each frame", fLoss * 100);
+	check((s_Peer.nBadChecksum == 0) && (s_Peer.nBadAddress == 0), aText);
+
+	snprintf(aText, sizeof(aText), "loss %.0f%%: closed after the FIN exchange, no abort", fLoss * 100);
+	check(isClosed() && !s_Peer.isRstReceived && (after.nAborts == before.nAborts), aText);
+
+	if (fLoss == 0) {
+		check((after.nRetransmits == before.nRetransmits) && (after.nFastRetransmits == before.nFastRetransmits), "loss 0%: nothing is sent again");
+		check(nMillis < (2 * DATA_SIZE * 2 * LATENCY_MILLIS) / TCP_TX_QUEUE_SIZE, "loss 0%: the send queue is the flight, one per round trip");
+	} else {
+		snprintf(aText, sizeof(aText), "loss %.0f%%: most losses are repaired by a fast retransmit", fLoss * 100);
+		check((after.nFastRetransmits - before.nFastRetransmits) > (after.nRetransmits - before.nRetransmits), aText);
+	}
+
+	reset();
+}
+
+/*
+ * RFC 6298 5.5 the timer backs off, after TCP_MAX_RETRANSMITS the connection is reset
+ */
+
+static void test_backoff() {
+	static std::vector<uint32_t> s_Sent;	///< Millis of the data segments and the RST
+
+	const auto before = get_statistics();
+
+	connect(1000, 65535, true, 0, 1);
+
+	s_Sent.clear();
+
+	// The peer does not see any frame of the device
+	s_Drop = [](const bool isToDevice, const struct t_tcp *pTcp) {
+		if (!isToDevice) {
+			const auto nTcpLength = static_cast<uint32_t>(__builtin_bswap16(pTcp->ip4.len) - sizeof(struct ip4_header));
+			if ((nTcpLength > static_cast<uint32_t>((pTcp->tcp.offset >> 4) * 4)) || (pTcp->tcp.control & CTL::RST)) {
+				s_Sent.push_back(millis());
+			}
+		}
+		return !isToDevice;
+	};
+
+	run_until([] { return !net::tcp_is_connected(0, 0); }, HOUR_MILLIS);
+
+	const auto after = get_statistics();
+
+	// The data, 8 retransmissions, then the RST
+	auto isDoubling = (s_Sent.size() == 10);
+
+	for (size_t i = 1; isDoubling && (i < s_Sent.size()); i++) {
+		const auto nInterval = s_Sent[i] - s_Sent[i - 1];
+		printf("  interval %zu: %5u ms\n", i, nInterval);
+		isDoubling = (nInterval == (200U << (i - 1)));
+	}
+
+	check(isDoubling, "backoff: 200 ms (TCP_RTO_MIN on a LAN), doubled each time");
+	check(after.nRetransmits == before.nRetransmits + 8, "backoff: 8 retransmissions");
+	check(!net::tcp_is_connected(0, 0) && (after.nAborts == before.nAborts + 1), "backoff: then aborted with RST");
+
+	reset();
+}
+
+/*
+ * RFC 5681 3.2 the third duplicate ACK, then RFC 6582 partial ACKs
+ */
+
+static void test_fast_retransmit() {
+	const auto before = get_statistics();
+
+	static uint32_t s_nDropSeq;
+	static bool s_isDropped;
+
+	connect(8 * 1400, 65535, true, 0, 1);
+
+	s_nDropSeq = s_Peer.nRcvNxt;
+	s_isDropped = false;
+
+	// The first data segment is lost, once
+	s_Drop = [](const bool isToDevice, const struct t_tcp *pTcp) {
+		if (!isToDevice && !s_isDropped && (__builtin_bswap32(pTcp->tcp.seqnum) == s_nDropSeq)) {
+			s_isDropped = true;
+			return true;
+		}
+		return false;
+	};
+
+	const auto nStart = millis();
+	run_until([] { return s_Peer.nReceived == s_Peer.nTotal; }, 10000);
+
+	const auto after = get_statistics();
+
+	uint32_t nResent = 0;
+
+	for (const auto& segment : s_Peer.segments) {
+		if (segment.nSeq == s_nDropSeq) {
+			nResent = segment.nMillis - nStart;
+		}
+	}
+
+	printf("  first segment sent again after %u ms, all received after %u ms\n", nResent, s_Peer.nLastProgress - nStart);
+
+	check(s_isDropped && (s_Peer.nReceived == s_Peer.nTotal) && (s_Peer.nBadData == 0), "fast retransmit: all data received");
+	check(after.nFastRetransmits == before.nFastRetransmits + 1, "fast retransmit: once, on the duplicate ACKs (early retransmit with less than 4 segments in flight)");
+	check(after.nRetransmits == before.nRetransmits, "fast retransmit: no retransmission timeout, partial ACKs send the next segment");
+	check((nResent != 0) && (nResent < 200), "fast retransmit: before the retransmission timer");
+
+	reset();
+}
+
+/*
+ * RFC 1122 4.2.2.17 the peer closes its window for one hour, the persist timer probes it
+ */
+
+static void test_persist() {
+	const auto before = get_statistics();
+
+	connect(64 * 1024, 4096, false, 0, 1);
+
+	const auto nStart = millis();
+	run_until([] { return false; }, HOUR_MILLIS);
+
+	const auto middle = get_statistics();
+
+	uint32_t nProbes = 0;
+	uint32_t nLongest = 0;
+	uint32_t nPrevious = 0;
+
+	for (const auto& segment : s_Peer.segments) {
+		if (segment.nSeq == s_Peer.nRcvNxt) {
+			if (nPrevious != 0) {
+				nLongest = std::max(nLongest, segment.nMillis - nPrevious);
+			}
+			nPrevious = segment.nMillis;
+			nProbes++;
+		}
+	}
+
+	printf("  one hour: %u bytes received, %u probes, longest interval %u ms\n", s_Peer.nReceived, nProbes, nLongest);
+
+	check(net::tcp_is_connected(0, 0) && !s_Peer.isRstReceived && (middle.nAborts == before.nAborts), "persist: connected after one hour of a zero window");
+	check(s_Peer.nReceived == 4096, "persist: the window is filled");
+	check((middle.nZeroWindowProbes > before.nZeroWindowProbes) && (nProbes >= HOUR_MILLIS / 60000), "persist: the zero window is probed");
+	check(nLongest == 60000, "persist: the probe interval backs off to TCP_RTO_MAX");
+
+	// The peer application reads again
+	s_Peer.isReading = true;
+
+	const auto nMillis = run_until([] { return s_Peer.isFinReceived && !net::tcp_is_connected(0, 0); }, 2 * 60000);
+
+	printf("  window opened: all received after %u ms\n", nMillis);
+
+	check((s_Peer.nReceived == s_Peer.nTotal) && (s_Peer.nBadData == 0), "persist: all data received when the window opens");
+	check(millis() - nStart > HOUR_MILLIS, "persist: simulated for more than one hour");
+
+	reset();
+}
+
+int main() {
+	for (uint32_t i = 0; i < DATA_SIZE; i++) {
+		s_Data[i] = static_cast<uint8_t>((i * 7) ^ (i >> 11));
+	}
+
+	memcpy(net::globals::netif_default.hwaddr, OWN_MAC, ETH_ADDR_LEN);
+
+	Hardware::Get()->SetMillis(1);
+
+	net::tcp_init();
+	net::tcp_begin(LOCAL_PORT);
+
+	printf("TCP_TX_QUEUE_SIZE=%u, TCP_RX_QUEUE_ENTRIES=%u, latency %u ms\n", TCP_TX_QUEUE_SIZE, TCP_RX_QUEUE_ENTRIES, LATENCY_MILLIS);
+
+	for (const auto fLoss : { 0.0, 0.01, 0.05 }) {
+		test_goodput(fLoss);
+	}
+
+	test_backoff();
+	test_fast_retransmit();
+	test_persist();
+
+	if (s_nFailed != 0) {
+		printf("%d failed\n", s_nFailed);
+		return 1;
+	}
+
+	puts("ok");
+	return 0;
+}
@@ -0,0 +1,198 @@
+/**
+ * @file udp_rx_bench.cpp
+ *
+ * Host benchmark: bytes copied per ArtDmx packet on the receive path,
+ * with and without CONFIG_NET_ENABLE_ZERO_COPY_RX.
+ */
+/* Copyright (C) 2024 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+#include "net.h"
+#include "netif.h"
+#include "net/protocol/udp.h"
+
+#include "../src/net/net_private.h"
+
+/*
+ * The EMAC is a ring of RXBUF_NUM descriptors, lending as in lib-network/src/emac/gd32/f/net.cpp
+ */
+static constexpr uint32_t RXBUF_NUM = 16;
+static constexpr uint32_t RXBUF_RESERVED = 4;
+static constexpr uint32_t ARTDMX_SIZE = 18 + 512;
+static constexpr uint32_t UNIVERSES = 4;
+static constexpr uint16_t ARTNET_PORT = 6454;
+
+static struct t_udp s_Ring[RXBUF_NUM];
+static uint32_t s_nCurrent;
+static uint32_t s_nLentMask;
+static uint32_t s_nLentCount;
+static uint32_t s_nMinFree = RXBUF_NUM;
+
+static uint64_t s_nCopied;
+static uint32_t s_nLent;
+static uint32_t s_nCopiedFrames;
+
+namespace net {
+namespace globals {
+struct netif netif_default;
+uint32_t nBroadcastMask;
+}  // namespace globals
+
+void arp_send(struct t_udp *, const uint32_t, const uint32_t) {}
+bool arp_resolve(const uint32_t, uint8_t *) { return false; }
+}  // namespace net
+
+extern "C" void console_error(const char *) {}
+
+void emac_eth_send(void *, uint32_t) {}
+uint8_t *emac_alloc_pkt() { return nullptr; }
+void emac_send_pkt(const uint32_t) {}
+uint32_t emac_eth_send_available() { return 4; }
+
+int32_t emac_lend_pkt() {
+	if (s_nLentCount >= (RXBUF_NUM - RXBUF_RESERVED)) {
+		return -1;
+	}
+
+	s_nLentMask |= (1U << s_nCurrent);
+	s_nLentCount++;
+
+	if ((RXBUF_NUM - s_nLentCount) < s_nMinFree) {
+		s_nMinFree = RXBUF_NUM - s_nLentCount;
+	}
+
+	return static_cast<int32_t>(s_nCurrent);
+}
+
+void emac_release_pkt(const int32_t nIndex) {
+	s_nLentMask &= ~(1U << nIndex);
+	s_nLentCount--;
+}
+
+static bool is_in_ring(const uint8_t *p) {
+	return (p >= reinterpret_cast<const uint8_t *>(s_Ring)) && (p < reinterpret_cast<const uint8_t *>(&s_Ring[RXBUF_NUM]));
+}
+
+/**
+ * @return false when the DMA is stalled at a lent descriptor
+ */
+static bool receive(const uint16_t nUniverse) {
+	if ((s_nLentMask & (1U << s_nCurrent)) != 0) {
+		return false;
+	}
+
+	auto &frame = s_Ring[s_nCurrent];
+
+	frame.ether.type = __builtin_bswap16(ETHER_TYPE_IPv4);
+	frame.ip4.proto = IPv4_PROTO_UDP;
+	frame.udp.source_port = __builtin_bswap16(ARTNET_PORT);
+	frame.udp.destination_port = __builtin_bswap16(ARTNET_PORT);
+	frame.udp.len = __builtin_bswap16(static_cast<uint16_t>(UDP_HEADER_SIZE + ARTDMX_SIZE));
+	frame.udp.data[14] = static_cast<uint8_t>(nUniverse);
+
+	net::udp_handle(&frame);
+
+	s_nCurrent = (s_nCurrent + 1) % RXBUF_NUM;
+	return true;
+}
+
+/**
+ * ArtNetNode::HandleDmx copies the slots into lightset::Data, the DMX output copies them into the Tx buffer
+ */
+static void consume(const int nHandle) {
+	static uint8_t lightsetData[512];
+	static uint8_t dmxTx[512];
+	const uint8_t *pData;
+	uint32_t nFromIp;
+	uint16_t nFromPort;
+
+	while (net::udp_recv2(nHandle, &pData, &nFromIp, &nFromPort) != 0) {
+		if (is_in_ring(pData)) {
+			s_nLent++;
+		} else {
+			s_nCopiedFrames++;
+		}
+
+		std::memcpy(lightsetData, &pData[18], 512);
+		std::memcpy(dmxTx, lightsetData, 512);
+		s_nCopied += 512 + 512;
+	}
+}
+
+static void run(const char *pName, const uint32_t nConsumeEvery, const uint32_t nFrames) {
+	const auto nHandle = net::udp_begin(ARTNET_PORT);
+	net::udp::Statistics before;
+	net::udp_get_statistics(nHandle, before);
+
+	s_nCopied = 0;
+	s_nLent = 0;
+	s_nCopiedFrames = 0;
+	s_nMinFree = RXBUF_NUM;
+
+	uint32_t nStalls = 0;
+
+	for (uint32_t i = 0; i < nFrames; i++) {
+#if defined (CONFIG_NET_ENABLE_ZERO_COPY_RX)
+		net::udp_release_pending();
+#endif
+		if (!receive(static_cast<uint16_t>(i % UNIVERSES))) {
+			nStalls++;
+		}
+
+		if ((i % nConsumeEvery) == (nConsumeEvery - 1)) {
+			consume(nHandle);
+		}
+	}
+
+	consume(nHandle);
+
+	net::udp::Statistics after;
+	net::udp_get_statistics(nHandle, after);
+	const auto nReceived = after.nReceived - before.nReceived;
+	const auto nDropped = after.nDropped - before.nDropped;
+
+#if defined (CONFIG_NET_ENABLE_ZERO_COPY_RX)
+	const uint64_t nNetCopied = static_cast<uint64_t>(s_nCopiedFrames) * ARTDMX_SIZE;
+	printf("zero-copy %-12s: %5.0f bytes/ArtDmx (udp %5.1f), lent %6u, copied %6u, dropped %5u, stalls %5u, min free descriptors %2u\n",
+			pName, static_cast<double>(s_nCopied + nNetCopied) / nReceived, static_cast<double>(nNetCopied) / nReceived,
+			s_nLent, s_nCopiedFrames, nDropped, nStalls, s_nMinFree);
+#else
+	const uint64_t nNetCopied = static_cast<uint64_t>(nReceived) * ARTDMX_SIZE;
+	printf("copy      %-12s: %5.0f bytes/ArtDmx (udp %5.1f), dropped %5u\n",
+			pName, static_cast<double>(s_nCopied + nNetCopied) / nReceived, static_cast<double>(nNetCopied) / nReceived, nDropped);
+#endif
+
+	net::udp_end(ARTNET_PORT);
+}
+
+int main() {
+	net::udp_init();
+
+	run("consumer 1:1", 1, 100000);
+	run("consumer 1:4", 4, 100000);
+	run("consumer 1:8", 8, 100000);
+
+	return 0;
+}
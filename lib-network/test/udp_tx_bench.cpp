@@ -0,0 +1,445 @@
+/**
+ * @file udp_tx_bench.cpp
+ *
+ * Host test and benchmark: the UDP transmit header templates and the zero-copy send.
+ * The frames sent with a template, zero-copy and on the ARP path (the two copy send)
+ * must be identical except for the IPv4 identification and header checksum.
+ * Then the bytes copied and the cycles per packet for each path.
+ */
+/* Copyright (C) 2024 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <chrono>
+#if defined (__x86_64__) || defined (__i386__)
+# include <x86intrin.h>
+#endif
+
+#include "../config/net_config.h"
+
+#include "net.h"
+#include "netif.h"
+#include "net/protocol/udp.h"
+
+#include "../src/net/net_memcpy.h"
+#include "../src/net/net_private.h"
+
+static constexpr uint32_t OWN_IP = 0x0A00000A;			///< 10.0.0.10
+static constexpr uint32_t OTHER_IP = 0x0B00000A;		///< 10.0.0.11
+static constexpr uint32_t UNICAST_IP = 0x1400000A;		///< 10.0.0.20
+static constexpr uint32_t DIRECTED_BROADCAST = 0xFFFFFF0A;	///< 10.255.255.255, the netmask is /8
+static constexpr uint32_t MULTICAST_IP = 0x0100FFEF;	///< 239.255.0.1, sACN universe 1
+static constexpr uint16_t LOCAL_PORT = 5568;
+static constexpr uint16_t REMOTE_PORT = 5568;
+static constexpr uint8_t OWN_MAC[ETH_ADDR_LEN] = { 0x02, 0x00, 0x0A, 0x00, 0x00, 0x0A };
+static constexpr uint8_t UNICAST_MAC[ETH_ADDR_LEN] = { 0x02, 0x00, 0x0A, 0x00, 0x00, 0x14 };
+
+namespace net {
+namespace globals {
+struct netif netif_default;
+uint32_t nBroadcastMask;
+}  // namespace globals
+}  // namespace net
+
+extern "C" void console_error(const char *) {}
+
+/*
+ * The Tx DMA buffer and the frames sent
+ */
+
+static uint8_t s_DmaBuffer[1536] __attribute__ ((aligned (4)));
+static uint8_t s_Frame[1536];
+static uint32_t s_nFrameLength;
+static uint32_t s_nInPlace;		///< Frames sent from the Tx DMA buffer
+static uint32_t s_nCopied;		///< Frames copied into the Tx DMA buffer
+static bool s_bKeepFrame = true;
+
+static void keep(const void *pFrame, const uint32_t nLength) {
+	if (s_bKeepFrame) {
+		memcpy(s_Frame, pFrame, nLength);
+		s_nFrameLength = nLength;
+	}
+}
+
+uint8_t *emac_alloc_pkt() {
+	return s_DmaBuffer;
+}
+
+void emac_send_pkt(const uint32_t nLength) {
+	s_nInPlace++;
+	keep(s_DmaBuffer, nLength);
+}
+
+/**
+ * As the GD32 driver: the frame is copied into the Tx DMA buffer
+ */
+void emac_eth_send(void *pBuffer, uint32_t nLength) {
+	s_nCopied++;
+	net::memcpy(s_DmaBuffer, pBuffer, nLength);
+	keep(s_DmaBuffer, nLength);
+}
+
+uint32_t emac_eth_send_available() { return 4; }
+
+/*
+ * The ARP cache: resolved or not. arp_send does what arp.cpp does on a cache hit.
+ */
+
+static bool s_bResolved = true;
+
+namespace net {
+bool arp_resolve(const uint32_t, uint8_t *pMacAddress) {
+	if (s_bResolved) {
+		std::memcpy(pMacAddress, UNICAST_MAC, ETH_ADDR_LEN);
+	}
+	return s_bResolved;
+}
+
+void arp_send(struct t_udp *pPacket, const uint32_t nSize, const uint32_t nRemoteIp) {
+	net::memcpy_ip(pPacket->ip4.dst, nRemoteIp);
+	pPacket->ip4.chksum = 0;
+#if !defined (CHECKSUM_BY_HARDWARE)
+	pPacket->ip4.chksum = net_chksum(reinterpret_cast<void *>(&pPacket->ip4), sizeof(pPacket->ip4));
+#endif
+	std::memcpy(pPacket->ether.dst, UNICAST_MAC, ETH_ADDR_LEN);
+	emac_eth_send(reinterpret_cast<void *>(pPacket), nSize);
+}
+}  // namespace net
+
+static int s_nFailed;
+
+static void check(const bool bCondition, const char *pText) {
+	printf("%s: %s\n", bCondition ? "ok" : "FAIL", pText);
+	if (!bCondition) {
+		s_nFailed++;
+	}
+}
+
+/*
+ * Frame checks
+ */
+
+#if !defined (CHECKSUM_BY_HARDWARE)
+static uint16_t sum16(const uint8_t *p, const uint32_t nLength) {
+	uint32_t nSum = 0;
+	for (uint32_t i = 0; i < nLength; i += 2) {
+		nSum += static_cast<uint32_t>((p[i] << 8) | p[i + 1]);
+	}
+	while ((nSum >> 16) != 0) {
+		nSum = (nSum & 0xFFFF) + (nSum >> 16);
+	}
+	return static_cast<uint16_t>(nSum);
+}
+#endif
+
+/**
+ * @return true when the frame is a valid UDP frame from the own address with the payload
+ */
+static bool is_valid(const uint8_t *pFrame, const uint32_t nFrameLength, const uint8_t *pDstMac, const uint32_t nDstIp, const uint8_t *pPayload, const uint32_t nPayloadLength) {
+	const auto *pUdp = reinterpret_cast<const struct t_udp *>(pFrame);
+
+	if (nFrameLength != UDP_PACKET_HEADERS_SIZE + nPayloadLength) {
+		printf("frame length %u\n", nFrameLength);
+		return false;
+	}
+
+	uint32_t nSrcIp, nIp;
+	memcpy(&nSrcIp, pUdp->ip4.src, 4);
+	memcpy(&nIp, pUdp->ip4.dst, 4);
+
+	const bool bHeaders = (memcmp(pUdp->ether.dst, pDstMac, ETH_ADDR_LEN) == 0)
+			&& (memcmp(pUdp->ether.src, OWN_MAC, ETH_ADDR_LEN) == 0)
+			&& (pUdp->ether.type == __builtin_bswap16(ETHER_TYPE_IPv4))
+			&& (pUdp->ip4.ver_ihl == 0x45) && (pUdp->ip4.proto == IPv4_PROTO_UDP) && (pUdp->ip4.ttl == 64)
+			&& (pUdp->ip4.flags_froff == __builtin_bswap16(IPv4_FLAG_DF))
+			&& (__builtin_bswap16(pUdp->ip4.len) == IPv4_UDP_HEADERS_SIZE + nPayloadLength)
+			&& (nSrcIp == net::globals::netif_default.ip.addr) && (nIp == nDstIp)
+			&& (__builtin_bswap16(pUdp->udp.source_port) == LOCAL_PORT)
+			&& (__builtin_bswap16(pUdp->udp.destination_port) == REMOTE_PORT)
+			&& (__builtin_bswap16(pUdp->udp.len) == UDP_HEADER_SIZE + nPayloadLength)
+			&& (pUdp->udp.checksum == 0);
+
+	if (!bHeaders) {
+		puts("headers");
+		return false;
+	}
+
+#if defined (CHECKSUM_BY_HARDWARE)
+	if (pUdp->ip4.chksum != 0) {
+		puts("IPv4 checksum is not left to the MAC");
+		return false;
+	}
+#else
+	if (sum16(reinterpret_cast<const uint8_t *>(&pUdp->ip4), sizeof(pUdp->ip4)) != 0xFFFF) {
+		puts("IPv4 checksum");
+		return false;
+	}
+#endif
+
+	if (memcmp(pUdp->udp.data, pPayload, nPayloadLength) != 0) {
+		puts("payload");
+		return false;
+	}
+
+	return true;
+}
+
+/**
+ * The frames are identical except for the IPv4 identification and header checksum
+ */
+static bool is_same(const uint8_t *pFrame, const uint32_t nLength) {
+	if (nLength != s_nFrameLength) {
+		return false;
+	}
+
+	static uint8_t a[1536];
+	static uint8_t b[1536];
+	memcpy(a, pFrame, nLength);
+	memcpy(b, s_Frame, nLength);
+
+	for (auto *p : { a, b }) {
+		auto *pUdp = reinterpret_cast<struct t_udp *>(p);
+		pUdp->ip4.id = 0;
+		pUdp->ip4.chksum = 0;
+	}
+
+	return memcmp(a, b, nLength) == 0;
+}
+
+struct Destination {
+	const char *pName;
+	uint32_t nIp;
+	uint8_t mac[ETH_ADDR_LEN];
+};
+
+static uint8_t s_Payload[UDP_DATA_SIZE + 64];
+
+static void fill_payload(const uint32_t nSeed) {
+	for (uint32_t i = 0; i < sizeof(s_Payload); i++) {
+		s_Payload[i] = static_cast<uint8_t>((i * 31U) + nSeed);
+	}
+}
+
+static void send_zero_copy(const int nHandle, const uint32_t nRemoteIp, const uint32_t nLength) {
+	auto *pBuffer = net::udp_get_send_buffer(nHandle, nRemoteIp, REMOTE_PORT);
+	memcpy(pBuffer, s_Payload, nLength);
+	net::udp_send_buffer(nLength);
+}
+
+static void test_frames(const int nHandle) {
+	const Destination destinations[] = {
+			{ "unicast", UNICAST_IP, { 0x02, 0x00, 0x0A, 0x00, 0x00, 0x14 } },
+			{ "broadcast", 0xFFFFFFFF, { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF } },
+			{ "directed broadcast", DIRECTED_BROADCAST, { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF } },
+			{ "multicast", MULTICAST_IP, { 0x01, 0x00, 0x5E, 0x7F, 0x00, 0x01 } }
+	};
+
+	static uint8_t reference[1536];
+	char aText[96];
+
+	for (const auto& destination : destinations) {
+		for (const uint32_t nLength : { 0U, 1U, 530U, 638U, static_cast<uint32_t>(UDP_DATA_SIZE) }) {
+			fill_payload(nLength);
+
+			/*
+			 * Unicast not resolved: the two copy send through arp_send
+			 */
+			if (destination.nIp == UNICAST_IP) {
+				s_bResolved = false;
+				const auto nCopied = s_nCopied;
+				net::udp_send(nHandle, s_Payload, nLength, destination.nIp, REMOTE_PORT);
+				snprintf(aText, sizeof(aText), "%s %u: ARP path frame", destination.pName, nLength);
+				check((s_nCopied == nCopied + 1) && is_valid(s_Frame, s_nFrameLength, destination.mac, destination.nIp, s_Payload, nLength), aText);
+				memcpy(reference, s_Frame, s_nFrameLength);
+
+				s_bResolved = true;
+			}
+
+			const auto nInPlace = s_nInPlace;
+			net::udp_send(nHandle, s_Payload, nLength, destination.nIp, REMOTE_PORT);
+			snprintf(aText, sizeof(aText), "%s %u: template frame", destination.pName, nLength);
+			check((s_nInPlace == nInPlace + 1) && is_valid(s_Frame, s_nFrameLength, destination.mac, destination.nIp, s_Payload, nLength), aText);
+
+			if (destination.nIp == UNICAST_IP) {
+				snprintf(aText, sizeof(aText), "%s %u: template frame is the ARP path frame", destination.pName, nLength);
+				check(is_same(reference, UDP_PACKET_HEADERS_SIZE + nLength), aText);
+			}
+
+			memcpy(reference, s_Frame, s_nFrameLength);
+
+			send_zero_copy(nHandle, destination.nIp, nLength);
+			snprintf(aText, sizeof(aText), "%s %u: zero-copy frame is the template frame", destination.pName, nLength);
+			check((s_nInPlace == nInPlace + 2) && is_same(reference, UDP_PACKET_HEADERS_SIZE + nLength), aText);
+		}
+	}
+
+	/*
+	 * Zero-copy to a destination not resolved: the payload is written in the ARP send packet
+	 */
+	s_bResolved = false;
+	fill_payload(7);
+	const auto nCopied = s_nCopied;
+	send_zero_copy(nHandle, UNICAST_IP, 530);
+	check((s_nCopied == nCopied + 1) && is_valid(s_Frame, s_nFrameLength, UNICAST_MAC, UNICAST_IP, s_Payload, 530), "zero-copy not resolved: ARP path frame");
+	s_bResolved = true;
+
+	/*
+	 * The payload is truncated to UDP_DATA_SIZE
+	 */
+	fill_payload(3);
+	net::udp_send(nHandle, s_Payload, sizeof(s_Payload), MULTICAST_IP, REMOTE_PORT);
+	check(is_valid(s_Frame, s_nFrameLength, destinations[3].mac, MULTICAST_IP, s_Payload, UDP_DATA_SIZE), "template: truncated to UDP_DATA_SIZE");
+
+	/*
+	 * More destinations than templates, the templates are reused round robin
+	 */
+	bool bValid = true;
+
+	for (uint32_t nRound = 0; nRound < 3; nRound++) {
+		for (uint32_t nUniverse = 1; nUniverse <= (UDP_TX_TEMPLATES + 3); nUniverse++) {
+			const auto nIp = 0xFFEF | (nUniverse << 24);
+			const uint8_t mac[ETH_ADDR_LEN] = { 0x01, 0x00, 0x5E, 0x7F, 0x00, static_cast<uint8_t>(nUniverse) };
+			fill_payload(nUniverse + nRound);
+			net::udp_send(nHandle, s_Payload, 530, nIp, REMOTE_PORT);
+			bValid &= is_valid(s_Frame, s_nFrameLength, mac, nIp, s_Payload, 530);
+		}
+	}
+
+	check(bValid, "more destinations than UDP_TX_TEMPLATES");
+
+	/*
+	 * A new local address invalidates the templates
+	 */
+	net::globals::netif_default.ip.addr = OTHER_IP;
+	net::udp_set_ip();
+	fill_payload(11);
+	net::udp_send(nHandle, s_Payload, 530, MULTICAST_IP, REMOTE_PORT);
+	check(is_valid(s_Frame, s_nFrameLength, destinations[3].mac, MULTICAST_IP, s_Payload, 530), "udp_set_ip: the new source address");
+
+	net::globals::netif_default.ip.addr = OWN_IP;
+	net::udp_set_ip();
+}
+
+/*
+ * Benchmark
+ */
+
+static uint64_t cycles() {
+#if defined (__x86_64__) || defined (__i386__)
+	return __rdtsc();
+#else
+	return static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+}
+
+enum class Path {
+	ARP, TEMPLATE, ZERO_COPY
+};
+
+/**
+ * Bytes copied for each packet
+ * ARP: the payload into the send packet, then the frame into the Tx DMA buffer
+ * TEMPLATE: the headers and the payload into the Tx DMA buffer
+ * ZERO_COPY: the headers, the sender writes its payload in place
+ */
+static uint32_t bytes_copied(const Path path, const uint32_t nLength) {
+	constexpr auto HEADERS_SIZE = static_cast<uint32_t>(UDP_PACKET_HEADERS_SIZE);
+
+	switch (path) {
+	case Path::ARP:
+		return nLength + HEADERS_SIZE + nLength;
+	case Path::TEMPLATE:
+		return HEADERS_SIZE + nLength;
+	default:
+		return HEADERS_SIZE;
+	}
+}
+
+static void bench(const int nHandle, const Path path, const uint32_t nLength) {
+	static constexpr uint32_t PACKETS = 200000;
+	static const char *pName[] = { "ARP path (two copies)", "template", "zero-copy" };
+
+	s_bKeepFrame = false;
+	s_bResolved = (path != Path::ARP);
+	fill_payload(0);
+
+	const auto nInPlace = s_nInPlace;
+	const auto nCopied = s_nCopied;
+	const auto nStartNanos = std::chrono::steady_clock::now();
+	const auto nStartCycles = cycles();
+
+	for (uint32_t i = 0; i < PACKETS; i++) {
+		if (path == Path::ZERO_COPY) {
+			auto *pBuffer = net::udp_get_send_buffer(nHandle, UNICAST_IP, REMOTE_PORT);
+			// The sender builds its payload in place, as E131Controller::HandleDmxOut
+			pBuffer[0] = static_cast<uint8_t>(i);
+			net::udp_send_buffer(nLength);
+		} else {
+			s_Payload[0] = static_cast<uint8_t>(i);
+			net::udp_send(nHandle, s_Payload, nLength, UNICAST_IP, REMOTE_PORT);
+		}
+	}
+
+	const auto nCycles = cycles() - nStartCycles;
+	const auto nNanos = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - nStartNanos).count();
+
+	const auto nSent = (s_nInPlace - nInPlace) + (s_nCopied - nCopied);
+	const auto bInPlace = (path == Path::ARP) ? (s_nCopied - nCopied == PACKETS) : (s_nInPlace - nInPlace == PACKETS);
+
+	printf("%-22s %4u bytes payload: %5u bytes copied/packet, %6.0f cycles/packet, %5.0f ns/packet\n", pName[static_cast<uint32_t>(path)], nLength,
+			bytes_copied(path, nLength), static_cast<double>(nCycles) / PACKETS, static_cast<double>(nNanos) / PACKETS);
+
+	if ((nSent != PACKETS) || !bInPlace) {
+		printf("FAIL %u packets sent on the wrong path\n", nSent);
+		s_nFailed++;
+	}
+
+	s_bKeepFrame = true;
+	s_bResolved = true;
+}
+
+int main() {
+	memcpy(net::globals::netif_default.hwaddr, OWN_MAC, ETH_ADDR_LEN);
+	net::globals::netif_default.ip.addr = OWN_IP;
+	net::globals::netif_default.netmask.addr = 0x000000FF;
+	net::globals::nBroadcastMask = ~(net::globals::netif_default.netmask.addr);
+
+	net::udp_init();
+	const auto nHandle = net::udp_begin(LOCAL_PORT);
+
+	test_frames(nHandle);
+
+	for (const uint32_t nLength : { 530U, 638U }) {
+		bench(nHandle, Path::ARP, nLength);
+		bench(nHandle, Path::TEMPLATE, nLength);
+		bench(nHandle, Path::ZERO_COPY, nLength);
+	}
+
+	if (s_nFailed != 0) {
+		printf("%d failed\n", s_nFailed);
+		return 1;
+	}
+
+	puts("ok");
+	return 0;
+}
@@ -49,6 +49,14 @@ public:
 		Dmx::Get()->SetPortDirection(nPortIndex, dmx::PortDirection::INP, true);
 	}
 
+	static bool SendRawQueued(const uint32_t nPortIndex, const uint8_t *pRdmData, const uint32_t nLength, const uint32_t nTag) {
+		return Dmx::Get()->RdmSendRawQueued(nPortIndex, pRdmData, nLength, nTag);
+	}
+
+	static uint32_t GetQueueDepth(const uint32_t nPortIndex) {
+		return Dmx::Get()->GetRdmQueueDepth(nPortIndex);
+	}
+
 	static void Send(const uint32_t nPortIndex, struct TRdmMessage *pRdmCommand) {
 		assert(nPortIndex < dmx::config::max::PORTS);
 		assert(pRdmCommand != nullptr);
@@ -91,6 +99,10 @@ public:
 		return Dmx::Get()->RdmReceive(nPortIndex);
 	}
 
+	static const uint8_t *ReceiveQueued(const uint32_t nPortIndex, uint32_t& nTag) {
+		return Dmx::Get()->RdmReceiveQueued(nPortIndex, nTag);
+	}
+
 	static const uint8_t *ReceiveTimeOut(const uint32_t nPortIndex, const uint16_t nTimeOut) {
 		return Dmx::Get()->RdmReceiveTimeOut(nPortIndex, nTimeOut);
 	}
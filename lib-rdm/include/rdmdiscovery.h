@@ -43,7 +43,11 @@ namespace rdmdiscovery {
 #endif
 static constexpr uint32_t UNMUTE_COUNTER = 3;
 static constexpr uint32_t MUTE_COUNTER = 10;
-static constexpr uint32_t DISCOVERY_STACK_SIZE = rdmtod::TOD_TABLE_SIZE;
+/*
+ * Depth first: a DUB pops one range and pushes two halves.
+ * The stack depth is bounded by the 48-bit UID space, not by the number of devices.
+ */
+static constexpr uint32_t DISCOVERY_STACK_SIZE = 48 + 1;
 static constexpr uint32_t DISCOVERY_COUNTER = 3;
 static constexpr uint32_t QUIKFIND_COUNTER = 5;
 static constexpr uint32_t QUIKFIND_DISCOVERY_COUNTER = 5;
@@ -62,9 +66,17 @@ enum class State {
 };
 }  // namespace rdmdiscovery
 
+/*
+ * One instance per port. The instances are stepped with Run() in turn, so each port
+ * sends its next DUB/(UN)MUTE while the other ports are waiting for responses.
+ */
 class RDMDiscovery {
 public:
-	RDMDiscovery(const uint8_t *pUid);
+	RDMDiscovery() {
+		m_Discovery.stack.nTop = -1;
+	}
+
+	void SetUid(const uint8_t *pUid);
 
 	bool Full(const uint32_t nPortIndex, RDMTod *pRDMTod);
 	bool Incremental(const uint32_t nPortIndex, RDMTod *pRDMTod);
@@ -196,6 +208,7 @@ private:
 		uint32_t nMicros;
 		bool bCommandRunning;
 		uint8_t uid[RDM_UID_SIZE];
+		uint8_t uidMuteFailed[RDM_UID_SIZE];	///< Answers DISC_UNIQUE_BRANCH but not DISC_MUTE, its branches are split
 	} m_QuikFind;
 
 	struct {
@@ -210,7 +223,7 @@ private:
 		struct {
 			uint64_t nLowerBound;
 			uint64_t nUpperBound;
-		} tree[1024];
+		} tree[256];
 
 		uint32_t nTreeIndex;
 	} debug;
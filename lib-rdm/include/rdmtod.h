@@ -2,7 +2,7 @@
  * @file rdmtod.h
  *
  */
-/* Copyright (C) 2017-2023 by Arjan van Vught mailto:info@orangepi-dmx.nl
+/* Copyright (C) 2017-2024 by Arjan van Vught mailto:info@orangepi-dmx.nl
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -29,6 +29,7 @@
 #include <cstdint>
 #include <cstring>
 #include <cassert>
+#include <algorithm>
 #ifndef NDEBUG
 # include <cstdio>
 #endif
@@ -42,130 +43,231 @@ namespace rdmtod {
 # define RDM_DISCOVERY_TOD_TABLE_SIZE 200U
 #endif
 static constexpr uint32_t TOD_TABLE_SIZE = RDM_DISCOVERY_TOD_TABLE_SIZE;
-static constexpr uint32_t MUTES_TABLE_SIZE = (TOD_TABLE_SIZE + 32) / 32;
+static constexpr uint32_t CHANGES_SIZE = 32;
 static constexpr uint32_t INVALID_ENTRY = static_cast<uint32_t>(~0);
-struct Tod {
-	uint8_t uid[RDM_UID_SIZE];
-};
+/**
+ * A TOD entry is the 48-bit UID, most significant byte first, packed in an uint64_t.
+ * Bit 48 is the mute flag, it is masked off for the comparisons.
+ */
+static constexpr uint64_t UID_MASK = (static_cast<uint64_t>(1) << 48) - 1;
+static constexpr uint64_t MUTED = static_cast<uint64_t>(1) << 48;
+
+inline uint64_t uid_pack(const uint8_t *pUid) {
+	uint64_t nUid = 0;
+
+	for (uint32_t i = 0; i < RDM_UID_SIZE; i++) {
+		nUid = (nUid << 8) | pUid[i];
+	}
+
+	return nUid;
+}
+
+inline void uid_unpack(uint64_t nUid, uint8_t *pUid) {
+	for (auto i = RDM_UID_SIZE; i-- > 0;) {
+		pUid[i] = static_cast<uint8_t>(nUid);
+		nUid >>= 8;
+	}
+}
 }  // namespace rdmtod
 
+/**
+ * The TOD is kept sorted, lookups are a binary search.
+ * Every change increments the generation and is recorded in the added/removed change lists,
+ * so that only the differences need to be reported. When a change list is full, the changes
+ * are flagged as overflowed and the full TOD must be reported.
+ */
 class RDMTod {
 public:
 	RDMTod() {
-		for (uint32_t i = 0; i < rdmtod::TOD_TABLE_SIZE; i++) {
-			memcpy(&m_Tod[i], UID_ALL, RDM_UID_SIZE);
-		}
-
-		for (uint32_t i = 0; i < rdmtod::MUTES_TABLE_SIZE; i++) {
-			m_nMutes[i] = 0;
-		}
+		m_Changes.nAdded = 0;
+		m_Changes.nRemoved = 0;
+		m_Changes.bOverflow = false;
 	}
 
 	~RDMTod() = default;
 
 	void Reset() {
-		for (uint32_t i = 0; i < m_nEntries; i++) {
-			memcpy(&m_Tod[i], UID_ALL, RDM_UID_SIZE);
-		}
-
 		m_nEntries = 0;
+		m_nSavedIndex = rdmtod::INVALID_ENTRY;
+		m_nGeneration++;
 
-		for (uint32_t i = 0; i < rdmtod::MUTES_TABLE_SIZE; i++) {
-			m_nMutes[i] = 0;
-		}
+		m_Changes.nAdded = 0;
+		m_Changes.nRemoved = 0;
+		m_Changes.bOverflow = true;
 	}
 
 	bool AddUid(const uint8_t *pUid) {
-		if (m_nEntries == rdmtod::TOD_TABLE_SIZE) {
+		const auto nUid = rdmtod::uid_pack(pUid);
+		const auto nIndex = LowerBound(nUid);
+
+		if ((nIndex < m_nEntries) && ((m_Tod[nIndex] & rdmtod::UID_MASK) == nUid)) {
 			return false;
 		}
 
-		if (Exist(pUid)) {
+		if (m_nEntries == rdmtod::TOD_TABLE_SIZE) {
 			return false;
 		}
 
-		memcpy(&m_Tod[m_nEntries++], pUid, RDM_UID_SIZE);
+		memmove(&m_Tod[nIndex + 1], &m_Tod[nIndex], (m_nEntries - nIndex) * sizeof(m_Tod[0]));
+		m_Tod[nIndex] = nUid;
+		m_nEntries++;
+
+		if ((m_nSavedIndex != rdmtod::INVALID_ENTRY) && (m_nSavedIndex >= nIndex)) {
+			m_nSavedIndex++;
+		}
+
+		RecordChange(nUid, m_Changes.added, m_Changes.nAdded, m_Changes.removed, m_Changes.nRemoved);
 
 		return true;
 	}
 
+	/**
+	 * Merges nCount UIDs (6 bytes each) into the TOD.
+	 * The new UIDs are appended and then sorted in, which is a single pass when pTable is sorted.
+	 * @return the number of UIDs added
+	 */
+	uint32_t AddUids(const uint8_t *pTable, const uint32_t nCount) {
+		assert(pTable != nullptr);
+
+		const auto nEntries = m_nEntries;
+
+		for (uint32_t i = 0; (i < nCount) && (m_nEntries < rdmtod::TOD_TABLE_SIZE); i++) {
+			const auto nUid = rdmtod::uid_pack(&pTable[i * RDM_UID_SIZE]);
+			const auto nIndex = LowerBound(nUid, nEntries);
+
+			if ((nIndex < nEntries) && ((m_Tod[nIndex] & rdmtod::UID_MASK) == nUid)) {
+				continue;
+			}
+
+			m_Tod[m_nEntries++] = nUid | NEW;
+		}
+
+		if (m_nEntries == nEntries) {
+			return 0;
+		}
+
+		// Insertion sort, [0, nEntries) is sorted already
+		for (auto i = nEntries; i < m_nEntries; i++) {
+			const auto nUid = m_Tod[i];
+			auto j = i;
+
+			while ((j > 0) && ((m_Tod[j - 1] & rdmtod::UID_MASK) > (nUid & rdmtod::UID_MASK))) {
+				m_Tod[j] = m_Tod[j - 1];
+				j--;
+			}
+
+			m_Tod[j] = nUid;
+		}
+
+		// Remove the duplicates within pTable, these are all flagged as new
+		uint32_t nLast = 0;
+
+		for (uint32_t i = 1; i < m_nEntries; i++) {
+			if ((m_Tod[i] & rdmtod::UID_MASK) != (m_Tod[nLast] & rdmtod::UID_MASK)) {
+				m_Tod[++nLast] = m_Tod[i];
+			}
+		}
+
+		m_nEntries = nLast + 1;
+		m_nSavedIndex = rdmtod::INVALID_ENTRY;
+
+		for (uint32_t i = 0; i < m_nEntries; i++) {
+			if ((m_Tod[i] & NEW) == NEW) {
+				m_Tod[i] &= ~NEW;
+				RecordChange(m_Tod[i], m_Changes.added, m_Changes.nAdded, m_Changes.removed, m_Changes.nRemoved);
+			}
+		}
+
+		const auto nAdded = m_nEntries - nEntries;
+
+		return nAdded;
+	}
+
 	uint32_t GetUidCount() const {
 		return m_nEntries;
 	}
 
 	bool CopyUidEntry(uint32_t nIndex, uint8_t uid[RDM_UID_SIZE]) {
-		if (nIndex > m_nEntries) {
+		if (nIndex >= m_nEntries) {
 			memcpy(uid, UID_ALL, RDM_UID_SIZE);
 			return false;
 		}
 
-		memcpy(uid, &m_Tod[nIndex], RDM_UID_SIZE);
+		rdmtod::uid_unpack(m_Tod[nIndex], uid);
 		return true;
 	}
 
 	void Copy(uint8_t *pTable) {
+		Copy(pTable, 0, m_nEntries);
+	}
+
+	/**
+	 * Copies at most nCount UIDs, starting at entry nOffset, as 6 bytes each.
+	 * @return the number of UIDs copied
+	 */
+	uint32_t Copy(uint8_t *pTable, const uint32_t nOffset, uint32_t nCount) {
 		DEBUG_ENTRY
-		DEBUG_PRINTF("m_nEntries=%u", static_cast<unsigned int>(m_nEntries));
+		DEBUG_PRINTF("m_nEntries=%u, nOffset=%u, nCount=%u", static_cast<unsigned int>(m_nEntries), static_cast<unsigned int>(nOffset), static_cast<unsigned int>(nCount));
 		assert(pTable != nullptr);
 
-		const auto *pSrc = reinterpret_cast<const uint8_t*>(m_Tod);
-		auto *pDst = pTable;
+		if (nOffset >= m_nEntries) {
+			DEBUG_EXIT
+			return 0;
+		}
 
-		for (uint32_t i = 0; i < (m_nEntries * RDM_UID_SIZE); i++) {
-			*pDst++ = *pSrc++;
+		nCount = std::min(nCount, m_nEntries - nOffset);
+
+		for (uint32_t i = 0; i < nCount; i++) {
+			rdmtod::uid_unpack(m_Tod[nOffset + i], &pTable[i * RDM_UID_SIZE]);
 		}
 
 		DEBUG_EXIT
+		return nCount;
 	}
 
 	bool Delete(const uint8_t *pUid) {
-		bool found = false;
-		uint32_t i;
-
-		for (i = 0; i < m_nEntries; i++) {
-			if (memcmp(&m_Tod[i], pUid, RDM_UID_SIZE) == 0) {
-				found = true;
-				break;
-			}
-		}
+		const auto nUid = rdmtod::uid_pack(pUid);
+		const auto nIndex = Find(nUid);
 
-		if (!found) {
+		if (nIndex == rdmtod::INVALID_ENTRY) {
 			return false;
 		}
 
-		if (i == rdmtod::TOD_TABLE_SIZE - 1) {
-			memcpy(&m_Tod[i], UID_ALL, RDM_UID_SIZE);
-		} else {
-			for (; i < m_nEntries; i++) {
-				memcpy(&m_Tod[i], &m_Tod[i + 1], RDM_UID_SIZE);
+		m_nEntries--;
+		memmove(&m_Tod[nIndex], &m_Tod[nIndex + 1], (m_nEntries - nIndex) * sizeof(m_Tod[0]));
+
+		if (m_nSavedIndex != rdmtod::INVALID_ENTRY) {
+			if (m_nSavedIndex == nIndex) {
+				m_nSavedIndex = rdmtod::INVALID_ENTRY;
+			} else if (m_nSavedIndex > nIndex) {
+				m_nSavedIndex--;
 			}
 		}
 
-		m_nEntries--;
+		RecordChange(nUid, m_Changes.removed, m_Changes.nRemoved, m_Changes.added, m_Changes.nAdded);
 
 		return true;
 	}
 
 	bool Exist(const uint8_t *pUid) {
-		for (uint32_t nIndex = 0 ; nIndex < m_nEntries; nIndex++) {
-			if (memcmp(&m_Tod[nIndex], pUid, RDM_UID_SIZE) == 0) {
-				m_nSavedIndex = nIndex;
-				return true;
-			}
-		}
-
-		m_nSavedIndex = rdmtod::INVALID_ENTRY;
-		return false;
+		m_nSavedIndex = Find(rdmtod::uid_pack(pUid));
+		return (m_nSavedIndex != rdmtod::INVALID_ENTRY);
 	}
 
 	const uint8_t *Next() {
+		if (m_nEntries == 0) {
+			m_nSavedIndex = rdmtod::INVALID_ENTRY;
+			return UID_ALL;
+		}
+
 		m_nSavedIndex++;
 
-		if (m_nSavedIndex == m_nEntries) {
+		if (m_nSavedIndex >= m_nEntries) {
 			m_nSavedIndex = 0;
 		}
 
-		return m_Tod[m_nSavedIndex].uid;
+		rdmtod::uid_unpack(m_Tod[m_nSavedIndex], m_NextUid);
+		return m_NextUid;
 	}
 
 	void Mute() {
@@ -173,10 +275,7 @@ public:
 			return;
 		}
 
-		const auto i = m_nSavedIndex / 32;
-		const auto shift = m_nSavedIndex - (i * 32);
-
-		m_nMutes[i] |= (1U << shift);
+		m_Tod[m_nSavedIndex] |= rdmtod::MUTED;
 	}
 
 	void UnMute() {
@@ -184,15 +283,12 @@ public:
 			return;
 		}
 
-		const auto i = m_nSavedIndex / 32;
-		const auto shift = m_nSavedIndex - (i * 32);
-
-		m_nMutes[i] &= ~(1U << shift);
+		m_Tod[m_nSavedIndex] &= ~rdmtod::MUTED;
 	}
 
 	void UnMuteAll() {
-		for (uint32_t i = 0; i < rdmtod::MUTES_TABLE_SIZE; i++) {
-			m_nMutes[i] = 0;
+		for (uint32_t i = 0; i < m_nEntries; i++) {
+			m_Tod[i] &= ~rdmtod::MUTED;
 		}
 	}
 
@@ -201,22 +297,59 @@ public:
 			return true;
 		}
 
-		const auto i = m_nSavedIndex / 32;
-		const auto mutes = m_nMutes[i];
-		const auto shift = m_nSavedIndex - (i * 32);
+		return (m_Tod[m_nSavedIndex] & rdmtod::MUTED) == rdmtod::MUTED;
+	}
+
+	/*
+	 * Changes
+	 */
+
+	uint32_t GetGeneration() const {
+		return m_nGeneration;
+	}
+
+	bool IsChangesOverflow() const {
+		return m_Changes.bOverflow;
+	}
+
+	uint32_t GetAddedCount() const {
+		return m_Changes.nAdded;
+	}
 
-		return (mutes & (1U << shift)) == (1U << shift);
+	uint32_t GetRemovedCount() const {
+		return m_Changes.nRemoved;
+	}
+
+	void CopyAdded(uint8_t *pTable) const {
+		for (uint32_t i = 0; i < m_Changes.nAdded; i++) {
+			rdmtod::uid_unpack(m_Changes.added[i], &pTable[i * RDM_UID_SIZE]);
+		}
+	}
+
+	void CopyRemoved(uint8_t *pTable) const {
+		for (uint32_t i = 0; i < m_Changes.nRemoved; i++) {
+			rdmtod::uid_unpack(m_Changes.removed[i], &pTable[i * RDM_UID_SIZE]);
+		}
+	}
+
+	void ClearChanges() {
+		m_Changes.nAdded = 0;
+		m_Changes.nRemoved = 0;
+		m_Changes.bOverflow = false;
 	}
 
 	void Dump([[maybe_unused]] uint32_t nCount) {
 #ifndef NDEBUG
-	if (nCount > rdmtod::TOD_TABLE_SIZE) {
-		nCount = rdmtod::TOD_TABLE_SIZE;
+	if (nCount > m_nEntries) {
+		nCount = m_nEntries;
 	}
 
-	printf("[%u]\n", static_cast<unsigned int>(nCount));
+	printf("[%u] generation=%u, added=%u, removed=%u%s\n", static_cast<unsigned int>(nCount), static_cast<unsigned int>(m_nGeneration),
+			static_cast<unsigned int>(m_Changes.nAdded), static_cast<unsigned int>(m_Changes.nRemoved), m_Changes.bOverflow ? ", overflow" : "");
 	for (uint32_t i = 0 ; i < nCount; i++) {
-		printf("%.2x%.2x:%.2x%.2x%.2x%.2x\n", m_Tod[i].uid[0], m_Tod[i].uid[1], m_Tod[i].uid[2], m_Tod[i].uid[3], m_Tod[i].uid[4], m_Tod[i].uid[5]);
+		uint8_t uid[RDM_UID_SIZE];
+		rdmtod::uid_unpack(m_Tod[i], uid);
+		printf("%.2x%.2x:%.2x%.2x%.2x%.2x%s\n", uid[0], uid[1], uid[2], uid[3], uid[4], uid[5], (m_Tod[i] & rdmtod::MUTED) ? " M" : "");
 	}
 #endif
 	}
@@ -228,10 +361,76 @@ public:
 	}
 
 private:
+	/**
+	 * @return the index of the first entry not less than nUid, searched in [0, nEntries)
+	 */
+	uint32_t LowerBound(const uint64_t nUid, const uint32_t nEntries) const {
+		uint32_t nLow = 0;
+		uint32_t nHigh = nEntries;
+
+		while (nLow < nHigh) {
+			const auto nMiddle = (nLow + nHigh) / 2;
+
+			if ((m_Tod[nMiddle] & rdmtod::UID_MASK) < nUid) {
+				nLow = nMiddle + 1;
+			} else {
+				nHigh = nMiddle;
+			}
+		}
+
+		return nLow;
+	}
+
+	uint32_t LowerBound(const uint64_t nUid) const {
+		return LowerBound(nUid, m_nEntries);
+	}
+
+	uint32_t Find(const uint64_t nUid) const {
+		const auto nIndex = LowerBound(nUid);
+
+		if ((nIndex < m_nEntries) && ((m_Tod[nIndex] & rdmtod::UID_MASK) == nUid)) {
+			return nIndex;
+		}
+
+		return rdmtod::INVALID_ENTRY;
+	}
+
+	/**
+	 * A change cancels the opposite change of the same UID, when still pending.
+	 */
+	void RecordChange(const uint64_t nUid, uint64_t *pList, uint32_t& nList, uint64_t *pOpposite, uint32_t& nOpposite) {
+		m_nGeneration++;
+
+		for (uint32_t i = 0; i < nOpposite; i++) {
+			if (pOpposite[i] == nUid) {
+				pOpposite[i] = pOpposite[--nOpposite];
+				return;
+			}
+		}
+
+		if (nList == rdmtod::CHANGES_SIZE) {
+			m_Changes.bOverflow = true;
+			return;
+		}
+
+		pList[nList++] = nUid;
+	}
+
+private:
+	static constexpr uint64_t NEW = static_cast<uint64_t>(1) << 49;	///< Only set during AddUids
+
 	uint32_t m_nEntries { 0 };
 	uint32_t m_nSavedIndex { rdmtod::INVALID_ENTRY };
-	uint32_t m_nMutes[rdmtod::MUTES_TABLE_SIZE];
-	rdmtod::Tod m_Tod[rdmtod::TOD_TABLE_SIZE];
+	uint32_t m_nGeneration { 0 };
+	struct {
+		uint64_t added[rdmtod::CHANGES_SIZE];
+		uint64_t removed[rdmtod::CHANGES_SIZE];
+		uint32_t nAdded;
+		uint32_t nRemoved;
+		bool bOverflow;
+	} m_Changes;
+	uint64_t m_Tod[rdmtod::TOD_TABLE_SIZE];
+	uint8_t m_NextUid[RDM_UID_SIZE];
 };
 
 #endif /* RDMTOD_H_ */
@@ -76,7 +76,7 @@ static void print_uid([[maybe_unused]] uint64_t nUid) {
 #define NEW_STATE(state, late)	NewState (state, late, __LINE__);
 #define SAVED_STATE()			SavedState (__LINE__);
 
-RDMDiscovery::RDMDiscovery(const uint8_t *pUid) {
+void RDMDiscovery::SetUid(const uint8_t *pUid) {
 	memcpy(m_Uid, pUid, RDM_UID_SIZE);
 	m_Message.SetSrcUid(pUid);
 
@@ -163,6 +163,7 @@ bool RDMDiscovery::Start(const uint32_t nPortIndex, RDMTod *pRDMTod, const bool
 
 	m_QuikFind.nCounter = rdmdiscovery::QUIKFIND_COUNTER;
 	m_QuikFind.bCommandRunning = false;
+	memset(m_QuikFind.uidMuteFailed, 0, RDM_UID_SIZE);
 
 	m_QuikFindDiscovery.nCounter = rdmdiscovery::QUIKFIND_DISCOVERY_COUNTER;
 	m_QuikFindDiscovery.bCommandRunning = false;
@@ -385,8 +386,10 @@ void RDMDiscovery::Process() {
 		}
 
 #ifndef NDEBUG
-		debug.tree[debug.nTreeIndex].nLowerBound = m_Discovery.nLowerBound;
-		debug.tree[debug.nTreeIndex++].nUpperBound = m_Discovery.nUpperBound;
+		if (debug.nTreeIndex < (sizeof(debug.tree) / sizeof(debug.tree[0]))) {
+			debug.tree[debug.nTreeIndex].nLowerBound = m_Discovery.nLowerBound;
+			debug.tree[debug.nTreeIndex++].nUpperBound = m_Discovery.nUpperBound;
+		}
 #endif
 
 		if (m_Discovery.nLowerBound == m_Discovery.nUpperBound) {
@@ -475,7 +478,7 @@ void RDMDiscovery::Process() {
 			return;
 		}
 
-		if (IsValidDiscoveryResponse(m_QuikFind.uid)) {
+		if (IsValidDiscoveryResponse(m_QuikFind.uid) && (memcmp(m_QuikFind.uid, m_QuikFind.uidMuteFailed, RDM_UID_SIZE) != 0)) {
 			NEW_STATE(rdmdiscovery::State::QUICKFIND, true);
 			return;
 		}
@@ -492,6 +495,9 @@ void RDMDiscovery::Process() {
 		break;
 	case rdmdiscovery::State::QUICKFIND:	///< QUICKFIND
 		if (m_QuikFind.nCounter == 0) {
+			// No DISC_MUTE response: the branch is split as for a collision, so that the other devices are still found
+			memcpy(m_QuikFind.uidMuteFailed, m_QuikFind.uid, RDM_UID_SIZE);
+			m_QuikFind.nCounter = rdmdiscovery::QUIKFIND_COUNTER;
 			m_QuikFind.bCommandRunning = false;
 			NEW_STATE(rdmdiscovery::State::QUICKFIND_DISCOVERY, false);
 			return;
@@ -510,7 +516,6 @@ void RDMDiscovery::Process() {
 			m_Message.SetPd(nullptr, 0);
 			m_Message.Send(m_nPortIndex);
 
-			m_QuikFind.nCounter = rdmdiscovery::QUIKFIND_COUNTER;
 			m_QuikFind.nMicros = Hardware::Get()->Micros();
 			m_QuikFind.bCommandRunning = true;
 			return;
@@ -572,14 +577,14 @@ void RDMDiscovery::Process() {
 
 		m_pResponse = const_cast<uint8_t *>(m_Message.Receive(m_nPortIndex));
 
-		if ((m_pResponse != nullptr) && (IsValidDiscoveryResponse(m_QuikFind.uid))) {
+		if ((m_pResponse != nullptr) && IsValidDiscoveryResponse(m_QuikFind.uid) && (memcmp(m_QuikFind.uid, m_QuikFind.uidMuteFailed, RDM_UID_SIZE) != 0)) {
 			m_QuikFindDiscovery.nCounter = rdmdiscovery::QUIKFIND_DISCOVERY_COUNTER;
 			m_QuikFindDiscovery.bCommandRunning = false;
 			NEW_STATE(rdmdiscovery::State::QUICKFIND, true);
 			return;
 		}
 
-		if ((m_pResponse != nullptr) && (!IsValidDiscoveryResponse(m_QuikFind.uid))) {
+		if (m_pResponse != nullptr) {
 			m_QuikFindDiscovery.nCounter = rdmdiscovery::QUIKFIND_DISCOVERY_COUNTER;
 			m_QuikFindDiscovery.bCommandRunning = false;
 			NEW_STATE(rdmdiscovery::State::DUB, false);
@@ -23,13 +23,16 @@
  * THE SOFTWARE.
  */
 
+#include <cstdint>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
 #include <dirent.h>
 #include <cassert>
 
-#include "httpd/httpd.h"
+#include <zlib.h>
+
+#include "httpd/http.h"
 
 static constexpr char supported_extensions[static_cast<int>(http::contentTypes::NOT_DEFINED)][8] = {
 		"html",
@@ -45,6 +48,8 @@ static constexpr char content_header[] =
 		"\tconst char *pContent;\n"
 		"\tconst uint32_t nContentLength;\n"
 		"\tconst http::contentTypes contentType;\n"
+		"\tconst char *pETag;\n"
+		"\tconst bool isGzip;\n"
 		"};\n\n"
 		"static constexpr struct FilesContent HttpContent[] = {\n";
 
@@ -86,7 +91,48 @@ static http::contentTypes getContentType(const char *pFileName) {
 	return http::contentTypes::NOT_DEFINED;
 }
 
-static int convert_to_h(const char *pFileName) {
+/**
+ * The content is stored gzip compressed when that is smaller.
+ * No file name and no time stamp in the gzip header, the output only depends on the content.
+ */
+
+static int gzip_compress(const unsigned char *pIn, const int nInLength, unsigned char *pOut, const int nOutSize) {
+	z_stream stream;
+	memset(&stream, 0, sizeof(z_stream));
+
+	if (deflateInit2(&stream, Z_BEST_COMPRESSION, Z_DEFLATED, 15 + 16, 9, Z_DEFAULT_STRATEGY) != Z_OK) {
+		return -1;
+	}
+
+	stream.next_in = const_cast<unsigned char *>(pIn);
+	stream.avail_in = static_cast<uInt>(nInLength);
+	stream.next_out = pOut;
+	stream.avail_out = static_cast<uInt>(nOutSize);
+
+	const auto nResult = deflate(&stream, Z_FINISH);
+	const auto nOutLength = static_cast<int>(stream.total_out);
+
+	deflateEnd(&stream);
+
+	return (nResult == Z_STREAM_END) ? nOutLength : -1;
+}
+
+/**
+ * FNV-1a 32-bit
+ */
+
+static unsigned hash(const unsigned char *pData, const int nLength) {
+	unsigned nHash = 2166136261U;
+
+	for (int i = 0; i < nLength; i++) {
+		nHash ^= pData[i];
+		nHash *= 16777619U;
+	}
+
+	return nHash;
+}
+
+static int convert_to_h(const char *pFileName, unsigned& nETag, bool& isGzip) {
 	printf("File to convert: %s, ", pFileName);
 
 	auto *pFileIn = fopen(pFileName, "r");
@@ -199,9 +245,15 @@ static int convert_to_h(const char *pFileName) {
 	fwrite(pConstantName, sizeof(char), strlen(pConstantName), pFileContent);
 	fwrite("[] = {\n", sizeof(char), 7, pFileOut);
 
-	unsigned nOffset = 0;
+	fseek(pFileIn, 0, SEEK_END);
+	const auto nFileInSize = static_cast<int>(ftell(pFileIn));
+	fseek(pFileIn, 0, SEEK_SET);
+
+	auto *pContent = new unsigned char[nFileInSize + 1];
+	assert(pContent != nullptr);
+
 	auto doRemoveWhiteSpaces = true;
-	int nFileSize = 0;
+	int nContentLength = 0;
 	int c;
 
 	while ((c = fgetc (pFileIn)) != EOF) {
@@ -217,14 +269,38 @@ static int convert_to_h(const char *pFileName) {
 			}
 		}
 
-		i = snprintf(buffer, sizeof(buffer) - 1, "0x%02X,%c", c, ++nOffset % 16 == 0 ? '\n' : ' ');
+		pContent[nContentLength++] = static_cast<unsigned char>(c);
+	}
+
+	const auto nGzipSize = nContentLength + 64;
+	auto *pGzip = new unsigned char[nGzipSize];
+	assert(pGzip != nullptr);
+
+	const auto nGzipLength = gzip_compress(pContent, nContentLength, pGzip, nGzipSize);
+
+	/*
+	 * The httpd decompresses into its dynamic content buffer for a client not accepting gzip,
+	 * content not fitting in http::BUFSIZE is stored uncompressed.
+	 */
+	isGzip = (nGzipLength > 0) && (nGzipLength < nContentLength) && (nContentLength <= static_cast<int>(http::BUFSIZE));
+
+	const auto *pData = isGzip ? pGzip : pContent;
+	const auto nFileSize = isGzip ? nGzipLength : nContentLength;
+
+	nETag = hash(pData, nFileSize);
+
+	unsigned nOffset = 0;
+
+	for (int n = 0; n < nFileSize; n++) {
+		i = snprintf(buffer, sizeof(buffer) - 1, "0x%02X,%c", pData[n], ++nOffset % 16 == 0 ? '\n' : ' ');
 		assert(i < static_cast<int>(sizeof(buffer)));
 
 		fwrite(buffer, sizeof(char), i, pFileOut);
-
-		nFileSize++;
 	}
 
+	delete [] pContent;
+	delete [] pGzip;
+
 	fwrite("0x00\n};\n", sizeof(char), 8, pFileOut);
 
 	delete [] pFileNameOut;
@@ -233,7 +309,7 @@ static int convert_to_h(const char *pFileName) {
 	fclose(pFileIn);
 	fclose(pFileOut);
 
-	printf("File size: %d\n", nFileSize);
+	printf("File size: %d -> %d%s\n", nContentLength, nFileSize, isGzip ? " gzip" : "");
 
 	return nFileSize;
 }
@@ -299,10 +375,12 @@ int main() {
 				fwrite(pFileName, sizeof(char), i, pFileContent);
 				delete[] pFileName;
 
-				auto nContentLength = convert_to_h(pDirEntry->d_name);
+				unsigned nETag;
+				bool isGzip;
+				auto nContentLength = convert_to_h(pDirEntry->d_name, nETag, isGzip);
 
-				char buffer[64];
-				i = snprintf(buffer, sizeof(buffer) - 1, ", %d, static_cast<http::contentTypes>(%d)", nContentLength, static_cast<int>(contentType));
+				char buffer[128];
+				i = snprintf(buffer, sizeof(buffer) - 1, ", %d, static_cast<http::contentTypes>(%d), \"\\\"%08x\\\"\", %s", nContentLength, static_cast<int>(contentType), nETag, isGzip ? "true" : "false");
 				assert(i < static_cast<int>(sizeof(buffer)));
 				fwrite(buffer, sizeof(char), i, pFileContent);
 
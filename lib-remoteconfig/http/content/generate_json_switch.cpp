@@ -48,7 +48,8 @@ static constexpr char JSON_ENDPOINTS[][MAX_LENGTH] = {
 		"timedate",
 		"rtcalarm",
 		"polltable",
-		"types"
+		"types",
+		"analyzer"
 };
 
 inline uint16_t get_uint(const char *pString) {					/* djb2 */
@@ -1,42 +1,36 @@
 #if !defined (CONFIG_HTTP_HTML_NO_DMX) && (defined(OUTPUT_DMX_SEND) || defined(OUTPUT_DMX_SEND_MULTI))
-# include "dmx.js.h"
+# include "dmx.html.h"
 #endif /* !defined (CONFIG_HTTP_HTML_NO_DMX) && (defined(OUTPUT_DMX_SEND) || defined(OUTPUT_DMX_SEND_MULTI)) */
 #if !defined (CONFIG_HTTP_HTML_NO_RTC) && !defined (DISABLE_RTC)
-# include "rtc.html.h"
+# include "rtc.js.h"
 #endif /* !defined (CONFIG_HTTP_HTML_NO_RTC) && !defined (DISABLE_RTC) */
-#include "static.js.h"
+#include "default.js.h"
 #include "styles.css.h"
-#include "index.js.h"
-#include "date.js.h"
-#if defined (ENABLE_PHY_SWITCH)
-# include "dsa.js.h"
-#endif /* (ENABLE_PHY_SWITCH) */
+#if !defined (CONFIG_HTTP_HTML_NO_RTC) && !defined (DISABLE_RTC)
+# include "rtc.html.h"
+#endif /* !defined (CONFIG_HTTP_HTML_NO_RTC) && !defined (DISABLE_RTC) */
 #if defined (NODE_SHOWFILE)
 # include "showfile.html.h"
 #endif /* (NODE_SHOWFILE) */
-#include "default.js.h"
-#if !defined (CONFIG_HTTP_HTML_NO_RTC) && !defined (DISABLE_RTC)
-# include "rtc.js.h"
-#endif /* !defined (CONFIG_HTTP_HTML_NO_RTC) && !defined (DISABLE_RTC) */
+#include "index.html.h"
+#if !defined (CONFIG_HTTP_HTML_NO_DMX) && (defined(OUTPUT_DMX_SEND) || defined(OUTPUT_DMX_SEND_MULTI))
+# include "dmx.js.h"
+#endif /* !defined (CONFIG_HTTP_HTML_NO_DMX) && (defined(OUTPUT_DMX_SEND) || defined(OUTPUT_DMX_SEND_MULTI)) */
+#include "date.js.h"
+#include "static.js.h"
+#include "index.js.h"
 #if !defined (CONFIG_HTTP_HTML_NO_RDM) && defined (RDM_CONTROLLER)
 # include "rdm.js.h"
 #endif /* !defined (CONFIG_HTTP_HTML_NO_RDM) && defined (RDM_CONTROLLER) */
 #if !defined (CONFIG_HTTP_HTML_NO_TIME)
 # include "time.js.h"
 #endif /* !defined (CONFIG_HTTP_HTML_NO_TIME) */
-#if !defined (CONFIG_HTTP_HTML_NO_RDM) && defined (RDM_CONTROLLER)
-# include "rdm.html.h"
-#endif /* !defined (CONFIG_HTTP_HTML_NO_RDM) && defined (RDM_CONTROLLER) */
-#include "index.html.h"
 #if defined (NODE_SHOWFILE)
 # include "showfile.js.h"
 #endif /* (NODE_SHOWFILE) */
+#if !defined (CONFIG_HTTP_HTML_NO_RDM) && defined (RDM_CONTROLLER)
+# include "rdm.html.h"
+#endif /* !defined (CONFIG_HTTP_HTML_NO_RDM) && defined (RDM_CONTROLLER) */
 #if !defined (CONFIG_HTTP_HTML_NO_TIME)
 # include "time.html.h"
 #endif /* !defined (CONFIG_HTTP_HTML_NO_TIME) */
-#if !defined (CONFIG_HTTP_HTML_NO_DMX) && (defined(OUTPUT_DMX_SEND) || defined(OUTPUT_DMX_SEND_MULTI))
-# include "dmx.html.h"
-#endif /* !defined (CONFIG_HTTP_HTML_NO_DMX) && (defined(OUTPUT_DMX_SEND) || defined(OUTPUT_DMX_SEND_MULTI)) */
-#if defined (ENABLE_PHY_SWITCH)
-# include "dsa.html.h"
-#endif /* (ENABLE_PHY_SWITCH) */
@@ -1,44 +1,24 @@
 static constexpr char index_html[] = {
-0x3C, 0x21, 0x44, 0x4F, 0x43, 0x54, 0x59, 0x50, 0x45, 0x20, 0x68, 0x74, 0x6D, 0x6C, 0x3E, 0x0A,
-0x3C, 0x68, 0x74, 0x6D, 0x6C, 0x3E, 0x0A, 0x3C, 0x68, 0x65, 0x61, 0x64, 0x3E, 0x0A, 0x3C, 0x6C,
-0x69, 0x6E, 0x6B, 0x20, 0x72, 0x65, 0x6C, 0x3D, 0x22, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x73, 0x68,
-0x65, 0x65, 0x74, 0x22, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3D, 0x22, 0x73, 0x74, 0x79, 0x6C, 0x65,
-0x73, 0x2E, 0x63, 0x73, 0x73, 0x22, 0x20, 0x2F, 0x3E, 0x0A, 0x3C, 0x74, 0x69, 0x74, 0x6C, 0x65,
-0x3E, 0x3C, 0x2F, 0x74, 0x69, 0x74, 0x6C, 0x65, 0x3E, 0x0A, 0x3C, 0x2F, 0x68, 0x65, 0x61, 0x64,
-0x3E, 0x0A, 0x3C, 0x62, 0x6F, 0x64, 0x79, 0x3E, 0x0A, 0x3C, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72,
-0x3E, 0x3C, 0x75, 0x6C, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x69, 0x64, 0x4C, 0x69, 0x73, 0x74, 0x22,
-0x3E, 0x3C, 0x2F, 0x75, 0x6C, 0x3E, 0x3C, 0x2F, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x3E, 0x0A,
-0x3C, 0x70, 0x3E, 0x3C, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x69,
-0x64, 0x44, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x79, 0x22, 0x20, 0x6F, 0x6E, 0x63, 0x68,
-0x61, 0x6E, 0x67, 0x65, 0x3D, 0x22, 0x67, 0x65, 0x74, 0x5F, 0x74, 0x78, 0x74, 0x28, 0x74, 0x68,
-0x69, 0x73, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x29, 0x22, 0x3E, 0x3C, 0x2F, 0x73, 0x65, 0x6C,
-0x65, 0x63, 0x74, 0x3E, 0x3C, 0x2F, 0x70, 0x3E, 0x0A, 0x3C, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20,
-0x69, 0x64, 0x3D, 0x22, 0x69, 0x64, 0x54, 0x78, 0x74, 0x22, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65,
-0x72, 0x3D, 0x27, 0x31, 0x27, 0x3E, 0x3C, 0x2F, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x3E, 0x0A, 0x3C,
-0x66, 0x6F, 0x6F, 0x74, 0x65, 0x72, 0x3E, 0x3C, 0x75, 0x6C, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x69,
-0x64, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x22, 0x3E, 0x3C, 0x2F, 0x75, 0x6C, 0x3E, 0x3C,
-0x2F, 0x66, 0x6F, 0x6F, 0x74, 0x65, 0x72, 0x3E, 0x0A, 0x3C, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x3C,
-0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x6C, 0x6F, 0x63, 0x61, 0x74,
-0x65, 0x42, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x22, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22,
-0x69, 0x6E, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x22, 0x20, 0x6F, 0x6E, 0x63, 0x6C, 0x69, 0x63,
-0x6B, 0x3D, 0x22, 0x6C, 0x6F, 0x63, 0x61, 0x74, 0x65, 0x28, 0x29, 0x22, 0x3E, 0x4C, 0x6F, 0x63,
-0x61, 0x74, 0x65, 0x20, 0x4F, 0x66, 0x66, 0x3C, 0x2F, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x3E,
-0x0A, 0x3C, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x20, 0x6F, 0x6E, 0x63, 0x6C, 0x69, 0x63, 0x6B,
-0x3D, 0x22, 0x72, 0x65, 0x62, 0x6F, 0x6F, 0x74, 0x28, 0x29, 0x22, 0x3E, 0x52, 0x65, 0x62, 0x6F,
-0x6F, 0x74, 0x3C, 0x2F, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x3E, 0x0A, 0x3C, 0x2F, 0x64, 0x69,
-0x76, 0x3E, 0x0A, 0x3C, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x73, 0x72, 0x63, 0x3D, 0x22,
-0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x2E, 0x6A, 0x73, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D,
-0x22, 0x74, 0x65, 0x78, 0x74, 0x2F, 0x6A, 0x61, 0x76, 0x61, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74,
-0x22, 0x3E, 0x3C, 0x2F, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3E, 0x0A, 0x3C, 0x73, 0x63, 0x72,
-0x69, 0x70, 0x74, 0x20, 0x73, 0x72, 0x63, 0x3D, 0x22, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x2E, 0x6A,
-0x73, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x74, 0x65, 0x78, 0x74, 0x2F, 0x6A, 0x61,
-0x76, 0x61, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x3E, 0x3C, 0x2F, 0x73, 0x63, 0x72, 0x69,
-0x70, 0x74, 0x3E, 0x0A, 0x3C, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x73, 0x72, 0x63, 0x3D,
-0x22, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x2E, 0x6A, 0x73, 0x22, 0x20, 0x74, 0x79, 0x70,
-0x65, 0x3D, 0x22, 0x74, 0x65, 0x78, 0x74, 0x2F, 0x6A, 0x61, 0x76, 0x61, 0x73, 0x63, 0x72, 0x69,
-0x70, 0x74, 0x22, 0x3E, 0x3C, 0x2F, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3E, 0x0A, 0x3C, 0x73,
-0x63, 0x72, 0x69, 0x70, 0x74, 0x3E, 0x6C, 0x69, 0x73, 0x74, 0x28, 0x29, 0x3B, 0x76, 0x65, 0x72,
-0x73, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x3B, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x79,
-0x28, 0x29, 0x3B, 0x3C, 0x2F, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3E, 0x0A, 0x3C, 0x2F, 0x62,
-0x6F, 0x64, 0x79, 0x3E, 0x0A, 0x3C, 0x2F, 0x68, 0x74, 0x6D, 0x6C, 0x3E, 0x0A, 0x00
+0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x9D, 0x92, 0x3F, 0x4F, 0xC3, 0x30,
+0x10, 0xC5, 0xF7, 0x7C, 0x0A, 0xE3, 0xA5, 0xED, 0x52, 0x8B, 0x19, 0x27, 0x03, 0x94, 0xAD, 0x52,
+0x11, 0xAA, 0x90, 0x98, 0x90, 0x63, 0x5F, 0x1A, 0xB7, 0x26, 0x8E, 0xEC, 0x4B, 0x94, 0x7C, 0x7B,
+0x2E, 0xFF, 0x4A, 0x61, 0x83, 0xC9, 0x2F, 0xF6, 0xEF, 0x9E, 0x5F, 0xEE, 0x2C, 0xEF, 0x76, 0x87,
+0xA7, 0xE3, 0xFB, 0xCB, 0x33, 0x2B, 0xF1, 0xD3, 0x65, 0x89, 0x5C, 0x16, 0x50, 0x86, 0x16, 0x67,
+0xAB, 0x0B, 0x0B, 0xE0, 0x52, 0x1E, 0xB1, 0x77, 0x10, 0x4B, 0x00, 0xE4, 0xAC, 0x0C, 0x50, 0x2C,
+0x3B, 0x5B, 0x1D, 0x23, 0x67, 0x82, 0x58, 0xB4, 0xE8, 0x20, 0x93, 0x62, 0x5A, 0x13, 0x29, 0x66,
+0x8F, 0xDC, 0x9B, 0x7E, 0x76, 0x84, 0x90, 0xC9, 0xC6, 0x31, 0x6B, 0x52, 0x6E, 0xCD, 0xDE, 0x46,
+0xE4, 0xC4, 0x37, 0x2E, 0x9B, 0x58, 0x3A, 0x4D, 0x64, 0x9D, 0xC9, 0x08, 0x0E, 0x34, 0xCE, 0xD4,
+0xCE, 0x06, 0xFA, 0xF0, 0xA1, 0xE7, 0xCC, 0x57, 0xBA, 0x54, 0xD5, 0x09, 0x52, 0x7E, 0x02, 0xFC,
+0xC0, 0x0E, 0xD7, 0x58, 0xDA, 0xB8, 0x6D, 0x95, 0x6B, 0x60, 0x33, 0x38, 0x4D, 0x85, 0x24, 0xEA,
+0x21, 0x8E, 0xCA, 0x1D, 0xCC, 0x26, 0xC7, 0x8E, 0x52, 0xE7, 0x3E, 0xD0, 0x15, 0xE9, 0xEA, 0x7E,
+0x35, 0x84, 0x1C, 0x4E, 0x89, 0x2A, 0xBC, 0xC7, 0x1F, 0xA9, 0xDE, 0x20, 0x44, 0xEB, 0xAB, 0x6B,
+0xB0, 0x19, 0x48, 0xA4, 0xB1, 0xED, 0xF0, 0x33, 0x0D, 0xA2, 0xAF, 0x46, 0xD6, 0x79, 0xAD, 0x10,
+0x1E, 0xC7, 0x0D, 0xCE, 0xB4, 0x53, 0x31, 0x92, 0x41, 0xA5, 0x34, 0xDA, 0x16, 0xC6, 0xB4, 0xCE,
+0xEA, 0xCB, 0xC2, 0xAD, 0x29, 0xE1, 0x7E, 0x54, 0xEC, 0x50, 0x14, 0x52, 0x4C, 0x46, 0xDF, 0x8E,
+0x57, 0x3C, 0x40, 0x4E, 0x57, 0x0E, 0xF8, 0xEB, 0xA8, 0x6E, 0x50, 0x31, 0x65, 0x88, 0x3A, 0xD8,
+0x1A, 0x59, 0x0C, 0x7A, 0x18, 0x82, 0x42, 0xAB, 0xB7, 0x67, 0x9A, 0x01, 0xF6, 0x35, 0xB5, 0x06,
+0xA1, 0x43, 0x71, 0x56, 0xAD, 0x9A, 0xA8, 0xB1, 0x2D, 0xA3, 0xFA, 0x55, 0x68, 0x2B, 0x03, 0xDD,
+0x3F, 0xEA, 0x0C, 0x14, 0xAA, 0x71, 0xF8, 0xA7, 0xCA, 0xCC, 0xD1, 0xA8, 0xD7, 0x9B, 0x87, 0x76,
+0xEA, 0x2D, 0x29, 0xB3, 0x4C, 0x95, 0xF4, 0x0D, 0x2E, 0xE6, 0xB7, 0x22, 0xA6, 0x57, 0xF8, 0x05,
+0x01, 0x94, 0x32, 0xA8, 0x9D, 0x02, 0x00, 0x00, 0x00
 };
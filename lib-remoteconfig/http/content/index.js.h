@@ -1,74 +1,40 @@
 static constexpr char index_js[] = {
-0x61, 0x73, 0x79, 0x6E, 0x63, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x64,
-0x69, 0x72, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x79, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x6C, 0x65, 0x74,
-0x20, 0x64, 0x20, 0x3D, 0x20, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x67, 0x65, 0x74, 0x4A, 0x53,
-0x4F, 0x4E, 0x28, 0x27, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x79, 0x27, 0x29, 0x0A,
-0x6C, 0x65, 0x74, 0x20, 0x68, 0x20, 0x3D, 0x20, 0x22, 0x22, 0x0A, 0x6C, 0x65, 0x74, 0x20, 0x66,
-0x20, 0x3D, 0x20, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x2E, 0x6B, 0x65, 0x79, 0x73, 0x28, 0x64,
-0x5B, 0x22, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x22, 0x5D, 0x29, 0x0A, 0x66, 0x2E, 0x66, 0x6F, 0x72,
-0x45, 0x61, 0x63, 0x68, 0x28, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x6B, 0x65,
-0x79, 0x29, 0x20, 0x7B, 0x0A, 0x76, 0x61, 0x72, 0x20, 0x76, 0x20, 0x3D, 0x20, 0x64, 0x5B, 0x22,
-0x66, 0x69, 0x6C, 0x65, 0x73, 0x22, 0x5D, 0x5B, 0x6B, 0x65, 0x79, 0x5D, 0x0A, 0x68, 0x20, 0x2B,
-0x3D, 0x20, 0x22, 0x3C, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65,
-0x3D, 0x22, 0x2B, 0x6B, 0x65, 0x79, 0x2B, 0x22, 0x3E, 0x22, 0x2B, 0x76, 0x2B, 0x22, 0x3C, 0x2F,
-0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x3E, 0x22, 0x0A, 0x7D, 0x29, 0x3B, 0x0A, 0x64, 0x6F, 0x63,
-0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74,
-0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x69, 0x64, 0x44, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6F, 0x72,
-0x79, 0x22, 0x29, 0x2E, 0x69, 0x6E, 0x6E, 0x65, 0x72, 0x48, 0x54, 0x4D, 0x4C, 0x20, 0x3D, 0x20,
-0x68, 0x0A, 0x67, 0x65, 0x74, 0x5F, 0x74, 0x78, 0x74, 0x28, 0x66, 0x5B, 0x30, 0x5D, 0x29, 0x0A,
-0x7D, 0x0A, 0x61, 0x73, 0x79, 0x6E, 0x63, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E,
-0x20, 0x67, 0x65, 0x74, 0x5F, 0x74, 0x78, 0x74, 0x28, 0x73, 0x65, 0x6C, 0x29, 0x20, 0x7B, 0x0A,
-0x6C, 0x65, 0x74, 0x20, 0x74, 0x78, 0x74, 0x20, 0x3D, 0x20, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20,
-0x67, 0x65, 0x74, 0x4A, 0x53, 0x4F, 0x4E, 0x28, 0x73, 0x65, 0x6C, 0x29, 0x0A, 0x6C, 0x65, 0x74,
-0x20, 0x68, 0x20, 0x3D, 0x20, 0x22, 0x22, 0x0A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x2E, 0x6B,
-0x65, 0x79, 0x73, 0x28, 0x74, 0x78, 0x74, 0x5B, 0x73, 0x65, 0x6C, 0x5D, 0x29, 0x2E, 0x66, 0x6F,
-0x72, 0x45, 0x61, 0x63, 0x68, 0x28, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x6B,
-0x65, 0x79, 0x29, 0x20, 0x7B, 0x0A, 0x76, 0x61, 0x72, 0x20, 0x76, 0x20, 0x3D, 0x20, 0x74, 0x78,
-0x74, 0x5B, 0x73, 0x65, 0x6C, 0x5D, 0x5B, 0x6B, 0x65, 0x79, 0x5D, 0x0A, 0x68, 0x20, 0x2B, 0x3D,
-0x20, 0x22, 0x3C, 0x74, 0x72, 0x3E, 0x3C, 0x74, 0x64, 0x3E, 0x22, 0x2B, 0x6B, 0x65, 0x79, 0x2B,
-0x27, 0x3C, 0x2F, 0x74, 0x64, 0x3E, 0x3C, 0x74, 0x64, 0x3E, 0x3C, 0x69, 0x6E, 0x70, 0x75, 0x74,
-0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 0x76, 0x61, 0x6C,
-0x75, 0x65, 0x3D, 0x22, 0x27, 0x2B, 0x76, 0x2B, 0x27, 0x22, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x27,
-0x2B, 0x6B, 0x65, 0x79, 0x2B, 0x27, 0x22, 0x3E, 0x3C, 0x2F, 0x74, 0x64, 0x3E, 0x3C, 0x2F, 0x74,
-0x72, 0x3E, 0x27, 0x0A, 0x7D, 0x29, 0x3B, 0x0A, 0x68, 0x20, 0x2B, 0x3D, 0x20, 0x27, 0x3C, 0x74,
-0x72, 0x3E, 0x3C, 0x74, 0x64, 0x20, 0x63, 0x6F, 0x6C, 0x73, 0x70, 0x61, 0x6E, 0x3D, 0x22, 0x32,
-0x22, 0x3E, 0x3C, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x20, 0x6F, 0x6E, 0x63, 0x6C, 0x69, 0x63,
-0x6B, 0x3D, 0x22, 0x73, 0x61, 0x76, 0x65, 0x28, 0x5C, 0x27, 0x27, 0x2B, 0x73, 0x65, 0x6C, 0x2B,
-0x27, 0x5C, 0x27, 0x29, 0x22, 0x3E, 0x53, 0x61, 0x76, 0x65, 0x3C, 0x2F, 0x62, 0x75, 0x74, 0x74,
-0x6F, 0x6E, 0x3E, 0x27, 0x3B, 0x0A, 0x68, 0x20, 0x2B, 0x3D, 0x20, 0x27, 0x3C, 0x62, 0x75, 0x74,
-0x74, 0x6F, 0x6E, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x62, 0x74, 0x6E, 0x22, 0x20,
-0x6F, 0x6E, 0x63, 0x6C, 0x69, 0x63, 0x6B, 0x3D, 0x22, 0x72, 0x65, 0x73, 0x65, 0x74, 0x28, 0x5C,
-0x27, 0x27, 0x2B, 0x73, 0x65, 0x6C, 0x2B, 0x27, 0x5C, 0x27, 0x29, 0x22, 0x3E, 0x44, 0x65, 0x66,
-0x61, 0x75, 0x6C, 0x74, 0x73, 0x3C, 0x2F, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x3E, 0x3C, 0x2F,
-0x74, 0x64, 0x3E, 0x3C, 0x2F, 0x74, 0x72, 0x3E, 0x27, 0x3B, 0x0A, 0x64, 0x6F, 0x63, 0x75, 0x6D,
-0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79,
-0x49, 0x64, 0x28, 0x22, 0x69, 0x64, 0x54, 0x78, 0x74, 0x22, 0x29, 0x2E, 0x69, 0x6E, 0x6E, 0x65,
-0x72, 0x48, 0x54, 0x4D, 0x4C, 0x20, 0x3D, 0x20, 0x68, 0x0A, 0x7D, 0x0A, 0x66, 0x75, 0x6E, 0x63,
-0x74, 0x69, 0x6F, 0x6E, 0x20, 0x73, 0x61, 0x76, 0x65, 0x28, 0x73, 0x65, 0x6C, 0x29, 0x20, 0x7B,
-0x0A, 0x76, 0x61, 0x72, 0x20, 0x64, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x0A, 0x76, 0x61, 0x72, 0x20,
-0x69, 0x6E, 0x70, 0x75, 0x74, 0x73, 0x20, 0x3D, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E,
-0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64,
-0x28, 0x22, 0x69, 0x64, 0x54, 0x78, 0x74, 0x22, 0x29, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65,
-0x6D, 0x65, 0x6E, 0x74, 0x73, 0x42, 0x79, 0x54, 0x61, 0x67, 0x4E, 0x61, 0x6D, 0x65, 0x28, 0x22,
-0x69, 0x6E, 0x70, 0x75, 0x74, 0x22, 0x29, 0x0A, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x76, 0x61, 0x72,
-0x20, 0x69, 0x20, 0x3D, 0x20, 0x30, 0x3B, 0x20, 0x69, 0x20, 0x3C, 0x20, 0x69, 0x6E, 0x70, 0x75,
-0x74, 0x73, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x3B, 0x20, 0x69, 0x2B, 0x2B, 0x29, 0x20,
-0x7B, 0x0A, 0x76, 0x61, 0x72, 0x20, 0x6B, 0x20, 0x3D, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x73,
-0x5B, 0x69, 0x5D, 0x2E, 0x69, 0x64, 0x0A, 0x76, 0x61, 0x72, 0x20, 0x76, 0x20, 0x3D, 0x20, 0x69,
-0x6E, 0x70, 0x75, 0x74, 0x73, 0x5B, 0x69, 0x5D, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x0A, 0x64,
-0x5B, 0x6B, 0x5D, 0x20, 0x3D, 0x20, 0x76, 0x0A, 0x7D, 0x0A, 0x76, 0x61, 0x72, 0x20, 0x6F, 0x75,
-0x74, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x0A, 0x6F, 0x75, 0x74, 0x5B, 0x73, 0x65, 0x6C, 0x5D, 0x20,
-0x3D, 0x20, 0x64, 0x0A, 0x76, 0x61, 0x72, 0x20, 0x70, 0x61, 0x79, 0x6C, 0x6F, 0x61, 0x64, 0x20,
-0x3D, 0x20, 0x4A, 0x53, 0x4F, 0x4E, 0x2E, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x69, 0x66, 0x79,
-0x28, 0x6F, 0x75, 0x74, 0x29, 0x0A, 0x66, 0x65, 0x74, 0x63, 0x68, 0x28, 0x27, 0x2F, 0x6A, 0x73,
-0x6F, 0x6E, 0x27, 0x2C, 0x20, 0x7B, 0x0A, 0x6D, 0x65, 0x74, 0x68, 0x6F, 0x64, 0x3A, 0x20, 0x27,
-0x50, 0x4F, 0x53, 0x54, 0x27, 0x2C, 0x0A, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x73, 0x3A, 0x20,
-0x7B, 0x0A, 0x27, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x2D, 0x54, 0x79, 0x70, 0x65, 0x27,
-0x3A, 0x20, 0x27, 0x61, 0x70, 0x70, 0x6C, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2F, 0x6A,
-0x73, 0x6F, 0x6E, 0x27, 0x0A, 0x7D, 0x2C, 0x0A, 0x62, 0x6F, 0x64, 0x79, 0x3A, 0x20, 0x70, 0x61,
-0x79, 0x6C, 0x6F, 0x61, 0x64, 0x0A, 0x7D, 0x29, 0x20, 0x2E, 0x74, 0x68, 0x65, 0x6E, 0x28, 0x72,
-0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x65, 0x20, 0x3D, 0x3E, 0x20, 0x7B, 0x69, 0x66, 0x20, 0x28,
-0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x65, 0x2E, 0x6F, 0x6B, 0x29, 0x20, 0x7B, 0x20, 0x67,
-0x65, 0x74, 0x5F, 0x74, 0x78, 0x74, 0x28, 0x73, 0x65, 0x6C, 0x29, 0x3B, 0x20, 0x7D, 0x7D, 0x29,
-0x3B, 0x0A, 0x7D, 0x0A, 0x00
+0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x85, 0x53, 0x4D, 0x6F, 0xDB, 0x30,
+0x0C, 0xBD, 0xEB, 0x57, 0x08, 0xBA, 0xC8, 0x86, 0x33, 0xA7, 0xD8, 0x31, 0x75, 0x7C, 0xE8, 0x5A,
+0x60, 0x1B, 0xB6, 0x66, 0x40, 0x72, 0x73, 0x83, 0x41, 0xB1, 0xE4, 0x58, 0x8D, 0x23, 0x19, 0x96,
+0x9C, 0xD5, 0x08, 0xFC, 0xDF, 0x47, 0xC9, 0x71, 0x3E, 0x3A, 0x60, 0x3D, 0x85, 0x26, 0x1F, 0x9F,
+0x1E, 0x1F, 0x19, 0x66, 0x3A, 0x95, 0xE3, 0xA2, 0x55, 0xB9, 0x95, 0x5A, 0x61, 0x2E, 0x1B, 0x91,
+0x5B, 0xDD, 0x74, 0x41, 0x88, 0x8F, 0xA8, 0x12, 0x16, 0x73, 0x3C, 0xC7, 0xEC, 0x0F, 0x93, 0x16,
+0x6F, 0x85, 0xFD, 0xBE, 0x5C, 0x3C, 0x07, 0xF4, 0x0C, 0xA2, 0xA1, 0x87, 0x94, 0x00, 0x21, 0xC4,
+0x87, 0x05, 0x84, 0x8B, 0xCD, 0x2B, 0x94, 0xE3, 0x9D, 0xE8, 0x4C, 0xC0, 0x33, 0x52, 0xC8, 0x4A,
+0x18, 0xB2, 0x0E, 0x51, 0x11, 0x17, 0xBA, 0x79, 0x62, 0x79, 0x19, 0x8C, 0xCF, 0x05, 0x80, 0x71,
+0xEF, 0x1C, 0x58, 0x83, 0x0F, 0xD0, 0x79, 0x41, 0x67, 0x50, 0x59, 0xA3, 0x12, 0x47, 0xC0, 0x9C,
+0xE8, 0xDA, 0x6B, 0x3B, 0xB0, 0xAA, 0x15, 0x73, 0x12, 0x41, 0x29, 0x22, 0x29, 0x89, 0x0E, 0x11,
+0x49, 0xA6, 0x43, 0x2D, 0x25, 0xA8, 0x0F, 0xEF, 0x11, 0xD7, 0x79, 0xBB, 0x17, 0xCA, 0xC6, 0x20,
+0xF5, 0xA9, 0x12, 0x2E, 0x7C, 0xE8, 0xBE, 0xF1, 0x80, 0x48, 0xFE, 0x38, 0x6A, 0x26, 0x61, 0x2C,
+0x95, 0x12, 0xCD, 0xD7, 0xD5, 0xCF, 0x1F, 0xF0, 0x64, 0x89, 0x00, 0xFB, 0xDB, 0xBE, 0xD9, 0xA0,
+0xC8, 0xEE, 0x40, 0x64, 0x8F, 0xD8, 0xAD, 0x23, 0x63, 0xD9, 0x88, 0x6A, 0xB4, 0x04, 0x3E, 0xFF,
+0x31, 0xC5, 0x95, 0xAF, 0xCD, 0xB8, 0x36, 0x01, 0xF0, 0x19, 0xD4, 0xD7, 0xE1, 0x87, 0x06, 0x8C,
+0xC8, 0x9B, 0xF1, 0x6D, 0x93, 0x26, 0x96, 0xA7, 0xC3, 0xE0, 0x34, 0x99, 0x42, 0xEC, 0xBE, 0x13,
+0xA9, 0xEA, 0x16, 0xC4, 0x74, 0x35, 0x98, 0x62, 0xC5, 0x9B, 0x25, 0xA3, 0x43, 0x14, 0xAC, 0xA1,
+0x04, 0x4B, 0xEE, 0x42, 0xDF, 0x44, 0xD2, 0xA1, 0x6D, 0x0A, 0x5C, 0xD4, 0x5B, 0xE5, 0xB9, 0xE9,
+0x89, 0x1B, 0xE7, 0xBA, 0x32, 0x35, 0x53, 0x73, 0xF2, 0x19, 0x90, 0x9B, 0xD6, 0x5A, 0x18, 0x5C,
+0xAB, 0xBC, 0x92, 0xF9, 0x6E, 0x4E, 0x0C, 0x3B, 0x88, 0xE0, 0x85, 0xD2, 0x08, 0x94, 0x45, 0xF4,
+0x85, 0x86, 0x24, 0x5D, 0x42, 0x2A, 0x99, 0x0E, 0xC0, 0x94, 0x9E, 0xD9, 0x4E, 0x9D, 0x79, 0xC5,
+0x8C, 0x99, 0x93, 0x8D, 0x55, 0xE4, 0xC2, 0xD2, 0x08, 0x23, 0xEC, 0x3B, 0x9A, 0x47, 0x51, 0xB0,
+0xB6, 0xB2, 0xE6, 0x4C, 0x75, 0xA5, 0xF2, 0xBF, 0xDB, 0x5C, 0xC1, 0xB4, 0xEF, 0xF7, 0xD8, 0xA3,
+0xF3, 0xCE, 0xBC, 0xE2, 0xD3, 0xC2, 0x9C, 0xB5, 0xEE, 0x86, 0x8F, 0xBD, 0x0F, 0xBD, 0x69, 0xC6,
+0xDD, 0xDA, 0x47, 0xEC, 0x97, 0xBC, 0x79, 0xE8, 0x56, 0x6C, 0xFB, 0xCC, 0xF6, 0x02, 0xAA, 0xAE,
+0x9F, 0xC0, 0x31, 0xEB, 0x06, 0x07, 0x9E, 0x10, 0xB8, 0xEE, 0xEE, 0xE1, 0x27, 0x39, 0x71, 0xC7,
+0x95, 0x50, 0x5B, 0x5B, 0x42, 0x2A, 0x8A, 0x46, 0x01, 0x3B, 0x00, 0x0D, 0xD5, 0x4C, 0xAE, 0x63,
+0xC9, 0xCF, 0x0B, 0xBF, 0x24, 0xFD, 0xEE, 0x10, 0xCF, 0x76, 0x6B, 0x48, 0x1F, 0xD0, 0xA0, 0x56,
+0xB7, 0x76, 0x90, 0x0E, 0x81, 0x3F, 0x0C, 0x27, 0xDC, 0x57, 0x6A, 0xD6, 0x55, 0x9A, 0xB9, 0xC1,
+0xDC, 0xF9, 0xC5, 0xC6, 0x36, 0x52, 0x6D, 0x65, 0xD1, 0x05, 0x80, 0x04, 0x75, 0xC2, 0xC2, 0x95,
+0xD1, 0xE9, 0xAB, 0xD1, 0x8A, 0x4E, 0x40, 0xC4, 0x5E, 0xD8, 0x52, 0xF3, 0x19, 0xA6, 0xBF, 0x16,
+0xCB, 0x15, 0x9D, 0xA0, 0x52, 0x30, 0x2E, 0x1A, 0x33, 0x83, 0x12, 0xFD, 0xA2, 0x95, 0x85, 0x29,
+0x3F, 0xAD, 0xE0, 0x92, 0x28, 0x40, 0x58, 0x5D, 0xC3, 0xCA, 0x98, 0x73, 0x72, 0x20, 0x40, 0xFD,
+0x04, 0x6D, 0x34, 0xEF, 0x66, 0xE3, 0xAB, 0x70, 0x41, 0x38, 0xB6, 0xA5, 0x50, 0x01, 0x6C, 0xB5,
+0xD6, 0xCA, 0x08, 0x3C, 0x4F, 0xF1, 0x51, 0x16, 0xF8, 0x9C, 0x88, 0xF5, 0x0E, 0x86, 0xBF, 0xF9,
+0xF7, 0xDC, 0xE3, 0xDE, 0x5D, 0x5E, 0x8F, 0xFE, 0x02, 0x9C, 0xC6, 0xE0, 0xA0, 0x74, 0x04, 0x00,
+0x00, 0x00
 };
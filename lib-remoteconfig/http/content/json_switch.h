@@ -22,6 +22,7 @@ static constexpr uint16_t TIMEDATE    = 0x2472;
 static constexpr uint16_t RTCALARM    = 0x817b;
 static constexpr uint16_t POLLTABLE   = 0x0864;
 static constexpr uint16_t TYPES       = 0x5e5a;
+static constexpr uint16_t ANALYZER    = 0x37eb;
 }
 }
 }
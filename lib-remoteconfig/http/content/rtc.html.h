@@ -1,66 +1,31 @@
 static constexpr char rtc_html[] = {
-0x3C, 0x21, 0x44, 0x4F, 0x43, 0x54, 0x59, 0x50, 0x45, 0x20, 0x68, 0x74, 0x6D, 0x6C, 0x3E, 0x0A,
-0x3C, 0x68, 0x74, 0x6D, 0x6C, 0x3E, 0x0A, 0x3C, 0x68, 0x65, 0x61, 0x64, 0x3E, 0x3C, 0x6C, 0x69,
-0x6E, 0x6B, 0x20, 0x72, 0x65, 0x6C, 0x3D, 0x22, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x73, 0x68, 0x65,
-0x65, 0x74, 0x22, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3D, 0x22, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x73,
-0x2E, 0x63, 0x73, 0x73, 0x22, 0x20, 0x2F, 0x3E, 0x3C, 0x74, 0x69, 0x74, 0x6C, 0x65, 0x3E, 0x52,
-0x65, 0x61, 0x6C, 0x2D, 0x74, 0x69, 0x6D, 0x65, 0x20, 0x63, 0x6C, 0x6F, 0x63, 0x6B, 0x3C, 0x2F,
-0x74, 0x69, 0x74, 0x6C, 0x65, 0x3E, 0x3C, 0x2F, 0x68, 0x65, 0x61, 0x64, 0x3E, 0x0A, 0x3C, 0x62,
-0x6F, 0x64, 0x79, 0x3E, 0x0A, 0x3C, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x3E, 0x3C, 0x75, 0x6C,
-0x20, 0x69, 0x64, 0x3D, 0x22, 0x69, 0x64, 0x4C, 0x69, 0x73, 0x74, 0x22, 0x3E, 0x3C, 0x2F, 0x75,
-0x6C, 0x3E, 0x3C, 0x2F, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x3E, 0x0A, 0x3C, 0x70, 0x3E, 0x3C,
-0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x20, 0x6F, 0x6E, 0x63, 0x6C, 0x69, 0x63, 0x6B, 0x3D, 0x22,
-0x72, 0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x28, 0x29, 0x22, 0x3E, 0x52, 0x65, 0x66, 0x72, 0x65,
-0x73, 0x68, 0x3C, 0x2F, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x3E, 0x3C, 0x2F, 0x70, 0x3E, 0x0A,
-0x3C, 0x70, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x6E, 0x6F, 0x64, 0x65, 0x54, 0x69, 0x6D, 0x65, 0x22,
-0x3E, 0x4E, 0x6F, 0x64, 0x65, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20,
-0x62, 0x65, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x65, 0x64, 0x20, 0x68, 0x65, 0x72,
-0x65, 0x3C, 0x2F, 0x70, 0x3E, 0x0A, 0x3C, 0x70, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x72, 0x74, 0x63,
-0x54, 0x69, 0x6D, 0x65, 0x22, 0x3E, 0x52, 0x54, 0x43, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x20, 0x77,
-0x69, 0x6C, 0x6C, 0x20, 0x62, 0x65, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x65, 0x64,
-0x20, 0x68, 0x65, 0x72, 0x65, 0x3C, 0x2F, 0x70, 0x3E, 0x0A, 0x3C, 0x64, 0x69, 0x76, 0x3E, 0x0A,
-0x3C, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x20, 0x6F, 0x6E, 0x63, 0x6C, 0x69, 0x63, 0x6B, 0x3D,
-0x22, 0x68, 0x63, 0x54, 0x6F, 0x53, 0x79, 0x73, 0x28, 0x29, 0x22, 0x3E, 0x53, 0x65, 0x74, 0x20,
-0x74, 0x68, 0x65, 0x20, 0x4E, 0x6F, 0x64, 0x65, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x20, 0x66, 0x72,
-0x6F, 0x6D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x52, 0x54, 0x43, 0x3C, 0x2F, 0x62, 0x75, 0x74, 0x74,
-0x6F, 0x6E, 0x3E, 0x0A, 0x3C, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x20, 0x6F, 0x6E, 0x63, 0x6C,
-0x69, 0x63, 0x6B, 0x3D, 0x22, 0x73, 0x79, 0x73, 0x54, 0x6F, 0x48, 0x63, 0x28, 0x29, 0x22, 0x3E,
-0x53, 0x65, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x52, 0x54, 0x43, 0x20, 0x66, 0x72, 0x6F, 0x6D,
-0x20, 0x74, 0x68, 0x65, 0x20, 0x4E, 0x6F, 0x64, 0x65, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x3C, 0x2F,
-0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x3E, 0x0A, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x3C,
-0x70, 0x3E, 0x0A, 0x3C, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x66, 0x6F, 0x72,
-0x6D, 0x22, 0x3E, 0x0A, 0x3C, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x20, 0x66, 0x6F, 0x72, 0x3D, 0x22,
-0x61, 0x6C, 0x61, 0x72, 0x6D, 0x49, 0x6E, 0x70, 0x75, 0x74, 0x22, 0x3E, 0x52, 0x54, 0x43, 0x20,
-0x41, 0x6C, 0x61, 0x72, 0x6D, 0x3A, 0x3C, 0x2F, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x0A, 0x3C,
-0x69, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x64, 0x61, 0x74, 0x65,
-0x74, 0x69, 0x6D, 0x65, 0x2D, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x22, 0x20, 0x69, 0x64, 0x3D, 0x22,
-0x61, 0x6C, 0x61, 0x72, 0x6D, 0x49, 0x6E, 0x70, 0x75, 0x74, 0x22, 0x20, 0x6E, 0x61, 0x6D, 0x65,
-0x3D, 0x22, 0x61, 0x6C, 0x61, 0x72, 0x6D, 0x49, 0x6E, 0x70, 0x75, 0x74, 0x22, 0x20, 0x72, 0x65,
-0x71, 0x75, 0x69, 0x72, 0x65, 0x64, 0x3E, 0x0A, 0x3C, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x20, 0x66,
-0x6F, 0x72, 0x3D, 0x22, 0x63, 0x68, 0x6B, 0x62, 0x6F, 0x78, 0x22, 0x3E, 0x45, 0x6E, 0x61, 0x62,
-0x6C, 0x65, 0x3C, 0x2F, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x0A, 0x3C, 0x69, 0x6E, 0x70, 0x75,
-0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x62, 0x6F, 0x78,
-0x22, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x63, 0x68, 0x6B, 0x62, 0x6F, 0x78, 0x22, 0x20, 0x6E, 0x61,
-0x6D, 0x65, 0x3D, 0x22, 0x45, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x22, 0x3E, 0x0A, 0x3C, 0x62, 0x75,
-0x74, 0x74, 0x6F, 0x6E, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x62, 0x75, 0x74, 0x74, 0x6F,
-0x6E, 0x22, 0x20, 0x6F, 0x6E, 0x63, 0x6C, 0x69, 0x63, 0x6B, 0x3D, 0x22, 0x61, 0x6C, 0x61, 0x72,
-0x6D, 0x28, 0x29, 0x22, 0x3E, 0x53, 0x65, 0x74, 0x3C, 0x2F, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E,
-0x3E, 0x0A, 0x3C, 0x2F, 0x66, 0x6F, 0x72, 0x6D, 0x3E, 0x0A, 0x3C, 0x66, 0x6F, 0x6F, 0x74, 0x65,
-0x72, 0x3E, 0x3C, 0x75, 0x6C, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x69, 0x64, 0x56, 0x65, 0x72, 0x73,
-0x69, 0x6F, 0x6E, 0x22, 0x3E, 0x3C, 0x2F, 0x75, 0x6C, 0x3E, 0x3C, 0x2F, 0x66, 0x6F, 0x6F, 0x74,
-0x65, 0x72, 0x3E, 0x0A, 0x3C, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x73, 0x72, 0x63, 0x3D,
-0x22, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x2E, 0x6A, 0x73, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65,
-0x3D, 0x22, 0x74, 0x65, 0x78, 0x74, 0x2F, 0x6A, 0x61, 0x76, 0x61, 0x73, 0x63, 0x72, 0x69, 0x70,
-0x74, 0x22, 0x3E, 0x3C, 0x2F, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3E, 0x0A, 0x3C, 0x73, 0x63,
-0x72, 0x69, 0x70, 0x74, 0x20, 0x73, 0x72, 0x63, 0x3D, 0x22, 0x64, 0x61, 0x74, 0x65, 0x2E, 0x6A,
-0x73, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x74, 0x65, 0x78, 0x74, 0x2F, 0x6A, 0x61,
-0x76, 0x61, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x3E, 0x3C, 0x2F, 0x73, 0x63, 0x72, 0x69,
-0x70, 0x74, 0x3E, 0x0A, 0x3C, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x73, 0x72, 0x63, 0x3D,
-0x22, 0x72, 0x74, 0x63, 0x2E, 0x6A, 0x73, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x74,
-0x65, 0x78, 0x74, 0x2F, 0x6A, 0x61, 0x76, 0x61, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x3E,
-0x3C, 0x2F, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3E, 0x0A, 0x3C, 0x73, 0x63, 0x72, 0x69, 0x70,
-0x74, 0x3E, 0x6C, 0x69, 0x73, 0x74, 0x28, 0x29, 0x3B, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E,
-0x28, 0x29, 0x3B, 0x72, 0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x28, 0x29, 0x3C, 0x2F, 0x73, 0x63,
-0x72, 0x69, 0x70, 0x74, 0x3E, 0x0A, 0x3C, 0x2F, 0x62, 0x6F, 0x64, 0x79, 0x3E, 0x0A, 0x3C, 0x2F,
-0x68, 0x74, 0x6D, 0x6C, 0x3E, 0x00
+0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x9D, 0x53, 0x4B, 0x6F, 0xDB, 0x30,
+0x0C, 0xBE, 0xE7, 0x57, 0x68, 0x3A, 0xB5, 0x87, 0x56, 0xF7, 0x4D, 0x36, 0x30, 0x74, 0x05, 0x36,
+0x60, 0xE8, 0x8A, 0xD6, 0x18, 0xB0, 0xA3, 0x2C, 0x31, 0xB0, 0x1A, 0xDA, 0x72, 0x25, 0x3A, 0xAD,
+0xFF, 0xFD, 0xF4, 0x70, 0x12, 0xA7, 0x1D, 0x30, 0x6C, 0xA7, 0x50, 0xF4, 0xF7, 0x12, 0x43, 0xC9,
+0x0F, 0x5F, 0x7E, 0xDC, 0x34, 0xBF, 0xEE, 0x6F, 0x59, 0x47, 0x3D, 0xD6, 0x1B, 0x79, 0xF8, 0x01,
+0x65, 0x6A, 0x89, 0x76, 0xD8, 0x31, 0x0F, 0x58, 0xF1, 0x40, 0x33, 0x42, 0xE8, 0x00, 0x88, 0xB3,
+0xCE, 0xC3, 0xF6, 0xD0, 0xB9, 0xD6, 0x21, 0x70, 0x26, 0x6A, 0x49, 0x96, 0x10, 0xEA, 0x07, 0x50,
+0x78, 0x45, 0xB6, 0x07, 0xA6, 0xD1, 0xE9, 0x9D, 0x14, 0xA5, 0x2D, 0x45, 0xD6, 0xDB, 0xC8, 0xD6,
+0x99, 0x79, 0x51, 0x07, 0x5F, 0xCB, 0x09, 0x99, 0x35, 0x15, 0xB7, 0xE6, 0xBB, 0x0D, 0xC4, 0x23,
+0x6C, 0xC2, 0x05, 0x1B, 0xBF, 0x6E, 0xE4, 0x58, 0xCB, 0x76, 0x22, 0x72, 0x03, 0x73, 0x83, 0x46,
+0xAB, 0x77, 0x15, 0x8F, 0xD6, 0x3E, 0xE6, 0xB8, 0xB8, 0xE4, 0xD1, 0x2B, 0x97, 0x52, 0x14, 0x4C,
+0x24, 0x8E, 0x89, 0x93, 0x15, 0x07, 0x67, 0xA0, 0x89, 0x31, 0x78, 0x7D, 0x17, 0x2B, 0x96, 0x13,
+0xBD, 0x58, 0x44, 0xD6, 0x02, 0x33, 0x36, 0x8C, 0xA8, 0x66, 0x30, 0xAC, 0x03, 0x0F, 0x6B, 0x96,
+0x27, 0x5D, 0x48, 0x0F, 0xCD, 0xCD, 0xDF, 0x39, 0xC6, 0xEE, 0xD3, 0x8D, 0xDE, 0x04, 0xEC, 0x74,
+0xE3, 0x1E, 0xE7, 0x90, 0x02, 0x3E, 0x02, 0x31, 0xEA, 0x80, 0x9D, 0x22, 0x6C, 0xBD, 0xEB, 0x73,
+0x2B, 0x1A, 0x1C, 0x73, 0xBF, 0xD7, 0x08, 0x73, 0x68, 0xDC, 0x57, 0xBD, 0xD6, 0x48, 0x89, 0x8E,
+0xEC, 0xA3, 0xE0, 0x4A, 0x43, 0x94, 0x38, 0x29, 0xD8, 0xD6, 0xF9, 0x3E, 0xDF, 0x27, 0x15, 0x3C,
+0x36, 0x50, 0xB5, 0x80, 0x2C, 0x9E, 0x2A, 0xAE, 0x50, 0xF9, 0xFE, 0xDB, 0x30, 0x4E, 0x54, 0x6E,
+0xF9, 0x39, 0x9D, 0x3F, 0x4A, 0x91, 0x21, 0x11, 0x6A, 0xD3, 0x27, 0x46, 0xF3, 0x08, 0x15, 0x37,
+0x8A, 0x20, 0xB9, 0x5C, 0xC5, 0xBF, 0x52, 0x21, 0xCF, 0x92, 0x2B, 0x3E, 0x1B, 0x54, 0x0F, 0xE7,
+0x1D, 0x0F, 0xCF, 0x93, 0xF5, 0x60, 0xCE, 0x3D, 0x75, 0xB7, 0x6B, 0xDD, 0x2B, 0xAF, 0x6F, 0x07,
+0xD5, 0x22, 0xFC, 0xD9, 0x4B, 0x77, 0xA0, 0x33, 0x2A, 0xBB, 0x2C, 0x8C, 0xC5, 0xA1, 0xF0, 0xF8,
+0x69, 0x50, 0x85, 0x52, 0x0E, 0xFC, 0x34, 0xB6, 0x9C, 0x64, 0x19, 0xDA, 0x7A, 0x32, 0x69, 0x0C,
+0x79, 0x2C, 0x8E, 0xCE, 0x96, 0xEE, 0x27, 0xF8, 0x60, 0xA3, 0xC2, 0x61, 0xEF, 0x16, 0xC0, 0x46,
+0x06, 0xED, 0xED, 0x48, 0x2C, 0x78, 0x9D, 0xD6, 0x5C, 0x91, 0xD5, 0xD7, 0x4F, 0x71, 0xCB, 0x8B,
+0x2D, 0xC1, 0x2B, 0x89, 0x27, 0xB5, 0x57, 0x05, 0x95, 0xD8, 0xA5, 0x7A, 0x43, 0x4C, 0xD3, 0xFB,
+0x0F, 0x5A, 0xDC, 0xC1, 0x7F, 0x62, 0xD5, 0x18, 0x9F, 0xCE, 0xC5, 0xE5, 0xA7, 0x7D, 0xB9, 0x4C,
+0xAC, 0x8E, 0x4F, 0x64, 0x85, 0x15, 0xCB, 0xC3, 0x13, 0xF9, 0x79, 0xFF, 0x06, 0x50, 0x7D, 0x44,
+0x0C, 0xF5, 0x03, 0x00, 0x00, 0x00
 };
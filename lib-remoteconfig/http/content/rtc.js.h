@@ -1,55 +1,25 @@
 static constexpr char rtc_js[] = {
-0x61, 0x73, 0x79, 0x6E, 0x63, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x72,
-0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x6C, 0x65, 0x74, 0x20, 0x64,
-0x31, 0x3D, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x67, 0x65, 0x74, 0x4A, 0x53, 0x4F, 0x4E, 0x28,
-0x27, 0x74, 0x69, 0x6D, 0x65, 0x64, 0x61, 0x74, 0x65, 0x27, 0x29, 0x0A, 0x63, 0x6F, 0x6E, 0x73,
-0x74, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x20, 0x3D, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x44,
-0x61, 0x74, 0x65, 0x54, 0x69, 0x6D, 0x65, 0x28, 0x6E, 0x65, 0x77, 0x20, 0x44, 0x61, 0x74, 0x65,
-0x28, 0x64, 0x31, 0x2E, 0x64, 0x61, 0x74, 0x65, 0x29, 0x29, 0x0A, 0x64, 0x6F, 0x63, 0x75, 0x6D,
-0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79,
-0x49, 0x64, 0x28, 0x27, 0x6E, 0x6F, 0x64, 0x65, 0x54, 0x69, 0x6D, 0x65, 0x27, 0x29, 0x2E, 0x74,
-0x65, 0x78, 0x74, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x20, 0x3D, 0x20, 0x60, 0x4E, 0x6F,
-0x64, 0x65, 0x20, 0x54, 0x69, 0x6D, 0x65, 0x3A, 0x20, 0x24, 0x7B, 0x6E, 0x6F, 0x64, 0x65, 0x7D,
-0x60, 0x0A, 0x6C, 0x65, 0x74, 0x20, 0x64, 0x32, 0x3D, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x67,
-0x65, 0x74, 0x4A, 0x53, 0x4F, 0x4E, 0x28, 0x27, 0x72, 0x74, 0x63, 0x61, 0x6C, 0x61, 0x72, 0x6D,
-0x27, 0x29, 0x0A, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x72, 0x74, 0x63, 0x20, 0x3D, 0x20, 0x66,
-0x6F, 0x72, 0x6D, 0x61, 0x74, 0x44, 0x61, 0x74, 0x65, 0x54, 0x69, 0x6D, 0x65, 0x28, 0x6E, 0x65,
-0x77, 0x20, 0x44, 0x61, 0x74, 0x65, 0x28, 0x64, 0x32, 0x2E, 0x72, 0x74, 0x63, 0x29, 0x29, 0x0A,
-0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D,
-0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x72, 0x74, 0x63, 0x54, 0x69, 0x6D, 0x65,
-0x27, 0x29, 0x2E, 0x74, 0x65, 0x78, 0x74, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x20, 0x3D,
-0x20, 0x60, 0x52, 0x54, 0x43, 0x20, 0x54, 0x69, 0x6D, 0x65, 0x3A, 0x20, 0x24, 0x7B, 0x72, 0x74,
-0x63, 0x7D, 0x60, 0x0A, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74,
-0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x61, 0x6C, 0x61,
-0x72, 0x6D, 0x49, 0x6E, 0x70, 0x75, 0x74, 0x27, 0x29, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20,
-0x3D, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x44, 0x61, 0x74, 0x65, 0x54, 0x69, 0x6D, 0x65,
-0x28, 0x6E, 0x65, 0x77, 0x20, 0x44, 0x61, 0x74, 0x65, 0x28, 0x64, 0x32, 0x2E, 0x61, 0x6C, 0x61,
-0x72, 0x6D, 0x29, 0x29, 0x0A, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65,
-0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x63, 0x68,
-0x6B, 0x62, 0x6F, 0x78, 0x27, 0x29, 0x2E, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x65, 0x64, 0x20, 0x3D,
-0x20, 0x28, 0x64, 0x32, 0x2E, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x20, 0x3D, 0x3D, 0x3D,
-0x20, 0x22, 0x31, 0x22, 0x29, 0x0A, 0x7D, 0x0A, 0x61, 0x73, 0x79, 0x6E, 0x63, 0x20, 0x66, 0x75,
-0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x68, 0x63, 0x54, 0x6F, 0x53, 0x79, 0x73, 0x28, 0x29,
-0x20, 0x7B, 0x0A, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x70, 0x6F, 0x73, 0x74, 0x28, 0x7B, 0x20,
-0x72, 0x74, 0x63, 0x3A, 0x20, 0x22, 0x22, 0x2C, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x3A,
-0x20, 0x22, 0x68, 0x63, 0x74, 0x6F, 0x73, 0x79, 0x73, 0x22, 0x20, 0x7D, 0x29, 0x3B, 0x0A, 0x72,
-0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x28, 0x29, 0x3B, 0x0A, 0x7D, 0x0A, 0x61, 0x73, 0x79, 0x6E,
-0x63, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x73, 0x79, 0x73, 0x54, 0x6F,
-0x48, 0x63, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x70, 0x6F, 0x73,
-0x74, 0x28, 0x7B, 0x20, 0x72, 0x74, 0x63, 0x3A, 0x20, 0x22, 0x22, 0x2C, 0x20, 0x61, 0x63, 0x74,
-0x69, 0x6F, 0x6E, 0x3A, 0x20, 0x22, 0x73, 0x79, 0x73, 0x74, 0x6F, 0x68, 0x63, 0x22, 0x20, 0x7D,
-0x29, 0x3B, 0x0A, 0x72, 0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x28, 0x29, 0x3B, 0x0A, 0x7D, 0x0A,
-0x61, 0x73, 0x79, 0x6E, 0x63, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61,
-0x6C, 0x61, 0x72, 0x6D, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x61,
-0x20, 0x3D, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45,
-0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x61, 0x6C, 0x61, 0x72,
-0x6D, 0x49, 0x6E, 0x70, 0x75, 0x74, 0x27, 0x29, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x3B, 0x0A,
-0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x62, 0x20, 0x3D, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65,
-0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49,
-0x64, 0x28, 0x27, 0x63, 0x68, 0x6B, 0x62, 0x6F, 0x78, 0x27, 0x29, 0x2E, 0x63, 0x68, 0x65, 0x63,
-0x6B, 0x65, 0x64, 0x20, 0x3F, 0x20, 0x22, 0x31, 0x22, 0x20, 0x3A, 0x20, 0x22, 0x30, 0x22, 0x3B,
-0x0A, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x70, 0x6F, 0x73, 0x74, 0x28, 0x7B, 0x20, 0x72, 0x74,
-0x63, 0x3A, 0x22, 0x22, 0x2C, 0x20, 0x61, 0x6C, 0x61, 0x72, 0x6D, 0x3A, 0x20, 0x61, 0x2C, 0x20,
-0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x3A, 0x20, 0x62, 0x20, 0x7D, 0x29, 0x3B, 0x0A, 0x72, 0x65,
-0x66, 0x72, 0x65, 0x73, 0x68, 0x28, 0x29, 0x3B, 0x0A, 0x7D, 0x0A, 0x00
+0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x95, 0x92, 0xD1, 0x4A, 0xC3, 0x40,
+0x10, 0x45, 0xDF, 0xF3, 0x15, 0x43, 0x10, 0x92, 0x40, 0x09, 0xB6, 0x8F, 0x09, 0x41, 0xB0, 0x0A,
+0xD6, 0x87, 0x0A, 0x36, 0x1F, 0xE0, 0x76, 0x77, 0x6A, 0x4A, 0x93, 0xDD, 0x92, 0x9D, 0xD8, 0x86,
+0xD2, 0x7F, 0x77, 0x36, 0x91, 0x82, 0x46, 0xA3, 0xBE, 0xED, 0x66, 0xEE, 0x9C, 0xBD, 0x73, 0x27,
+0xC2, 0xB6, 0x5A, 0xC2, 0xA6, 0xD1, 0x92, 0xB6, 0x46, 0x43, 0x8D, 0x9B, 0x1A, 0x6D, 0x11, 0x46,
+0x70, 0xF2, 0x4A, 0x24, 0x50, 0xD3, 0x4C, 0x1C, 0xC4, 0x96, 0xE0, 0x15, 0xE9, 0x71, 0xF5, 0xB4,
+0x0C, 0x03, 0xDA, 0x56, 0xA8, 0x04, 0x61, 0x10, 0x79, 0xD2, 0x68, 0x4B, 0xA0, 0x8D, 0x42, 0xC8,
+0x60, 0x63, 0xEA, 0x4A, 0xD0, 0x1D, 0x57, 0x72, 0x56, 0x84, 0x1A, 0x0F, 0xE0, 0x2E, 0xA1, 0x9A,
+0xC6, 0x4E, 0x1E, 0x45, 0x9E, 0x32, 0xB2, 0xA9, 0x50, 0x53, 0xCC, 0xAC, 0xFB, 0x12, 0xDD, 0xF1,
+0xB6, 0x5D, 0xA8, 0x30, 0x70, 0x04, 0xD7, 0x14, 0x44, 0x31, 0xE1, 0x91, 0xE6, 0x46, 0x13, 0xD7,
+0x98, 0xF9, 0xB2, 0x74, 0x6C, 0x57, 0x4A, 0xE0, 0xEA, 0xE4, 0x64, 0xE7, 0x97, 0xDE, 0xD6, 0xEC,
+0xAB, 0xAD, 0x9A, 0xA4, 0x28, 0x45, 0x5D, 0x5D, 0x6C, 0xF1, 0x87, 0x31, 0x57, 0xB3, 0x98, 0x05,
+0x63, 0xA6, 0xB8, 0xFC, 0xBD, 0xA7, 0xE7, 0x7C, 0x7E, 0xB1, 0xC4, 0x22, 0x76, 0xF4, 0x23, 0xA3,
+0x73, 0xB4, 0xD0, 0xFB, 0x86, 0x18, 0xF3, 0x26, 0xCA, 0x06, 0xC7, 0x2D, 0x75, 0xFA, 0x31, 0x53,
+0xB2, 0xD8, 0xAD, 0xCD, 0x91, 0x61, 0xB2, 0x40, 0xB9, 0x43, 0xC5, 0x38, 0xD7, 0x87, 0x5A, 0xAC,
+0x4B, 0x77, 0xCB, 0x32, 0xF0, 0xA7, 0x7E, 0xE4, 0x9D, 0x3D, 0xF1, 0x79, 0xAF, 0x85, 0xCC, 0xCD,
+0xAA, 0xB5, 0xDD, 0x5E, 0xFB, 0xE4, 0xF6, 0xC6, 0x52, 0x78, 0x72, 0x31, 0x25, 0xE0, 0xFB, 0x13,
+0x10, 0x9D, 0x90, 0xCF, 0x85, 0x24, 0x63, 0x5B, 0xEB, 0xC3, 0x39, 0x4A, 0xBD, 0xCB, 0xFF, 0x90,
+0x0E, 0x99, 0x2C, 0xCA, 0xCD, 0x83, 0xFC, 0x0B, 0x93, 0xA5, 0x64, 0x0A, 0xF9, 0x3B, 0xB3, 0x4B,
+0xA0, 0x23, 0xF6, 0x5B, 0x14, 0x3C, 0xE1, 0x3F, 0xE2, 0x4D, 0x3F, 0xDA, 0xD6, 0x63, 0x6D, 0x83,
+0x10, 0x6F, 0x5C, 0x68, 0xC0, 0x36, 0xAF, 0xFD, 0x74, 0x38, 0x49, 0x37, 0x88, 0x7B, 0x29, 0x01,
+0x31, 0x81, 0x3E, 0xEA, 0x84, 0x5F, 0x18, 0x8C, 0xF2, 0x0E, 0x9B, 0x9A, 0xE6, 0x40, 0x4B, 0x03,
+0x00, 0x00, 0x00
 };
@@ -1,84 +1,37 @@
 static constexpr char showfile_html[] = {
-0x3C, 0x21, 0x44, 0x4F, 0x43, 0x54, 0x59, 0x50, 0x45, 0x20, 0x68, 0x74, 0x6D, 0x6C, 0x3E, 0x0A,
-0x3C, 0x68, 0x74, 0x6D, 0x6C, 0x3E, 0x0A, 0x3C, 0x68, 0x65, 0x61, 0x64, 0x3E, 0x0A, 0x3C, 0x6C,
-0x69, 0x6E, 0x6B, 0x20, 0x72, 0x65, 0x6C, 0x3D, 0x22, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x73, 0x68,
-0x65, 0x65, 0x74, 0x22, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3D, 0x22, 0x73, 0x74, 0x79, 0x6C, 0x65,
-0x73, 0x2E, 0x63, 0x73, 0x73, 0x22, 0x20, 0x2F, 0x3E, 0x0A, 0x3C, 0x74, 0x69, 0x74, 0x6C, 0x65,
-0x3E, 0x3C, 0x2F, 0x74, 0x69, 0x74, 0x6C, 0x65, 0x3E, 0x0A, 0x3C, 0x2F, 0x68, 0x65, 0x61, 0x64,
-0x3E, 0x0A, 0x3C, 0x62, 0x6F, 0x64, 0x79, 0x3E, 0x0A, 0x3C, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72,
-0x3E, 0x3C, 0x75, 0x6C, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x69, 0x64, 0x4C, 0x69, 0x73, 0x74, 0x22,
-0x3E, 0x3C, 0x2F, 0x75, 0x6C, 0x3E, 0x3C, 0x2F, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x3E, 0x0A,
-0x3C, 0x70, 0x3E, 0x3C, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x20, 0x6F, 0x6E, 0x63, 0x6C, 0x69,
-0x63, 0x6B, 0x3D, 0x22, 0x72, 0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x28, 0x29, 0x22, 0x3E, 0x52,
-0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x3C, 0x2F, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x3E, 0x3C,
-0x2F, 0x70, 0x3E, 0x0A, 0x3C, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x69,
-0x64, 0x53, 0x74, 0x61, 0x74, 0x75, 0x73, 0x22, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x3D,
-0x27, 0x31, 0x27, 0x3E, 0x3C, 0x2F, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x3E, 0x0A, 0x3C, 0x64, 0x69,
-0x76, 0x3E, 0x0A, 0x3C, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x20, 0x6F, 0x6E, 0x63, 0x6C, 0x69,
-0x63, 0x6B, 0x3D, 0x22, 0x70, 0x6C, 0x61, 0x79, 0x28, 0x29, 0x22, 0x3E, 0x50, 0x6C, 0x61, 0x79,
-0x3C, 0x2F, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x3E, 0x0A, 0x3C, 0x62, 0x75, 0x74, 0x74, 0x6F,
-0x6E, 0x20, 0x6F, 0x6E, 0x63, 0x6C, 0x69, 0x63, 0x6B, 0x3D, 0x22, 0x73, 0x74, 0x6F, 0x70, 0x28,
-0x29, 0x22, 0x3E, 0x53, 0x74, 0x6F, 0x70, 0x3C, 0x2F, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x3E,
-0x0A, 0x3C, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x20, 0x6F, 0x6E, 0x63, 0x6C, 0x69, 0x63, 0x6B,
-0x3D, 0x22, 0x72, 0x65, 0x73, 0x75, 0x6D, 0x65, 0x28, 0x29, 0x22, 0x3E, 0x52, 0x65, 0x73, 0x75,
-0x6D, 0x65, 0x3C, 0x2F, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x3E, 0x0A, 0x3C, 0x62, 0x75, 0x74,
-0x74, 0x6F, 0x6E, 0x20, 0x6F, 0x6E, 0x63, 0x6C, 0x69, 0x63, 0x6B, 0x3D, 0x22, 0x72, 0x65, 0x63,
-0x6F, 0x72, 0x64, 0x28, 0x29, 0x22, 0x3E, 0x52, 0x65, 0x63, 0x6F, 0x72, 0x64, 0x3C, 0x2F, 0x62,
-0x75, 0x74, 0x74, 0x6F, 0x6E, 0x3E, 0x0A, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x3C, 0x64,
-0x69, 0x76, 0x3E, 0x0A, 0x3C, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x20, 0x69, 0x64, 0x3D, 0x22,
-0x69, 0x64, 0x34, 0x22, 0x20, 0x6F, 0x6E, 0x63, 0x6C, 0x69, 0x63, 0x6B, 0x3D, 0x22, 0x6C, 0x6F,
-0x6F, 0x70, 0x28, 0x29, 0x22, 0x3E, 0x3C, 0x2F, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x3E, 0x0A,
-0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x3C, 0x70, 0x3E, 0x50, 0x6C, 0x61, 0x79, 0x65, 0x72,
-0x20, 0x53, 0x68, 0x6F, 0x77, 0x20, 0x3C, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x20, 0x69, 0x64,
-0x3D, 0x22, 0x69, 0x64, 0x31, 0x22, 0x3E, 0x3C, 0x2F, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x3E,
-0x3C, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x20, 0x6F, 0x6E, 0x63, 0x6C, 0x69, 0x63, 0x6B, 0x3D,
-0x22, 0x73, 0x65, 0x6C, 0x28, 0x29, 0x22, 0x3E, 0x53, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x3C, 0x2F,
-0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x3E, 0x3C, 0x2F, 0x70, 0x3E, 0x0A, 0x3C, 0x70, 0x3E, 0x53,
-0x65, 0x74, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x72, 0x65, 0x63, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x20,
-0x66, 0x69, 0x6C, 0x65, 0x20, 0x3C, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x20, 0x69, 0x64, 0x3D,
-0x22, 0x69, 0x64, 0x33, 0x22, 0x20, 0x6F, 0x6E, 0x63, 0x6C, 0x69, 0x63, 0x6B, 0x3D, 0x22, 0x72,
-0x65, 0x63, 0x28, 0x29, 0x22, 0x3E, 0x3C, 0x2F, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x3E, 0x3C,
-0x2F, 0x70, 0x3E, 0x0A, 0x3C, 0x70, 0x3E, 0x44, 0x65, 0x6C, 0x65, 0x74, 0x65, 0x20, 0x53, 0x68,
-0x6F, 0x77, 0x20, 0x3C, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x69,
-0x64, 0x32, 0x22, 0x3E, 0x3C, 0x2F, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x3E, 0x3C, 0x62, 0x75,
-0x74, 0x74, 0x6F, 0x6E, 0x20, 0x6F, 0x6E, 0x63, 0x6C, 0x69, 0x63, 0x6B, 0x3D, 0x22, 0x64, 0x65,
-0x6C, 0x28, 0x29, 0x22, 0x3E, 0x44, 0x65, 0x6C, 0x65, 0x74, 0x65, 0x3C, 0x2F, 0x62, 0x75, 0x74,
-0x74, 0x6F, 0x6E, 0x3E, 0x3C, 0x2F, 0x70, 0x3E, 0x0A, 0x3C, 0x66, 0x6F, 0x6F, 0x74, 0x65, 0x72,
-0x3E, 0x3C, 0x75, 0x6C, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x69, 0x64, 0x56, 0x65, 0x72, 0x73, 0x69,
-0x6F, 0x6E, 0x22, 0x3E, 0x3C, 0x2F, 0x75, 0x6C, 0x3E, 0x3C, 0x2F, 0x66, 0x6F, 0x6F, 0x74, 0x65,
-0x72, 0x3E, 0x0A, 0x3C, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x73, 0x72, 0x63, 0x3D, 0x22,
-0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x2E, 0x6A, 0x73, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D,
-0x22, 0x74, 0x65, 0x78, 0x74, 0x2F, 0x6A, 0x61, 0x76, 0x61, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74,
-0x22, 0x3E, 0x3C, 0x2F, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3E, 0x0A, 0x3C, 0x73, 0x63, 0x72,
-0x69, 0x70, 0x74, 0x20, 0x73, 0x72, 0x63, 0x3D, 0x22, 0x73, 0x68, 0x6F, 0x77, 0x66, 0x69, 0x6C,
-0x65, 0x2E, 0x6A, 0x73, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x74, 0x65, 0x78, 0x74,
-0x2F, 0x6A, 0x61, 0x76, 0x61, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x3E, 0x3C, 0x2F, 0x73,
-0x63, 0x72, 0x69, 0x70, 0x74, 0x3E, 0x0A, 0x3C, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3E, 0x66,
-0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x70, 0x6C, 0x61, 0x79, 0x28, 0x29, 0x7B, 0x73,
-0x65, 0x6E, 0x64, 0x28, 0x22, 0x70, 0x6C, 0x61, 0x79, 0x22, 0x29, 0x3B, 0x7D, 0x66, 0x75, 0x6E,
-0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x73, 0x74, 0x6F, 0x70, 0x28, 0x29, 0x7B, 0x73, 0x65, 0x6E,
-0x64, 0x28, 0x22, 0x73, 0x74, 0x6F, 0x70, 0x22, 0x29, 0x3B, 0x7D, 0x66, 0x75, 0x6E, 0x63, 0x74,
-0x69, 0x6F, 0x6E, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6D, 0x65, 0x28, 0x29, 0x20, 0x7B, 0x73, 0x65,
-0x6E, 0x64, 0x28, 0x22, 0x72, 0x65, 0x73, 0x75, 0x6D, 0x65, 0x22, 0x29, 0x3B, 0x7D, 0x66, 0x75,
-0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x72, 0x65, 0x63, 0x6F, 0x72, 0x64, 0x28, 0x29, 0x20,
-0x7B, 0x73, 0x65, 0x6E, 0x64, 0x28, 0x22, 0x72, 0x65, 0x63, 0x6F, 0x72, 0x64, 0x22, 0x29, 0x3B,
-0x7D, 0x0A, 0x61, 0x73, 0x79, 0x6E, 0x63, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E,
-0x20, 0x73, 0x65, 0x6E, 0x64, 0x28, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x29, 0x20, 0x7B, 0x61,
-0x77, 0x61, 0x69, 0x74, 0x20, 0x70, 0x6F, 0x73, 0x74, 0x28, 0x7B, 0x20, 0x73, 0x68, 0x6F, 0x77,
-0x3A, 0x20, 0x22, 0x22, 0x2C, 0x20, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x3A, 0x20, 0x73, 0x74,
-0x61, 0x74, 0x75, 0x73, 0x20, 0x7D, 0x29, 0x3B, 0x72, 0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x28,
-0x29, 0x3B, 0x7D, 0x0A, 0x61, 0x73, 0x79, 0x6E, 0x63, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69,
-0x6F, 0x6E, 0x20, 0x6C, 0x6F, 0x6F, 0x70, 0x28, 0x29, 0x20, 0x7B, 0x63, 0x6F, 0x6E, 0x73, 0x74,
-0x20, 0x76, 0x3D, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45,
-0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x69, 0x64, 0x34, 0x27,
-0x29, 0x2E, 0x69, 0x6E, 0x6E, 0x65, 0x72, 0x48, 0x54, 0x4D, 0x4C, 0x20, 0x3D, 0x3D, 0x20, 0x22,
-0x4C, 0x6F, 0x6F, 0x70, 0x69, 0x6E, 0x67, 0x22, 0x20, 0x3F, 0x20, 0x22, 0x31, 0x22, 0x20, 0x3A,
-0x20, 0x22, 0x30, 0x22, 0x3B, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x70, 0x6F, 0x73, 0x74, 0x28,
-0x7B, 0x20, 0x73, 0x68, 0x6F, 0x77, 0x3A, 0x22, 0x22, 0x2C, 0x6C, 0x6F, 0x6F, 0x70, 0x3A, 0x60,
-0x24, 0x7B, 0x76, 0x7D, 0x60, 0x20, 0x7D, 0x29, 0x3B, 0x72, 0x65, 0x66, 0x72, 0x65, 0x73, 0x68,
-0x28, 0x29, 0x3B, 0x7D, 0x3C, 0x2F, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3E, 0x0A, 0x3C, 0x73,
-0x63, 0x72, 0x69, 0x70, 0x74, 0x3E, 0x6C, 0x69, 0x73, 0x74, 0x28, 0x29, 0x3B, 0x76, 0x65, 0x72,
-0x73, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x3B, 0x72, 0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x28, 0x29,
-0x3C, 0x2F, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3E, 0x0A, 0x3C, 0x2F, 0x62, 0x6F, 0x64, 0x79,
-0x3E, 0x0A, 0x3C, 0x2F, 0x68, 0x74, 0x6D, 0x6C, 0x3E, 0x00
+0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x95, 0x54, 0x5D, 0x8B, 0xDB, 0x30,
+0x10, 0x7C, 0xCF, 0xAF, 0xD8, 0x8A, 0x42, 0x1C, 0x28, 0x71, 0xD3, 0xF6, 0x29, 0xB1, 0x5D, 0x68,
+0xEF, 0xA0, 0x85, 0x94, 0x1E, 0xCD, 0x51, 0xE8, 0xDB, 0x39, 0xB2, 0x72, 0xD1, 0x9D, 0x4E, 0x32,
+0xD6, 0xDA, 0xA9, 0x09, 0xF9, 0xEF, 0xB7, 0xB2, 0x9C, 0x0F, 0xDB, 0x25, 0xD0, 0xA7, 0x95, 0xB4,
+0xB3, 0xB3, 0xB3, 0xF2, 0x58, 0xD1, 0x9B, 0x9B, 0x9F, 0x5F, 0xEF, 0xFF, 0xDC, 0xDD, 0xC2, 0x16,
+0x5F, 0x54, 0x32, 0x8A, 0x8E, 0x41, 0xA4, 0x19, 0x05, 0x25, 0xF5, 0x33, 0x14, 0x42, 0xC5, 0xCC,
+0x62, 0xAD, 0x84, 0xDD, 0x0A, 0x81, 0x0C, 0xB6, 0x85, 0xD8, 0x1C, 0x4F, 0xA6, 0xDC, 0x5A, 0x06,
+0x21, 0x61, 0x51, 0xA2, 0x12, 0x49, 0x14, 0xFA, 0x38, 0x8A, 0xC2, 0x96, 0x63, 0x6D, 0xB2, 0xBA,
+0x65, 0x14, 0x45, 0x12, 0x95, 0x0A, 0x64, 0x16, 0x33, 0x99, 0x2D, 0xA5, 0x45, 0x46, 0xF8, 0x52,
+0x25, 0x1E, 0x4B, 0xD9, 0x51, 0x94, 0x27, 0xD1, 0xBA, 0x44, 0x34, 0x1A, 0x8C, 0xE6, 0x4A, 0xF2,
+0xE7, 0x98, 0x51, 0xB7, 0x82, 0x5A, 0x07, 0x13, 0x96, 0xFC, 0xF2, 0xCB, 0x28, 0xF4, 0x18, 0x2A,
+0xCC, 0x5D, 0xE7, 0x74, 0xAD, 0x44, 0xCB, 0xBA, 0xC2, 0x14, 0x4B, 0x52, 0xB4, 0x36, 0x05, 0x11,
+0xC6, 0xE3, 0xD9, 0xD8, 0x49, 0x72, 0x00, 0x02, 0x66, 0xB2, 0x72, 0x82, 0x7A, 0xFC, 0xB9, 0x4A,
+0x6B, 0x47, 0x7E, 0x47, 0xF1, 0xC4, 0x3C, 0x84, 0x59, 0x34, 0xB9, 0x83, 0xAD, 0x28, 0x5E, 0x81,
+0x91, 0xBE, 0xF2, 0x45, 0x78, 0xB1, 0x6E, 0x75, 0x15, 0xCA, 0x49, 0xA5, 0x87, 0xBA, 0xD5, 0x05,
+0x34, 0xF4, 0x52, 0x3B, 0x82, 0xFD, 0x80, 0x9F, 0xD8, 0x99, 0x40, 0x19, 0x2F, 0x69, 0x58, 0x98,
+0x37, 0xD3, 0x88, 0x02, 0x56, 0x5B, 0xB3, 0x83, 0xC8, 0x0A, 0x25, 0x38, 0xB6, 0x0C, 0x33, 0x57,
+0xE0, 0x4F, 0x86, 0x97, 0x4D, 0xE7, 0xCD, 0x90, 0x4D, 0xBA, 0x77, 0xCF, 0x39, 0x1D, 0x23, 0x68,
+0xB1, 0x03, 0xAF, 0x9C, 0xE8, 0x37, 0x92, 0x6E, 0xBE, 0x2B, 0xF0, 0x23, 0xEB, 0x4C, 0xD8, 0xD1,
+0x77, 0xE4, 0xB9, 0x21, 0x7A, 0x14, 0xFF, 0x12, 0xF7, 0xE1, 0x9A, 0xB8, 0xCC, 0x8B, 0xF3, 0xD5,
+0x3D, 0xD2, 0x8D, 0x31, 0xD8, 0xF1, 0xD7, 0x6F, 0x51, 0x58, 0x69, 0xF4, 0xC9, 0x62, 0x2D, 0x60,
+0x14, 0x59, 0x5E, 0xC8, 0x1C, 0xC1, 0x16, 0xDC, 0x7D, 0xD4, 0x14, 0x25, 0x9F, 0x3E, 0x91, 0x63,
+0xB0, 0xCE, 0x45, 0xCC, 0x50, 0xFC, 0xC5, 0xF0, 0x29, 0xAD, 0x52, 0x8F, 0x6A, 0xD4, 0x34, 0xAB,
+0x7E, 0x21, 0x49, 0x77, 0xC3, 0xFF, 0x57, 0x69, 0xB2, 0x29, 0x35, 0x47, 0x12, 0x05, 0xDE, 0x73,
+0x7B, 0x2B, 0x74, 0x16, 0x34, 0x06, 0x64, 0x93, 0xC5, 0xE1, 0x94, 0xF5, 0x56, 0x6B, 0xB3, 0x6E,
+0xD3, 0xC9, 0x1E, 0x1D, 0x06, 0x2D, 0xC0, 0xEF, 0x7B, 0x10, 0xEF, 0xAC, 0x33, 0xC4, 0xED, 0x1D,
+0x64, 0x94, 0xDA, 0x5A, 0x73, 0x38, 0xB7, 0x72, 0x79, 0xDB, 0xFC, 0x34, 0x84, 0x4E, 0x77, 0xA9,
+0x44, 0xC8, 0x8D, 0xC5, 0x60, 0x0F, 0x6E, 0xC4, 0x39, 0x30, 0xF6, 0x0E, 0x7C, 0x7E, 0xDE, 0x46,
+0x38, 0x4C, 0x16, 0xA7, 0x7F, 0x72, 0xC8, 0xE8, 0x4D, 0x09, 0x7B, 0x6E, 0xB4, 0x45, 0xA8, 0xE2,
+0xCC, 0x70, 0x92, 0xA7, 0x71, 0xFA, 0x28, 0xF0, 0x56, 0x09, 0xB7, 0xFC, 0x52, 0x7F, 0xCF, 0x82,
+0x31, 0x79, 0x79, 0x3C, 0x99, 0x4A, 0xAD, 0x45, 0xF1, 0xED, 0xFE, 0xC7, 0x12, 0xE2, 0x18, 0xD8,
+0x92, 0x8A, 0xA5, 0x7E, 0x64, 0xF0, 0x19, 0xD8, 0x8C, 0x01, 0xB5, 0x7F, 0xCF, 0x16, 0x43, 0x55,
+0x24, 0xCA, 0xB5, 0x99, 0x3F, 0xBC, 0xDD, 0x57, 0x87, 0x87, 0x9E, 0xA0, 0xE1, 0xB5, 0x2B, 0x7A,
+0x6A, 0x28, 0x53, 0x79, 0x47, 0x04, 0x17, 0xE8, 0x0B, 0x6C, 0xD8, 0x3E, 0x54, 0x61, 0xF3, 0x04,
+0xBE, 0x02, 0x3B, 0x24, 0x91, 0x60, 0x19, 0x05, 0x00, 0x00, 0x00
 };
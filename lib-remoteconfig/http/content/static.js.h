@@ -1,79 +1,34 @@
 static constexpr char static_js[] = {
-0x61, 0x73, 0x79, 0x6E, 0x63, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x67,
-0x65, 0x74, 0x4A, 0x53, 0x4F, 0x4E, 0x28, 0x6A, 0x73, 0x6F, 0x6E, 0x29, 0x20, 0x7B, 0x0A, 0x74,
-0x72, 0x79, 0x20, 0x7B, 0x0A, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x72, 0x20, 0x3D, 0x20, 0x61,
-0x77, 0x61, 0x69, 0x74, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x28, 0x27, 0x2F, 0x6A, 0x73, 0x6F,
-0x6E, 0x2F, 0x27, 0x2B, 0x6A, 0x73, 0x6F, 0x6E, 0x29, 0x0A, 0x69, 0x66, 0x20, 0x28, 0x21, 0x72,
-0x2E, 0x6F, 0x6B, 0x29, 0x20, 0x7B, 0x0A, 0x74, 0x68, 0x72, 0x6F, 0x77, 0x20, 0x6E, 0x65, 0x77,
-0x20, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x28, 0x27, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x27, 0x29, 0x0A,
-0x7D, 0x0A, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x72, 0x2E, 0x6A, 0x73, 0x6F, 0x6E, 0x28,
-0x29, 0x0A, 0x7D, 0x20, 0x63, 0x61, 0x74, 0x63, 0x68, 0x20, 0x28, 0x65, 0x72, 0x72, 0x6F, 0x72,
-0x29, 0x20, 0x7B, 0x7D, 0x0A, 0x7D, 0x0A, 0x61, 0x73, 0x79, 0x6E, 0x63, 0x20, 0x66, 0x75, 0x6E,
-0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6C, 0x69, 0x73, 0x74, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x63,
-0x6F, 0x6E, 0x73, 0x74, 0x20, 0x6C, 0x20, 0x3D, 0x20, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x67,
-0x65, 0x74, 0x4A, 0x53, 0x4F, 0x4E, 0x28, 0x27, 0x6C, 0x69, 0x73, 0x74, 0x27, 0x29, 0x0A, 0x64,
-0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65,
-0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x69, 0x64, 0x4C, 0x69, 0x73, 0x74, 0x22, 0x29,
-0x2E, 0x69, 0x6E, 0x6E, 0x65, 0x72, 0x48, 0x54, 0x4D, 0x4C, 0x20, 0x3D, 0x20, 0x22, 0x3C, 0x6C,
-0x69, 0x3E, 0x22, 0x2B, 0x6C, 0x2E, 0x6C, 0x69, 0x73, 0x74, 0x2E, 0x6E, 0x61, 0x6D, 0x65, 0x2B,
-0x22, 0x3C, 0x2F, 0x6C, 0x69, 0x3E, 0x3C, 0x6C, 0x69, 0x3E, 0x22, 0x2B, 0x6C, 0x2E, 0x6C, 0x69,
-0x73, 0x74, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x2E, 0x74, 0x79, 0x70, 0x65, 0x2B, 0x22, 0x3C, 0x2F,
-0x6C, 0x69, 0x3E, 0x3C, 0x6C, 0x69, 0x3E, 0x22, 0x2B, 0x6C, 0x2E, 0x6C, 0x69, 0x73, 0x74, 0x2E,
-0x6E, 0x6F, 0x64, 0x65, 0x2E, 0x70, 0x6F, 0x72, 0x74, 0x2E, 0x74, 0x79, 0x70, 0x65, 0x2B, 0x22,
-0x3C, 0x2F, 0x6C, 0x69, 0x3E, 0x22, 0x0A, 0x7D, 0x0A, 0x61, 0x73, 0x79, 0x6E, 0x63, 0x20, 0x66,
-0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x28,
-0x29, 0x20, 0x7B, 0x0A, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x76, 0x20, 0x3D, 0x20, 0x61, 0x77,
-0x61, 0x69, 0x74, 0x20, 0x67, 0x65, 0x74, 0x4A, 0x53, 0x4F, 0x4E, 0x28, 0x27, 0x76, 0x65, 0x72,
-0x73, 0x69, 0x6F, 0x6E, 0x27, 0x29, 0x0A, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E,
-0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22,
-0x69, 0x64, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x22, 0x29, 0x2E, 0x69, 0x6E, 0x6E, 0x65,
-0x72, 0x48, 0x54, 0x4D, 0x4C, 0x20, 0x3D, 0x20, 0x22, 0x3C, 0x6C, 0x69, 0x3E, 0x56, 0x22, 0x2B,
-0x76, 0x2E, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x2B, 0x22, 0x3C, 0x2F, 0x6C, 0x69, 0x3E,
-0x3C, 0x6C, 0x69, 0x3E, 0x22, 0x2B, 0x76, 0x2E, 0x62, 0x75, 0x69, 0x6C, 0x64, 0x2E, 0x64, 0x61,
-0x74, 0x65, 0x2B, 0x22, 0x3C, 0x2F, 0x6C, 0x69, 0x3E, 0x3C, 0x6C, 0x69, 0x3E, 0x22, 0x2B, 0x76,
-0x2E, 0x62, 0x75, 0x69, 0x6C, 0x64, 0x2E, 0x74, 0x69, 0x6D, 0x65, 0x2B, 0x22, 0x3C, 0x2F, 0x6C,
-0x69, 0x3E, 0x3C, 0x6C, 0x69, 0x3E, 0x22, 0x2B, 0x76, 0x2E, 0x62, 0x6F, 0x61, 0x72, 0x64, 0x2B,
-0x22, 0x3C, 0x2F, 0x6C, 0x69, 0x3E, 0x22, 0x0A, 0x7D, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69,
-0x6F, 0x6E, 0x20, 0x70, 0x6F, 0x73, 0x74, 0x28, 0x73, 0x29, 0x20, 0x7B, 0x0A, 0x72, 0x65, 0x74,
-0x75, 0x72, 0x6E, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x28, 0x27, 0x2F, 0x6A, 0x73, 0x6F, 0x6E,
-0x2F, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x27, 0x2C, 0x20, 0x7B, 0x0A, 0x6D, 0x65, 0x74, 0x68,
-0x6F, 0x64, 0x3A, 0x20, 0x27, 0x50, 0x4F, 0x53, 0x54, 0x27, 0x2C, 0x0A, 0x68, 0x65, 0x61, 0x64,
-0x65, 0x72, 0x73, 0x3A, 0x20, 0x7B, 0x0A, 0x27, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x2D,
-0x54, 0x79, 0x70, 0x65, 0x27, 0x3A, 0x20, 0x27, 0x61, 0x70, 0x70, 0x6C, 0x69, 0x63, 0x61, 0x74,
-0x69, 0x6F, 0x6E, 0x2F, 0x6A, 0x73, 0x6F, 0x6E, 0x27, 0x0A, 0x7D, 0x2C, 0x0A, 0x62, 0x6F, 0x64,
-0x79, 0x3A, 0x20, 0x4A, 0x53, 0x4F, 0x4E, 0x2E, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x69, 0x66,
-0x79, 0x28, 0x73, 0x29, 0x0A, 0x7D, 0x29, 0x0A, 0x7D, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69,
-0x6F, 0x6E, 0x20, 0x64, 0x65, 0x6C, 0x65, 0x74, 0x28, 0x73, 0x29, 0x20, 0x7B, 0x0A, 0x72, 0x65,
-0x74, 0x75, 0x72, 0x6E, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x28, 0x27, 0x2F, 0x6A, 0x73, 0x6F,
-0x6E, 0x2F, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x27, 0x2C, 0x20, 0x7B, 0x0A, 0x6D, 0x65, 0x74,
-0x68, 0x6F, 0x64, 0x3A, 0x20, 0x27, 0x44, 0x45, 0x4C, 0x45, 0x54, 0x45, 0x27, 0x2C, 0x0A, 0x68,
-0x65, 0x61, 0x64, 0x65, 0x72, 0x73, 0x3A, 0x20, 0x7B, 0x0A, 0x27, 0x43, 0x6F, 0x6E, 0x74, 0x65,
-0x6E, 0x74, 0x2D, 0x54, 0x79, 0x70, 0x65, 0x27, 0x3A, 0x20, 0x27, 0x61, 0x70, 0x70, 0x6C, 0x69,
-0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2F, 0x6A, 0x73, 0x6F, 0x6E, 0x27, 0x0A, 0x7D, 0x2C, 0x0A,
-0x62, 0x6F, 0x64, 0x79, 0x3A, 0x20, 0x4A, 0x53, 0x4F, 0x4E, 0x2E, 0x73, 0x74, 0x72, 0x69, 0x6E,
-0x67, 0x69, 0x66, 0x79, 0x28, 0x73, 0x29, 0x0A, 0x7D, 0x29, 0x0A, 0x7D, 0x0A, 0x66, 0x75, 0x6E,
-0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x72, 0x65, 0x62, 0x6F, 0x6F, 0x74, 0x28, 0x29, 0x20, 0x7B,
-0x0A, 0x70, 0x6F, 0x73, 0x74, 0x28, 0x7B, 0x20, 0x72, 0x65, 0x62, 0x6F, 0x6F, 0x74, 0x3A, 0x20,
-0x31, 0x20, 0x7D, 0x29, 0x0A, 0x7D, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20,
-0x6C, 0x6F, 0x63, 0x61, 0x74, 0x65, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x76, 0x61, 0x72, 0x20, 0x62,
-0x20, 0x3D, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45,
-0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x6C, 0x6F, 0x63, 0x61,
-0x74, 0x65, 0x42, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x27, 0x29, 0x3B, 0x0A, 0x69, 0x66, 0x20, 0x28,
-0x62, 0x2E, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4C, 0x69, 0x73, 0x74, 0x2E, 0x63, 0x6F, 0x6E, 0x74,
-0x61, 0x69, 0x6E, 0x73, 0x28, 0x27, 0x69, 0x6E, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x27, 0x29,
-0x29, 0x20, 0x7B, 0x0A, 0x62, 0x2E, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4C, 0x69, 0x73, 0x74, 0x2E,
-0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x28, 0x27, 0x69, 0x6E, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65,
-0x27, 0x29, 0x0A, 0x62, 0x2E, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4C, 0x69, 0x73, 0x74, 0x2E, 0x61,
-0x64, 0x64, 0x28, 0x27, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x27, 0x29, 0x0A, 0x62, 0x2E, 0x69,
-0x6E, 0x6E, 0x65, 0x72, 0x48, 0x54, 0x4D, 0x4C, 0x20, 0x3D, 0x20, 0x27, 0x4C, 0x6F, 0x63, 0x61,
-0x74, 0x65, 0x20, 0x4F, 0x6E, 0x27, 0x0A, 0x70, 0x6F, 0x73, 0x74, 0x28, 0x7B, 0x20, 0x69, 0x64,
-0x65, 0x6E, 0x74, 0x69, 0x66, 0x79, 0x3A, 0x20, 0x31, 0x20, 0x7D, 0x29, 0x0A, 0x7D, 0x20, 0x65,
-0x6C, 0x73, 0x65, 0x20, 0x7B, 0x0A, 0x62, 0x2E, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4C, 0x69, 0x73,
-0x74, 0x2E, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x28, 0x27, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65,
-0x27, 0x29, 0x0A, 0x62, 0x2E, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4C, 0x69, 0x73, 0x74, 0x2E, 0x61,
-0x64, 0x64, 0x28, 0x27, 0x69, 0x6E, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x27, 0x29, 0x0A, 0x62,
-0x2E, 0x69, 0x6E, 0x6E, 0x65, 0x72, 0x48, 0x54, 0x4D, 0x4C, 0x20, 0x3D, 0x20, 0x27, 0x4C, 0x6F,
-0x63, 0x61, 0x74, 0x65, 0x20, 0x4F, 0x66, 0x66, 0x27, 0x0A, 0x70, 0x6F, 0x73, 0x74, 0x28, 0x7B,
-0x20, 0x69, 0x64, 0x65, 0x6E, 0x74, 0x69, 0x66, 0x79, 0x3A, 0x20, 0x30, 0x20, 0x7D, 0x29, 0x0A,
-0x7D, 0x0A, 0x7D, 0x00
+0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xB5, 0x53, 0xC1, 0x8E, 0xD3, 0x30,
+0x10, 0xBD, 0xE7, 0x2B, 0x86, 0x5C, 0x9C, 0xA8, 0xC5, 0x85, 0x6B, 0x77, 0xE1, 0xB0, 0x50, 0x09,
+0x50, 0xA1, 0x48, 0x5B, 0xED, 0xDD, 0x89, 0x27, 0x5B, 0x83, 0x6B, 0x47, 0xB6, 0x93, 0x2A, 0x5A,
+0xF5, 0xDF, 0x19, 0xA7, 0xD9, 0x2A, 0x51, 0x5B, 0x24, 0x0E, 0x5C, 0x92, 0x68, 0xE6, 0xCD, 0xBC,
+0xF7, 0x66, 0x26, 0xC2, 0x77, 0xA6, 0x84, 0xAA, 0x31, 0x65, 0x50, 0xD6, 0xC0, 0x33, 0x86, 0x6F,
+0x8F, 0x9B, 0x1F, 0xD9, 0x2F, 0x6F, 0x4D, 0x0E, 0x2F, 0x49, 0x70, 0x1D, 0x3D, 0x4B, 0x6B, 0x7C,
+0x00, 0x07, 0x1F, 0x40, 0x1C, 0x84, 0x0A, 0x50, 0x61, 0x28, 0x77, 0x19, 0x5B, 0x44, 0xD4, 0x82,
+0xCD, 0x7A, 0x70, 0xA2, 0x2A, 0xC8, 0xDE, 0x38, 0x6E, 0x7F, 0xF7, 0x75, 0x3B, 0x67, 0x0F, 0x60,
+0xF0, 0x00, 0x2B, 0xE7, 0xAC, 0xCB, 0x58, 0xFF, 0x62, 0x79, 0x72, 0x4C, 0x1C, 0x86, 0xC6, 0x19,
+0x70, 0x3C, 0x96, 0x65, 0x14, 0x81, 0x52, 0x50, 0x3B, 0xC8, 0x30, 0x42, 0xA8, 0xF8, 0x48, 0x20,
+0x31, 0x95, 0xA5, 0x95, 0x0F, 0x59, 0x7E, 0x56, 0xA2, 0xCF, 0x4A, 0x5E, 0xF5, 0xB2, 0x88, 0xA0,
+0xF6, 0xD2, 0x96, 0xCD, 0x1E, 0x4D, 0xE0, 0x94, 0x58, 0x69, 0x8C, 0x9F, 0x0F, 0xDD, 0x57, 0x99,
+0xA5, 0x4A, 0xAE, 0x09, 0x91, 0xE6, 0x5C, 0x19, 0x83, 0xEE, 0xCB, 0xF6, 0xFB, 0x9A, 0x7A, 0xA4,
+0xF7, 0x5A, 0x7D, 0x4C, 0x67, 0x9A, 0xC7, 0x6A, 0x6E, 0xC4, 0x1E, 0x67, 0xE9, 0xFD, 0x82, 0x62,
+0xD3, 0xB8, 0x95, 0xC8, 0x43, 0x57, 0xDF, 0x4E, 0xD6, 0xD6, 0x85, 0x31, 0x22, 0xBD, 0x74, 0xD0,
+0xA2, 0xF3, 0x2A, 0xFA, 0x3D, 0x9B, 0x68, 0x2F, 0x4D, 0x0C, 0xA0, 0xBF, 0xFB, 0x78, 0x3A, 0x81,
+0xAE, 0x59, 0x79, 0x4A, 0x67, 0x2D, 0x1F, 0x9A, 0x4C, 0xC4, 0xB6, 0xBC, 0x68, 0x94, 0x96, 0x5C,
+0x8A, 0x80, 0x57, 0x13, 0x41, 0xED, 0x2F, 0x12, 0x56, 0x38, 0x39, 0x32, 0x74, 0xB6, 0x52, 0x5B,
+0x5A, 0x86, 0x8F, 0x46, 0x86, 0x55, 0x4E, 0xCE, 0x41, 0xF4, 0x20, 0x36, 0xA7, 0xF4, 0x1E, 0xC3,
+0xCE, 0xCA, 0x25, 0xB0, 0x9F, 0x9B, 0xC7, 0x2D, 0x9B, 0x27, 0x3B, 0x14, 0x92, 0xC4, 0x2D, 0x29,
+0xC5, 0x3E, 0x59, 0x13, 0xC8, 0xD4, 0xDB, 0x2D, 0x4D, 0x8D, 0x11, 0x44, 0xD4, 0xB5, 0x56, 0x74,
+0x08, 0x54, 0xDB, 0xF7, 0x61, 0xC9, 0x71, 0x9E, 0x14, 0x56, 0x76, 0x4B, 0x88, 0xB3, 0xE1, 0x3E,
+0x38, 0x65, 0x9E, 0x55, 0xD5, 0x11, 0x73, 0x72, 0xCC, 0xC7, 0x7A, 0x24, 0x6A, 0xFC, 0x47, 0x41,
+0x9F, 0x57, 0xEB, 0xD5, 0x76, 0xF5, 0xFF, 0x24, 0x39, 0x2C, 0xAC, 0x3D, 0x5D, 0x6C, 0x3F, 0xAD,
+0x97, 0x21, 0xB2, 0x84, 0xF7, 0x30, 0x45, 0x6A, 0x4B, 0x0C, 0xD8, 0x23, 0x5B, 0xE1, 0xA0, 0xA0,
+0x55, 0xDE, 0xDA, 0x3D, 0x3B, 0x61, 0x1F, 0x9A, 0x10, 0xE2, 0x8D, 0xDC, 0xF5, 0x7F, 0x5C, 0xC1,
+0x4B, 0x2D, 0xBC, 0x8F, 0xC7, 0xCD, 0xE9, 0xAE, 0x82, 0x50, 0xC6, 0x67, 0x4C, 0x99, 0xE8, 0xBA,
+0x45, 0x96, 0xC7, 0xC6, 0x63, 0x8C, 0xC3, 0xBD, 0x6D, 0x71, 0x8C, 0x98, 0xA4, 0x85, 0x24, 0x9E,
+0x51, 0x66, 0x7C, 0x62, 0x6C, 0xDD, 0xF3, 0xC3, 0x86, 0x26, 0x31, 0xB8, 0x52, 0x92, 0xC4, 0xD1,
+0x04, 0x5E, 0x7D, 0x01, 0x6A, 0x8F, 0x37, 0x18, 0x6F, 0xF3, 0x4D, 0xB4, 0x5C, 0x65, 0xAC, 0xAA,
+0x2B, 0x94, 0xEF, 0x4E, 0xA3, 0x3C, 0xFE, 0x01, 0x14, 0x12, 0x4C, 0x69, 0xC3, 0x04, 0x00, 0x00,
+0x00
 };
@@ -1,28 +1,17 @@
 static constexpr char styles_css[] = {
-0x62, 0x6F, 0x64, 0x79, 0x20, 0x7B, 0x0A, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E,
-0x64, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x72, 0x67, 0x62, 0x28, 0x32, 0x30, 0x2C,
-0x32, 0x30, 0x2C, 0x32, 0x30, 0x29, 0x3B, 0x0A, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x72,
-0x67, 0x62, 0x28, 0x32, 0x35, 0x35, 0x2C, 0x20, 0x32, 0x35, 0x35, 0x2C, 0x20, 0x32, 0x35, 0x35,
-0x29, 0x3B, 0x0A, 0x7D, 0x0A, 0x75, 0x6C, 0x20, 0x7B, 0x0A, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61,
-0x79, 0x3A, 0x20, 0x66, 0x6C, 0x65, 0x78, 0x3B, 0x0A, 0x7D, 0x0A, 0x6C, 0x69, 0x20, 0x7B, 0x0A,
-0x6C, 0x69, 0x73, 0x74, 0x2D, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3A, 0x20, 0x6E, 0x6F, 0x6E, 0x65,
-0x3B, 0x0A, 0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E, 0x3A, 0x20, 0x31, 0x70, 0x78, 0x20, 0x35, 0x70,
-0x78, 0x3B, 0x0A, 0x7D, 0x0A, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x20, 0x7B, 0x0A, 0x64, 0x69,
-0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x20, 0x66, 0x6C, 0x65, 0x78, 0x3B, 0x0A, 0x62, 0x6F, 0x72,
-0x64, 0x65, 0x72, 0x2D, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3A, 0x20, 0x34, 0x70, 0x78, 0x3B,
-0x0A, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x3A, 0x20, 0x73, 0x6F, 0x6C, 0x69, 0x64, 0x20, 0x67,
-0x72, 0x65, 0x79, 0x20, 0x31, 0x70, 0x78, 0x3B, 0x0A, 0x7D, 0x0A, 0x66, 0x6F, 0x6F, 0x74, 0x65,
-0x72, 0x20, 0x7B, 0x0A, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x20, 0x66, 0x6C, 0x65,
-0x78, 0x3B, 0x0A, 0x6A, 0x75, 0x73, 0x74, 0x69, 0x66, 0x79, 0x2D, 0x63, 0x6F, 0x6E, 0x74, 0x65,
-0x6E, 0x74, 0x3A, 0x20, 0x63, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x3B, 0x0A, 0x62, 0x6F, 0x72, 0x64,
-0x65, 0x72, 0x2D, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3A, 0x20, 0x34, 0x70, 0x78, 0x3B, 0x0A,
-0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x3A, 0x20, 0x73, 0x6F, 0x6C, 0x69, 0x64, 0x20, 0x67, 0x72,
-0x65, 0x79, 0x20, 0x31, 0x70, 0x78, 0x3B, 0x0A, 0x7D, 0x0A, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E,
-0x20, 0x7B, 0x0A, 0x63, 0x75, 0x72, 0x73, 0x6F, 0x72, 0x3A, 0x20, 0x70, 0x6F, 0x69, 0x6E, 0x74,
-0x65, 0x72, 0x3B, 0x0A, 0x7D, 0x0A, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x3A, 0x61, 0x63, 0x74,
-0x69, 0x76, 0x65, 0x20, 0x7B, 0x0A, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64,
-0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x23, 0x30, 0x30, 0x30, 0x3B, 0x0A, 0x63, 0x6F,
-0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x23, 0x66, 0x66, 0x66, 0x3B, 0x0A, 0x7D, 0x0A, 0x2E, 0x62, 0x74,
-0x6E, 0x20, 0x7B, 0x0A, 0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E, 0x2D, 0x6C, 0x65, 0x66, 0x74, 0x3A,
-0x20, 0x35, 0x30, 0x70, 0x78, 0x3B, 0x0A, 0x7D, 0x0A, 0x00
+0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x95, 0x90, 0xCF, 0x6A, 0x03, 0x21,
+0x10, 0x87, 0xEF, 0xFB, 0x14, 0x03, 0xB9, 0xA4, 0x90, 0x0D, 0xB6, 0x74, 0x2F, 0xE6, 0x69, 0xFC,
+0xBB, 0xB5, 0xB5, 0x8E, 0x8C, 0x63, 0x89, 0x94, 0xBC, 0x7B, 0x35, 0x4B, 0x42, 0xA1, 0xB9, 0x14,
+0x64, 0x0E, 0xDF, 0xE8, 0x37, 0xE3, 0x4F, 0xA3, 0x6D, 0xF0, 0x3D, 0x69, 0x65, 0x3E, 0x56, 0xC2,
+0x9A, 0xEC, 0x6C, 0x30, 0x22, 0x49, 0xA0, 0x55, 0xEF, 0x5F, 0xC4, 0xE1, 0x7A, 0x9E, 0x4E, 0xD3,
+0x6F, 0xBA, 0x2C, 0x07, 0xB8, 0x95, 0xDE, 0xBA, 0x4C, 0x35, 0x76, 0x85, 0x0D, 0x25, 0x47, 0xD5,
+0x24, 0xF8, 0xE8, 0xCE, 0x83, 0xC6, 0xD0, 0x69, 0x0C, 0x85, 0xE7, 0xC2, 0x2D, 0x3A, 0x09, 0x09,
+0x93, 0x3B, 0x4D, 0x9F, 0x8A, 0xD6, 0x90, 0x24, 0x3C, 0xE7, 0x33, 0x2C, 0xF9, 0x7A, 0xF3, 0xCD,
+0x29, 0xEB, 0xE8, 0xAF, 0x43, 0x23, 0x75, 0x3E, 0x93, 0xB2, 0xA1, 0x16, 0x09, 0xAF, 0xF9, 0xCE,
+0x24, 0x14, 0x8C, 0xC1, 0xC2, 0x4A, 0xAE, 0x0D, 0xD3, 0xB0, 0x78, 0x44, 0x7E, 0x64, 0x79, 0xAF,
+0x85, 0x83, 0x6F, 0xFD, 0x63, 0x89, 0x5D, 0x62, 0x09, 0xA6, 0x57, 0x47, 0xFF, 0xD5, 0xEB, 0xCA,
+0x8C, 0xA9, 0xEB, 0x4D, 0xA5, 0x32, 0xB2, 0xC8, 0x18, 0x36, 0xCF, 0xAD, 0x27, 0x95, 0xE1, 0xF0,
+0xE5, 0x1E, 0xC6, 0xB9, 0x13, 0x42, 0xDC, 0x53, 0xDC, 0x79, 0xEF, 0xC7, 0xB3, 0xA3, 0xE6, 0x21,
+0xDC, 0x12, 0x99, 0xA3, 0xF3, 0x7D, 0xB9, 0x45, 0x6C, 0xE3, 0x7E, 0x00, 0xF7, 0x11, 0x51, 0x2F,
+0x99, 0x01, 0x00, 0x00, 0x00
 };
@@ -30,8 +30,10 @@ namespace http {
 static constexpr uint32_t BUFSIZE = 1440; //TODO We need the TCP max segment size here
 enum class Status {
 	OK = 200,
+	NOT_MODIFIED = 304,
 	BAD_REQUEST = 400,
 	NOT_FOUND = 404,
+	NOT_ACCEPTABLE = 406,
 	REQUEST_TIMEOUT = 408,
 	REQUEST_ENTITY_TOO_LARGE = 413,
 	REQUEST_URI_TOO_LONG = 414,
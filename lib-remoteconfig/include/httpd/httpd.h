@@ -41,6 +41,21 @@ public:
 	~HttpDaemon();
 
 	void Run() {
+		auto isDynamicContentPending = false;
+
+		for (auto *pRequest : pHandleRequest) {
+			pRequest->Run();
+			isDynamicContentPending |= pRequest->IsDynamicContentPending();
+		}
+
+		/*
+		 * The dynamic content buffer is shared by the connections,
+		 * a new request waits until the pending dynamic content is queued
+		 */
+		if (__builtin_expect((isDynamicContentPending), 0)) {
+			return;
+		}
+
 		uint32_t nConnectionHandle;
 		const auto nBytesReceived = Network::Get()->TcpRead(m_nHandle, const_cast<const uint8_t **>(reinterpret_cast<uint8_t **>(&m_RequestHeaderResponse)), nConnectionHandle);
 
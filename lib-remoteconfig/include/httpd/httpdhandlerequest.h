@@ -42,7 +42,21 @@ public:
 
 	void HandleRequest(const uint32_t nBytesReceived, char *pRequestHeaderResponse);
 
+	/**
+	 * Sends the rest of the content, TcpWrite queues only what fits in the send queue
+	 */
+	void Run() {
+		if (__builtin_expect((m_nPendingLength != 0), 0)) {
+			SendPending();
+		}
+	}
+
+	bool IsDynamicContentPending() const {
+		return (m_nPendingLength != 0) && (m_pContent == m_DynamicContent);
+	}
+
 private:
+	void SendPending();
 	http::Status ParseRequest();
 	http::Status ParseMethod(char *pLine);
 	http::Status ParseHeaderField(char *pLine);
@@ -58,10 +72,14 @@ private:
 	uint32_t m_nFileDataLength { 0 };
 	uint32_t m_nRequestContentSize { 0 };
 	uint32_t m_nBytesReceived { 0 };
+	uint32_t m_nPendingLength { 0 };
 
 	char *m_pUri { nullptr };
 	char *m_pFileData { nullptr };
 	const char *m_pContent { nullptr };
+	const char *m_pPending { nullptr };
+	const char *m_pETag { nullptr };
+	const char *m_pIfNoneMatch { nullptr };
 	char *m_RequestHeaderResponse { nullptr };
 
 	http::Status m_Status { http::Status::UNKNOWN_ERROR };
@@ -69,6 +87,8 @@ private:
 	http::contentTypes m_ContentType { http::contentTypes::NOT_DEFINED };
 
 	bool m_IsAction { false };
+	bool m_IsGzip { false };
+	bool m_IsAcceptGzip { false };
 
 	static char m_DynamicContent[http::BUFSIZE];
 };
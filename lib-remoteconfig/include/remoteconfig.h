@@ -474,6 +474,8 @@ private:
 	void HandleTftpGet();
 	void HandleRdmSet();
 	void HandleRdmGet();
+	void HandleAnalyzerGet();
+	void HandleAnalyzerSet();
 
 	void PlatformHandleTftpSet();
 	void PlatformHandleTftpGet();
@@ -40,7 +40,11 @@ uint32_t json_get_phystatus(char *pOutBuffer, const uint32_t nOutBufferSize);
 namespace dmx {
 uint32_t json_get_ports(char *pOutBuffer, const uint32_t nOutBufferSize);
 uint32_t json_get_portstatus(const char cPort, char *pOutBuffer, const uint32_t nOutBufferSize);
+uint32_t json_get_analyzer(const char cPort, char *pOutBuffer, const uint32_t nOutBufferSize);
 }  // namespace dmx
+namespace e131 {
+uint32_t json_get_portstatus(const char cPort, char *pOutBuffer, const uint32_t nOutBufferSize);
+}  // namespace e131
 namespace rdm {
 uint32_t json_get_rdm(char *pOutBuffer, const uint32_t nOutBufferSize);
 uint32_t json_get_queue(char *pOutBuffer, const uint32_t nOutBufferSize);
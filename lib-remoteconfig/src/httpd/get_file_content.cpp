@@ -106,11 +106,13 @@ uint32_t get_file_content(const char *fileName, char *pDst, http::contentTypes&
 
 static char s_StaticContent[http::BUFSIZE];
 
-const char *get_file_content(const char *pFileName, uint32_t& nSize, http::contentTypes& contentType) {
+const char *get_file_content(const char *pFileName, uint32_t& nSize, http::contentTypes& contentType, const char *& pETag, bool& isGzip) {
 	DEBUG_ENTRY
 	DEBUG_PUTS(pFileName);
 
 	nSize = get_file_content(pFileName, s_StaticContent, contentType);
+	pETag = nullptr;
+	isGzip = false;
 
 	if (nSize != 0) {
 		return s_StaticContent;
@@ -120,7 +122,7 @@ const char *get_file_content(const char *pFileName, uint32_t& nSize, http::conte
 	return nullptr;
 }
 #else
-const char *get_file_content(const char *pFileName, uint32_t& nSize, http::contentTypes& contentType) {
+const char *get_file_content(const char *pFileName, uint32_t& nSize, http::contentTypes& contentType, const char *& pETag, bool& isGzip) {
 	DEBUG_ENTRY
 	DEBUG_PUTS(pFileName);
 
@@ -128,12 +130,16 @@ const char *get_file_content(const char *pFileName, uint32_t& nSize, http::conte
 		if (strcmp(pFileName, content.pFileName) == 0) {
 			nSize = content.nContentLength;
 			contentType = content.contentType;
+			pETag = content.pETag;
+			isGzip = content.isGzip;
 			return content.pContent;
 		}
 	}
 
 	nSize = 0;
 	contentType = http::contentTypes::NOT_DEFINED;
+	pETag = nullptr;
+	isGzip = false;
 
 	DEBUG_EXIT
 	return nullptr;
@@ -0,0 +1,450 @@
+/**
+ * @file gunzip.cpp
+ *
+ * Inflate after the canonical Huffman decoding of puff.c (zlib contrib),
+ * decoded bit by bit: small code, no tables in RAM, fast enough for the static content.
+ */
+/* Copyright (C) 2024 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <cstdint>
+#include <cstring>
+
+#include "httpd/gunzip.h"
+
+#include "debug.h"
+
+namespace http {
+namespace inflate {
+static constexpr uint32_t MAX_BITS = 15;
+static constexpr uint32_t MAX_LCODES = 286;
+static constexpr uint32_t MAX_DCODES = 30;
+static constexpr uint32_t FIXED_LCODES = 288;
+
+namespace flag {
+static constexpr uint8_t FHCRC = (1U << 1);
+static constexpr uint8_t FEXTRA = (1U << 2);
+static constexpr uint8_t FNAME = (1U << 3);
+static constexpr uint8_t FCOMMENT = (1U << 4);
+}  // namespace flag
+
+static constexpr uint16_t LENGTH_BASE[29] = {
+	3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+	35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+static constexpr uint8_t LENGTH_EXTRA[29] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+	3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+static constexpr uint16_t DISTANCE_BASE[30] = {
+	1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+	257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+static constexpr uint8_t DISTANCE_EXTRA[30] = {
+	0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+	7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+
+struct State {
+	const uint8_t *pIn;
+	uint32_t nInLength;
+	uint32_t nInIndex;
+	uint8_t *pOut;
+	uint32_t nOutSize;
+	uint32_t nOutIndex;
+	uint32_t nBitBuffer;
+	uint32_t nBitCount;
+	bool isError;
+};
+
+struct Huffman {
+	uint16_t count[MAX_BITS + 1];	///< Number of codes of each length
+	uint16_t symbol[FIXED_LCODES];	///< Symbols ordered by code
+};
+
+static uint32_t bits(State& s, const uint32_t nBits) {
+	auto nValue = s.nBitBuffer;
+
+	while (s.nBitCount < nBits) {
+		if (s.nInIndex == s.nInLength) {
+			s.isError = true;
+			return 0;
+		}
+
+		nValue |= static_cast<uint32_t>(s.pIn[s.nInIndex++]) << s.nBitCount;
+		s.nBitCount += 8;
+	}
+
+	s.nBitBuffer = nValue >> nBits;
+	s.nBitCount -= nBits;
+
+	return nValue & ((1U << nBits) - 1);
+}
+
+/**
+ * @return the symbol, or -1 when the code is not in the table
+ */
+static int32_t decode(State& s, const Huffman& h) {
+	int32_t nCode = 0;	// Bits being decoded
+	int32_t nFirst = 0;	// First code of the length
+	int32_t nIndex = 0;	// Index of the first code of the length in symbol[]
+
+	for (uint32_t nLength = 1; nLength <= MAX_BITS; nLength++) {
+		nCode |= static_cast<int32_t>(bits(s, 1));
+
+		if (s.isError) {
+			return -1;
+		}
+
+		const auto nCount = static_cast<int32_t>(h.count[nLength]);
+
+		if ((nCode - nCount) < nFirst) {
+			return h.symbol[nIndex + (nCode - nFirst)];
+		}
+
+		nIndex += nCount;
+		nFirst += nCount;
+		nFirst <<= 1;
+		nCode <<= 1;
+	}
+
+	return -1;
+}
+
+/**
+ * @return false when the code lengths are over-subscribed
+ */
+static bool construct(Huffman& h, const uint8_t *pLengths, const uint32_t nCodes) {
+	memset(h.count, 0, sizeof(h.count));
+
+	for (uint32_t nSymbol = 0; nSymbol < nCodes; nSymbol++) {
+		h.count[pLengths[nSymbol]]++;
+	}
+
+	if (h.count[0] == nCodes) {
+		return true;	// No codes, decode() fails when it is used
+	}
+
+	int32_t nLeft = 1;
+
+	for (uint32_t nLength = 1; nLength <= MAX_BITS; nLength++) {
+		nLeft <<= 1;
+		nLeft -= h.count[nLength];
+
+		if (nLeft < 0) {
+			return false;
+		}
+	}
+
+	uint16_t offsets[MAX_BITS + 1];
+	offsets[1] = 0;
+
+	for (uint32_t nLength = 1; nLength < MAX_BITS; nLength++) {
+		offsets[nLength + 1] = static_cast<uint16_t>(offsets[nLength] + h.count[nLength]);
+	}
+
+	for (uint32_t nSymbol = 0; nSymbol < nCodes; nSymbol++) {
+		if (pLengths[nSymbol] != 0) {
+			h.symbol[offsets[pLengths[nSymbol]]++] = static_cast<uint16_t>(nSymbol);
+		}
+	}
+
+	return true;
+}
+
+static bool codes(State& s, const Huffman& lencode, const Huffman& distcode) {
+	for (;;) {
+		auto nSymbol = decode(s, lencode);
+
+		if (nSymbol < 0) {
+			return false;
+		}
+
+		if (nSymbol < 256) {
+			if (s.nOutIndex == s.nOutSize) {
+				return false;
+			}
+
+			s.pOut[s.nOutIndex++] = static_cast<uint8_t>(nSymbol);
+			continue;
+		}
+
+		if (nSymbol == 256) {
+			return true;
+		}
+
+		nSymbol -= 257;
+
+		if (nSymbol >= 29) {
+			return false;
+		}
+
+		const auto nLength = LENGTH_BASE[nSymbol] + bits(s, LENGTH_EXTRA[nSymbol]);
+		const auto nDistanceSymbol = decode(s, distcode);
+
+		if ((nDistanceSymbol < 0) || (nDistanceSymbol >= 30)) {
+			return false;
+		}
+
+		const auto nDistance = DISTANCE_BASE[nDistanceSymbol] + bits(s, DISTANCE_EXTRA[nDistanceSymbol]);
+
+		if (s.isError || (nDistance > s.nOutIndex) || (nLength > (s.nOutSize - s.nOutIndex))) {
+			return false;
+		}
+
+		// Byte by byte, the copy may overlap
+		for (uint32_t i = 0; i < nLength; i++) {
+			s.pOut[s.nOutIndex] = s.pOut[s.nOutIndex - nDistance];
+			s.nOutIndex++;
+		}
+	}
+}
+
+static bool stored(State& s) {
+	// Discard the rest of the byte
+	s.nBitBuffer = 0;
+	s.nBitCount = 0;
+
+	if ((s.nInLength - s.nInIndex) < 4) {
+		return false;
+	}
+
+	const auto nLength = static_cast<uint32_t>(s.pIn[s.nInIndex] | (s.pIn[s.nInIndex + 1] << 8));
+	const auto nComplement = static_cast<uint32_t>(s.pIn[s.nInIndex + 2] | (s.pIn[s.nInIndex + 3] << 8));
+	s.nInIndex += 4;
+
+	if ((nLength != (~nComplement & 0xFFFF)) || (nLength > (s.nInLength - s.nInIndex)) || (nLength > (s.nOutSize - s.nOutIndex))) {
+		return false;
+	}
+
+	memcpy(&s.pOut[s.nOutIndex], &s.pIn[s.nInIndex], nLength);
+	s.nOutIndex += nLength;
+	s.nInIndex += nLength;
+
+	return true;
+}
+
+static bool fixed(State& s) {
+	Huffman lencode;
+	Huffman distcode;
+	uint8_t lengths[FIXED_LCODES];
+	uint32_t nSymbol = 0;
+
+	for (; nSymbol < 144; nSymbol++) lengths[nSymbol] = 8;
+	for (; nSymbol < 256; nSymbol++) lengths[nSymbol] = 9;
+	for (; nSymbol < 280; nSymbol++) lengths[nSymbol] = 7;
+	for (; nSymbol < FIXED_LCODES; nSymbol++) lengths[nSymbol] = 8;
+
+	construct(lencode, lengths, FIXED_LCODES);
+
+	memset(lengths, 5, MAX_DCODES);
+	construct(distcode, lengths, MAX_DCODES);
+
+	return codes(s, lencode, distcode);
+}
+
+static bool dynamic(State& s) {
+	static constexpr uint8_t ORDER[19] = { 16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+
+	Huffman lencode;
+	Huffman distcode;
+	uint8_t lengths[MAX_LCODES + MAX_DCODES];
+
+	const auto nLengthCodes = bits(s, 5) + 257;
+	const auto nDistanceCodes = bits(s, 5) + 1;
+	const auto nCodeLengthCodes = bits(s, 4) + 4;
+
+	if (s.isError || (nLengthCodes > MAX_LCODES) || (nDistanceCodes > MAX_DCODES)) {
+		return false;
+	}
+
+	uint32_t nIndex = 0;
+
+	for (; nIndex < nCodeLengthCodes; nIndex++) {
+		lengths[ORDER[nIndex]] = static_cast<uint8_t>(bits(s, 3));
+	}
+
+	for (; nIndex < 19; nIndex++) {
+		lengths[ORDER[nIndex]] = 0;
+	}
+
+	if (s.isError || !construct(lencode, lengths, 19)) {
+		return false;
+	}
+
+	nIndex = 0;
+
+	while (nIndex < (nLengthCodes + nDistanceCodes)) {
+		const auto nSymbol = decode(s, lencode);
+
+		if (nSymbol < 0) {
+			return false;
+		}
+
+		if (nSymbol < 16) {
+			lengths[nIndex++] = static_cast<uint8_t>(nSymbol);
+			continue;
+		}
+
+		uint8_t nLength = 0;
+		uint32_t nRepeat;
+
+		if (nSymbol == 16) {
+			if (nIndex == 0) {
+				return false;
+			}
+			nLength = lengths[nIndex - 1];
+			nRepeat = 3 + bits(s, 2);
+		} else if (nSymbol == 17) {
+			nRepeat = 3 + bits(s, 3);
+		} else {
+			nRepeat = 11 + bits(s, 7);
+		}
+
+		if (s.isError || ((nIndex + nRepeat) > (nLengthCodes + nDistanceCodes))) {
+			return false;
+		}
+
+		while (nRepeat-- != 0) {
+			lengths[nIndex++] = nLength;
+		}
+	}
+
+	// The end of block code is required
+	if (lengths[256] == 0) {
+		return false;
+	}
+
+	if (!construct(lencode, lengths, nLengthCodes) || !construct(distcode, &lengths[nLengthCodes], nDistanceCodes)) {
+		return false;
+	}
+
+	return codes(s, lencode, distcode);
+}
+
+static uint32_t crc32(const uint8_t *pData, const uint32_t nLength) {
+	uint32_t nCrc = 0xFFFFFFFF;
+
+	for (uint32_t i = 0; i < nLength; i++) {
+		nCrc ^= pData[i];
+
+		for (uint32_t j = 0; j < 8; j++) {
+			nCrc = (nCrc >> 1) ^ (0xEDB88320 & (0U - (nCrc & 1U)));
+		}
+	}
+
+	return ~nCrc;
+}
+
+static uint32_t get_uint32(const uint8_t *p) {
+	return static_cast<uint32_t>(p[0]) | static_cast<uint32_t>(p[1]) << 8 | static_cast<uint32_t>(p[2]) << 16 | static_cast<uint32_t>(p[3]) << 24;
+}
+}  // namespace inflate
+
+uint32_t gunzip(const uint8_t *pIn, const uint32_t nInLength, uint8_t *pOut, const uint32_t nOutSize) {
+	DEBUG_ENTRY
+
+	// Header 10, trailer 8 (CRC32, ISIZE)
+	if ((nInLength < 18) || (pIn[0] != 0x1F) || (pIn[1] != 0x8B) || (pIn[2] != 8)) {
+		DEBUG_EXIT
+		return 0;
+	}
+
+	const auto nFlags = pIn[3];
+	uint32_t nIndex = 10;
+
+	if ((nFlags & inflate::flag::FEXTRA) != 0) {
+		nIndex += 2U + (static_cast<uint32_t>(pIn[10]) | static_cast<uint32_t>(pIn[11]) << 8);
+	}
+
+	if ((nFlags & inflate::flag::FNAME) != 0) {
+		while ((nIndex < nInLength) && (pIn[nIndex++] != 0)) {
+		}
+	}
+
+	if ((nFlags & inflate::flag::FCOMMENT) != 0) {
+		while ((nIndex < nInLength) && (pIn[nIndex++] != 0)) {
+		}
+	}
+
+	if ((nFlags & inflate::flag::FHCRC) != 0) {
+		nIndex += 2;
+	}
+
+	if ((nIndex + 8) > nInLength) {
+		DEBUG_EXIT
+		return 0;
+	}
+
+	inflate::State s;
+	s.pIn = pIn;
+	s.nInLength = nInLength - 8;
+	s.nInIndex = nIndex;
+	s.pOut = pOut;
+	s.nOutSize = nOutSize;
+	s.nOutIndex = 0;
+	s.nBitBuffer = 0;
+	s.nBitCount = 0;
+	s.isError = false;
+
+	uint32_t nLast;
+
+	do {
+		nLast = inflate::bits(s, 1);
+		const auto nType = inflate::bits(s, 2);
+
+		if (s.isError) {
+			DEBUG_EXIT
+			return 0;
+		}
+
+		bool isOk;
+
+		switch (nType) {
+		case 0:
+			isOk = inflate::stored(s);
+			break;
+		case 1:
+			isOk = inflate::fixed(s);
+			break;
+		case 2:
+			isOk = inflate::dynamic(s);
+			break;
+		default:
+			isOk = false;
+			break;
+		}
+
+		if (!isOk || s.isError) {
+			DEBUG_PUTS("Invalid deflate data");
+			DEBUG_EXIT
+			return 0;
+		}
+	} while (nLast == 0);
+
+	const auto *pTrailer = &pIn[nInLength - 8];
+
+	if ((inflate::get_uint32(pTrailer) != inflate::crc32(pOut, s.nOutIndex)) || (inflate::get_uint32(&pTrailer[4]) != s.nOutIndex)) {
+		DEBUG_PUTS("CRC32 or ISIZE mismatch");
+		DEBUG_EXIT
+		return 0;
+	}
+
+	DEBUG_EXIT
+	return s.nOutIndex;
+}
+}  // namespace http
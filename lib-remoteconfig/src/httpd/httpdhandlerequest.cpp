@@ -62,6 +62,10 @@
 # endif
 #endif
 
+#if defined (NODE_E131) || defined (NODE_E131_MULTI)
+# define HAVE_E131
+#endif
+
 #if defined (NODE_SHOWFILE)
 # define ENABLE_METHOD_DELETE
 #endif
@@ -69,8 +73,9 @@
 #include "debug.h"
 
 #if defined ENABLE_CONTENT
+# include "httpd/gunzip.h"
 //uint32_t get_file_content(const char *fileName, char *pDst, http::contentTypes& contentType);
-const char *get_file_content(const char *fileName, uint32_t& nSize, http::contentTypes& contentType);
+const char *get_file_content(const char *fileName, uint32_t& nSize, http::contentTypes& contentType, const char *& pETag, bool& isGzip);
 #endif
 
 char HttpDeamonHandleRequest::m_DynamicContent[http::BUFSIZE];
@@ -87,6 +92,7 @@ void HttpDeamonHandleRequest::HandleRequest(const uint32_t nBytesReceived, char
 
 	m_nBytesReceived = nBytesReceived;
 	m_RequestHeaderResponse = pRequestHeaderResponse;
+	m_nPendingLength = 0;
 
 	const char *pStatusMsg = "OK";
 
@@ -133,7 +139,10 @@ void HttpDeamonHandleRequest::HandleRequest(const uint32_t nBytesReceived, char
 	}
 #endif
 
-	if (m_Status != http::Status::OK) {
+	if (m_Status == http::Status::NOT_MODIFIED) {
+		pStatusMsg = "Not Modified";
+		m_nContentSize = 0;
+	} else if (m_Status != http::Status::OK) {
 		switch (m_Status) {
 		case http::Status::BAD_REQUEST:
 			pStatusMsg = "Bad Request";
@@ -141,6 +150,9 @@ void HttpDeamonHandleRequest::HandleRequest(const uint32_t nBytesReceived, char
 		case http::Status::NOT_FOUND:
 			pStatusMsg = "Not Found";
 			break;
+		case http::Status::NOT_ACCEPTABLE:
+			pStatusMsg = "Not Acceptable";
+			break;
 		case http::Status::REQUEST_ENTITY_TOO_LARGE:
 			pStatusMsg = "Request Entity Too Large";
 			break;
@@ -163,6 +175,8 @@ void HttpDeamonHandleRequest::HandleRequest(const uint32_t nBytesReceived, char
 
 		m_ContentType = http::contentTypes::TEXT_HTML;
 		m_pContent = m_DynamicContent;
+		m_pETag = nullptr;
+		m_IsGzip = false;
 		m_nContentSize = static_cast<uint32_t>(snprintf(m_DynamicContent, http::BUFSIZE - 1U,
 				"<!DOCTYPE html>\n"
 				"<html>\n"
@@ -171,16 +185,56 @@ void HttpDeamonHandleRequest::HandleRequest(const uint32_t nBytesReceived, char
 				"</html>\n", static_cast<unsigned int>(m_Status), pStatusMsg, pStatusMsg));
 	}
 
-	const auto nHeaderLength = snprintf(m_RequestHeaderResponse, http::BUFSIZE - 1U,
+	auto nHeaderLength = snprintf(m_RequestHeaderResponse, http::BUFSIZE - 1U,
 			"HTTP/1.1 %u %s\r\n"
-			"Server: %s\r\n"
-			"Content-Type: %s\r\n"
-			"Content-Length: %u\r\n"
+			"Server: %s\r\n", static_cast<unsigned int>(m_Status), pStatusMsg, Network::Get()->GetHostName());
+
+	if (m_Status != http::Status::NOT_MODIFIED) {
+		nHeaderLength += snprintf(&m_RequestHeaderResponse[nHeaderLength], http::BUFSIZE - 1U - static_cast<uint32_t>(nHeaderLength),
+				"Content-Type: %s\r\n"
+				"Content-Length: %u\r\n", s_contentType[static_cast<uint32_t>(m_ContentType)], static_cast<unsigned int>(m_nContentSize));
+
+		/*
+		 * m_IsGzip: the content is stored gzip compressed, it is decompressed for a client not accepting gzip
+		 */
+		if (m_IsGzip) {
+			if (m_IsAcceptGzip) {
+				nHeaderLength += snprintf(&m_RequestHeaderResponse[nHeaderLength], http::BUFSIZE - 1U - static_cast<uint32_t>(nHeaderLength),
+						"Content-Encoding: gzip\r\n");
+			}
+
+			nHeaderLength += snprintf(&m_RequestHeaderResponse[nHeaderLength], http::BUFSIZE - 1U - static_cast<uint32_t>(nHeaderLength),
+					"Vary: Accept-Encoding\r\n");
+		}
+	}
+
+	/*
+	 * The browser must revalidate, the ETag changes with every firmware containing different content
+	 */
+	if (m_pETag != nullptr) {
+		nHeaderLength += snprintf(&m_RequestHeaderResponse[nHeaderLength], http::BUFSIZE - 1U - static_cast<uint32_t>(nHeaderLength),
+				"ETag: %s\r\n"
+				"Cache-Control: no-cache\r\n", m_pETag);
+	}
+
+	nHeaderLength += snprintf(&m_RequestHeaderResponse[nHeaderLength], http::BUFSIZE - 1U - static_cast<uint32_t>(nHeaderLength),
 			"Connection: close\r\n"
-			"\r\n", static_cast<unsigned int>(m_Status), pStatusMsg, Network::Get()->GetHostName(), s_contentType[static_cast<uint32_t>(m_ContentType)], static_cast<unsigned int>(m_nContentSize));
+			"\r\n");
+
+	/*
+	 * The header is in the receive buffer, when it is not queued completely the request fails.
+	 * The content is queued as far as it fits, the rest is sent from Run().
+	 */
+	const auto nHeaderQueued = Network::Get()->TcpWrite(m_nHandle, reinterpret_cast<uint8_t *>(m_RequestHeaderResponse), static_cast<uint32_t>(nHeaderLength), m_nConnectionHandle);
+
+	if (nHeaderQueued == static_cast<uint32_t>(nHeaderLength)) {
+		m_pPending = m_pContent;
+		m_nPendingLength = m_nContentSize;
+		Run();
+	} else {
+		DEBUG_PUTS("Header is not queued");
+	}
 
-	Network::Get()->TcpWrite(m_nHandle, reinterpret_cast<uint8_t *>(m_RequestHeaderResponse), nHeaderLength, m_nConnectionHandle);
-	Network::Get()->TcpWrite(m_nHandle, reinterpret_cast<const uint8_t *>(m_pContent), m_nContentSize, m_nConnectionHandle);
 	DEBUG_PRINTF("m_nContentLength=%u", m_nContentSize);
 
 	m_Status = http::Status::UNKNOWN_ERROR;
@@ -189,6 +243,19 @@ void HttpDeamonHandleRequest::HandleRequest(const uint32_t nBytesReceived, char
 	DEBUG_EXIT
 }
 
+void HttpDeamonHandleRequest::SendPending() {
+	if (!Network::Get()->TcpIsConnected(m_nHandle, m_nConnectionHandle)) {
+		DEBUG_PUTS("Connection is closed");
+		m_nPendingLength = 0;
+		return;
+	}
+
+	const auto nQueued = Network::Get()->TcpWrite(m_nHandle, reinterpret_cast<const uint8_t *>(m_pPending), m_nPendingLength, m_nConnectionHandle);
+
+	m_pPending += nQueued;
+	m_nPendingLength -= nQueued;
+}
+
 http::Status HttpDeamonHandleRequest::ParseRequest() {
 	char *pLine = m_RequestHeaderResponse;
 	uint32_t nLine = 0;
@@ -196,6 +263,10 @@ http::Status HttpDeamonHandleRequest::ParseRequest() {
 	m_ContentType = http::contentTypes::NOT_DEFINED;
 	m_nRequestContentSize = 0;
 	m_nFileDataLength = 0;
+	m_pETag = nullptr;
+	m_pIfNoneMatch = nullptr;
+	m_IsGzip = false;
+	m_IsAcceptGzip = true;	// RFC 9110 12.5.3, no Accept-Encoding: any content coding is acceptable
 
 	for (uint32_t i = 0; i < m_nBytesReceived; i++) {
 		if (m_RequestHeaderResponse[i] == '\n') {
@@ -276,8 +347,95 @@ http::Status HttpDeamonHandleRequest::ParseMethod(char *pLine) {
 	return http::Status::OK;
 }
 
+static const char *skip_whitespace(const char *p) {
+	while ((*p == ' ') || (*p == '\t')) {
+		p++;
+	}
+	return p;
+}
+
+/**
+ * RFC 9110 12.5.3 Accept-Encoding
+ * gzip is acceptable when "gzip" (or "x-gzip") is listed with a qvalue > 0,
+ * or, when gzip is not listed, "*" is listed with a qvalue > 0.
+ * An empty field value is handled as an absent field, see ParseHeaderField.
+ */
+static bool is_gzip_acceptable(const char *pEncoding) {
+	enum class Listed { NO, ZERO, YES };
+	auto gzip = Listed::NO;
+	auto any = Listed::NO;
+
+	auto *p = pEncoding;
+
+	while (*p != '\0') {
+		p = skip_whitespace(p);
+
+		if (*p == ',') {
+			p++;
+			continue;
+		}
+
+		const auto *pCoding = p;
+
+		while ((*p != '\0') && (*p != ',') && (*p != ';') && (*p != ' ') && (*p != '\t')) {
+			p++;
+		}
+
+		const auto nCodingLength = static_cast<uint32_t>(p - pCoding);
+		auto isZero = false;
+
+		// Parameters, only the weight is used
+		while ((*p != '\0') && (*p != ',')) {
+			p = skip_whitespace(p);
+
+			if (*p != ';') {
+				if ((*p != '\0') && (*p != ',')) {
+					p++;
+				}
+				continue;
+			}
+
+			p = skip_whitespace(p + 1);
+
+			if (((p[0] == 'q') || (p[0] == 'Q')) && (p[1] == '=')) {
+				p += 2;
+				// qvalue = ( "0" [ "." 0*3DIGIT ] ) / ( "1" [ "." 0*3("0") ] )
+				isZero = (*p == '0');
+
+				if (isZero) {
+					p++;
+
+					if (*p == '.') {
+						p++;
+
+						while ((*p >= '0') && (*p <= '9')) {
+							if (*p++ != '0') {
+								isZero = false;
+							}
+						}
+					}
+				}
+			}
+		}
+
+		const auto listed = isZero ? Listed::ZERO : Listed::YES;
+
+		if (((nCodingLength == 4) && (strncasecmp(pCoding, "gzip", 4) == 0)) || ((nCodingLength == 6) && (strncasecmp(pCoding, "x-gzip", 6) == 0))) {
+			gzip = listed;
+		} else if ((nCodingLength == 1) && (pCoding[0] == '*')) {
+			any = listed;
+		}
+	}
+
+	if (gzip != Listed::NO) {
+		return gzip == Listed::YES;
+	}
+
+	return any == Listed::YES;
+}
+
 /**
- * Only interested in "Content-Type" and "Content-Length"
+ * Only interested in "Content-Type", "Content-Length", "If-None-Match" and "Accept-Encoding"
  * Where we check for "Content-Type: application/json" and "Content-Type: application/octet-stream"
  */
 
@@ -324,6 +482,15 @@ http::Status HttpDeamonHandleRequest::ParseHeaderField(char *pLine) {
 		}
 
 		m_nRequestContentSize = nTmp;
+	} else if (strcasecmp(pToken, "If-None-Match") == 0) {
+		m_pIfNoneMatch = strtok(nullptr, "");
+	} else if (strcasecmp(pToken, "Accept-Encoding") == 0) {
+		/*
+		 * An empty field value is handled as an absent field: gzip is acceptable.
+		 * A client excluding gzip gets the static content decompressed, never 406.
+		 */
+		const auto *pEncoding = strtok(nullptr, "");
+		m_IsAcceptGzip = (pEncoding == nullptr) || (*skip_whitespace(pEncoding) == '\0') || is_gzip_acceptable(pEncoding);
 	}
 
 	DEBUG_EXIT
@@ -390,22 +557,45 @@ http::Status HttpDeamonHandleRequest::HandleGet() {
 #if defined (HAVE_DMX)
 			if (memcmp(pGet, "dmx/", 4) == 0) {
 				const auto *pDmx = &pGet[4];
-				const bool isQuestionMark = (pDmx[6] == '?'); // Handle /dmx/status?X
-				if (isQuestionMark) {
-					auto *p = const_cast<char *>(pDmx);
-					p[6] = '\0';
+				auto *pQuestionMark = const_cast<char *>(strchr(pDmx, '?')); // Handle /dmx/status?X and /dmx/analyzer?X
+				if (pQuestionMark != nullptr) {
+					*pQuestionMark++ = '\0';
 				}
 				DEBUG_PRINTF("pDmx=[%s]", pDmx);
 				switch (http::get_uint(pDmx)) {
 				case http::json::get::PORTSTATUS:
 					nLength = remoteconfig::dmx::json_get_ports(m_DynamicContent, sizeof(m_DynamicContent));
 					break;
-				case http::json::get::STATUS: {
-					const auto *pStatus = &pDmx[7];
-					if (isQuestionMark && isalpha(static_cast<int>(pStatus[0])))  {
-						nLength = remoteconfig::dmx::json_get_portstatus(pStatus[0], m_DynamicContent, sizeof(m_DynamicContent));
+				case http::json::get::STATUS:
+					if ((pQuestionMark != nullptr) && isalpha(static_cast<int>(pQuestionMark[0])))  {
+						nLength = remoteconfig::dmx::json_get_portstatus(pQuestionMark[0], m_DynamicContent, sizeof(m_DynamicContent));
+					}
+					break;
+#if defined (CONFIG_DMX_RX_ANALYZER)
+				case http::json::get::ANALYZER:
+					if ((pQuestionMark != nullptr) && isalpha(static_cast<int>(pQuestionMark[0])))  {
+						nLength = remoteconfig::dmx::json_get_analyzer(pQuestionMark[0], m_DynamicContent, sizeof(m_DynamicContent));
 					}
+					break;
+#endif
+				default:
+					break;
+				}
+			} else
+#endif
+#if defined (HAVE_E131)
+			if (memcmp(pGet, "sacn/", 5) == 0) {
+				const auto *pSacn = &pGet[5];
+				auto *pQuestionMark = const_cast<char *>(strchr(pSacn, '?')); // Handle /sacn/status?X
+				if (pQuestionMark != nullptr) {
+					*pQuestionMark++ = '\0';
 				}
+				switch (http::get_uint(pSacn)) {
+				case http::json::get::STATUS:
+					if ((pQuestionMark != nullptr) && isalpha(static_cast<int>(pQuestionMark[0])))  {
+						nLength = remoteconfig::e131::json_get_portstatus(pQuestionMark[0], m_DynamicContent, sizeof(m_DynamicContent));
+					}
+					break;
 				default:
 					break;
 				}
@@ -504,40 +694,40 @@ http::Status HttpDeamonHandleRequest::HandleGet() {
 	}
 #if defined (ENABLE_CONTENT)
 	else if (strcmp(m_pUri, "/") == 0) {
-		m_pContent = get_file_content("index.html", nLength, m_ContentType);
+		m_pContent = get_file_content("index.html", nLength, m_ContentType, m_pETag, m_IsGzip);
 	}
 #if defined (HAVE_DMX)
 	else if (strcmp(m_pUri, "/dmx") == 0) {
-		m_pContent = get_file_content("dmx.html", nLength, m_ContentType);
+		m_pContent = get_file_content("dmx.html", nLength, m_ContentType, m_pETag, m_IsGzip);
 	}
 #endif
 #if defined (RDM_CONTROLLER) && !defined (CONFIG_HTTP_HTML_NO_RDM)
 	else if (strcmp(m_pUri, "/rdm") == 0) {
-		m_pContent = get_file_content("rdm.html", nLength, m_ContentType);
+		m_pContent = get_file_content("rdm.html", nLength, m_ContentType, m_pETag, m_IsGzip);
 	}
 #endif
 #if defined (NODE_SHOWFILE)
 	else if (strcmp(m_pUri, "/showfile") == 0) {
-		m_pContent = get_file_content("showfile.html", nLength, m_ContentType);
+		m_pContent = get_file_content("showfile.html", nLength, m_ContentType, m_pETag, m_IsGzip);
 	}
 #endif
 #if defined (ENABLE_PHY_SWITCH)
 	else if (strcmp(m_pUri, "/dsa") == 0) {
-		m_pContent = get_file_content("dsa.html", nLength, m_ContentType);
+		m_pContent = get_file_content("dsa.html", nLength, m_ContentType, m_pETag, m_IsGzip);
 	}
 #endif
 #if !defined (CONFIG_HTTP_HTML_NO_TIME)
 	else if (strcmp(m_pUri, "/time") == 0) {
-		m_pContent = get_file_content("time.html", nLength, m_ContentType);
+		m_pContent = get_file_content("time.html", nLength, m_ContentType, m_pETag, m_IsGzip);
 	}
 #endif
 #if !defined (CONFIG_HTTP_HTML_NO_RTC) && !defined (DISABLE_RTC)
 	else if (strcmp(m_pUri, "/rtc") == 0) {
-		m_pContent = get_file_content("rtc.html", nLength, m_ContentType);
+		m_pContent = get_file_content("rtc.html", nLength, m_ContentType, m_pETag, m_IsGzip);
 	}
 #endif
 	else {
-		m_pContent = get_file_content(&m_pUri[1], nLength, m_ContentType);
+		m_pContent = get_file_content(&m_pUri[1], nLength, m_ContentType, m_pETag, m_IsGzip);
 	}
 #endif
 
@@ -548,6 +738,29 @@ http::Status HttpDeamonHandleRequest::HandleGet() {
 
 	m_nContentSize = nLength;
 
+#if defined (ENABLE_CONTENT)
+	/*
+	 * The client has excluded gzip (gzip;q=0 or identity only): the identity representation
+	 * is decompressed into the dynamic content buffer. The generator only stores gzip when
+	 * the uncompressed content fits in http::BUFSIZE. The ETag belongs to the gzip representation.
+	 */
+	if (m_IsGzip && !m_IsAcceptGzip) {
+		m_nContentSize = http::gunzip(reinterpret_cast<const uint8_t *>(m_pContent), nLength, reinterpret_cast<uint8_t *>(m_DynamicContent), sizeof(m_DynamicContent));
+		m_pContent = m_DynamicContent;
+		m_pETag = nullptr;
+
+		if (m_nContentSize == 0) {
+			DEBUG_EXIT
+			return http::Status::INTERNAL_SERVER_ERROR;
+		}
+	}
+
+	if ((m_pETag != nullptr) && (m_pIfNoneMatch != nullptr) && (strstr(m_pIfNoneMatch, m_pETag) != nullptr)) {
+		DEBUG_EXIT
+		return http::Status::NOT_MODIFIED;
+	}
+#endif
+
 	DEBUG_EXIT
 	return http::Status::OK;
 }
@@ -79,6 +79,10 @@
 # include "e131params.h"
 #endif
 
+#if defined (CONFIG_DMX_RX_ANALYZER) && !defined (CONFIG_REMOTECONFIG_MINIMUM)
+# include "dmx.h"
+#endif
+
 #if defined (NODE_OSC_CLIENT)
 /* oscclnt.txt */
 # include "oscclientparams.h"
@@ -192,6 +196,9 @@ enum class Command {
 	RDM,
 # endif
 	GET,
+# if defined (CONFIG_DMX_RX_ANALYZER)
+	ANALYZER,
+# endif
 #endif
 	TFTP,
 	FACTORY
@@ -203,6 +210,9 @@ enum class Command {
 # if (defined (NODE_ARTNET) || defined (NODE_NODE)) && (defined (RDM_CONTROLLER) || defined (RDM_RESPONDER))
 	RDM,
 # endif
+# if defined (CONFIG_DMX_RX_ANALYZER)
+	ANALYZER,
+# endif
 #endif
 	TFTP,
 	DISPLAY
@@ -222,6 +232,9 @@ constexpr struct RemoteConfig::Commands RemoteConfig::s_GET[] = {
 		{ &RemoteConfig::HandleRdmGet,  	"rdm#",  	 4, false },
 # endif
 		{ &RemoteConfig::HandleGetNoParams, "get#",      4, true },
+# if defined (CONFIG_DMX_RX_ANALYZER)
+		{ &RemoteConfig::HandleAnalyzerGet, "analyzer#", 9, true },
+# endif
 #endif
 		{ &RemoteConfig::HandleTftpGet,     "tftp#",     5, false },
 		{ &RemoteConfig::HandleFactory,     "factory##", 9, false }
@@ -232,6 +245,9 @@ constexpr struct RemoteConfig::Commands RemoteConfig::s_SET[] = {
 # if (defined (NODE_ARTNET) || defined (NODE_NODE)) && (defined (RDM_CONTROLLER) || defined (RDM_RESPONDER))
 		{ &RemoteConfig::HandleRdmSet,  	"rdm#",     4, true },
 # endif
+# if defined (CONFIG_DMX_RX_ANALYZER)
+		{ &RemoteConfig::HandleAnalyzerSet, "analyzer#", 9, true },
+# endif
 #endif
 		{ &RemoteConfig::HandleTftpSet,    "tftp#",     5, true },
 		{ &RemoteConfig::HandleDisplaySet, "display#",  8, true }
@@ -525,6 +541,56 @@ void RemoteConfig::HandleRdmGet() {
 	DEBUG_EXIT
 }
 #endif
+
+#if defined (CONFIG_DMX_RX_ANALYZER)
+/**
+ * ?analyzer#A returns the DMX input line analyzer of port A, !analyzer#A resets it
+ */
+void RemoteConfig::HandleAnalyzerGet() {
+	DEBUG_ENTRY
+
+	constexpr auto nCmdLength = s_GET[static_cast<uint32_t>(remoteconfig::udp::get::Command::ANALYZER)].nLength;
+
+	if (m_nBytesReceived != (nCmdLength + 1U)) {
+		Network::Get()->SendTo(m_nHandle, "ERROR#?analyzer\n", 16, m_nIPAddressFrom, remoteconfig::udp::PORT);
+		DEBUG_EXIT
+		return;
+	}
+
+	const auto cPort = s_pUdpBuffer[nCmdLength + 1U];
+	const auto nLength = remoteconfig::dmx::json_get_analyzer(cPort, s_pUdpBuffer, remoteconfig::udp::BUFFER_SIZE);
+
+	if (nLength == 0) {
+		Network::Get()->SendTo(m_nHandle, "ERROR#?analyzer\n", 16, m_nIPAddressFrom, remoteconfig::udp::PORT);
+		DEBUG_EXIT
+		return;
+	}
+
+	Network::Get()->SendTo(m_nHandle, s_pUdpBuffer, nLength, m_nIPAddressFrom, remoteconfig::udp::PORT);
+
+	DEBUG_EXIT
+}
+
+void RemoteConfig::HandleAnalyzerSet() {
+	DEBUG_ENTRY
+
+	constexpr auto nCmdLength = s_SET[static_cast<uint32_t>(remoteconfig::udp::set::Command::ANALYZER)].nLength;
+
+	if (m_nBytesReceived != (nCmdLength + 1U)) {
+		DEBUG_EXIT
+		return;
+	}
+
+	const auto nPortIndex = static_cast<uint32_t>((s_pUdpBuffer[nCmdLength + 1U] | 0x20) - 'a');
+
+	if (nPortIndex < ::dmx::config::max::PORTS) {
+		Dmx::Get()->ResetRxAnalyzer(nPortIndex);
+	}
+
+	DEBUG_PRINTF("%c", s_pUdpBuffer[nCmdLength + 1U]);
+	DEBUG_EXIT
+}
+#endif
 /**
  * GET
  */
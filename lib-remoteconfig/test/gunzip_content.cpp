@@ -0,0 +1,131 @@
+/**
+ * @file gunzip_content.cpp
+ *
+ * Host test: http::gunzip of every generated static content file against its source,
+ * a stored block with FNAME, and the invalid input cases.
+ */
+/* Copyright (C) 2024 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#include "httpd/gunzip.h"
+
+#include "../http/content/content.h"
+
+static int s_nFailed;
+static uint8_t s_Out[http::BUFSIZE];
+
+static void check(const bool isOk, const char *pName) {
+	if (!isOk) {
+		s_nFailed++;
+	}
+
+	printf("%-4s %s\n", isOk ? "ok" : "FAIL", pName);
+}
+
+/**
+ * The source as stored by generate_content: leading white space removed from every line
+ */
+static std::string read_source(const char *pFileName) {
+	const auto path = std::string("../http/content/") + pFileName;
+	auto *pFile = fopen(path.c_str(), "r");
+	std::string source;
+
+	if (pFile == nullptr) {
+		return source;
+	}
+
+	auto doRemoveWhiteSpaces = true;
+	int c;
+
+	while ((c = fgetc(pFile)) != EOF) {
+		if (doRemoveWhiteSpaces) {
+			if (c <= ' ') {
+				continue;
+			}
+			doRemoveWhiteSpaces = false;
+		} else if (c == '\n') {
+			doRemoveWhiteSpaces = true;
+		}
+
+		source += static_cast<char>(c);
+	}
+
+	fclose(pFile);
+	return source;
+}
+
+int main() {
+	for (const auto& content : HttpContent) {
+		const auto source = read_source(content.pFileName);
+		auto isOk = !source.empty();
+
+		if (content.isGzip) {
+			const auto nLength = http::gunzip(reinterpret_cast<const uint8_t *>(content.pContent), content.nContentLength, s_Out, sizeof(s_Out));
+			isOk = isOk && (source == std::string(reinterpret_cast<const char *>(s_Out), static_cast<size_t>(nLength)));
+		} else {
+			isOk = isOk && (source == std::string(content.pContent, static_cast<size_t>(content.nContentLength)));
+		}
+
+		check(isOk, content.pFileName);
+	}
+
+	// Stored block, FNAME "name"
+	static constexpr char STORED[] =
+		"\x1f\x8b\x08\x08\x00\x00\x00\x00\x00\xff\x6e\x61\x6d\x65\x00\x01"
+		"\x19\x00\xe6\xff\x73\x74\x6f\x72\x65\x64\x20\x62\x6c\x6f\x63\x6b"
+		"\x20\x73\x74\x6f\x72\x65\x64\x20\x62\x6c\x6f\x63\x6b\xe2\x12\x0f"
+		"\x8a\x19\x00\x00\x00";
+	const auto *pStored = reinterpret_cast<const uint8_t *>(STORED);
+	const auto nStoredLength = static_cast<uint32_t>(sizeof(STORED) - 1);
+
+	auto nLength = http::gunzip(pStored, nStoredLength, s_Out, sizeof(s_Out));
+	check((nLength == 25) && (memcmp(s_Out, "stored block stored block", 25) == 0), "stored block");
+
+	check(http::gunzip(pStored, nStoredLength, s_Out, 24) == 0, "output does not fit");
+	check(http::gunzip(pStored, nStoredLength - 1, s_Out, sizeof(s_Out)) == 0, "truncated");
+
+	uint8_t corrupt[sizeof(STORED)];
+	memcpy(corrupt, STORED, sizeof(STORED));
+	corrupt[20] ^= 0x01;
+	check(http::gunzip(corrupt, nStoredLength, s_Out, sizeof(s_Out)) == 0, "CRC32 mismatch");
+
+	memcpy(corrupt, STORED, sizeof(STORED));
+	corrupt[17] ^= 0x01;
+	check(http::gunzip(corrupt, nStoredLength, s_Out, sizeof(s_Out)) == 0, "LEN/NLEN mismatch");
+
+	memcpy(corrupt, STORED, sizeof(STORED));
+	corrupt[15] = 0x07;	// BTYPE 11
+	check(http::gunzip(corrupt, nStoredLength, s_Out, sizeof(s_Out)) == 0, "reserved block type");
+
+	check(http::gunzip(reinterpret_cast<const uint8_t *>("index.html"), 10, s_Out, sizeof(s_Out)) == 0, "not gzip");
+
+	if (s_nFailed != 0) {
+		printf("%d failed\n", s_nFailed);
+		return 1;
+	}
+
+	return 0;
+}
@@ -0,0 +1,121 @@
+/**
+ * @file httpd_accept_encoding.cpp
+ *
+ * Host test: request/response for the static (stored gzip) content,
+ * RFC 9110 12.5.3 Accept-Encoding. A client excluding gzip gets the
+ * identity representation, decompressed by the httpd.
+ */
+/* Copyright (C) 2024 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#include "httpd/httpdhandlerequest.h"
+
+#include "network.h"
+
+#include "content.h"
+
+static int s_nFailed;
+
+enum class Body {
+	NONE, GZIP, IDENTITY
+};
+
+static void test(const char *pName, const char *pHeaders, const unsigned nStatus, const Body body, const char *pUri = "/") {
+	char buffer[http::BUFSIZE];
+	const auto nLength = static_cast<uint32_t>(snprintf(buffer, sizeof(buffer), "GET %s HTTP/1.1\r\nHost: test\r\n%s\r\n", pUri, pHeaders));
+
+	auto *pNetwork = Network::Get();
+	pNetwork->Reset();
+	auto &response = pNetwork->m_Connection[0].response;
+
+	HttpDeamonHandleRequest handleRequest(0, 0);
+	handleRequest.HandleRequest(nLength, buffer);
+
+	char status[32];
+	snprintf(status, sizeof(status), "HTTP/1.1 %u ", nStatus);
+
+	const auto isStatus = (response.compare(0, strlen(status), status) == 0);
+	const auto nHeaderEnd = response.find("\r\n\r\n");
+	const auto header = response.substr(0, nHeaderEnd);
+	const auto content = (nHeaderEnd == std::string::npos) ? std::string() : response.substr(nHeaderEnd + 4);
+	const auto isEncodingGzip = (header.find("Content-Encoding: gzip\r\n") != std::string::npos);
+
+	bool isBody;
+
+	switch (body) {
+	case Body::GZIP:
+		isBody = isEncodingGzip && (content == std::string(content::INDEX_HTML, sizeof(content::INDEX_HTML) - 1));
+		break;
+	case Body::IDENTITY:
+		isBody = !isEncodingGzip && (content == content::INDEX_HTML_IDENTITY)
+				&& (header.find("Vary: Accept-Encoding\r\n") != std::string::npos)
+				&& (header.find("ETag:") == std::string::npos);
+		break;
+	default:
+		isBody = !isEncodingGzip && (content.find(std::string(content::INDEX_HTML, sizeof(content::INDEX_HTML) - 1)) == std::string::npos);
+		break;
+	}
+
+	const auto isOk = isStatus && isBody;
+
+	if (!isOk) {
+		s_nFailed++;
+	}
+
+	printf("%-4s %-32s -> %.*s\n", isOk ? "ok" : "FAIL", pName, static_cast<int>(response.find('\r')), response.c_str());
+}
+
+int main() {
+	test("no Accept-Encoding", "", 200, Body::GZIP);
+	test("gzip", "Accept-Encoding: gzip\r\n", 200, Body::GZIP);
+	test("gzip, deflate, br", "Accept-Encoding: gzip, deflate, br\r\n", 200, Body::GZIP);
+	test("GZIP", "accept-encoding: GZIP\r\n", 200, Body::GZIP);
+	test("x-gzip", "Accept-Encoding: x-gzip\r\n", 200, Body::GZIP);
+	test("deflate, gzip;q=0.5", "Accept-Encoding: deflate, gzip;q=0.5\r\n", 200, Body::GZIP);
+	test("gzip;q=0.001", "Accept-Encoding: gzip;q=0.001\r\n", 200, Body::GZIP);
+	test("gzip ; q=1.0", "Accept-Encoding: gzip ; q=1.0\r\n", 200, Body::GZIP);
+	test("*", "Accept-Encoding: *\r\n", 200, Body::GZIP);
+	test("identity, *;q=0.5", "Accept-Encoding: identity, *;q=0.5\r\n", 200, Body::GZIP);
+	test("empty", "Accept-Encoding:\r\n", 200, Body::GZIP);
+	test("gzip;q=0", "Accept-Encoding: gzip;q=0\r\n", 200, Body::IDENTITY);
+	test("gzip;q=0.000", "Accept-Encoding: gzip;q=0.000\r\n", 200, Body::IDENTITY);
+	test("deflate, gzip;q=0", "Accept-Encoding: deflate, gzip;q=0\r\n", 200, Body::IDENTITY);
+	test("gzip;q=0, *", "Accept-Encoding: gzip;q=0, *\r\n", 200, Body::IDENTITY);
+	test("identity", "Accept-Encoding: identity\r\n", 200, Body::IDENTITY);
+	test("deflate, br", "Accept-Encoding: deflate, br\r\n", 200, Body::IDENTITY);
+	test("*;q=0", "Accept-Encoding: *;q=0\r\n", 200, Body::IDENTITY);
+	test("If-None-Match", "Accept-Encoding: gzip\r\nIf-None-Match: \"1234\"\r\n", 304, Body::NONE);
+	test("If-None-Match, other ETag", "Accept-Encoding: gzip\r\nIf-None-Match: \"5678\"\r\n", 200, Body::GZIP);
+	test("If-None-Match, identity", "Accept-Encoding: identity\r\nIf-None-Match: \"1234\"\r\n", 200, Body::IDENTITY);
+	test("corrupt, identity", "Accept-Encoding: identity\r\n", 500, Body::NONE, "/corrupt.html");
+
+	if (s_nFailed != 0) {
+		printf("%d failed\n", s_nFailed);
+		return 1;
+	}
+
+	return 0;
+}
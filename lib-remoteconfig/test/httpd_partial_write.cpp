@@ -0,0 +1,156 @@
+/**
+ * @file httpd_partial_write.cpp
+ *
+ * Host test: responses larger than the TCP send queue are completed from HttpDaemon::Run()
+ */
+/* Copyright (C) 2024 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#include "httpd/httpd.h"
+
+#include "network.h"
+
+#include "content.h"
+
+static int s_nFailed;
+
+static void check(const bool isOk, const char *pName) {
+	printf("%-4s %s\n", isOk ? "ok" : "FAIL", pName);
+
+	if (!isOk) {
+		s_nFailed++;
+	}
+}
+
+static std::string get_body(const std::string& response) {
+	const auto nOffset = response.find("\r\n\r\n");
+	return (nOffset == std::string::npos) ? std::string() : response.substr(nOffset + 4);
+}
+
+static uint32_t get_content_length(const std::string& response) {
+	const auto nOffset = response.find("Content-Length: ");
+	return (nOffset == std::string::npos) ? 0 : static_cast<uint32_t>(strtoul(&response[nOffset + 16], nullptr, 10));
+}
+
+/**
+ * Runs the daemon and acknowledges the connection until nothing more is queued
+ */
+static uint32_t run(HttpDaemon& httpDaemon, const uint32_t nConnection) {
+	auto& connection = Network::Get()->m_Connection[nConnection];
+	uint32_t nRuns = 0;
+	size_t nSize;
+
+	do {
+		nSize = connection.response.size();
+		Network::Get()->Acknowledge(nConnection);
+		httpDaemon.Run();
+		nRuns++;
+	} while (connection.response.size() != nSize);
+
+	return nRuns;
+}
+
+static void test_static(HttpDaemon& httpDaemon) {
+	auto *pNetwork = Network::Get();
+	pNetwork->Reset();
+
+	pNetwork->Request(1, "GET /large.js HTTP/1.1\r\nAccept-Encoding: gzip\r\n\r\n");
+	httpDaemon.Run();
+
+	const auto& response = pNetwork->m_Connection[1].response;
+
+	check(response.size() == Network::TX_QUEUE_SIZE, "static: first Run() fills the send queue");
+
+	const auto nRuns = run(httpDaemon, 1);
+	const auto body = get_body(response);
+
+	check(nRuns > 2, "static: the rest is sent from the next Run()");
+	check(get_content_length(response) == content::LARGE_JS_SIZE, "static: Content-Length");
+	check((body.size() == content::LARGE_JS_SIZE) && (memcmp(body.data(), content::LARGE_JS, content::LARGE_JS_SIZE) == 0), "static: complete content");
+}
+
+static void test_closed(HttpDaemon& httpDaemon) {
+	auto *pNetwork = Network::Get();
+	pNetwork->Reset();
+
+	pNetwork->Request(2, "GET /large.js HTTP/1.1\r\nAccept-Encoding: gzip\r\n\r\n");
+	httpDaemon.Run();
+
+	auto& connection = pNetwork->m_Connection[2];
+	connection.isConnected = false;
+	httpDaemon.Run();
+
+	// A new connection with the same handle does not get the rest
+	connection.isConnected = true;
+	pNetwork->Acknowledge(2);
+	httpDaemon.Run();
+
+	check(connection.response.size() == Network::TX_QUEUE_SIZE, "closed: the rest is dropped");
+}
+
+static void test_dynamic(HttpDaemon& httpDaemon) {
+	auto *pNetwork = Network::Get();
+	pNetwork->Reset();
+
+	// The send queue holds a previous response, only 600 bytes are free
+	pNetwork->m_Connection[3].nQueued = Network::TX_QUEUE_SIZE - 600;
+
+	pNetwork->Request(3, "GET /json/version HTTP/1.1\r\n\r\n");
+	httpDaemon.Run();
+
+	check(pNetwork->m_Connection[3].response.size() == 600, "dynamic: first Run() fills the send queue");
+
+	pNetwork->Request(4, "GET / HTTP/1.1\r\n\r\n");
+	httpDaemon.Run();
+
+	check(pNetwork->IsRequestPending(), "dynamic: a new request waits while the dynamic content is pending");
+
+	run(httpDaemon, 3);
+
+	const auto& response = pNetwork->m_Connection[3].response;
+	const auto body = get_body(response);
+
+	check((get_content_length(response) == content::VERSION_JSON_SIZE) && (body == std::string(content::VERSION_JSON_SIZE, 'v')), "dynamic: complete content");
+
+	httpDaemon.Run();
+
+	check(!pNetwork->IsRequestPending() && (pNetwork->m_Connection[4].response.compare(0, 15, "HTTP/1.1 200 OK") == 0), "dynamic: the waiting request is handled");
+}
+
+int main() {
+	HttpDaemon httpDaemon;
+
+	test_static(httpDaemon);
+	test_closed(httpDaemon);
+	test_dynamic(httpDaemon);
+
+	if (s_nFailed != 0) {
+		printf("%d failed\n", s_nFailed);
+		return 1;
+	}
+
+	return 0;
+}
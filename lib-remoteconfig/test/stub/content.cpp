@@ -0,0 +1,87 @@
+/**
+ * @file content.cpp
+ *
+ * Host stub, the link dependencies of httpdhandlerequest.cpp
+ */
+
+#include <cstdint>
+#include <cstring>
+
+#include "httpd/http.h"
+
+#include "remoteconfig.h"
+#include "remoteconfigjson.h"
+#include "properties.h"
+#include "propertiesconfig.h"
+#include "sscan.h"
+
+#include "content.h"
+
+namespace content {
+char LARGE_JS[LARGE_JS_SIZE];
+char CORRUPT_HTML[sizeof(INDEX_HTML)];
+}  // namespace content
+
+const char *get_file_content(const char *pFileName, uint32_t& nSize, http::contentTypes& contentType, const char *& pETag, bool& isGzip) {
+	if (strcmp(pFileName, "index.html") == 0) {
+		nSize = sizeof(content::INDEX_HTML) - 1;
+		contentType = http::contentTypes::TEXT_HTML;
+		pETag = content::ETAG;
+		isGzip = true;
+		return content::INDEX_HTML;
+	}
+
+	if (strcmp(pFileName, "corrupt.html") == 0) {
+		memcpy(content::CORRUPT_HTML, content::INDEX_HTML, sizeof(content::INDEX_HTML));
+		content::CORRUPT_HTML[sizeof(content::INDEX_HTML) - 9] ^= 0x01;
+
+		nSize = sizeof(content::CORRUPT_HTML) - 1;
+		contentType = http::contentTypes::TEXT_HTML;
+		pETag = content::ETAG;
+		isGzip = true;
+		return content::CORRUPT_HTML;
+	}
+
+	if (strcmp(pFileName, "large.js") == 0) {
+		for (uint32_t i = 0; i < content::LARGE_JS_SIZE; i++) {
+			content::LARGE_JS[i] = static_cast<char>('a' + (i % 26));
+		}
+
+		nSize = content::LARGE_JS_SIZE;
+		contentType = http::contentTypes::TEXT_JS;
+		pETag = content::ETAG;
+		isGzip = false;	// Larger than http::BUFSIZE, the generator stores it uncompressed
+		return content::LARGE_JS;
+	}
+
+	nSize = 0;
+	return nullptr;
+}
+
+RemoteConfig *RemoteConfig::s_pThis;
+uint32_t RemoteConfig::HandleGet(void *, uint32_t) { return 0; }
+void RemoteConfig::HandleSet(void *, uint32_t) {}
+void RemoteConfig::HandleReboot() {}
+uint8_t PropertiesConfig::s_Config;
+Sscan::ReturnCode Sscan::Uint8(const char *, const char *, uint8_t&) { return Sscan::NAME_ERROR; }
+
+namespace properties {
+int convert_json_file(char *, uint32_t, const bool) { return 0; }
+}  // namespace properties
+
+namespace remoteconfig {
+uint32_t json_get_version(char *pOutBuffer, const uint32_t nOutBufferSize) {
+	const auto nLength = (content::VERSION_JSON_SIZE < nOutBufferSize) ? content::VERSION_JSON_SIZE : nOutBufferSize;
+	memset(pOutBuffer, 'v', nLength);
+	return nLength;
+}
+
+uint32_t json_get_list(char *, const uint32_t) { return 0; }
+uint32_t json_get_uptime(char *, const uint32_t) { return 0; }
+uint32_t json_get_display(char *, const uint32_t) { return 0; }
+uint32_t json_get_directory(char *, const uint32_t) { return 0; }
+namespace timedate {
+uint32_t json_get_timeofday(char *, const uint32_t) { return 0; }
+void json_set_timeofday(const char *, const uint32_t) {}
+}  // namespace timedate
+}  // namespace remoteconfig
@@ -0,0 +1,38 @@
+/**
+ * @file content.h
+ *
+ * Host stub, the static and dynamic content served by the tests
+ */
+
+#ifndef STUB_CONTENT_H_
+#define STUB_CONTENT_H_
+
+#include <cstdint>
+
+namespace content {
+/**
+ * gzip -n of INDEX_HTML_IDENTITY
+ */
+static constexpr char INDEX_HTML[] =
+	"\x1f\x8b\x08\x00\x00\x00\x00\x00\x02\xff\xb3\x51\x74\xf1\x77\x0e"
+	"\x89\x0c\x70\x55\xc8\x28\xc9\xcd\xb1\xe3\xb2\x81\x51\xa9\x89\x29"
+	"\x76\x36\x25\x99\x25\x39\xa9\x76\x99\x79\x29\xa9\x15\x7a\x20\x09"
+	"\x1b\x7d\x88\x88\x8d\x3e\x58\x9e\xcb\x26\x29\x3f\xa5\xd2\xce\x26"
+	"\xc3\x10\x45\x0d\x90\x6b\x53\x80\x24\xa2\x80\x95\x69\xa3\x5f\x00"
+	"\x34\x07\x6c\x00\x17\x50\x0f\xd8\x5a\x00\x7c\x97\x35\xda\x8e\x00"
+	"\x00\x00";
+static constexpr char INDEX_HTML_IDENTITY[] =
+	"<!DOCTYPE html>\n"
+	"<html>\n"
+	"<head><title>index.html</title></head>\n"
+	"<body><h1>index.html</h1><p>index.html index.html index.html</p></body>\n"
+	"</html>\n";
+static constexpr char ETAG[] = "\"1234\"";
+static constexpr uint32_t LARGE_JS_SIZE = 6000;		///< larger than the send queue
+static constexpr uint32_t VERSION_JSON_SIZE = 1400;	///< fits in the dynamic content buffer
+
+extern char LARGE_JS[LARGE_JS_SIZE];
+extern char CORRUPT_HTML[sizeof(INDEX_HTML)];	///< INDEX_HTML with a CRC32 mismatch
+}  // namespace content
+
+#endif /* STUB_CONTENT_H_ */
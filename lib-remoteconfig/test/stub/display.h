@@ -0,0 +1,20 @@
+/**
+ * @file display.h
+ *
+ * Host stub
+ */
+
+#ifndef DISPLAY_H_
+#define DISPLAY_H_
+
+class Display {
+public:
+	void SetSleep(const bool) {}
+
+	static Display *Get() {
+		static Display s_Display;
+		return &s_Display;
+	}
+};
+
+#endif /* DISPLAY_H_ */
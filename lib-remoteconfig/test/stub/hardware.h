@@ -0,0 +1,30 @@
+/**
+ * @file hardware.h
+ *
+ * Host stub
+ */
+
+#ifndef HARDWARE_H_
+#define HARDWARE_H_
+
+#include <cstdint>
+
+namespace hardware {
+namespace ledblink {
+enum class Mode {
+	OFF_OFF, OFF_ON, NORMAL, DATA, FAST, REBOOT, UNKNOWN
+};
+}  // namespace ledblink
+}  // namespace hardware
+
+class Hardware {
+public:
+	void SetMode(const hardware::ledblink::Mode) {}
+
+	static Hardware *Get() {
+		static Hardware s_Hardware;
+		return &s_Hardware;
+	}
+};
+
+#endif /* HARDWARE_H_ */
@@ -0,0 +1,34 @@
+/**
+ * @file mdns.h
+ *
+ * Host stub
+ */
+
+#ifndef NET_APPS_MDNS_H_
+#define NET_APPS_MDNS_H_
+
+#include <cstdint>
+
+namespace mdns {
+enum class Services {
+	CONFIG, TFTP, HTTP, RDMNET_LLRP, NTP, MIDI, OSC, DDP, PP, LAST_NOT_USED
+};
+}  // namespace mdns
+
+class MDNS {
+public:
+	bool ServiceRecordAdd(const char *, const mdns::Services, const char * = nullptr, const uint16_t = 0) {
+		return true;
+	}
+
+	bool ServiceRecordDelete(const mdns::Services) {
+		return true;
+	}
+
+	static MDNS *Get() {
+		static MDNS s_MDNS;
+		return &s_MDNS;
+	}
+};
+
+#endif /* NET_APPS_MDNS_H_ */
@@ -0,0 +1,125 @@
+/**
+ * @file network.h
+ *
+ * Host stub, one TCP listen port.
+ * TcpWrite queues into a send queue of TX_QUEUE_SIZE bytes per connection,
+ * what is queued is appended to the response of the connection.
+ */
+
+#ifndef NETWORK_H_
+#define NETWORK_H_
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+namespace network {
+static constexpr uint32_t MAC_SIZE = 6;
+}  // namespace network
+
+class Network {
+public:
+	static constexpr uint32_t CONNECTIONS = 16;
+	static constexpr uint32_t TX_QUEUE_SIZE = 2048;
+
+	struct Connection {
+		std::string response;
+		uint32_t nQueued;
+		bool isConnected;
+	};
+
+	uint32_t RecvFrom(const int32_t, const void **, uint32_t *, uint16_t *) {
+		return 0;
+	}
+
+	const char *GetHostName() const {
+		return "test";
+	}
+
+	int32_t TcpBegin(const uint16_t) {
+		return 0;
+	}
+
+	int32_t TcpEnd(const int32_t) {
+		return 0;
+	}
+
+	/**
+	 * Returns the request set with Request() once
+	 */
+	uint16_t TcpRead(const int32_t, const uint8_t **ppBuffer, uint32_t& nHandleConnection) {
+		if (m_nRequestLength == 0) {
+			return 0;
+		}
+
+		const auto nLength = m_nRequestLength;
+		m_nRequestLength = 0;
+
+		*ppBuffer = reinterpret_cast<const uint8_t *>(m_Request);
+		nHandleConnection = m_nRequestConnection;
+
+		return nLength;
+	}
+
+	uint32_t TcpWrite(const int32_t, const uint8_t *pBuffer, uint32_t nLength, const uint32_t nHandleConnection) {
+		auto& connection = m_Connection[nHandleConnection];
+
+		if (!connection.isConnected) {
+			return 0;
+		}
+
+		if (nLength > (TX_QUEUE_SIZE - connection.nQueued)) {
+			nLength = TX_QUEUE_SIZE - connection.nQueued;
+		}
+
+		connection.response.append(reinterpret_cast<const char *>(pBuffer), nLength);
+		connection.nQueued += nLength;
+
+		return nLength;
+	}
+
+	bool TcpIsConnected(const int32_t, const uint32_t nHandleConnection) const {
+		return m_Connection[nHandleConnection].isConnected;
+	}
+
+	void Request(const uint32_t nHandleConnection, const char *pRequest) {
+		const auto nLength = static_cast<uint16_t>(strlen(pRequest));
+		memcpy(m_Request, pRequest, nLength);
+		m_nRequestLength = nLength;
+		m_nRequestConnection = nHandleConnection;
+	}
+
+	bool IsRequestPending() const {
+		return m_nRequestLength != 0;
+	}
+
+	/**
+	 * The peer has acknowledged everything
+	 */
+	void Acknowledge(const uint32_t nHandleConnection) {
+		m_Connection[nHandleConnection].nQueued = 0;
+	}
+
+	void Reset() {
+		for (auto& connection : m_Connection) {
+			connection.response.clear();
+			connection.nQueued = 0;
+			connection.isConnected = true;
+		}
+		m_nRequestLength = 0;
+	}
+
+	Connection m_Connection[CONNECTIONS];
+
+	static Network *Get() {
+		static Network s_Network;
+		return &s_Network;
+	}
+
+private:
+	char m_Request[1440];
+	uint16_t m_nRequestLength { 0 };
+	uint32_t m_nRequestConnection { 0 };
+};
+
+#endif /* NETWORK_H_ */
@@ -0,0 +1,122 @@
+/**
+ * @file showfilebinary.h
+ *
+ */
+/* Copyright (C) 2024 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef FORMATS_SHOWFILEBINARY_H_
+#define FORMATS_SHOWFILEBINARY_H_
+
+#include <cstdint>
+
+/**
+ * Binary show file, little endian.
+ *
+ * [Header][Record]...[Record INDEX]
+ *
+ * A FRAME or KEYFRAME record holds the time since the start of the show,
+ * it is followed by the KEY and DELTA records of the universes in that frame.
+ * A KEYFRAME is followed by a KEY record for every universe, so playback can start there.
+ * The INDEX record at the end has an IndexEntry for each KEYFRAME, sorted by time.
+ * A LOST record is skipped by the player.
+ */
+
+namespace showfile {
+namespace binary {
+static constexpr char MAGIC[4] = { 'S', 'H', 'W', 'B' };
+static constexpr uint8_t VERSION = 1;
+static constexpr uint32_t SLOTS_MAX = 512;
+static constexpr uint32_t KEYFRAME_INTERVAL_MILLIS = 1000;
+
+enum class Type : uint8_t {
+	FRAME,		///< nValue is milliseconds since the start of the show
+	KEYFRAME,	///< nValue is milliseconds since the start of the show
+	KEY,		///< nValue is universe | (slots << 16), payload is all the slots
+	DELTA,		///< nValue is universe | (slots << 16), payload is Run's with the changed slots
+	INDEX,		///< nValue is the number of IndexEntry's in the payload
+	LOST		///< nValue is the number of frames lost while recording
+};
+
+struct Header {
+	char aMagic[4];
+	uint8_t nVersion;
+	uint8_t nReserved;
+	uint16_t nKeyframeIntervalMillis;
+	uint32_t nIndexOffset;		///< 0 when the recording was not closed
+	uint32_t nIndexEntries;
+} __attribute__((packed));
+
+struct Record {
+	uint8_t nType;
+	uint8_t nReserved;
+	uint16_t nLength;			///< Payload bytes following the record
+	uint32_t nValue;
+} __attribute__((packed));
+
+/**
+ * DELTA payload: nOffset (uint16_t), nCount (uint16_t), nCount slots, repeated.
+ */
+struct Run {
+	uint16_t nOffset;
+	uint16_t nCount;
+} __attribute__((packed));
+
+struct IndexEntry {
+	uint32_t nMillis;
+	uint32_t nOffset;			///< File offset of the KEYFRAME record
+} __attribute__((packed));
+
+static_assert(sizeof(struct Header) == 16, "");
+static_assert(sizeof(struct Record) == 8, "");
+
+/**
+ * The largest payload of a KEY or DELTA record, a DELTA larger than the slots is written as a KEY.
+ */
+static constexpr uint32_t PAYLOAD_MAX = SLOTS_MAX;
+
+inline constexpr uint32_t universe_value(const uint32_t nUniverse, const uint32_t nSlots) {
+	return (nUniverse & 0xFFFF) | (nSlots << 16);
+}
+
+inline constexpr uint16_t universe(const uint32_t nValue) {
+	return static_cast<uint16_t>(nValue & 0xFFFF);
+}
+
+inline constexpr uint32_t slots(const uint32_t nValue) {
+	return nValue >> 16;
+}
+
+/**
+ * @return the DELTA payload length in pOut, 0 when nothing has changed,
+ * PAYLOAD_MAX + 1 when a KEY record is smaller
+ */
+uint32_t delta_encode(const uint8_t *pPrevious, const uint8_t *pCurrent, const uint32_t nSlots, uint8_t *pOut);
+
+/**
+ * Applies a DELTA payload to pData.
+ * @return false when the payload does not fit in nSlots
+ */
+bool delta_decode(const uint8_t *pPayload, const uint32_t nLength, uint8_t *pData, const uint32_t nSlots);
+}  // namespace binary
+}  // namespace showfile
+
+#endif /* FORMATS_SHOWFILEBINARY_H_ */
@@ -0,0 +1,165 @@
+/**
+ * @file showfileformatbinary.h
+ *
+ */
+/* Copyright (C) 2024 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef FORMATS_SHOWFILEFORMATBINARY_H_
+#define FORMATS_SHOWFILEFORMATBINARY_H_
+
+#include <cstdint>
+#include <cstdio>
+#include <cassert>
+
+#include "formats/showfilebinary.h"
+
+#include "showfileplayback.h"
+#include "showfileconst.h"
+
+#include "debug.h"
+
+#define SHOWFILE_PREFIX	"show"
+#define SHOWFILE_SUFFIX	".shw"
+
+#if !defined (CONFIG_SHOWFILE_BINARY_MAX_UNIVERSES)
+# define CONFIG_SHOWFILE_BINARY_MAX_UNIVERSES	16
+#endif
+
+namespace showfile {
+static constexpr uint32_t FILE_NAME_LENGTH = sizeof(SHOWFILE_PREFIX "NN" SHOWFILE_SUFFIX) - 1U;
+static constexpr uint32_t FILE_MAX_NUMBER = 99;
+namespace binary {
+static constexpr uint32_t MAX_UNIVERSES = CONFIG_SHOWFILE_BINARY_MAX_UNIVERSES;	///< With DELTA records, more universes are recorded as KEY records
+static constexpr uint32_t INDEX_ENTRIES = 256;	///< When full, every other KEYFRAME is dropped from the index
+static constexpr uint32_t PREFETCH_RECORDS = 64;	///< Records read in one Run
+}  // namespace binary
+}  // namespace showfile
+
+class ShowFileFormat: protected ShowFilePlayback {
+public:
+	ShowFileFormat() {
+		DEBUG_ENTRY
+
+		assert(s_pThis == nullptr);
+		s_pThis = this;
+
+		ShowFileProtocol::Start();
+
+		DEBUG_EXIT
+	}
+
+	void ShowFileStart();
+	void ShowFileStop();
+	void ShowFileResume();
+	void ShowFileRecord();
+
+	/**
+	 * Continues the playback from the last KEYFRAME before nMillis, the frames up to nMillis are sent immediately
+	 * @return false when the show file has no index
+	 */
+	bool ShowFileSeek(const uint32_t nMillis);
+
+	void ShowFilePrint() {
+		puts(" Format: Binary");
+		ShowFilePlayback::PlaybackPrint();
+		ShowFileProtocol::Print();
+	}
+
+	void ShowFileRun(const bool doRun) {
+		if (doRun) {
+			Run();
+		}
+
+		ShowFileProtocol::Run();
+	}
+
+	void DoRunCleanupProcess(const bool bDoRun) {
+		ShowFileProtocol::DoRunCleanupProcess(bDoRun);
+	}
+
+	void ShowfileWrite(const uint8_t *pDmxData, const uint32_t nSize, const uint32_t nUniverse, const uint32_t nMillis);
+	void ShowfileLost(const uint32_t nLost);
+
+	void BlackOut() {
+#if defined (CONFIG_SHOWFILE_ENABLE_MASTER)
+		ShowFileProtocol::DmxBlackout();
+#endif
+	}
+
+	void SetMaster([[maybe_unused]] const uint32_t nMaster) {
+#if defined (CONFIG_SHOWFILE_ENABLE_MASTER)
+		ShowFileProtocol::DmxMaster(nMaster);
+#endif
+	}
+
+	bool IsSyncDisabled() {
+		return ShowFileProtocol::IsSyncDisabled();
+	}
+
+	static ShowFileFormat *Get() {
+		return s_pThis;
+	}
+
+private:
+	struct Universe {
+		uint16_t nUniverse;
+		uint16_t nSlots;
+		uint8_t data[showfile::binary::SLOTS_MAX];
+	};
+
+	void Run();
+	void EndOfShow();
+	bool ReadRecord(showfile::binary::Record& record);
+	Universe *GetUniverse(const uint16_t nUniverse, const bool bAdd);
+	void WriteRecord(const showfile::binary::Type type, const uint32_t nValue, const uint8_t *pPayload, const uint32_t nLength);
+	void WriteKeyframe(const uint32_t nMillis);
+	void WriteIndex();
+
+protected:
+	uint32_t m_nShowFileCurrent { showfile::FILE_MAX_NUMBER + 1 };
+	bool m_bDoLoop { false };
+	FILE *m_pShowFile { nullptr };
+
+private:
+	enum class State {
+		IDLE, PLAYING, TIME_WAITING, FAILED, RECORD_FIRST, RECORDING
+	};
+
+	State m_State { State::IDLE };
+	bool m_bEndOfShow { false };
+	bool m_bFramePending { false };
+	uint32_t m_nStartMillis { 0 };		///< Recorder
+	uint32_t m_nFrameMillis { 0 };
+	uint32_t m_nKeyframeMillis { 0 };
+	uint32_t m_nKeyframeInterval { showfile::binary::KEYFRAME_INTERVAL_MILLIS };
+	uint32_t m_nFileOffset { 0 };
+	uint32_t m_nIndexOffset { 0 };
+	uint32_t m_nIndexEntries { 0 };
+	uint32_t m_nUniverses { 0 };
+	Universe m_Universe[showfile::binary::MAX_UNIVERSES];
+	showfile::binary::IndexEntry m_Index[showfile::binary::INDEX_ENTRIES];
+	uint8_t m_Buffer[sizeof(struct showfile::binary::Record) + showfile::binary::PAYLOAD_MAX] __attribute__ ((aligned (4)));
+
+	static ShowFileFormat *s_pThis;
+};
+
+#endif /* FORMATS_SHOWFILEFORMATBINARY_H_ */
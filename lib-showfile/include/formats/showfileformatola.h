@@ -34,7 +34,7 @@
 #include <cstdio>
 #include <cassert>
 
-#include "showfileprotocol.h"
+#include "showfileplayback.h"
 #include "showfileconst.h"
 
 #include "debug.h"
@@ -45,9 +45,12 @@
 namespace showfile {
 static constexpr uint32_t FILE_NAME_LENGTH = sizeof(SHOWFILE_PREFIX "NN" SHOWFILE_SUFFIX) - 1U;
 static constexpr uint32_t FILE_MAX_NUMBER = 99;
+namespace ola {
+static constexpr uint32_t PREFETCH_LINES = 64;	///< Lines parsed in one Run
+}  // namespace ola
 }  // namespace showfile
 
-class ShowFileFormat: ShowFileProtocol {
+class ShowFileFormat: protected ShowFilePlayback {
 public:
 	ShowFileFormat() {
 		DEBUG_ENTRY
@@ -70,26 +73,30 @@ public:
 		DEBUG_ENTRY
 
 		m_nDelayMillis = 0;
-		m_nLastMillis = 0;
+		m_nFrameMillis = 0;
+		m_bEndOfShow = false;
 
 		fseek(m_pShowFile, 0L, SEEK_SET);
 
 		m_OlaState = OlaState::IDLE;
 
+		ShowFilePlayback::PlaybackStart(0);
+
 		DEBUG_EXIT
 	}
 
 	void ShowFileStop() {
 		DEBUG_ENTRY
 
+		ShowFilePlayback::PlaybackStop();
+
 		DEBUG_EXIT
 	}
 
 	void ShowFileResume() {
 		DEBUG_ENTRY
 
-		m_nDelayMillis = 0;
-		m_nLastMillis = 0;
+		ShowFilePlayback::PlaybackResume();
 
 		DEBUG_EXIT
 	}
@@ -115,6 +122,7 @@ public:
 
 	void ShowFilePrint() {
 		puts(" Format: OLA");
+		ShowFilePlayback::PlaybackPrint();
 		ShowFileProtocol::Print();
 	}
 
@@ -167,6 +175,14 @@ public:
 #endif
 	}
 
+	void ShowfileLost(const uint32_t nLost) {
+		/*
+		 * Not starting with a digit, the player skips this line
+		 */
+		snprintf(m_buffer, sizeof(m_buffer), "# %u frames lost\n", static_cast<unsigned int>(nLost));
+		fputs(m_buffer, m_pShowFile);
+	}
+
 	void BlackOut() {
 #if defined (CONFIG_SHOWFILE_ENABLE_MASTER)
 		ShowFileProtocol::DmxBlackout();
@@ -202,7 +218,7 @@ private:
 			pDestination[3] = m_digitsTable[nIndex];
 			pDestination[4] = m_digitsTable[nIndex + 1];
 			nUniverse /= 100;
-			n = 5;
+			n = 4;	// The leading digit is counted below
 		} else if (nUniverse >= 1000) {
 			const auto nIndex = (nUniverse % 100) * 2;
 			pDestination[2] = m_digitsTable[nIndex];
@@ -279,7 +295,7 @@ protected:
 
 private:
 	enum class OlaState {
-		IDLE, PARSING_DMX, TIME_WAITING, RECORD_FIRST, RECORDING
+		IDLE, RECORD_FIRST, RECORDING
 	};
 
 	enum class OlaParseCode {
@@ -293,10 +309,12 @@ private:
 private:
 	OlaParseCode m_OlaParseCode { OlaParseCode::FAILED };
 	OlaState m_OlaState { OlaState::IDLE };
-	char m_buffer[2048];
+	char m_buffer[sizeof("65535 ") + (512 * 4)];	///< The widest line: universe 65535 and 512 slots "255,", the last ',' becomes '\n'
 	char m_digitsTable[200];
 	uint32_t m_nDelayMillis { 0 };
 	uint32_t m_nLastMillis { 0 };
+	uint32_t m_nFrameMillis { 0 };
+	bool m_bEndOfShow { false };
 	uint32_t m_nDmxDataLength { 0 };
 	uint16_t m_nUniverse { 0 };
 	uint8_t m_DmxData[512];
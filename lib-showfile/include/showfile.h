@@ -32,6 +32,9 @@
 #include "showfiletftp.h"
 #include "showfileformat.h"
 #include "showfileprotocol.h"
+#if !defined (CONFIG_SHOWFILE_DISABLE_RECORD)
+# include "showfilerecorder.h"
+#endif
 
 #if defined (CONFIG_SHOWFILE_ENABLE_OSC)
 # include "showfileosc.h"
@@ -80,11 +83,17 @@ public:
 		DEBUG_ENTRY
 
 		if (m_pShowFile != nullptr) {
+#if !defined (CONFIG_SHOWFILE_DISABLE_RECORD)
+			if (m_Status == showfile::Status::RECORDING) {
+				RecordDrain(UINT32_MAX);
+			}
+#endif
 			ShowFileFormat::ShowFileStop();
 
 			if ((m_Status == showfile::Status::STOPPED) || (m_Status == showfile::Status::RECORDING)) {
 				if (m_Status == showfile::Status::RECORDING) {
 					fclose(m_pShowFile);
+					m_pShowFile = nullptr;
 				}
 				SetStatus(showfile::Status::IDLE);
 			} else {
@@ -121,6 +130,7 @@ public:
 		}
 
 		if (m_pShowFile != nullptr) {
+			m_RingBuffer.Reset();
 			ShowFileFormat::ShowFileRecord();
 			SetStatus(showfile::Status::RECORDING);
 		} else {
@@ -129,10 +139,30 @@ public:
 
 		DEBUG_EXIT
 	}
+
+	const struct showfile::recorder::Statistics& GetRecorderStatistics() const {
+		return m_RingBuffer.GetStatistics();
+	}
 #endif
 
+	/**
+	 * Called from the receive path, the show file is written in Run
+	 */
+	void RecordPush([[maybe_unused]] const uint8_t *pDmxData, [[maybe_unused]] const uint32_t nLength, [[maybe_unused]] const uint32_t nUniverse, [[maybe_unused]] const uint32_t nMillis) {
+#if !defined (CONFIG_SHOWFILE_DISABLE_RECORD)
+		if (m_Status == showfile::Status::RECORDING) {
+			m_RingBuffer.Push(pDmxData, nLength, nUniverse, nMillis);
+		}
+#endif
+	}
+
 	void Run() {
 		ShowFileFormat::ShowFileRun(m_Status == showfile::Status::PLAYING);
+#if !defined (CONFIG_SHOWFILE_DISABLE_RECORD)
+		if (m_Status == showfile::Status::RECORDING) {
+			RecordDrain(showfile::recorder::DRAIN_ENTRIES);
+		}
+#endif
 #if defined (CONFIG_SHOWFILE_ENABLE_OSC)
 		m_showFileOSC.Run();
 #endif
@@ -154,6 +184,9 @@ public:
 		printf(" %s\n", m_bDoLoop ? "Looping" : "Not looping");
 #if defined (CONFIG_SHOWFILE_DISABLE_RECORD)
 		puts(" Recorder is disabled.");
+#else
+		const auto& statistics = m_RingBuffer.GetStatistics();
+		printf(" Recorder buffer %u/%u bytes, %u frames lost\n", static_cast<unsigned int>(statistics.nHighWater), static_cast<unsigned int>(showfile::recorder::BUFFER_SIZE), static_cast<unsigned int>(statistics.nLost));
 #endif
 		ShowFileFormat::ShowFilePrint();
 #if defined (CONFIG_SHOWFILE_ENABLE_OSC)
@@ -236,6 +269,21 @@ public:
 		return ShowFileFormat::IsSyncDisabled();
 	}
 
+	/**
+	 * @param nSpeed in percent, 100 is real time
+	 */
+	void SetSpeed(const uint32_t nSpeed) {
+		ShowFilePlayback::SetSpeed(nSpeed);
+	}
+
+	uint32_t GetSpeed() const {
+		return ShowFilePlayback::GetSpeed();
+	}
+
+	const showfile::playback::TimingStatistics& GetTimingStatistics() const {
+		return ShowFilePlayback::GetTimingStatistics();
+	}
+
 	void BlackOut() {
 #if defined (CONFIG_SHOWFILE_ENABLE_MASTER)
 		Stop();
@@ -291,6 +339,9 @@ public:
 private:
 	void OpenFile(const showfile::Mode mode, const uint32_t nShowFileNumber);
 	bool AddShow(const uint32_t nShowFileNumber);
+#if !defined (CONFIG_SHOWFILE_DISABLE_RECORD)
+	void RecordDrain(const uint32_t nEntries);
+#endif
 
 private:
 #if defined (CONFIG_SHOWFILE_ENABLE_OSC)
@@ -302,6 +353,9 @@ private:
 	uint32_t m_nShows { 0 };
 	int32_t m_nShowFileNumber[showfile::FILE_MAX_NUMBER + 1];
 	bool m_bAutoPlay { false };
+#if !defined (CONFIG_SHOWFILE_DISABLE_RECORD)
+	showfile::recorder::RingBuffer m_RingBuffer;
+#endif
 #if !defined(CONFIG_SHOWFILE_DISABLE_TFTP)
 	bool m_bEnableTFTP { false };
 	ShowFileTFTP *m_pShowFileTFTP { nullptr };
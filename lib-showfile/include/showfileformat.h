@@ -28,6 +28,8 @@
 
 #if defined (CONFIG_SHOWFILE_FORMAT_OLA)
 # include "formats/showfileformatola.h"
+#elif defined (CONFIG_SHOWFILE_FORMAT_BINARY)
+# include "formats/showfileformatbinary.h"
 #else
 # error Format is not supported
 #endif
@@ -0,0 +1,187 @@
+/**
+ * @file showfileplayback.h
+ *
+ */
+/* Copyright (C) 2024 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef SHOWFILEPLAYBACK_H_
+#define SHOWFILEPLAYBACK_H_
+
+#include <cstdint>
+
+#include "showfileprotocol.h"
+
+#if !defined (CONFIG_SHOWFILE_PLAYBACK_MAX_UNIVERSES)
+# define CONFIG_SHOWFILE_PLAYBACK_MAX_UNIVERSES	16
+#endif
+
+/**
+ * The format prefetches a frame with Stage and SetDeadline.
+ * When the show time has reached the deadline, Release sends all the staged universes followed by DmxSync.
+ */
+
+namespace showfile {
+namespace playback {
+static constexpr uint32_t MAX_UNIVERSES = CONFIG_SHOWFILE_PLAYBACK_MAX_UNIVERSES;	///< More universes are sent when staged, without sync
+static constexpr uint32_t SLOTS_MAX = 512;
+static constexpr uint32_t SPEED_MIN = 10;		///< Percent
+static constexpr uint32_t SPEED_MAX = 1000;		///< Percent
+static constexpr uint32_t SPEED_DEFAULT = 100;	///< Percent
+static constexpr uint32_t BUCKETS = 8;
+
+/**
+ * Upper bound (exclusive) in microseconds of the first BUCKETS - 1 buckets, the last bucket is everything above.
+ */
+static constexpr uint32_t BUCKET_LIMITS[BUCKETS - 1] = { 100, 250, 500, 1000, 2000, 5000, 10000 };
+
+/**
+ * Release time minus deadline, in microseconds
+ */
+struct TimingStatistics {
+	uint64_t nSum;
+	uint32_t nCount;
+	uint32_t nMax;
+	uint32_t nBucket[BUCKETS];
+
+	void Reset() {
+		nSum = 0;
+		nCount = 0;
+		nMax = 0;
+
+		for (auto& nValue : nBucket) {
+			nValue = 0;
+		}
+	}
+
+	void Add(const uint32_t nValue) {
+		nSum += nValue;
+		nCount++;
+
+		if (nValue > nMax) {
+			nMax = nValue;
+		}
+
+		uint32_t i = 0;
+
+		while ((i < (BUCKETS - 1)) && (nValue >= BUCKET_LIMITS[i])) {
+			i++;
+		}
+
+		nBucket[i]++;
+	}
+
+	uint32_t GetMean() const {
+		return (nCount == 0) ? 0 : static_cast<uint32_t>(nSum / nCount);
+	}
+};
+}  // namespace playback
+}  // namespace showfile
+
+class ShowFilePlayback: public ShowFileProtocol {
+public:
+	/**
+	 * Starts the show clock at nMillis, the staging buffer is cleared
+	 */
+	void PlaybackStart(const uint32_t nMillis);
+
+	void PlaybackStop() {
+		Tick();
+		m_bRunning = false;
+	}
+
+	void PlaybackResume() {
+		Tick();
+		m_bRunning = true;
+	}
+
+	/**
+	 * Adds a universe to the next frame, a staged universe is replaced.
+	 */
+	void Stage(const uint16_t nUniverse, const uint8_t *pDmxData, const uint32_t nLength);
+
+	/**
+	 * The staged frame is released when the show time has reached nMillis
+	 */
+	void SetDeadline(const uint32_t nMillis) {
+		m_nDeadline = static_cast<uint64_t>(nMillis) * 1000U * showfile::playback::SPEED_DEFAULT;
+		m_bStaged = true;
+	}
+
+	bool IsStaged() const {
+		return m_bStaged;
+	}
+
+	bool IsDue() {
+		Tick();
+		return m_nPosition >= m_nDeadline;
+	}
+
+	void Release();
+
+	/**
+	 * @param nSpeed in percent, 100 is real time
+	 */
+	void SetSpeed(uint32_t nSpeed) {
+		if (nSpeed < showfile::playback::SPEED_MIN) {
+			nSpeed = showfile::playback::SPEED_MIN;
+		} else if (nSpeed > showfile::playback::SPEED_MAX) {
+			nSpeed = showfile::playback::SPEED_MAX;
+		}
+
+		Tick();
+		m_nSpeed = nSpeed;
+	}
+
+	uint32_t GetSpeed() const {
+		return m_nSpeed;
+	}
+
+	const showfile::playback::TimingStatistics& GetTimingStatistics() const {
+		return m_TimingStatistics;
+	}
+
+	void PlaybackPrint();
+
+private:
+	/**
+	 * The show time advances with the elapsed microseconds times the speed
+	 */
+	void Tick();
+
+	struct Universe {
+		uint16_t nUniverse;
+		uint16_t nLength;
+		uint8_t data[showfile::playback::SLOTS_MAX];
+	};
+
+	uint64_t m_nPosition { 0 };		///< Show time in microseconds * SPEED_DEFAULT
+	uint64_t m_nDeadline { 0 };		///< Show time in microseconds * SPEED_DEFAULT
+	uint32_t m_nMicrosPrevious { 0 };
+	uint32_t m_nSpeed { showfile::playback::SPEED_DEFAULT };
+	uint32_t m_nStaged { 0 };
+	bool m_bRunning { false };
+	bool m_bStaged { false };
+	Universe m_Staging[showfile::playback::MAX_UNIVERSES];
+	showfile::playback::TimingStatistics m_TimingStatistics;
+};
+
+#endif /* SHOWFILEPLAYBACK_H_ */
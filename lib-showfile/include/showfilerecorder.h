@@ -0,0 +1,188 @@
+/**
+ * @file showfilerecorder.h
+ *
+ */
+/* Copyright (C) 2024 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef SHOWFILERECORDER_H_
+#define SHOWFILERECORDER_H_
+
+#include <cstdint>
+#include <cstring>
+
+#if !defined (CONFIG_SHOWFILE_RECORD_BUFFER_SIZE)
+# define CONFIG_SHOWFILE_RECORD_BUFFER_SIZE	(16 * 1024)
+#endif
+
+/**
+ * The receive path pushes the DMX data into a ring buffer,
+ * ShowFile::Run drains it into the show file.
+ * There is one producer and one consumer, no locking is needed.
+ */
+
+namespace showfile {
+namespace recorder {
+static constexpr uint32_t BUFFER_SIZE = CONFIG_SHOWFILE_RECORD_BUFFER_SIZE;
+static constexpr uint32_t DRAIN_ENTRIES = 4;	///< Written to the show file in one ShowFile::Run
+static constexpr uint32_t SLOTS_MAX = 512;
+static constexpr uint16_t PAD = 0xFFFF;			///< The rest of the buffer is not used, continue at the start
+
+static_assert((BUFFER_SIZE & (BUFFER_SIZE - 1)) == 0, "BUFFER_SIZE must be a power of 2");
+
+struct Entry {
+	uint32_t nMillis;
+	uint32_t nLost;			///< Frames lost before this entry
+	uint16_t nUniverse;
+	uint16_t nLength;		///< DMX data following the entry, or PAD
+};
+
+static_assert(sizeof(struct Entry) == 12, "");
+
+struct Statistics {
+	uint32_t nEntries;
+	uint32_t nLost;			///< Frames lost, the buffer was full
+	uint32_t nOverflows;	///< Times the buffer became full
+	uint32_t nHighWater;	///< Most bytes in use
+};
+
+class RingBuffer {
+public:
+	void Reset() {
+		m_nHead = 0;
+		m_nTail = 0;
+		m_nLost = 0;
+		memset(&m_Statistics, 0, sizeof(struct Statistics));
+	}
+
+	/**
+	 * Producer
+	 * @return false when the buffer is full, the frame is counted as lost
+	 */
+	bool Push(const uint8_t *pData, uint32_t nLength, const uint32_t nUniverse, const uint32_t nMillis) {
+		if (nLength > SLOTS_MAX) {
+			nLength = SLOTS_MAX;
+		}
+
+		const auto nSize = static_cast<uint32_t>(sizeof(struct Entry)) + ((nLength + 3U) & ~3U);
+		const auto nHead = m_nHead;
+		const auto nContiguous = BUFFER_SIZE - (nHead & (BUFFER_SIZE - 1));
+		const auto nPad = (nContiguous < nSize) ? nContiguous : 0;
+		const auto nUsed = nHead - m_nTail;
+
+		if ((nUsed + nPad + nSize) > BUFFER_SIZE) {
+			if (m_nLost == 0) {
+				m_Statistics.nOverflows++;
+			}
+			m_nLost++;
+			m_Statistics.nLost++;
+			return false;
+		}
+
+		auto nOffset = nHead & (BUFFER_SIZE - 1);
+
+		if (nPad != 0) {
+			if (nPad >= sizeof(struct Entry)) {
+				reinterpret_cast<struct Entry *>(&m_Buffer[nOffset])->nLength = PAD;
+			}
+			nOffset = 0;
+		}
+
+		auto *pEntry = reinterpret_cast<struct Entry *>(&m_Buffer[nOffset]);
+		pEntry->nMillis = nMillis;
+		pEntry->nLost = m_nLost;
+		pEntry->nUniverse = static_cast<uint16_t>(nUniverse);
+		pEntry->nLength = static_cast<uint16_t>(nLength);
+		memcpy(&m_Buffer[nOffset + sizeof(struct Entry)], pData, nLength);
+
+		m_nLost = 0;
+		m_Statistics.nEntries++;
+
+		if ((nUsed + nPad + nSize) > m_Statistics.nHighWater) {
+			m_Statistics.nHighWater = nUsed + nPad + nSize;
+		}
+
+		__sync_synchronize();
+		m_nHead = nHead + nPad + nSize;
+
+		return true;
+	}
+
+	/**
+	 * Consumer
+	 * @return nullptr when the buffer is empty
+	 */
+	const struct Entry *Front() {
+		for (;;) {
+			const auto nTail = m_nTail;
+
+			if (nTail == m_nHead) {
+				return nullptr;
+			}
+
+			__sync_synchronize();
+
+			const auto nOffset = nTail & (BUFFER_SIZE - 1);
+			const auto nContiguous = BUFFER_SIZE - nOffset;
+
+			if ((nContiguous < sizeof(struct Entry)) || (reinterpret_cast<const struct Entry *>(&m_Buffer[nOffset])->nLength == PAD)) {
+				m_nTail = nTail + nContiguous;
+				continue;
+			}
+
+			return reinterpret_cast<const struct Entry *>(&m_Buffer[nOffset]);
+		}
+	}
+
+	const uint8_t *GetData(const struct Entry *pEntry) const {
+		return reinterpret_cast<const uint8_t *>(pEntry) + sizeof(struct Entry);
+	}
+
+	void Pop() {
+		const auto *pEntry = reinterpret_cast<const struct Entry *>(&m_Buffer[m_nTail & (BUFFER_SIZE - 1)]);
+		const auto nSize = static_cast<uint32_t>(sizeof(struct Entry)) + ((pEntry->nLength + 3U) & ~3U);
+
+		__sync_synchronize();
+		m_nTail = m_nTail + nSize;
+	}
+
+	/**
+	 * Frames lost after the last entry in the buffer
+	 */
+	uint32_t GetLost() const {
+		return m_nLost;
+	}
+
+	const struct Statistics& GetStatistics() const {
+		return m_Statistics;
+	}
+
+private:
+	uint8_t m_Buffer[BUFFER_SIZE] __attribute__ ((aligned (4)));
+	volatile uint32_t m_nHead { 0 };
+	volatile uint32_t m_nTail { 0 };
+	uint32_t m_nLost { 0 };
+	struct Statistics m_Statistics {};
+};
+}  // namespace recorder
+}  // namespace showfile
+
+#endif /* SHOWFILERECORDER_H_ */
@@ -0,0 +1,102 @@
+/**
+ * @file showfilebinary.cpp
+ *
+ */
+/* Copyright (C) 2024 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#if !defined(__clang__)
+# pragma GCC push_options
+# pragma GCC optimize ("O2")
+#endif
+
+#include <cstdint>
+#include <cstring>
+
+#include "formats/showfilebinary.h"
+
+namespace showfile {
+namespace binary {
+uint32_t delta_encode(const uint8_t *pPrevious, const uint8_t *pCurrent, const uint32_t nSlots, uint8_t *pOut) {
+	uint32_t nLength = 0;
+	uint32_t nIndex = 0;
+
+	while (nIndex < nSlots) {
+		if (pPrevious[nIndex] == pCurrent[nIndex]) {
+			nIndex++;
+			continue;
+		}
+
+		/*
+		 * Start of a run. Unchanged gaps not larger than a Run header are taken into the run.
+		 */
+		const auto nOffset = nIndex;
+		auto nEnd = nIndex + 1;
+
+		for (auto i = nEnd; i < nSlots; i++) {
+			if (pPrevious[i] != pCurrent[i]) {
+				nEnd = i + 1;
+			} else if ((i - nEnd) >= sizeof(struct Run)) {
+				break;
+			}
+		}
+
+		const auto nCount = nEnd - nOffset;
+
+		if ((nLength + sizeof(struct Run) + nCount) >= nSlots) {
+			return PAYLOAD_MAX + 1;
+		}
+
+		struct Run run;
+		run.nOffset = static_cast<uint16_t>(nOffset);
+		run.nCount = static_cast<uint16_t>(nCount);
+
+		memcpy(&pOut[nLength], &run, sizeof(struct Run));
+		nLength += static_cast<uint32_t>(sizeof(struct Run));
+		memcpy(&pOut[nLength], &pCurrent[nOffset], nCount);
+		nLength += nCount;
+
+		nIndex = nEnd;
+	}
+
+	return nLength;
+}
+
+bool delta_decode(const uint8_t *pPayload, const uint32_t nLength, uint8_t *pData, const uint32_t nSlots) {
+	uint32_t nIndex = 0;
+
+	while ((nIndex + sizeof(struct Run)) <= nLength) {
+		struct Run run;
+		memcpy(&run, &pPayload[nIndex], sizeof(struct Run));
+		nIndex += static_cast<uint32_t>(sizeof(struct Run));
+
+		if (((static_cast<uint32_t>(run.nOffset) + run.nCount) > nSlots) || ((nIndex + run.nCount) > nLength)) {
+			return false;
+		}
+
+		memcpy(&pData[run.nOffset], &pPayload[nIndex], run.nCount);
+		nIndex += run.nCount;
+	}
+
+	return (nIndex == nLength);
+}
+}  // namespace binary
+}  // namespace showfile
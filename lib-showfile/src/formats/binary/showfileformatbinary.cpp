@@ -0,0 +1,527 @@
+/**
+ * @file showfileformatbinary.cpp
+ *
+ */
+/* Copyright (C) 2024 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#if !defined(__clang__)
+# pragma GCC push_options
+# pragma GCC optimize ("O2")
+#endif
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <cassert>
+
+#include "formats/showfileformatbinary.h"
+#include "formats/showfilebinary.h"
+#include "showfile.h"
+
+#include "debug.h"
+
+using namespace showfile::binary;
+
+ShowFileFormat *ShowFileFormat::s_pThis;
+
+/*
+ * Player
+ */
+
+void ShowFileFormat::ShowFileStart() {
+	DEBUG_ENTRY
+
+	m_State = State::FAILED;
+	m_nIndexOffset = 0;
+	m_nIndexEntries = 0;
+
+	struct Header header;
+
+	fseek(m_pShowFile, 0L, SEEK_SET);
+
+	if (fread(&header, sizeof(struct Header), 1, m_pShowFile) != 1) {
+		DEBUG_EXIT
+		return;
+	}
+
+	if ((memcmp(header.aMagic, MAGIC, sizeof(MAGIC)) != 0) || (header.nVersion != VERSION)) {
+		DEBUG_PUTS("Not a binary show file");
+		DEBUG_EXIT
+		return;
+	}
+
+	m_nIndexOffset = header.nIndexOffset;
+	m_nIndexEntries = header.nIndexEntries;
+	m_nUniverses = 0;
+	m_nFrameMillis = 0;
+	m_bEndOfShow = false;
+	m_State = State::PLAYING;
+
+	ShowFilePlayback::PlaybackStart(0);
+
+	DEBUG_PRINTF("m_nIndexOffset=%u, m_nIndexEntries=%u", m_nIndexOffset, m_nIndexEntries);
+	DEBUG_EXIT
+}
+
+void ShowFileFormat::ShowFileStop() {
+	DEBUG_ENTRY
+
+	if ((m_State == State::RECORD_FIRST) || (m_State == State::RECORDING)) {
+		WriteIndex();
+		m_State = State::IDLE;
+		DEBUG_EXIT
+		return;
+	}
+
+	ShowFilePlayback::PlaybackStop();
+
+	DEBUG_EXIT
+}
+
+void ShowFileFormat::ShowFileResume() {
+	DEBUG_ENTRY
+
+	ShowFilePlayback::PlaybackResume();
+
+	DEBUG_EXIT
+}
+
+bool ShowFileFormat::ShowFileSeek(const uint32_t nMillis) {
+	DEBUG_ENTRY
+	DEBUG_PRINTF("nMillis=%u", nMillis);
+
+	if ((m_pShowFile == nullptr) || (m_nIndexOffset == 0) || (m_nIndexEntries == 0)) {
+		DEBUG_EXIT
+		return false;
+	}
+
+	/*
+	 * The last KEYFRAME at or before nMillis, the first entry is the KEYFRAME at 0.
+	 */
+	const auto nEntries = static_cast<long>(m_nIndexOffset + sizeof(struct Record));
+	struct IndexEntry entry;
+	uint32_t nLow = 0;
+	uint32_t nHigh = m_nIndexEntries;
+	uint32_t nOffset = sizeof(struct Header);
+
+	while (nLow < nHigh) {
+		const auto nMiddle = (nLow + nHigh) / 2;
+
+		if ((fseek(m_pShowFile, nEntries + static_cast<long>(nMiddle * sizeof(struct IndexEntry)), SEEK_SET) != 0)
+				|| (fread(&entry, sizeof(struct IndexEntry), 1, m_pShowFile) != 1)) {
+			DEBUG_EXIT
+			return false;
+		}
+
+		if (entry.nMillis <= nMillis) {
+			nOffset = entry.nOffset;
+			nLow = nMiddle + 1;
+		} else {
+			nHigh = nMiddle;
+		}
+	}
+
+	if (fseek(m_pShowFile, static_cast<long>(nOffset), SEEK_SET) != 0) {
+		DEBUG_EXIT
+		return false;
+	}
+
+	/*
+	 * The frames from the KEYFRAME up to nMillis are due immediately
+	 */
+	m_bEndOfShow = false;
+	m_State = State::PLAYING;
+
+	ShowFilePlayback::PlaybackStart(nMillis);
+
+	DEBUG_PRINTF("nOffset=%u", nOffset);
+	DEBUG_EXIT
+	return true;
+}
+
+bool ShowFileFormat::ReadRecord(struct Record& record) {
+	if (fread(&record, sizeof(struct Record), 1, m_pShowFile) != 1) {
+		return false;
+	}
+
+	if ((record.nType == static_cast<uint8_t>(Type::INDEX)) || (record.nType > static_cast<uint8_t>(Type::LOST))) {
+		return false;
+	}
+
+	if (record.nLength != 0) {
+		if (record.nLength > PAYLOAD_MAX) {
+			return false;
+		}
+
+		if (fread(m_Buffer, record.nLength, 1, m_pShowFile) != 1) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void ShowFileFormat::EndOfShow() {
+	if (m_bDoLoop) {
+		/*
+		 * The first record is a KEYFRAME, there is no state to be cleared.
+		 */
+		fseek(m_pShowFile, static_cast<long>(sizeof(struct Header)), SEEK_SET);
+		m_nFrameMillis = 0;
+		m_bEndOfShow = false;
+		ShowFilePlayback::PlaybackStart(0);
+		return;
+	}
+
+	m_State = State::IDLE;
+	ShowFile::Get()->SetStatus(showfile::Status::ENDED);
+}
+
+void ShowFileFormat::Run() {
+	if (m_State != State::PLAYING) {
+		if (m_State == State::FAILED) {
+			m_State = State::IDLE;
+			ShowFile::Get()->SetStatus(showfile::Status::ENDED);
+		}
+		return;
+	}
+
+	if (ShowFilePlayback::IsStaged()) {
+		if (!ShowFilePlayback::IsDue()) {
+			return;
+		}
+
+		ShowFilePlayback::Release();
+	}
+
+	if (m_bEndOfShow) {
+		EndOfShow();
+		return;
+	}
+
+	struct Record record;
+
+	/*
+	 * Prefetch the next frame, all the records until the next FRAME or KEYFRAME.
+	 * The number of records in one Run is limited, the prefetch continues in the next Run.
+	 */
+	for (uint32_t nRecords = 0; nRecords < PREFETCH_RECORDS; nRecords++) {
+		if (!ReadRecord(record)) {
+			m_bEndOfShow = true;
+			ShowFilePlayback::SetDeadline(m_nFrameMillis);
+			return;
+		}
+
+		const auto type = static_cast<Type>(record.nType);
+
+		if ((type == Type::FRAME) || (type == Type::KEYFRAME)) {
+			ShowFilePlayback::SetDeadline(m_nFrameMillis);
+			m_nFrameMillis = record.nValue;
+			return;
+		}
+
+		if (type == Type::LOST) {
+			continue;
+		}
+
+		const auto nUniverse = universe(record.nValue);
+		const auto nSlots = slots(record.nValue);
+
+		if (nSlots > SLOTS_MAX) {
+			continue;
+		}
+
+		if (type == Type::KEY) {
+			if (record.nLength != nSlots) {
+				continue;
+			}
+
+			auto *pUniverse = GetUniverse(nUniverse, true);
+
+			if (pUniverse != nullptr) {
+				memcpy(pUniverse->data, m_Buffer, nSlots);
+				pUniverse->nSlots = static_cast<uint16_t>(nSlots);
+			}
+
+			ShowFilePlayback::Stage(nUniverse, m_Buffer, nSlots);
+		} else if (type == Type::DELTA) {
+			auto *pUniverse = GetUniverse(nUniverse, false);
+
+			if ((pUniverse == nullptr) || (pUniverse->nSlots != nSlots)) {
+				continue;
+			}
+
+			if (delta_decode(m_Buffer, record.nLength, pUniverse->data, nSlots)) {
+				ShowFilePlayback::Stage(nUniverse, pUniverse->data, nSlots);
+			}
+		}
+	}
+}
+
+ShowFileFormat::Universe *ShowFileFormat::GetUniverse(const uint16_t nUniverse, const bool bAdd) {
+	for (uint32_t i = 0; i < m_nUniverses; i++) {
+		if (m_Universe[i].nUniverse == nUniverse) {
+			return &m_Universe[i];
+		}
+	}
+
+	if (!bAdd || (m_nUniverses == MAX_UNIVERSES)) {
+		return nullptr;
+	}
+
+	auto *pUniverse = &m_Universe[m_nUniverses++];
+	pUniverse->nUniverse = nUniverse;
+	pUniverse->nSlots = 0;
+
+	return pUniverse;
+}
+
+/*
+ * Recorder
+ */
+
+void ShowFileFormat::ShowFileRecord() {
+	DEBUG_ENTRY
+	DEBUG_PRINTF("m_pShowFile%snullptr", m_pShowFile != nullptr ? "!=" : "==");
+
+	m_State = State::IDLE;
+
+	if (m_pShowFile != nullptr) {
+		struct Header header;
+		memcpy(header.aMagic, MAGIC, sizeof(MAGIC));
+		header.nVersion = VERSION;
+		header.nReserved = 0;
+		header.nKeyframeIntervalMillis = KEYFRAME_INTERVAL_MILLIS;
+		header.nIndexOffset = 0;
+		header.nIndexEntries = 0;
+
+		if (fwrite(&header, sizeof(struct Header), 1, m_pShowFile) == 1) {
+			m_nFileOffset = sizeof(struct Header);
+			m_nIndexEntries = 0;
+			m_nKeyframeInterval = KEYFRAME_INTERVAL_MILLIS;
+			m_nUniverses = 0;
+			m_State = State::RECORD_FIRST;
+		}
+#ifndef NDEBUG
+		else {
+			perror("fwrite");
+		}
+#endif
+	}
+
+	ShowFileProtocol::Record();
+
+	DEBUG_EXIT
+}
+
+void ShowFileFormat::WriteRecord(const Type type, const uint32_t nValue, const uint8_t *pPayload, const uint32_t nLength) {
+	assert(nLength <= PAYLOAD_MAX);
+
+	struct Record record;
+	record.nType = static_cast<uint8_t>(type);
+	record.nReserved = 0;
+	record.nLength = static_cast<uint16_t>(nLength);
+	record.nValue = nValue;
+
+	memcpy(m_Buffer, &record, sizeof(struct Record));
+
+	if ((nLength != 0) && (pPayload != &m_Buffer[sizeof(struct Record)])) {
+		memcpy(&m_Buffer[sizeof(struct Record)], pPayload, nLength);
+	}
+
+	const auto nSize = static_cast<uint32_t>(sizeof(struct Record)) + nLength;
+
+	if (fwrite(m_Buffer, nSize, 1, m_pShowFile) == 1) {
+		m_nFileOffset += nSize;
+	}
+#ifndef NDEBUG
+	else {
+		perror("fwrite");
+	}
+#endif
+}
+
+void ShowFileFormat::WriteKeyframe(const uint32_t nMillis) {
+	if (m_nIndexEntries == INDEX_ENTRIES) {
+		for (uint32_t i = 0; i < (INDEX_ENTRIES / 2); i++) {
+			m_Index[i] = m_Index[i * 2];
+		}
+
+		m_nIndexEntries = INDEX_ENTRIES / 2;
+		m_nKeyframeInterval *= 2;
+	}
+
+	m_Index[m_nIndexEntries].nMillis = nMillis;
+	m_Index[m_nIndexEntries].nOffset = m_nFileOffset;
+	m_nIndexEntries++;
+
+	m_nKeyframeMillis = nMillis;
+
+	WriteRecord(Type::KEYFRAME, nMillis, nullptr, 0);
+
+	for (uint32_t i = 0; i < m_nUniverses; i++) {
+		const auto& universe = m_Universe[i];
+		WriteRecord(Type::KEY, universe_value(universe.nUniverse, universe.nSlots), universe.data, universe.nSlots);
+	}
+}
+
+void ShowFileFormat::WriteIndex() {
+	DEBUG_ENTRY
+
+	if (m_State == State::RECORD_FIRST) {
+		WriteKeyframe(0);
+	}
+
+	const auto nIndexOffset = m_nFileOffset;
+	const auto nLength = m_nIndexEntries * static_cast<uint32_t>(sizeof(struct IndexEntry));
+
+	struct Record record;
+	record.nType = static_cast<uint8_t>(Type::INDEX);
+	record.nReserved = 0;
+	record.nLength = static_cast<uint16_t>(nLength);
+	record.nValue = m_nIndexEntries;
+
+	if ((fwrite(&record, sizeof(struct Record), 1, m_pShowFile) != 1) || (fwrite(m_Index, nLength, 1, m_pShowFile) != 1)) {
+#ifndef NDEBUG
+		perror("fwrite");
+#endif
+		DEBUG_EXIT
+		return;
+	}
+
+	struct Header header;
+	memcpy(header.aMagic, MAGIC, sizeof(MAGIC));
+	header.nVersion = VERSION;
+	header.nReserved = 0;
+	header.nKeyframeIntervalMillis = static_cast<uint16_t>(m_nKeyframeInterval > UINT16_MAX ? UINT16_MAX : m_nKeyframeInterval);
+	header.nIndexOffset = nIndexOffset;
+	header.nIndexEntries = m_nIndexEntries;
+
+	fseek(m_pShowFile, 0L, SEEK_SET);
+	fwrite(&header, sizeof(struct Header), 1, m_pShowFile);
+	fseek(m_pShowFile, 0L, SEEK_END);
+
+	DEBUG_PRINTF("nIndexOffset=%u, m_nIndexEntries=%u", nIndexOffset, m_nIndexEntries);
+	DEBUG_EXIT
+}
+
+void ShowFileFormat::ShowfileLost(const uint32_t nLost) {
+	if (m_State == State::RECORDING) {
+		WriteRecord(Type::LOST, nLost, nullptr, 0);
+	}
+}
+
+void ShowFileFormat::ShowfileWrite(const uint8_t *pDmxData, const uint32_t nSize, const uint32_t nUniverse, const uint32_t nMillis) {
+	if ((m_State != State::RECORD_FIRST) && (m_State != State::RECORDING)) {
+		return;
+	}
+
+	const auto nSlots = nSize > SLOTS_MAX ? SLOTS_MAX : nSize;
+	auto *pUniverse = GetUniverse(static_cast<uint16_t>(nUniverse), true);
+
+	if (m_State == State::RECORD_FIRST) {
+		m_State = State::RECORDING;
+		m_nStartMillis = nMillis;
+		m_nFrameMillis = 0;
+		m_bFramePending = false;
+
+		if (pUniverse != nullptr) {
+			memcpy(pUniverse->data, pDmxData, nSlots);
+			pUniverse->nSlots = static_cast<uint16_t>(nSlots);
+		}
+
+		WriteKeyframe(0);
+
+		if (pUniverse == nullptr) {
+			WriteRecord(Type::KEY, universe_value(nUniverse, nSlots), pDmxData, nSlots);
+		}
+
+		return;
+	}
+
+	const auto nFrameMillis = nMillis - m_nStartMillis;
+
+	if (nFrameMillis != m_nFrameMillis) {
+		m_nFrameMillis = nFrameMillis;
+
+		if ((nFrameMillis - m_nKeyframeMillis) >= m_nKeyframeInterval) {
+			m_bFramePending = false;
+
+			if (pUniverse != nullptr) {
+				memcpy(pUniverse->data, pDmxData, nSlots);
+				pUniverse->nSlots = static_cast<uint16_t>(nSlots);
+			}
+
+			WriteKeyframe(nFrameMillis);
+
+			if (pUniverse == nullptr) {
+				WriteRecord(Type::KEY, universe_value(nUniverse, nSlots), pDmxData, nSlots);
+			}
+
+			return;
+		}
+
+		/*
+		 * The FRAME record is written with the first changed universe.
+		 */
+		m_bFramePending = true;
+	}
+
+	auto type = Type::KEY;
+	const uint8_t *pPayload = pDmxData;
+	auto nLength = nSlots;
+
+	if ((pUniverse != nullptr) && (pUniverse->nSlots == nSlots)) {
+		const auto nDeltaLength = delta_encode(pUniverse->data, pDmxData, nSlots, &m_Buffer[sizeof(struct Record)]);
+
+		if (nDeltaLength == 0) {
+			return;
+		}
+
+		if (nDeltaLength <= PAYLOAD_MAX) {
+			type = Type::DELTA;
+			pPayload = &m_Buffer[sizeof(struct Record)];
+			nLength = nDeltaLength;
+		}
+	}
+
+	if (m_bFramePending) {
+		m_bFramePending = false;
+
+		struct Record record;
+		record.nType = static_cast<uint8_t>(Type::FRAME);
+		record.nReserved = 0;
+		record.nLength = 0;
+		record.nValue = nFrameMillis;
+
+		if (fwrite(&record, sizeof(struct Record), 1, m_pShowFile) == 1) {
+			m_nFileOffset += static_cast<uint32_t>(sizeof(struct Record));
+		}
+	}
+
+	WriteRecord(type, universe_value(nUniverse, nSlots), pPayload, nLength);
+
+	if (pUniverse != nullptr) {
+		memcpy(pUniverse->data, pDmxData, nSlots);
+		pUniverse->nSlots = static_cast<uint16_t>(nSlots);
+	}
+}
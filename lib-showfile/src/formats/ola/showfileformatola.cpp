@@ -31,41 +31,57 @@
 #include "formats/showfileformatola.h"
 #include "showfile.h"
 
-#include "hardware.h"
-
 #include "debug.h"
 
 ShowFileFormat *ShowFileFormat::s_pThis;
 
 void ShowFileFormat::Run() {
-	if (m_OlaState != OlaState::TIME_WAITING) {
+	if (ShowFilePlayback::IsStaged()) {
+		if (!ShowFilePlayback::IsDue()) {
+			return;
+		}
+
+		ShowFilePlayback::Release();
+	}
+
+	/*
+	 * Prefetch the next frame, all the universes until a delay.
+	 * The number of lines in one Run is limited, the prefetch continues in the next Run.
+	 */
+	for (uint32_t nLines = 0; nLines < showfile::ola::PREFETCH_LINES; nLines++) {
 		m_OlaParseCode = GetNextLine();
 
 		if (m_OlaParseCode == OlaParseCode::DMX) {
 			if (m_nDmxDataLength != 0) {
-				ShowFileProtocol::DmxOut(m_nUniverse, m_DmxData, m_nDmxDataLength);
+				ShowFilePlayback::Stage(m_nUniverse, m_DmxData, m_nDmxDataLength);
 			}
 		} else if (m_OlaParseCode == OlaParseCode::TIME) {
 			if (m_nDelayMillis != 0) {
-				if (m_nDmxDataLength != 0) {
-					ShowFileProtocol::DmxSync();
-				}
+				ShowFilePlayback::SetDeadline(m_nFrameMillis);
+				m_nFrameMillis += m_nDelayMillis;
+				return;
 			}
-			m_OlaState = OlaState::TIME_WAITING;
 		} else if (m_OlaParseCode == OlaParseCode::EOFILE) {
+			/*
+			 * First wait for the delay after the last frame
+			 */
+			if (!m_bEndOfShow) {
+				m_bEndOfShow = true;
+				ShowFilePlayback::SetDeadline(m_nFrameMillis);
+				return;
+			}
+
 			if (m_bDoLoop) {
 				fseek(m_pShowFile, 0L, SEEK_SET);
+				m_nFrameMillis = 0;
+				m_bEndOfShow = false;
+				ShowFilePlayback::PlaybackStart(0);
 			} else {
 				ShowFile::Get()->SetStatus(showfile::Status::ENDED);
 			}
-		}
-	}
 
-	const auto nMillis = Hardware::Get()->Millis();
-
-	if ((nMillis - m_nLastMillis) >= m_nDelayMillis) {
-		m_nLastMillis = nMillis;
-		m_OlaState = OlaState::PARSING_DMX;
+			return;
+		}
 	}
 }
 
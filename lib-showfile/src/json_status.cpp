@@ -62,6 +62,13 @@ static void staticCallbackFunction([[maybe_unused]] void *p, const char *s) {
 		return;
 	}
 
+	uint16_t nValue16;
+
+	if (Sscan::Uint16(s, "speed", nValue16) == Sscan::OK) {
+		ShowFile::Get()->SetSpeed(nValue16);
+		return;
+	}
+
 	char action[8];
 	uint32_t nLength = sizeof(action) - 1;
 
@@ -98,14 +105,30 @@ uint32_t json_get_status(char *pOutBuffer, const uint32_t nOutBufferSize) {
 	const auto status = ShowFile::Get()->GetStatus();
 	assert(status != ::showfile::Status::UNDEFINED);
 
-	const auto nLength = static_cast<uint32_t>(snprintf(pOutBuffer, nOutBufferSize,
-						"{\"mode\":\"%s\",\"%s\":\"%u\",\"status\":\"%s\",\"%s\":\"%s\"}",
+	const auto& timing = ShowFile::Get()->GetTimingStatistics();
+
+	auto nLength = static_cast<uint32_t>(snprintf(pOutBuffer, nOutBufferSize,
+						"{\"mode\":\"%s\",\"%s\":\"%u\",\"status\":\"%s\",\"%s\":\"%s\",\"speed\":\"%u\","
+						"\"timing\":{\"count\":%u,\"mean\":%u,\"max\":%u,\"buckets\":[",
 						ShowFile::Get()->GetMode() == ::showfile::Mode::RECORDER ? "Recorder" : "Player",
 						ShowFileParamsConst::SHOW,
 						static_cast<unsigned int>(ShowFile::Get()->GetShowFileCurrent()),
 						::showfile::STATUS[static_cast<int>(status)],
 						ShowFileParamsConst::OPTION_LOOP,
-						ShowFile::Get()->GetDoLoop() ? "1" : "0"));
+						ShowFile::Get()->GetDoLoop() ? "1" : "0",
+						static_cast<unsigned int>(ShowFile::Get()->GetSpeed()),
+						static_cast<unsigned int>(timing.nCount),
+						static_cast<unsigned int>(timing.GetMean()),
+						static_cast<unsigned int>(timing.nMax)));
+
+	for (uint32_t i = 0; (i < ::showfile::playback::BUCKETS) && (nLength < nOutBufferSize); i++) {
+		nLength += static_cast<uint32_t>(snprintf(&pOutBuffer[nLength], nOutBufferSize - nLength, "%s%u", i == 0 ? "" : ",", static_cast<unsigned int>(timing.nBucket[i])));
+	}
+
+	if (nLength < nOutBufferSize) {
+		nLength += static_cast<uint32_t>(snprintf(&pOutBuffer[nLength], nOutBufferSize - nLength, "]}}"));
+	}
+
 	return nLength;
 }
 
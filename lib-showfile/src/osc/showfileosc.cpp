@@ -45,6 +45,7 @@ namespace cmd {
 	static constexpr char RESUME[] = "resume";
 	static constexpr char SHOW[] = "show";
 	static constexpr char LOOP[] = "loop";
+	static constexpr char SPEED[] = "speed";
 	static constexpr char BO[] = "blackout";
 #if defined (CONFIG_SHOWFILE_ENABLE_MASTER)
 	static constexpr char MASTER[] = "master";
@@ -62,6 +63,7 @@ namespace length {
 	static constexpr uint32_t RESUME = sizeof(cmd::RESUME) - 1;
 	static constexpr uint32_t SHOW = sizeof(cmd::SHOW) - 1;
 	static constexpr uint32_t LOOP = sizeof(cmd::LOOP) - 1;
+	static constexpr uint32_t SPEED = sizeof(cmd::SPEED) - 1;
 	static constexpr uint32_t BO = sizeof(cmd::BO) - 1;
 #if defined (CONFIG_SHOWFILE_ENABLE_MASTER)
 	static constexpr uint32_t MASTER = sizeof(cmd::MASTER) - 1;
@@ -149,6 +151,27 @@ void ShowFileOSC::Process() {
 		return;
 	}
 
+	if (memcmp(&m_pBuffer[length::PATH], cmd::SPEED, length::SPEED) == 0) {
+		OscSimpleMessage Msg(m_pBuffer, m_nBytesReceived);
+
+		int nValue;
+
+		if (Msg.GetType(0) == osc::type::INT32) {
+			nValue = Msg.GetInt(0);
+		} else if (Msg.GetType(0) == osc::type::FLOAT) { // TouchOSC
+			nValue = static_cast<int>(Msg.GetFloat(0));
+		} else {
+			return;
+		}
+
+		if (nValue > 0) {
+			ShowFile::Get()->SetSpeed(static_cast<uint32_t>(nValue));
+		}
+
+		DEBUG_PRINTF("Speed %d", nValue);
+		return;
+	}
+
 	if (memcmp(&m_pBuffer[length::PATH], cmd::BO, length::BO) == 0) {
 		ShowFile::Get()->BlackOut();
 		SendStatus();
@@ -303,6 +303,29 @@ void ShowFile::EnableTFTP([[maybe_unused]] bool bEnableTFTP) {
 	DEBUG_EXIT
 }
 
+#if !defined (CONFIG_SHOWFILE_DISABLE_RECORD)
+void ShowFile::RecordDrain(const uint32_t nEntries) {
+	for (uint32_t i = 0; i < nEntries; i++) {
+		const auto *pEntry = m_RingBuffer.Front();
+
+		if (pEntry == nullptr) {
+			break;
+		}
+
+		if (pEntry->nLost != 0) {
+			ShowFileFormat::ShowfileLost(pEntry->nLost);
+		}
+
+		ShowFileFormat::ShowfileWrite(m_RingBuffer.GetData(pEntry), pEntry->nLength, pEntry->nUniverse, pEntry->nMillis);
+		m_RingBuffer.Pop();
+	}
+
+	if ((nEntries == UINT32_MAX) && (m_RingBuffer.GetLost() != 0)) {
+		ShowFileFormat::ShowfileLost(m_RingBuffer.GetLost());
+	}
+}
+#endif
+
 void ShowFile::SetStatus(const showfile::Status Status) {
 	DEBUG_ENTRY
 
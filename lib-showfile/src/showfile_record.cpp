@@ -29,7 +29,7 @@
 #endif
 
 #include <cstdint>
-#include "formats/showfileformatola.h"
+#include "showfile.h"
 
 #if defined (CONFIG_SHOWFILE_PROTOCOL_NODE_ARTNET)
 #include "artnet.h"
@@ -37,7 +37,7 @@
 namespace showfile {
 void record(const struct artnet::ArtDmx *pArtDmx, const uint32_t nMillis) {
 	const auto nDmxSlots = static_cast<uint32_t>(((pArtDmx->LengthHi << 8) & 0xff00) | pArtDmx->Length);
-	ShowFileFormat::Get()->ShowfileWrite(pArtDmx->Data, nDmxSlots, pArtDmx->PortAddress, nMillis);
+	ShowFile::Get()->RecordPush(pArtDmx->Data, nDmxSlots, pArtDmx->PortAddress, nMillis);
 }
 
 void record([[maybe_unused]] const struct artnet::ArtSync *pArtSync, [[maybe_unused]] const uint32_t nMillis) {
@@ -54,7 +54,7 @@ void record(const struct TE131DataPacket *pE131DataPacket, const uint32_t nMilli
 	const auto *const pDmxData = &pE131DataPacket->DMPLayer.PropertyValues[1];
 	const auto nLength = __builtin_bswap16(pE131DataPacket->DMPLayer.PropertyValueCount) - 1U;
 	const auto Universe = __builtin_bswap16(pE131DataPacket->FrameLayer.Universe);
-	ShowFileFormat::Get()->ShowfileWrite(pDmxData, nLength, Universe, nMillis);
+	ShowFile::Get()->RecordPush(pDmxData, nLength, Universe, nMillis);
 }
 
 void record([[maybe_unused]] const struct TE131SynchronizationPacket *pE131SynchronizationPacke, [[maybe_unused]] const uint32_t nMillis) {
@@ -0,0 +1,123 @@
+/**
+ * @file showfileplayback.cpp
+ *
+ */
+/* Copyright (C) 2024 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#if !defined(__clang__)
+# pragma GCC push_options
+# pragma GCC optimize ("O2")
+#endif
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+#include "showfileplayback.h"
+
+#include "hardware.h"
+
+#include "debug.h"
+
+using namespace showfile::playback;
+
+void ShowFilePlayback::PlaybackStart(const uint32_t nMillis) {
+	DEBUG_ENTRY
+	DEBUG_PRINTF("nMillis=%u", nMillis);
+
+	m_nPosition = static_cast<uint64_t>(nMillis) * 1000U * SPEED_DEFAULT;
+	m_nDeadline = 0;
+	m_nMicrosPrevious = Hardware::Get()->Micros();
+	m_nStaged = 0;
+	m_bStaged = false;
+	m_bRunning = true;
+	m_TimingStatistics.Reset();
+
+	DEBUG_EXIT
+}
+
+void ShowFilePlayback::Tick() {
+	const auto nMicros = Hardware::Get()->Micros();
+	const auto nElapsed = nMicros - m_nMicrosPrevious;
+
+	m_nMicrosPrevious = nMicros;
+
+	if (m_bRunning) {
+		m_nPosition += static_cast<uint64_t>(nElapsed) * m_nSpeed;
+	}
+}
+
+void ShowFilePlayback::Stage(const uint16_t nUniverse, const uint8_t *pDmxData, const uint32_t nLength) {
+	const auto nSlots = nLength > SLOTS_MAX ? SLOTS_MAX : nLength;
+	uint32_t i;
+
+	for (i = 0; i < m_nStaged; i++) {
+		if (m_Staging[i].nUniverse == nUniverse) {
+			break;
+		}
+	}
+
+	if (i == MAX_UNIVERSES) {
+		ShowFileProtocol::DmxOut(nUniverse, pDmxData, nSlots);
+		return;
+	}
+
+	if (i == m_nStaged) {
+		m_nStaged++;
+	}
+
+	auto& universe = m_Staging[i];
+	universe.nUniverse = nUniverse;
+	universe.nLength = static_cast<uint16_t>(nSlots);
+	memcpy(universe.data, pDmxData, nSlots);
+}
+
+void ShowFilePlayback::Release() {
+	m_bStaged = false;
+
+	if (m_nStaged == 0) {
+		return;
+	}
+
+	/*
+	 * The deadline has passed, m_nPosition >= m_nDeadline
+	 */
+	const auto nError = (m_nPosition - m_nDeadline) / m_nSpeed;
+	m_TimingStatistics.Add(nError > UINT32_MAX ? UINT32_MAX : static_cast<uint32_t>(nError));
+
+	for (uint32_t i = 0; i < m_nStaged; i++) {
+		const auto& universe = m_Staging[i];
+		ShowFileProtocol::DmxOut(universe.nUniverse, universe.data, universe.nLength);
+	}
+
+	m_nStaged = 0;
+
+	ShowFileProtocol::DmxSync();
+}
+
+void ShowFilePlayback::PlaybackPrint() {
+	printf(" Speed: %u%%\n", static_cast<unsigned int>(m_nSpeed));
+
+	if (m_TimingStatistics.nCount != 0) {
+		printf(" Timing error: mean %uus, max %uus\n", static_cast<unsigned int>(m_TimingStatistics.GetMean()), static_cast<unsigned int>(m_TimingStatistics.nMax));
+	}
+}
@@ -0,0 +1,421 @@
+/**
+ * @file showfile_recorder.cpp
+ *
+ * Host test: the show file recorder writing through a slow file backend.
+ * fopen is replaced by an in-memory file, each write advances the simulated clock
+ * with the backend latency, its throughput and a periodic stall (SD card erase).
+ * The recorded OLA show file is parsed back and compared frame by frame,
+ * frames lost must be accounted for exactly.
+ */
+/* Copyright (C) 2024 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <string>
+#include <sys/types.h>
+
+#include "showfile.h"
+#include "artnet.h"
+#include "hardware.h"
+
+namespace showfile {
+void record(const struct artnet::ArtDmx *pArtDmx, const uint32_t nMillis);
+
+void display_filename([[maybe_unused]] const char *pFileName, [[maybe_unused]] const uint32_t nShow) {}
+void display_status() {}
+}  // namespace showfile
+
+static int s_nFailed;
+
+static void check(const bool bCondition, const char *pText) {
+	printf("%s: %s\n", bCondition ? "ok" : "FAIL", pText);
+	if (!bCondition) {
+		s_nFailed++;
+	}
+}
+
+/*
+ * Slow file backend
+ */
+
+struct Backend {
+	uint32_t nLatencyMicros;	///< Each write
+	uint32_t nBytesPerSecond;
+	uint32_t nStallBytes;		///< A stall after each nStallBytes written, 0 is none
+	uint32_t nStallMicros;
+};
+
+static Backend s_Backend;
+static std::map<std::string, std::string> s_Files;
+static uint64_t s_nWritten;
+static uint32_t s_nWriteMaxMicros;
+
+struct Cookie {
+	std::string *pFile;
+	size_t nPosition;
+};
+
+static ssize_t file_read(void *pCookie, char *pBuffer, size_t nSize) {
+	auto *pFile = reinterpret_cast<Cookie *>(pCookie);
+	const auto nLength = std::min(nSize, pFile->pFile->size() - std::min(pFile->nPosition, pFile->pFile->size()));
+	memcpy(pBuffer, pFile->pFile->data() + pFile->nPosition, nLength);
+	pFile->nPosition += nLength;
+	return static_cast<ssize_t>(nLength);
+}
+
+static ssize_t file_write(void *pCookie, const char *pBuffer, size_t nSize) {
+	auto *pFile = reinterpret_cast<Cookie *>(pCookie);
+
+	if (pFile->pFile->size() < pFile->nPosition + nSize) {
+		pFile->pFile->resize(pFile->nPosition + nSize);
+	}
+
+	memcpy(pFile->pFile->data() + pFile->nPosition, pBuffer, nSize);
+	pFile->nPosition += nSize;
+
+	auto nMicros = s_Backend.nLatencyMicros + static_cast<uint32_t>((static_cast<uint64_t>(nSize) * 1000000U) / s_Backend.nBytesPerSecond);
+
+	if ((s_Backend.nStallBytes != 0) && (((s_nWritten + nSize) / s_Backend.nStallBytes) != (s_nWritten / s_Backend.nStallBytes))) {
+		nMicros += s_Backend.nStallMicros;
+	}
+
+	s_nWritten += nSize;
+	s_nWriteMaxMicros = std::max(s_nWriteMaxMicros, nMicros);
+	Hardware::Get()->Advance(nMicros);
+
+	return static_cast<ssize_t>(nSize);
+}
+
+static int file_seek(void *pCookie, off64_t *pOffset, int nWhence) {
+	auto *pFile = reinterpret_cast<Cookie *>(pCookie);
+	off64_t nPosition = *pOffset;
+
+	if (nWhence == SEEK_CUR) {
+		nPosition += static_cast<off64_t>(pFile->nPosition);
+	} else if (nWhence == SEEK_END) {
+		nPosition += static_cast<off64_t>(pFile->pFile->size());
+	}
+
+	if (nPosition < 0) {
+		return -1;
+	}
+
+	pFile->nPosition = static_cast<size_t>(nPosition);
+	*pOffset = nPosition;
+	return 0;
+}
+
+static int file_close(void *pCookie) {
+	delete reinterpret_cast<Cookie *>(pCookie);
+	return 0;
+}
+
+/**
+ * Replaces the libc fopen, the show file lives in memory.
+ * Unbuffered, each fputs is one write to the backend.
+ */
+extern "C" FILE *fopen(const char *pFileName, const char *pMode) {
+	auto& file = s_Files[pFileName];
+
+	if (pMode[0] == 'w') {
+		file.clear();
+	}
+
+	auto *pFile = fopencookie(new Cookie { &file, 0 }, pMode, cookie_io_functions_t { file_read, file_write, file_seek, file_close });
+
+	if (pFile != nullptr) {
+		setvbuf(pFile, nullptr, _IONBF, 0);
+	}
+
+	return pFile;
+}
+
+/*
+ * Art-Net producer, 40 frames a second for each universe
+ */
+
+static constexpr uint32_t FRAME_MILLIS = 25;
+static constexpr uint32_t SLOTS = 512;
+static constexpr uint32_t LOOP_MICROS = 100;	///< The rest of the main loop
+
+static uint8_t get_slot(const uint32_t nPacket, const uint32_t nSlot) {
+	if (nSlot < 4) {
+		return static_cast<uint8_t>(nPacket >> (8 * nSlot));
+	}
+	return static_cast<uint8_t>((nPacket * 7U) + nSlot);
+}
+
+struct Show {
+	uint32_t nUniverses;
+	uint32_t nFirstUniverse;
+	uint32_t nSeconds;
+};
+
+static uint32_t get_universe(const Show& show, const uint32_t nPacket) {
+	return show.nFirstUniverse + (nPacket % show.nUniverses);
+}
+
+static uint32_t get_millis(const Show& show, const uint32_t nPacket) {
+	return (nPacket / show.nUniverses) * FRAME_MILLIS;
+}
+
+static void push(const Show& show, const uint32_t nPacket) {
+	artnet::ArtDmx artDmx;
+	memset(&artDmx, 0, sizeof(artDmx));
+
+	artDmx.PortAddress = static_cast<uint16_t>(get_universe(show, nPacket));
+	artDmx.LengthHi = static_cast<uint8_t>(SLOTS >> 8);
+	artDmx.Length = static_cast<uint8_t>(SLOTS & 0xFF);
+
+	for (uint32_t i = 0; i < SLOTS; i++) {
+		artDmx.Data[i] = get_slot(nPacket, i);
+	}
+
+	showfile::record(&artDmx, get_millis(show, nPacket));
+}
+
+struct Result {
+	uint32_t nPushed;
+	uint32_t nRecorded;
+	uint32_t nLost;		///< From the "# N frames lost" lines
+	uint32_t nRunMaxMicros;
+	bool bValid;
+};
+
+/**
+ * "OLA Show", then for each frame "universe v,...,v", with the delay in milliseconds before all but the first frame
+ */
+static bool parse(const Show& show, const std::string& file, Result& result) {
+	size_t nPosition = 0;
+	bool bFirstLine = true;
+	bool bDelay = false;
+	uint32_t nDelay = 0;
+	uint32_t nPending = 0;
+	int64_t nPrevious = -1;
+
+	while (nPosition < file.size()) {
+		const auto nEnd = file.find('\n', nPosition);
+
+		if (nEnd == std::string::npos) {
+			printf("no linefeed at %zu\n", nPosition);
+			return false;
+		}
+
+		const auto line = file.substr(nPosition, nEnd - nPosition);
+		nPosition = nEnd + 1;
+
+		if (bFirstLine) {
+			bFirstLine = false;
+			if (line != "OLA Show") {
+				printf("header [%s]\n", line.c_str());
+				return false;
+			}
+			continue;
+		}
+
+		unsigned int nLost;
+
+		if (sscanf(line.c_str(), "# %u frames lost", &nLost) == 1) {
+			nPending += nLost;
+			result.nLost += nLost;
+			continue;
+		}
+
+		if (line.find(' ') == std::string::npos) {
+			nDelay = static_cast<uint32_t>(std::stoul(line));
+			bDelay = true;
+			continue;
+		}
+
+		const auto nPacket = static_cast<uint32_t>(nPrevious + 1 + nPending);
+
+		if (bDelay != (nPrevious >= 0)) {
+			printf("packet %u: delay line\n", nPacket);
+			return false;
+		}
+
+		if (bDelay && (nDelay != (get_millis(show, nPacket) - get_millis(show, static_cast<uint32_t>(nPrevious))))) {
+			printf("packet %u: delay %u\n", nPacket, nDelay);
+			return false;
+		}
+
+		char *pEnd;
+		const auto nUniverse = strtoul(line.c_str(), &pEnd, 10);
+
+		if (nUniverse != get_universe(show, nPacket)) {
+			printf("packet %u: universe %lu\n", nPacket, nUniverse);
+			return false;
+		}
+
+		for (uint32_t i = 0; i < SLOTS; i++) {
+			const auto nValue = strtoul(pEnd + 1, &pEnd, 10);
+			if (nValue != get_slot(nPacket, i)) {
+				printf("packet %u: slot %u is %lu\n", nPacket, i, nValue);
+				return false;
+			}
+		}
+
+		if (*pEnd != '\0') {
+			printf("packet %u: trailing [%s]\n", nPacket, pEnd);
+			return false;
+		}
+
+		nPrevious = nPacket;
+		nPending = 0;
+		bDelay = false;
+		result.nRecorded++;
+	}
+
+	const auto nEnd = static_cast<uint32_t>(nPrevious + 1 + nPending);
+
+	if (nEnd != result.nPushed) {
+		printf("%u frames accounted for, %u pushed\n", nEnd, result.nPushed);
+		return false;
+	}
+
+	return true;
+}
+
+static Result record(ShowFile& showFile, const uint32_t nShowFile, const Show& show, const Backend& backend) {
+	auto *pHardware = Hardware::Get();
+
+	s_Backend = backend;
+	s_nWritten = 0;
+	s_nWriteMaxMicros = 0;
+
+	showFile.SetRecorderShowFileCurrent(nShowFile);
+	showFile.Record();
+
+	Result result {};
+
+	const auto nStartMillis = pHardware->Millis();
+	const auto nPackets = (show.nSeconds * 1000U / FRAME_MILLIS) * show.nUniverses;
+
+	while (result.nPushed < nPackets) {
+		while ((result.nPushed < nPackets) && (nStartMillis + get_millis(show, result.nPushed) <= pHardware->Millis())) {
+			push(show, result.nPushed++);
+		}
+
+		const auto nMicros = pHardware->Micros();
+		showFile.Run();
+		result.nRunMaxMicros = std::max(result.nRunMaxMicros, pHardware->Micros() - nMicros);
+
+		pHardware->Advance(LOOP_MICROS);
+	}
+
+	showFile.Stop();
+
+	char aFileName[showfile::FILE_NAME_LENGTH + 1U];
+	showfile::filename_copyto(aFileName, sizeof(aFileName), nShowFile);
+
+	result.bValid = parse(show, s_Files[aFileName], result);
+
+	return result;
+}
+
+static void print(const char *pText, const Result& result, const showfile::recorder::Statistics& statistics) {
+	printf("%s: %u pushed, %u recorded, %u lost, %u overflows, high water %u/%u, Run max %u us, write max %u us\n", pText,
+			result.nPushed, result.nRecorded, statistics.nLost, statistics.nOverflows,
+			statistics.nHighWater, showfile::recorder::BUFFER_SIZE, result.nRunMaxMicros, s_nWriteMaxMicros);
+}
+
+int main() {
+	ShowFile showFile;
+
+	showFile.SetRecorderShowFileCurrent(0);
+	check(showFile.GetMode() == showfile::Mode::RECORDER, "recorder mode");
+
+	/*
+	 * SD card: 4 MB/s, a 60 ms erase stall each 128 KB. The ring buffer absorbs the stalls.
+	 */
+	{
+		const Show show { 4, 1, 20 };
+		const auto result = record(showFile, 1, show, Backend { 200, 4000000, 128 * 1024, 60000 });
+		const auto& statistics = showFile.GetRecorderStatistics();
+
+		print("sd card", result, statistics);
+		check(result.bValid, "sd card: show file matches");
+		check(statistics.nLost == 0, "sd card: no frames lost");
+		check(result.nRecorded == result.nPushed, "sd card: all frames recorded");
+		check(statistics.nHighWater > (4 * (sizeof(struct showfile::recorder::Entry) + SLOTS)), "sd card: the stalls are buffered");
+		check(result.nRunMaxMicros < 60000 + (showfile::recorder::DRAIN_ENTRIES * 2 * 1000), "sd card: Run is bounded by the drain entries");
+	}
+
+	/*
+	 * Too slow for 8 universes: frames are lost, each lost frame is accounted for in the show file
+	 */
+	{
+		const Show show { 8, 100, 10 };
+		const auto result = record(showFile, 2, show, Backend { 1000, 200000, 0, 0 });
+		const auto& statistics = showFile.GetRecorderStatistics();
+
+		print("slow", result, statistics);
+		check(result.bValid, "slow: show file matches");
+		check(statistics.nLost != 0, "slow: frames lost");
+		check(statistics.nOverflows != 0, "slow: overflows");
+		check(result.nLost == statistics.nLost, "slow: lost frames in the show file");
+		check(result.nRecorded + statistics.nLost == result.nPushed, "slow: recorded and lost");
+		check(statistics.nHighWater <= showfile::recorder::BUFFER_SIZE, "slow: high water");
+	}
+
+	/*
+	 * The widest line: a 5 digit universe and 512 slots of 255, then a 5 digit delay
+	 */
+	{
+		showFile.SetRecorderShowFileCurrent(3);
+		showFile.Record();
+
+		uint8_t data[SLOTS];
+		memset(data, 0xFF, sizeof(data));
+		showFile.RecordPush(data, SLOTS, 32767, 0);
+
+		for (uint32_t i = 0; i < SLOTS; i++) {
+			data[i] = static_cast<uint8_t>(i);
+		}
+		showFile.RecordPush(data, SLOTS, 32767, 25);
+		showFile.RecordPush(data, 1, 1, 25 + 12345);
+
+		showFile.Stop();
+
+		std::string expected("OLA Show\n32767 255");
+		for (uint32_t i = 1; i < SLOTS; i++) {
+			expected += ",255";
+		}
+		expected += "\n25\n32767 0";
+		for (uint32_t i = 1; i < SLOTS; i++) {
+			expected += "," + std::to_string(i & 0xFF);
+		}
+		expected += "\n12345\n1 0\n";
+
+		check(s_Files["show03.txt"] == expected, "widest line and 5 digits");
+	}
+
+	if (s_nFailed != 0) {
+		printf("%d failed\n", s_nFailed);
+		return 1;
+	}
+
+	puts("ok");
+	return 0;
+}
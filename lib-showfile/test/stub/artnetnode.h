@@ -0,0 +1,39 @@
+/**
+ * @file artnetnode.h
+ *
+ * Host stub
+ */
+
+#ifndef ARTNETNODE_H_
+#define ARTNETNODE_H_
+
+#include <cstdint>
+
+#include "artnet.h"
+
+namespace artnetnode {
+static constexpr uint32_t MAX_PORTS = 4;
+}  // namespace artnetnode
+
+class ArtNetNode {
+public:
+	void HandleShowFile([[maybe_unused]] const artnet::ArtDmx *pArtDmx) {}
+
+	void SetRecordShowfile(const bool doRecord) {
+		m_doRecordShowfile = doRecord;
+	}
+
+	bool GetRecordShowfile() const {
+		return m_doRecordShowfile;
+	}
+
+	static ArtNetNode *Get() {
+		static ArtNetNode s_ArtNetNode;
+		return &s_ArtNetNode;
+	}
+
+private:
+	bool m_doRecordShowfile { false };
+};
+
+#endif /* ARTNETNODE_H_ */
@@ -0,0 +1,51 @@
+/**
+ * @file hardware.h
+ *
+ * Host stub
+ */
+
+#ifndef HARDWARE_H_
+#define HARDWARE_H_
+
+#include <cstdint>
+
+namespace hardware {
+namespace ledblink {
+enum class Mode {
+	OFF_OFF, OFF_ON, NORMAL, DATA, FAST, REBOOT, UNKNOWN
+};
+}  // namespace ledblink
+}  // namespace hardware
+
+/**
+ * Simulated clock, advanced by the test
+ */
+class Hardware {
+public:
+	uint32_t Micros() const {
+		return m_nMicros;
+	}
+
+	uint32_t Millis() const {
+		return m_nMicros / 1000U;
+	}
+
+	void Advance(const uint32_t nMicros) {
+		m_nMicros += nMicros;
+	}
+
+	void SetMode(const hardware::ledblink::Mode mode) {
+		m_Mode = mode;
+	}
+
+	static Hardware *Get() {
+		static Hardware s_Hardware;
+		return &s_Hardware;
+	}
+
+private:
+	uint32_t m_nMicros { 0 };
+	hardware::ledblink::Mode m_Mode { hardware::ledblink::Mode::NORMAL };
+};
+
+#endif /* HARDWARE_H_ */
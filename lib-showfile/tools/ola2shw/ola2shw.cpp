@@ -0,0 +1,415 @@
+/**
+ * @file ola2shw.cpp
+ *
+ * Converts an OLA show file into a binary show file.
+ * With -b, both files are parsed and the parse cost per frame and the file sizes are printed.
+ */
+/* Copyright (C) 2024 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <cctype>
+#include <chrono>
+#include <vector>
+
+#include "formats/showfilebinary.h"
+
+using namespace showfile::binary;
+
+namespace ola {
+enum class Code {
+	DMX, TIME, EOFILE, FAILED
+};
+
+struct Parser {
+	FILE *pFile;
+	char buffer[2048];
+	uint8_t data[SLOTS_MAX];
+	uint32_t nLength;
+	uint32_t nUniverse;
+	uint32_t nDelayMillis;
+
+	/*
+	 * Same as ShowFileFormat::ParseDmxData and ShowFileFormat::ParseLine in formats/ola
+	 */
+	Code ParseDmxData(const char *p) {
+		int32_t k = 0;
+		nLength = 0;
+
+		while (isdigit(*p)) {
+			k = k * 10 + *p - '0';
+
+			if (k > 255) {
+				return Code::FAILED;
+			}
+
+			p++;
+
+			if (*p == ',' || !isdigit(*p)) {
+				if (nLength >= SLOTS_MAX) {
+					return Code::FAILED;
+				}
+
+				data[nLength++] = static_cast<uint8_t>(k);
+				k = 0;
+				p++;
+			}
+		}
+
+		return Code::DMX;
+	}
+
+	Code Next() {
+		if (fgets(buffer, sizeof(buffer) - 1, pFile) != buffer) {
+			return Code::EOFILE;
+		}
+
+		if (!isdigit(buffer[0])) {
+			return Code::FAILED;
+		}
+
+		const char *p = buffer;
+		int32_t k = 0;
+
+		while (isdigit(*p)) {
+			k = k * 10 + *p - '0';
+			p++;
+		}
+
+		if (k > 0xFFFF) {
+			return Code::FAILED;
+		}
+
+		if (*p++ == ' ') {
+			nUniverse = static_cast<uint32_t>(k);
+			return ParseDmxData(p);
+		}
+
+		nDelayMillis = static_cast<uint32_t>(k);
+		return Code::TIME;
+	}
+};
+}  // namespace ola
+
+namespace binary {
+struct Universe {
+	uint32_t nUniverse;
+	uint32_t nSlots;
+	uint8_t data[SLOTS_MAX];
+};
+
+/*
+ * Same encoding as ShowFileFormat::ShowfileWrite in formats/binary
+ */
+struct Writer {
+	FILE *pFile;
+	uint32_t nOffset;
+	uint32_t nFrameMillis;
+	uint32_t nKeyframeMillis;
+	bool bFirst;
+	bool bFramePending;
+	std::vector<Universe> universes;
+	std::vector<IndexEntry> index;
+	uint8_t payload[PAYLOAD_MAX];
+
+	void Record(const Type type, const uint32_t nValue, const uint8_t *pPayload, const uint32_t nLength) {
+		struct showfile::binary::Record record = { static_cast<uint8_t>(type), 0, static_cast<uint16_t>(nLength), nValue };
+		fwrite(&record, sizeof(record), 1, pFile);
+		if (nLength != 0) {
+			fwrite(pPayload, nLength, 1, pFile);
+		}
+		nOffset += static_cast<uint32_t>(sizeof(record)) + nLength;
+	}
+
+	void Keyframe(const uint32_t nMillis) {
+		index.push_back({ nMillis, nOffset });
+		nKeyframeMillis = nMillis;
+		Record(Type::KEYFRAME, nMillis, nullptr, 0);
+		for (const auto& u : universes) {
+			Record(Type::KEY, universe_value(u.nUniverse, u.nSlots), u.data, u.nSlots);
+		}
+	}
+
+	Universe *Find(const uint32_t nUniverse) {
+		for (auto& u : universes) {
+			if (u.nUniverse == nUniverse) {
+				return &u;
+			}
+		}
+		universes.push_back({ nUniverse, 0, {} });
+		return &universes.back();
+	}
+
+	void Write(const uint8_t *pData, const uint32_t nSlots, const uint32_t nUniverse, const uint32_t nMillis) {
+		auto *pUniverse = Find(nUniverse);
+
+		if (bFirst || ((nMillis != nFrameMillis) && ((nMillis - nKeyframeMillis) >= KEYFRAME_INTERVAL_MILLIS))) {
+			bFirst = false;
+			bFramePending = false;
+			nFrameMillis = nMillis;
+			memcpy(pUniverse->data, pData, nSlots);
+			pUniverse->nSlots = nSlots;
+			Keyframe(nMillis);
+			return;
+		}
+
+		if (nMillis != nFrameMillis) {
+			nFrameMillis = nMillis;
+			bFramePending = true;
+		}
+
+		auto type = Type::KEY;
+		const uint8_t *pPayload = pData;
+		auto nLength = nSlots;
+
+		if (pUniverse->nSlots == nSlots) {
+			const auto nDeltaLength = delta_encode(pUniverse->data, pData, nSlots, payload);
+			if (nDeltaLength == 0) {
+				return;
+			}
+			if (nDeltaLength <= PAYLOAD_MAX) {
+				type = Type::DELTA;
+				pPayload = payload;
+				nLength = nDeltaLength;
+			}
+		}
+
+		if (bFramePending) {
+			bFramePending = false;
+			Record(Type::FRAME, nFrameMillis, nullptr, 0);
+		}
+
+		Record(type, universe_value(nUniverse, nSlots), pPayload, nLength);
+		memcpy(pUniverse->data, pData, nSlots);
+		pUniverse->nSlots = nSlots;
+	}
+
+	void Close() {
+		const auto nIndexOffset = nOffset;
+		Record(Type::INDEX, static_cast<uint32_t>(index.size()), reinterpret_cast<const uint8_t *>(index.data()), static_cast<uint32_t>(index.size() * sizeof(IndexEntry)));
+
+		struct Header header;
+		memcpy(header.aMagic, MAGIC, sizeof(MAGIC));
+		header.nVersion = VERSION;
+		header.nReserved = 0;
+		header.nKeyframeIntervalMillis = KEYFRAME_INTERVAL_MILLIS;
+		header.nIndexOffset = nIndexOffset;
+		header.nIndexEntries = static_cast<uint32_t>(index.size());
+
+		fseek(pFile, 0L, SEEK_SET);
+		fwrite(&header, sizeof(header), 1, pFile);
+	}
+};
+
+/*
+ * Same decoding as ShowFileFormat::Run in formats/binary
+ */
+static uint32_t parse(FILE *pFile, uint32_t& nChecksum) {
+	struct Header header;
+	struct showfile::binary::Record record;
+	static uint8_t buffer[PAYLOAD_MAX];
+	std::vector<Universe> universes;
+	uint32_t nFrames = 0;
+
+	fseek(pFile, 0L, SEEK_SET);
+
+	if ((fread(&header, sizeof(header), 1, pFile) != 1) || (memcmp(header.aMagic, MAGIC, sizeof(MAGIC)) != 0)) {
+		return 0;
+	}
+
+	while (fread(&record, sizeof(record), 1, pFile) == 1) {
+		if ((record.nType == static_cast<uint8_t>(Type::INDEX)) || (record.nType > static_cast<uint8_t>(Type::LOST)) || (record.nLength > PAYLOAD_MAX)) {
+			break;
+		}
+
+		if ((record.nLength != 0) && (fread(buffer, record.nLength, 1, pFile) != 1)) {
+			break;
+		}
+
+		const auto type = static_cast<Type>(record.nType);
+
+		if ((type == Type::FRAME) || (type == Type::KEYFRAME)) {
+			nFrames++;
+			continue;
+		}
+
+		if (type == Type::LOST) {
+			continue;
+		}
+
+		const auto nUniverse = universe(record.nValue);
+		const auto nSlots = slots(record.nValue);
+		Universe *pUniverse = nullptr;
+
+		for (auto& u : universes) {
+			if (u.nUniverse == nUniverse) {
+				pUniverse = &u;
+			}
+		}
+
+		if (pUniverse == nullptr) {
+			universes.push_back({ nUniverse, 0, {} });
+			pUniverse = &universes.back();
+		}
+
+		if (type == Type::KEY) {
+			memcpy(pUniverse->data, buffer, nSlots);
+			pUniverse->nSlots = nSlots;
+		} else if (!delta_decode(buffer, record.nLength, pUniverse->data, nSlots)) {
+			break;
+		}
+
+		nChecksum += pUniverse->data[0] + pUniverse->data[nSlots - 1];
+	}
+
+	return nFrames;
+}
+}  // namespace binary
+
+static uint32_t convert(FILE *pIn, FILE *pOut) {
+	ola::Parser parser = {};
+	parser.pFile = pIn;
+
+	binary::Writer writer = {};
+	writer.pFile = pOut;
+	writer.bFirst = true;
+
+	struct Header header = {};
+	fwrite(&header, sizeof(header), 1, pOut);
+	writer.nOffset = sizeof(header);
+
+	uint32_t nMillis = 0;
+	uint32_t nFrames = 0;
+
+	fgets(parser.buffer, sizeof(parser.buffer) - 1, pIn);	// "OLA Show"
+
+	for (;;) {
+		const auto code = parser.Next();
+
+		if (code == ola::Code::DMX) {
+			writer.Write(parser.data, parser.nLength, parser.nUniverse, nMillis);
+		} else if (code == ola::Code::TIME) {
+			nMillis += parser.nDelayMillis;
+			nFrames++;
+		} else if (code == ola::Code::EOFILE) {
+			break;
+		}
+	}
+
+	writer.Close();
+
+	return nFrames;
+}
+
+static uint32_t parse_ola(FILE *pFile, uint32_t& nChecksum) {
+	ola::Parser parser = {};
+	parser.pFile = pFile;
+	uint32_t nFrames = 0;
+
+	fseek(pFile, 0L, SEEK_SET);
+	fgets(parser.buffer, sizeof(parser.buffer) - 1, pFile);
+
+	for (;;) {
+		const auto code = parser.Next();
+
+		if (code == ola::Code::DMX) {
+			if (parser.nLength != 0) {
+				nChecksum += parser.data[0] + parser.data[parser.nLength - 1];
+			}
+		} else if (code == ola::Code::TIME) {
+			nFrames++;
+		} else if (code == ola::Code::EOFILE) {
+			break;
+		}
+	}
+
+	return nFrames;
+}
+
+template<typename F>
+static void benchmark(const char *pName, FILE *pFile, const uint32_t nFrames, F f) {
+	constexpr auto RUNS = 10;
+	uint32_t nChecksum = 0;
+	uint32_t nParsed = 0;
+
+	const auto start = std::chrono::steady_clock::now();
+
+	for (auto i = 0; i < RUNS; i++) {
+		nParsed = f(pFile, nChecksum);
+	}
+
+	const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+	fseek(pFile, 0L, SEEK_END);
+	const auto nSize = ftell(pFile);
+
+	/*
+	 * Unchanged frames are not written in the binary file, the cost is per frame in the OLA file.
+	 */
+	printf("%-6s %10ld bytes %8u records %10.1f ns/frame (checksum %u)\n", pName, nSize, nParsed,
+			nFrames == 0 ? 0.0 : static_cast<double>(ns) / (static_cast<double>(nFrames) * RUNS), nChecksum / RUNS);
+}
+
+int main(int argc, char **argv) {
+	auto bBenchmark = false;
+	auto nArg = 1;
+
+	if ((argc > 1) && (strcmp(argv[1], "-b") == 0)) {
+		bBenchmark = true;
+		nArg++;
+	}
+
+	if ((argc - nArg) != 2) {
+		fprintf(stderr, "Usage: %s [-b] show.txt show.shw\n", argv[0]);
+		return 1;
+	}
+
+	auto *pIn = fopen(argv[nArg], "rb");
+
+	if (pIn == nullptr) {
+		perror(argv[nArg]);
+		return 1;
+	}
+
+	auto *pOut = fopen(argv[nArg + 1], "w+b");
+
+	if (pOut == nullptr) {
+		perror(argv[nArg + 1]);
+		fclose(pIn);
+		return 1;
+	}
+
+	const auto nFrames = convert(pIn, pOut);
+	printf("%u frames converted\n", nFrames);
+
+	if (bBenchmark) {
+		fflush(pOut);
+		benchmark("ola", pIn, nFrames, parse_ola);
+		benchmark("binary", pOut, nFrames, binary::parse);
+	}
+
+	fclose(pOut);
+	fclose(pIn);
+
+	return 0;
+}